@@ -70,6 +70,7 @@
 #include <ags/widget/ags_dial.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_plugin_browser.h>
 #include <ags/X/ags_bulk_member.h>
 
@@ -765,6 +766,8 @@ ags_effect_bulk_finalize(GObject *gobject)
   while(list != NULL){
     g_hash_table_remove(ags_effect_bulk_indicator_queue_draw,
 			list->data);
+    ags_refresh_scheduler_remove(ags_refresh_scheduler_get_instance(),
+				 (GtkWidget *) list->data);
 
     list = list->next;
   }
@@ -1281,7 +1284,9 @@ ags_effect_bulk_add_ladspa_effect(AgsEffectBulk *effect_bulk,
 			    child_widget, ags_effect_bulk_indicator_queue_draw_timeout);
 	effect_bulk->queued_drawing = g_list_prepend(effect_bulk->queued_drawing,
 						     child_widget);
-	g_timeout_add(1000 / 30, (GSourceFunc) ags_effect_bulk_indicator_queue_draw_timeout, (gpointer) child_widget);
+	ags_refresh_scheduler_add(ags_refresh_scheduler_get_instance(),
+				  (GtkWidget *) child_widget,
+				  (GSourceFunc) ags_effect_bulk_indicator_queue_draw_timeout);
       }
 
 #ifdef AGS_DEBUG
@@ -1756,7 +1761,9 @@ ags_effect_bulk_add_dssi_effect(AgsEffectBulk *effect_bulk,
 			    child_widget, ags_effect_bulk_indicator_queue_draw_timeout);
 	effect_bulk->queued_drawing = g_list_prepend(effect_bulk->queued_drawing,
 						     child_widget);
-	g_timeout_add(1000 / 30, (GSourceFunc) ags_effect_bulk_indicator_queue_draw_timeout, (gpointer) child_widget);
+	ags_refresh_scheduler_add(ags_refresh_scheduler_get_instance(),
+				  (GtkWidget *) child_widget,
+				  (GSourceFunc) ags_effect_bulk_indicator_queue_draw_timeout);
       }
 
       gtk_table_attach(effect_bulk->table,
@@ -2200,7 +2207,9 @@ ags_effect_bulk_add_lv2_effect(AgsEffectBulk *effect_bulk,
 			    child_widget, ags_effect_bulk_indicator_queue_draw_timeout);
 	effect_bulk->queued_drawing = g_list_prepend(effect_bulk->queued_drawing,
 						     child_widget);
-	g_timeout_add(1000 / 30, (GSourceFunc) ags_effect_bulk_indicator_queue_draw_timeout, (gpointer) child_widget);
+	ags_refresh_scheduler_add(ags_refresh_scheduler_get_instance(),
+				  (GtkWidget *) child_widget,
+				  (GSourceFunc) ags_effect_bulk_indicator_queue_draw_timeout);
       }
 
 #ifdef AGS_DEBUG
@@ -2441,6 +2450,8 @@ ags_effect_bulk_real_remove_effect(AgsEffectBulk *effect_bulk,
 	   AGS_IS_INDICATOR(child_widget)){
 	  g_hash_table_remove(ags_effect_bulk_indicator_queue_draw,
 			      child_widget);
+	  ags_refresh_scheduler_remove(ags_refresh_scheduler_get_instance(),
+				       (GtkWidget *) child_widget);
 	}
 
 	gtk_widget_destroy(list->data);
@@ -2884,25 +2895,20 @@ ags_effect_bulk_find_port(AgsEffectBulk *effect_bulk)
 
 /**
  * ags_effect_bulk_indicator_queue_draw_timeout:
- * @widget: the indicator widgt
+ * @refresh_entry: the #AgsRefreshEntry of the indicator
  *
- * Queue draw widget
+ * Queue draw widget. Called by #AgsRefreshScheduler.
  *
  * Returns: %TRUE if proceed with redraw, otherwise %FALSE
  *
  * Since: 0.7.128
  */
 gboolean
-ags_effect_bulk_indicator_queue_draw_timeout(GtkWidget *widget)
+ags_effect_bulk_indicator_queue_draw_timeout(AgsRefreshEntry *refresh_entry)
 {
-  if(g_hash_table_lookup(ags_effect_bulk_indicator_queue_draw,
-			 widget) != NULL){
-    gtk_widget_queue_draw(widget);
+  gtk_widget_queue_draw(refresh_entry->widget);
     
-    return(TRUE);
-  }else{
-    return(FALSE);
-  }
+  return(TRUE);
 }
 
 /**
@@ -26,6 +26,8 @@
 
 #include <ags/audio/ags_audio.h>
 
+#include <ags/X/ags_refresh_scheduler.h>
+
 #define AGS_TYPE_EFFECT_BULK                (ags_effect_bulk_get_type())
 #define AGS_EFFECT_BULK(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_EFFECT_BULK, AgsEffectBulk))
 #define AGS_EFFECT_BULK_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST((class), AGS_TYPE_EFFECT_BULK, AgsEffectBulkClass))
@@ -133,7 +135,7 @@ void ags_effect_bulk_resize_pads(AgsEffectBulk *effect_bulk,
 void ags_effect_bulk_map_recall(AgsEffectBulk *effect_bulk);
 GList* ags_effect_bulk_find_port(AgsEffectBulk *effect_bulk);
 
-gboolean ags_effect_bulk_indicator_queue_draw_timeout(GtkWidget *widget);
+gboolean ags_effect_bulk_indicator_queue_draw_timeout(AgsRefreshEntry *refresh_entry);
 
 AgsEffectBulk* ags_effect_bulk_new(AgsAudio *audio,
 				   GType channel_type);
@@ -53,6 +53,7 @@
 #include <ags/widget/ags_dial.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_machine.h>
 #include <ags/X/ags_effect_pad.h>
 #include <ags/X/ags_line_member.h>
@@ -573,6 +574,8 @@ ags_effect_line_finalize(GObject *gobject)
   while(list != NULL){
     g_hash_table_remove(ags_effect_line_indicator_queue_draw,
 			list->data);
+    ags_refresh_scheduler_remove(ags_refresh_scheduler_get_instance(),
+				 (GtkWidget *) list->data);
 
     list = list->next;
   }
@@ -892,7 +895,9 @@ ags_effect_line_add_ladspa_effect(AgsEffectLine *effect_line,
 			    child_widget, ags_effect_line_indicator_queue_draw_timeout);
 	effect_line->queued_drawing = g_list_prepend(effect_line->queued_drawing,
 						     child_widget);
-	g_timeout_add(1000 / 30, (GSourceFunc) ags_effect_line_indicator_queue_draw_timeout, (gpointer) child_widget);
+	ags_refresh_scheduler_add(ags_refresh_scheduler_get_instance(),
+				  (GtkWidget *) child_widget,
+				  (GSourceFunc) ags_effect_line_indicator_queue_draw_timeout);
       }
 
 #ifdef AGS_DEBUG
@@ -1214,7 +1219,9 @@ ags_effect_line_add_lv2_effect(AgsEffectLine *effect_line,
 			    child_widget, ags_effect_line_indicator_queue_draw_timeout);
 	effect_line->queued_drawing = g_list_prepend(effect_line->queued_drawing,
 						     child_widget);
-	g_timeout_add(1000 / 30, (GSourceFunc) ags_effect_line_indicator_queue_draw_timeout, (gpointer) child_widget);
+	ags_refresh_scheduler_add(ags_refresh_scheduler_get_instance(),
+				  (GtkWidget *) child_widget,
+				  (GSourceFunc) ags_effect_line_indicator_queue_draw_timeout);
       }
 
 #ifdef AGS_DEBUG
@@ -1472,6 +1479,8 @@ ags_effect_line_real_remove_effect(AgsEffectLine *effect_line,
 	   AGS_IS_INDICATOR(child_widget)){
 	  g_hash_table_remove(ags_effect_line_indicator_queue_draw,
 			      child_widget);
+	  ags_refresh_scheduler_remove(ags_refresh_scheduler_get_instance(),
+				       (GtkWidget *) child_widget);
 	}
 
 	gtk_widget_destroy(control->data);
@@ -1629,25 +1638,20 @@ ags_effect_line_find_port(AgsEffectLine *effect_line)
 
 /**
  * ags_effect_line_indicator_queue_draw_timeout:
- * @widget: the indicator widgt
+ * @refresh_entry: the #AgsRefreshEntry of the indicator
  *
- * Queue draw widget
+ * Queue draw widget. Called by #AgsRefreshScheduler.
  *
  * Returns: %TRUE if proceed with redraw, otherwise %FALSE
  *
  * Since: 0.7.128
  */
 gboolean
-ags_effect_line_indicator_queue_draw_timeout(GtkWidget *widget)
+ags_effect_line_indicator_queue_draw_timeout(AgsRefreshEntry *refresh_entry)
 {
-  if(g_hash_table_lookup(ags_effect_line_indicator_queue_draw,
-			 widget) != NULL){
-    gtk_widget_queue_draw(widget);
+  gtk_widget_queue_draw(refresh_entry->widget);
     
-    return(TRUE);
-  }else{
-    return(FALSE);
-  }
+  return(TRUE);
 }
 
 /**
@@ -26,6 +26,8 @@
 
 #include <ags/audio/ags_channel.h>
 
+#include <ags/X/ags_refresh_scheduler.h>
+
 #define AGS_TYPE_EFFECT_LINE                (ags_effect_line_get_type())
 #define AGS_EFFECT_LINE(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_EFFECT_LINE, AgsEffectLine))
 #define AGS_EFFECT_LINE_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST((class), AGS_TYPE_EFFECT_LINE, AgsEffectLineClass))
@@ -102,7 +104,7 @@ void ags_effect_line_map_recall(AgsEffectLine *effect_line,
 				guint output_pad_start);
 GList* ags_effect_line_find_port(AgsEffectLine *effect_line);
 
-gboolean ags_effect_line_indicator_queue_draw_timeout(GtkWidget *widget);
+gboolean ags_effect_line_indicator_queue_draw_timeout(AgsRefreshEntry *refresh_entry);
 
 AgsEffectLine* ags_effect_line_new(AgsChannel *channel);
 
@@ -55,6 +55,7 @@
 #include <ags/widget/ags_dial.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_machine.h>
 #include <ags/X/ags_pad.h>
 #include <ags/X/ags_line_member.h>
@@ -449,6 +450,8 @@ ags_line_finalize(GObject *gobject)
   if(line->indicator != NULL){
     g_hash_table_remove(ags_line_indicator_queue_draw,
 			line->indicator);
+    ags_refresh_scheduler_remove(ags_refresh_scheduler_get_instance(),
+				 (GtkWidget *) line->indicator);
   }
 
   /* remove of the queued drawing hash */
@@ -457,6 +460,8 @@ ags_line_finalize(GObject *gobject)
   while(list != NULL){
     g_hash_table_remove(ags_line_indicator_queue_draw,
 			list->data);
+    ags_refresh_scheduler_remove(ags_refresh_scheduler_get_instance(),
+				 (GtkWidget *) list->data);
 
     list = list->next;
   }
@@ -973,7 +978,9 @@ ags_line_add_ladspa_effect(AgsLine *line,
 			    child_widget, ags_line_indicator_queue_draw_timeout);
 	line->queued_drawing = g_list_prepend(line->queued_drawing,
 					      child_widget);
-	g_timeout_add(1000 / 30, (GSourceFunc) ags_line_indicator_queue_draw_timeout, (gpointer) child_widget);
+	ags_refresh_scheduler_add(ags_refresh_scheduler_get_instance(),
+				  (GtkWidget *) child_widget,
+				  (GSourceFunc) ags_line_indicator_queue_draw_timeout);
       }
       
 #ifdef AGS_DEBUG
@@ -1201,7 +1208,9 @@ ags_line_add_lv2_effect(AgsLine *line,
 			    child_widget, ags_line_indicator_queue_draw_timeout);
 	line->queued_drawing = g_list_prepend(line->queued_drawing,
 					      child_widget);
-	g_timeout_add(1000 / 30, (GSourceFunc) ags_line_indicator_queue_draw_timeout, (gpointer) child_widget);
+	ags_refresh_scheduler_add(ags_refresh_scheduler_get_instance(),
+				  (GtkWidget *) child_widget,
+				  (GSourceFunc) ags_line_indicator_queue_draw_timeout);
       }
 
 #ifdef AGS_DEBUG
@@ -1458,6 +1467,8 @@ ags_line_real_remove_effect(AgsLine *line,
 	   AGS_IS_INDICATOR(child_widget)){
 	  g_hash_table_remove(ags_line_indicator_queue_draw,
 			      child_widget);
+	  ags_refresh_scheduler_remove(ags_refresh_scheduler_get_instance(),
+				       (GtkWidget *) child_widget);
 	}
 	
 	ags_expander_remove(line->expander,
@@ -1633,173 +1644,127 @@ ags_line_find_next_grouped(GList *line)
 
 /**
  * ags_line_indicator_queue_draw_timeout:
- * @widget: the indicator widgt
+ * @refresh_entry: the #AgsRefreshEntry of the indicator
  *
- * Queue draw widget
+ * Update the value of the indicator from the meter slots of its
+ * #AgsLineMember or the ports resolved in @refresh_entry and queue draw it.
+ * Called by #AgsRefreshScheduler.
  *
  * Returns: %TRUE if proceed with redraw, otherwise %FALSE
  *
  * Since: 0.7.8
  */
 gboolean
-ags_line_indicator_queue_draw_timeout(GtkWidget *widget)
+ags_line_indicator_queue_draw_timeout(AgsRefreshEntry *refresh_entry)
 {
-  AgsLine *line;
-
-  if(g_hash_table_lookup(ags_line_indicator_queue_draw,
-			 widget) != NULL){      
-    GList *list, *list_start;
-    
-    line = gtk_widget_get_ancestor(widget,
-				   AGS_TYPE_LINE);
-  
-    list_start = 
-      list = gtk_container_get_children((GtkContainer *) AGS_LINE(line)->expander->table);
-    
-    /* check members */
-    while(list != NULL){
-      if(AGS_IS_LINE_MEMBER(list->data) &&
-	 (AGS_LINE_MEMBER(list->data)->widget_type == AGS_TYPE_VINDICATOR ||
-	  AGS_LINE_MEMBER(list->data)->widget_type == AGS_TYPE_HINDICATOR ||
-	  AGS_LINE_MEMBER(list->data)->widget_type == AGS_TYPE_LED)){
-	AgsLineMember *line_member;
-	GtkAdjustment *adjustment;
-	GtkWidget *child;
-
-	AgsPort *current;
+  AgsLineMember *line_member;
+  GtkWidget *widget;
+  GtkAdjustment *adjustment;
 	
-	gdouble average_peak;
-	gdouble lower, upper;
-	gdouble range;
-	gdouble peak;
+  gdouble average_peak;
+  gdouble peak;
 
-	GValue value = {0,};
+  GValue value = {0,};
 
-	line_member = AGS_LINE_MEMBER(list->data);
-	child = GTK_BIN(line_member)->child;
-      
-	average_peak = 0.0;
-      
-	/* play port */
-	current = line_member->port;
+  widget = refresh_entry->widget;
+  line_member = (AgsLineMember *) refresh_entry->line_member;
 
-	if(current == NULL){
-	  list = list->next;
-	
-	  continue;
-	}
-	
-	/* check if output port and specifier matches */
-	pthread_mutex_lock(current->mutex);
+  if(line_member == NULL){
+    return(TRUE);
+  }
+    
+  average_peak = 0.0;
       
-	if((AGS_PORT_IS_OUTPUT & (current->flags)) == 0 ||
-	   current->port_descriptor == NULL ||
-	   g_ascii_strcasecmp(current->specifier,
-			      line_member->specifier)){
-	  pthread_mutex_unlock(current->mutex);
-	
-	  list = list->next;
-	
-	  continue;
-	}
+  /* meter slot - read without locking */
+  if(line_member->meter_slot != NULL ||
+     line_member->recall_meter_slot != NULL){
+    gfloat slot_peak;
 
-	/* lower and upper */
-	lower = g_value_get_float(AGS_PORT_DESCRIPTOR(current->port_descriptor)->lower_value);
-	upper = g_value_get_float(AGS_PORT_DESCRIPTOR(current->port_descriptor)->upper_value);
-      
-	pthread_mutex_unlock(current->mutex);
+    if(line_member->meter_slot != NULL){
+      ags_meter_slot_read(line_member->meter_slot,
+			  &slot_peak, NULL, NULL);
 
-	/* get range */
-	if(line_member->conversion != NULL){
-	  lower = ags_conversion_convert(line_member->conversion,
-					 lower,
-					 TRUE);
+      average_peak += (10.0 * slot_peak);
+    }
 
-	  upper = ags_conversion_convert(line_member->conversion,
-					 upper,
-					 TRUE);
-	}
-      
-	range = upper - lower;
+    if(line_member->recall_meter_slot != NULL){
+      ags_meter_slot_read(line_member->recall_meter_slot,
+			  &slot_peak, NULL, NULL);
+
+      average_peak += (10.0 * slot_peak);
+    }
+  }else{
+    if(refresh_entry->port == NULL){
+      return(TRUE);
+    }
       
-	/* play port - read value */
-	g_value_init(&value, G_TYPE_FLOAT);
-	ags_port_safe_read(current,
-			   &value);
+    /* play port - read value */
+    g_value_init(&value, G_TYPE_FLOAT);
+    ags_port_safe_read(refresh_entry->port,
+		       &value);
       
-	peak = g_value_get_float(&value);
-	g_value_unset(&value);
+    peak = g_value_get_float(&value);
+    g_value_unset(&value);
 
-	if(line_member->conversion != NULL){
-	  peak = ags_conversion_convert(line_member->conversion,
-					peak,
-					TRUE);
-	}
+    if(refresh_entry->conversion != NULL){
+      peak = ags_conversion_convert(refresh_entry->conversion,
+				    peak,
+				    TRUE);
+    }
       
-	/* calculate peak */
-	if(range == 0.0 ||
-	   current->port_value_type == G_TYPE_BOOLEAN){
-	  if(peak != 0.0){
-	    average_peak = 10.0;
-	  }
-	}else{
-	  average_peak += ((1.0 / (range / peak)) * 10.0);
-	}
-
-	/* recall port */
-	current = line_member->recall_port;
+    /* calculate peak */
+    if((AGS_REFRESH_ENTRY_PORT_TOGGLED & (refresh_entry->flags)) != 0){
+      if(peak != 0.0){
+	average_peak = 10.0;
+      }
+    }else{
+      average_peak += ((1.0 / (refresh_entry->range / peak)) * 10.0);
+    }
 
-	/* recall port - read value */
-	g_value_init(&value, G_TYPE_FLOAT);
-	ags_port_safe_read(current,
-			   &value);
+    /* recall port - read value */
+    if(refresh_entry->recall_port != NULL){
+      g_value_init(&value, G_TYPE_FLOAT);
+      ags_port_safe_read(refresh_entry->recall_port,
+			 &value);
       
-	peak = g_value_get_float(&value);
-	g_value_unset(&value);
+      peak = g_value_get_float(&value);
+      g_value_unset(&value);
 
-	if(line_member->conversion != NULL){
-	  peak = ags_conversion_convert(line_member->conversion,
-					peak,
-					TRUE);
-	}
+      if(refresh_entry->conversion != NULL){
+	peak = ags_conversion_convert(refresh_entry->conversion,
+				      peak,
+				      TRUE);
+      }
 
-	/* calculate peak */
-	if(range == 0.0 ||
-	   current->port_value_type == G_TYPE_BOOLEAN){
-	  if(peak != 0.0){
-	    average_peak = 10.0;
-	  }
-	}else{
-	  average_peak += ((1.0 / (range / peak)) * 10.0);
-	}
-      
-	/* apply */
-	if(AGS_IS_LED(child)){
-	  if(average_peak != 0.0){
-	    ags_led_set_active(child);
-	  }
-	}else{
-	  g_object_get(child,
-		       "adjustment\0", &adjustment,
-		       NULL);
-	
-	  gtk_adjustment_set_value(adjustment,
-				   average_peak);
+      /* calculate peak */
+      if((AGS_REFRESH_ENTRY_RECALL_PORT_TOGGLED & (refresh_entry->flags)) != 0){
+	if(peak != 0.0){
+	  average_peak = 10.0;
 	}
+      }else{
+	average_peak += ((1.0 / (refresh_entry->range / peak)) * 10.0);
       }
-    
-      list = list->next;
     }
-
-    g_list_free(list_start);
-
-    /* queue draw */
-    gtk_widget_queue_draw(widget);
-    
-    return(TRUE);
+  }
+      
+  /* apply */
+  if(AGS_IS_LED(widget)){
+    if(average_peak != 0.0){
+      ags_led_set_active(widget);
+    }
   }else{
-    return(FALSE);
+    g_object_get(widget,
+		 "adjustment\0", &adjustment,
+		 NULL);
+	
+    gtk_adjustment_set_value(adjustment,
+			     average_peak);
   }
+
+  /* queue draw */
+  gtk_widget_queue_draw(widget);
+    
+  return(TRUE);
 }
 
 /**
@@ -28,6 +28,8 @@
 
 #include <ags/widget/ags_expander.h>
 
+#include <ags/X/ags_refresh_scheduler.h>
+
 #define AGS_TYPE_LINE                (ags_line_get_type())
 #define AGS_LINE(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_LINE, AgsLine))
 #define AGS_LINE_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST((class), AGS_TYPE_LINE, AgsLineClass))
@@ -118,7 +120,7 @@ GList* ags_line_find_port(AgsLine *line);
 
 GList* ags_line_find_next_grouped(GList *line);
 
-gboolean ags_line_indicator_queue_draw_timeout(GtkWidget *widget);
+gboolean ags_line_indicator_queue_draw_timeout(AgsRefreshEntry *refresh_entry);
 
 AgsLine* ags_line_new(GtkWidget *pad, AgsChannel *channel);
 
@@ -30,6 +30,8 @@
 
 #include <ags/audio/ags_channel.h>
 
+#include <ags/audio/recall/ags_peak_channel.h>
+
 #include <ags/audio/thread/ags_audio_loop.h>
 
 #include <ags/widget/ags_led.h>
@@ -37,6 +39,7 @@
 #include <ags/widget/ags_dial.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_machine.h>
 #include <ags/X/ags_pad.h>
 #include <ags/X/ags_line.h>
@@ -451,6 +454,9 @@ ags_line_member_init(AgsLineMember *line_member)
   line_member->recall_port_data = NULL;
   line_member->recall_active = FALSE;
 
+  line_member->meter_slot = NULL;
+  line_member->recall_meter_slot = NULL;
+
   line_member->task_type = G_TYPE_NONE;
 }
 
@@ -709,6 +715,10 @@ ags_line_member_set_property(GObject *gobject,
       }
 
       line_member->port = port;
+
+      /* the indicator reads the ports resolved by the refresh scheduler */
+      ags_refresh_scheduler_resolve(ags_refresh_scheduler_get_instance(),
+				    gtk_bin_get_child(GTK_BIN(line_member)));
     }
     break;
   case PROP_PORT_DATA:
@@ -743,6 +753,10 @@ ags_line_member_set_property(GObject *gobject,
       }
 
       line_member->recall_port = port;
+
+      /* the indicator reads the ports resolved by the refresh scheduler */
+      ags_refresh_scheduler_resolve(ags_refresh_scheduler_get_instance(),
+				    gtk_bin_get_child(GTK_BIN(line_member)));
     }
     break;
   case PROP_RECALL_PORT_DATA:
@@ -950,6 +964,14 @@ ags_line_member_disconnect(AgsConnectable *connectable)
 void
 ags_line_member_finalize(GObject *gobject)
 {
+  AgsLineMember *line_member;
+
+  line_member = AGS_LINE_MEMBER(gobject);
+
+  /* meter slot */
+  ags_meter_slot_unref(line_member->meter_slot);
+  ags_meter_slot_unref(line_member->recall_meter_slot);
+
   /* call parent */
   G_OBJECT_CLASS(ags_line_member_parent_class)->finalize(gobject);  
 }
@@ -1299,6 +1321,8 @@ ags_line_member_real_find_port(AgsLineMember *line_member)
   gchar *specifier;
 
   auto AgsPort* ags_line_member_find_specifier(GList *recall);
+  auto AgsMeterSlot* ags_line_member_find_meter_slot(GList *recall,
+						    AgsPort *port);
 
   AgsPort* ags_line_member_find_specifier(GList *recall){
     GList *port;
@@ -1331,6 +1355,24 @@ ags_line_member_real_find_port(AgsLineMember *line_member)
     return(NULL);
   }
 
+  AgsMeterSlot* ags_line_member_find_meter_slot(GList *recall,
+						AgsPort *port){
+    if(port == NULL){
+      return(NULL);
+    }
+    
+    while(recall != NULL){
+      if(AGS_IS_PEAK_CHANNEL(recall->data) &&
+	 AGS_PEAK_CHANNEL(recall->data)->peak == port){
+	return(ags_meter_slot_ref(AGS_PEAK_CHANNEL(recall->data)->meter_slot));
+      }
+
+      recall = recall->next;
+    }
+
+    return(NULL);
+  }
+
   if(line_member == NULL){
     return(NULL);
   }
@@ -1376,6 +1418,15 @@ ags_line_member_real_find_port(AgsLineMember *line_member)
   recall = channel->recall;
   recall_channel_port = ags_line_member_find_specifier(recall);
 
+  /* meter slot - polled by indicators without locking */
+  ags_meter_slot_unref(line_member->meter_slot);
+  line_member->meter_slot = ags_line_member_find_meter_slot(channel->play,
+							    channel_port);
+
+  ags_meter_slot_unref(line_member->recall_meter_slot);
+  line_member->recall_meter_slot = ags_line_member_find_meter_slot(channel->recall,
+								   recall_channel_port);
+
   if(channel_port != NULL){
     port = g_list_prepend(port,
 			  channel_port);
@@ -30,6 +30,7 @@
 
 #include <ags/audio/ags_recall.h>
 #include <ags/audio/ags_port.h>
+#include <ags/audio/ags_meter_util.h>
 
 #define AGS_TYPE_LINE_MEMBER                (ags_line_member_get_type())
 #define AGS_LINE_MEMBER(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_LINE_MEMBER, AgsLineMember))
@@ -92,6 +93,9 @@ struct _AgsLineMember
   gpointer recall_port_data;
   gboolean recall_active;
 
+  AgsMeterSlot *meter_slot;
+  AgsMeterSlot *recall_meter_slot;
+
   GType task_type;
 };
 
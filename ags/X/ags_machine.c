@@ -51,6 +51,7 @@
 #include <ags/audio/task/ags_open_file.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_pad.h>
 #include <ags/X/ags_effect_bridge.h>
 
@@ -1657,6 +1658,10 @@ ags_machine_set_run_extended(AgsMachine *machine,
 
       /* start soundcard */
       start_soundcard = ags_start_soundcard_new(window->application_context);
+
+      /* refresh indicators while playing */
+      ags_refresh_scheduler_start(ags_refresh_scheduler_get_instance());
+
       list = g_list_prepend(list, start_soundcard);
 
       /* task completion */
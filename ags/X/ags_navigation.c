@@ -33,6 +33,7 @@
 #include <ags/audio/task/ags_seek_soundcard.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_editor.h>
 
 #include <ags/X/editor/ags_note_edit.h>
@@ -269,7 +270,9 @@ ags_navigation_init(AgsNavigation *navigation)
 	       "label\0", "0000:00.000\0",
 	       NULL);
   gtk_box_pack_start((GtkBox *) hbox, (GtkWidget *) navigation->duration_time, FALSE, FALSE, 2);
-  g_timeout_add(1000 / 30, (GSourceFunc) ags_navigation_duration_time_queue_draw, (gpointer) navigation);
+  ags_refresh_scheduler_add(ags_refresh_scheduler_get_instance(),
+			    (GtkWidget *) navigation,
+			    (GSourceFunc) ags_navigation_duration_time_queue_draw);
 
   navigation->duration_tact = NULL;
   //  navigation->duration_tact = (GtkSpinButton *) gtk_spin_button_new_with_range(0.0, AGS_NOTE_EDIT_MAX_CONTROLS * 64.0, 1.0);
@@ -751,13 +754,13 @@ ags_navigation_set_seeking_sensitive(AgsNavigation *navigation,
 }
 
 gboolean
-ags_navigation_duration_time_queue_draw(GtkWidget *widget)
+ags_navigation_duration_time_queue_draw(AgsRefreshEntry *refresh_entry)
 {
   AgsNavigation *navigation;
 
   gchar *str;
   
-  navigation = AGS_NAVIGATION(widget);
+  navigation = AGS_NAVIGATION(refresh_entry->widget);
 
   if(navigation->soundcard == NULL){
     return(TRUE);
@@ -24,6 +24,8 @@
 #include <glib-object.h>
 #include <gtk/gtk.h>
 
+#include <ags/X/ags_refresh_scheduler.h>
+
 #define AGS_TYPE_NAVIGATION                (ags_navigation_get_type())
 #define AGS_NAVIGATION(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_NAVIGATION, AgsNavigation))
 #define AGS_NAVIGATION_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST((class), AGS_TYPE_NAVIGATION, AgsNavigationClass))
@@ -115,7 +117,7 @@ void ags_navigation_set_seeking_sensitive(AgsNavigation *navigation,
 void ags_navigation_change_position(AgsNavigation *navigation,
 				    gdouble tact);
 
-gboolean ags_navigation_duration_time_queue_draw(GtkWidget *widget);
+gboolean ags_navigation_duration_time_queue_draw(AgsRefreshEntry *refresh_entry);
 
 AgsNavigation* ags_navigation_new();
 
@@ -51,6 +51,7 @@
 #include <ags/audio/task/ags_cancel_channel.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_machine.h>
 
 #include <ags/X/thread/ags_gui_thread.h>
@@ -915,6 +916,10 @@ ags_pad_play(AgsPad *pad)
 							 AGS_TYPE_GUI_THREAD);
 
       start_soundcard = ags_start_soundcard_new(application_context);
+
+      /* refresh indicators while playing */
+      ags_refresh_scheduler_start(ags_refresh_scheduler_get_instance());
+
       tasks = g_list_prepend(tasks, start_soundcard);
 
       task_completion = ags_task_completion_new((GObject *) start_soundcard,
@@ -0,0 +1,558 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/X/ags_refresh_scheduler.h>
+
+#include <ags/object/ags_application_context.h>
+#include <ags/object/ags_soundcard.h>
+
+#include <ags/plugin/ags_base_plugin.h>
+
+#include <ags/audio/ags_sound_provider.h>
+
+#include <ags/X/ags_line_member.h>
+
+#include <stdlib.h>
+
+void ags_refresh_scheduler_class_init(AgsRefreshSchedulerClass *refresh_scheduler);
+void ags_refresh_scheduler_init(AgsRefreshScheduler *refresh_scheduler);
+void ags_refresh_scheduler_finalize(GObject *gobject);
+
+gboolean ags_refresh_scheduler_timeout(AgsRefreshScheduler *refresh_scheduler);
+
+/**
+ * SECTION:ags_refresh_scheduler
+ * @short_description: refresh indicators at display rate
+ * @title: AgsRefreshScheduler
+ * @section_id:
+ * @include: ags/X/ags_refresh_scheduler.h
+ *
+ * The #AgsRefreshScheduler runs one timeout for all registered widgets like
+ * meters, LEDs and the navigation's time display. It is started as playback
+ * starts and stops itself as soon as no soundcard is playing anymore.
+ *
+ * The refresh functions are called with their #AgsRefreshEntry. Widgets of
+ * an #AgsLineMember find its ports, their range and conversion resolved in
+ * the entry, so a tick only reads the port values or meter slots.
+ */
+
+static gpointer ags_refresh_scheduler_parent_class = NULL;
+
+AgsRefreshScheduler *ags_refresh_scheduler = NULL;
+
+GType
+ags_refresh_scheduler_get_type()
+{
+  static GType ags_type_refresh_scheduler = 0;
+
+  if(!ags_type_refresh_scheduler){
+    static const GTypeInfo ags_refresh_scheduler_info = {
+      sizeof (AgsRefreshSchedulerClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) ags_refresh_scheduler_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (AgsRefreshScheduler),
+      0,    /* n_preallocs */
+      (GInstanceInitFunc) ags_refresh_scheduler_init,
+    };
+
+    ags_type_refresh_scheduler = g_type_register_static(G_TYPE_OBJECT,
+							"AgsRefreshScheduler\0",
+							&ags_refresh_scheduler_info,
+							0);
+  }
+  
+  return(ags_type_refresh_scheduler);
+}
+
+void
+ags_refresh_scheduler_class_init(AgsRefreshSchedulerClass *refresh_scheduler)
+{
+  GObjectClass *gobject;
+
+  ags_refresh_scheduler_parent_class = g_type_class_peek_parent(refresh_scheduler);
+
+  /* GObject */
+  gobject = (GObjectClass *) refresh_scheduler;
+
+  gobject->finalize = ags_refresh_scheduler_finalize;
+}
+
+void
+ags_refresh_scheduler_init(AgsRefreshScheduler *refresh_scheduler)
+{
+  refresh_scheduler->flags = 0;
+
+  refresh_scheduler->frequency = AGS_REFRESH_SCHEDULER_DEFAULT_FREQUENCY;
+  refresh_scheduler->timeout_id = 0;
+
+  refresh_scheduler->idle_ticks = 0;
+  
+  refresh_scheduler->entry = NULL;
+}
+
+void
+ags_refresh_scheduler_finalize(GObject *gobject)
+{
+  AgsRefreshScheduler *refresh_scheduler;
+
+  refresh_scheduler = AGS_REFRESH_SCHEDULER(gobject);
+
+  ags_refresh_scheduler_stop(refresh_scheduler);
+  
+  g_list_free_full(refresh_scheduler->entry,
+		   (GDestroyNotify) ags_refresh_entry_free);
+
+  if(refresh_scheduler == ags_refresh_scheduler){
+    ags_refresh_scheduler = NULL;
+  }
+  
+  /* call parent */
+  G_OBJECT_CLASS(ags_refresh_scheduler_parent_class)->finalize(gobject);
+}
+
+/**
+ * ags_refresh_entry_alloc:
+ * @widget: the #GtkWidget to refresh
+ * @refresh: the function called with the #AgsRefreshEntry every tick
+ *
+ * Allocate #AgsRefreshEntry.
+ *
+ * Returns: the new #AgsRefreshEntry
+ *
+ * Since: 0.7.136
+ */
+AgsRefreshEntry*
+ags_refresh_entry_alloc(GtkWidget *widget,
+			GSourceFunc refresh)
+{
+  AgsRefreshEntry *refresh_entry;
+
+  refresh_entry = (AgsRefreshEntry *) malloc(sizeof(AgsRefreshEntry));
+
+  refresh_entry->flags = 0;
+  
+  refresh_entry->widget = widget;
+  refresh_entry->refresh = refresh;
+
+  refresh_entry->line_member = NULL;
+  
+  refresh_entry->port = NULL;
+  refresh_entry->recall_port = NULL;
+
+  refresh_entry->conversion = NULL;
+  refresh_entry->range = 0.0;
+  
+  return(refresh_entry);
+}
+
+/**
+ * ags_refresh_entry_free:
+ * @refresh_entry: the #AgsRefreshEntry
+ *
+ * Free @refresh_entry.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_refresh_entry_free(AgsRefreshEntry *refresh_entry)
+{
+  if(refresh_entry->port != NULL){
+    g_object_unref(refresh_entry->port);
+  }
+
+  if(refresh_entry->recall_port != NULL){
+    g_object_unref(refresh_entry->recall_port);
+  }
+  
+  free(refresh_entry);
+}
+
+/**
+ * ags_refresh_entry_resolve:
+ * @refresh_entry: the #AgsRefreshEntry
+ *
+ * Look up the #AgsLineMember of the entry's widget and keep its output
+ * port and recall port together with their converted range, if the port's
+ * specifier matches. Call it again as the ports of the line member change.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_refresh_entry_resolve(AgsRefreshEntry *refresh_entry)
+{
+  AgsLineMember *line_member;
+  AgsPort *port;
+
+  gdouble lower, upper;
+  
+  /* release previous */
+  if(refresh_entry->port != NULL){
+    g_object_unref(refresh_entry->port);
+
+    refresh_entry->port = NULL;
+  }
+
+  if(refresh_entry->recall_port != NULL){
+    g_object_unref(refresh_entry->recall_port);
+
+    refresh_entry->recall_port = NULL;
+  }
+
+  refresh_entry->flags &= (~(AGS_REFRESH_ENTRY_PORT_TOGGLED |
+			     AGS_REFRESH_ENTRY_RECALL_PORT_TOGGLED));
+
+  refresh_entry->conversion = NULL;
+  refresh_entry->range = 0.0;
+  
+  /* the line member owning the widget */
+  line_member = (AgsLineMember *) gtk_widget_get_ancestor(refresh_entry->widget,
+							  AGS_TYPE_LINE_MEMBER);
+  refresh_entry->line_member = (GtkWidget *) line_member;
+
+  if(line_member == NULL){
+    return;
+  }
+  
+  refresh_entry->conversion = line_member->conversion;
+
+  port = line_member->port;
+  
+  if(port == NULL){
+    return;
+  }
+
+  /* check if output port and specifier matches */
+  pthread_mutex_lock(port->mutex);
+      
+  if((AGS_PORT_IS_OUTPUT & (port->flags)) == 0 ||
+     port->port_descriptor == NULL ||
+     g_ascii_strcasecmp(port->specifier,
+			line_member->specifier)){
+    pthread_mutex_unlock(port->mutex);
+	
+    return;
+  }
+
+  /* lower and upper */
+  lower = g_value_get_float(AGS_PORT_DESCRIPTOR(port->port_descriptor)->lower_value);
+  upper = g_value_get_float(AGS_PORT_DESCRIPTOR(port->port_descriptor)->upper_value);
+      
+  pthread_mutex_unlock(port->mutex);
+
+  /* get range */
+  if(line_member->conversion != NULL){
+    lower = ags_conversion_convert(line_member->conversion,
+				   lower,
+				   TRUE);
+
+    upper = ags_conversion_convert(line_member->conversion,
+				   upper,
+				   TRUE);
+  }
+      
+  refresh_entry->range = upper - lower;
+
+  /* play port */
+  refresh_entry->port = port;
+  g_object_ref(port);
+
+  if(refresh_entry->range == 0.0 ||
+     port->port_value_type == G_TYPE_BOOLEAN){
+    refresh_entry->flags |= AGS_REFRESH_ENTRY_PORT_TOGGLED;
+  }
+
+  /* recall port */
+  port = line_member->recall_port;
+
+  if(port != NULL){
+    refresh_entry->recall_port = port;
+    g_object_ref(port);
+
+    if(refresh_entry->range == 0.0 ||
+       port->port_value_type == G_TYPE_BOOLEAN){
+      refresh_entry->flags |= AGS_REFRESH_ENTRY_RECALL_PORT_TOGGLED;
+    }
+  }
+}
+
+/**
+ * ags_refresh_scheduler_add:
+ * @refresh_scheduler: the #AgsRefreshScheduler
+ * @widget: the #GtkWidget to refresh
+ * @refresh: the function called with the #AgsRefreshEntry every tick
+ *
+ * Register @widget. As long as @refresh returns %TRUE it is called with the
+ * #AgsRefreshEntry once per tick, returning %FALSE removes @widget. The
+ * ports of an #AgsLineMember containing @widget are resolved right away.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_refresh_scheduler_add(AgsRefreshScheduler *refresh_scheduler,
+			  GtkWidget *widget,
+			  GSourceFunc refresh)
+{
+  AgsRefreshEntry *refresh_entry;
+  
+  if(refresh_scheduler == NULL ||
+     widget == NULL ||
+     refresh == NULL){
+    return;
+  }
+
+  refresh_entry = ags_refresh_entry_alloc(widget,
+					  refresh);
+  ags_refresh_entry_resolve(refresh_entry);
+  
+  refresh_scheduler->entry = g_list_prepend(refresh_scheduler->entry,
+					    refresh_entry);
+}
+
+/**
+ * ags_refresh_scheduler_remove:
+ * @refresh_scheduler: the #AgsRefreshScheduler
+ * @widget: the #GtkWidget
+ *
+ * Unregister @widget.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_refresh_scheduler_remove(AgsRefreshScheduler *refresh_scheduler,
+			     GtkWidget *widget)
+{
+  GList *entry;
+
+  if(refresh_scheduler == NULL){
+    return;
+  }
+
+  entry = refresh_scheduler->entry;
+
+  while(entry != NULL){
+    if(AGS_REFRESH_ENTRY(entry->data)->widget == widget){
+      ags_refresh_entry_free(entry->data);
+      refresh_scheduler->entry = g_list_delete_link(refresh_scheduler->entry,
+						    entry);
+
+      break;
+    }
+
+    entry = entry->next;
+  }
+}
+
+/**
+ * ags_refresh_scheduler_resolve:
+ * @refresh_scheduler: the #AgsRefreshScheduler
+ * @widget: the #GtkWidget
+ *
+ * Resolve the ports of @widget's entry again, see ags_refresh_entry_resolve().
+ *
+ * Since: 0.7.136
+ */
+void
+ags_refresh_scheduler_resolve(AgsRefreshScheduler *refresh_scheduler,
+			      GtkWidget *widget)
+{
+  GList *entry;
+
+  if(refresh_scheduler == NULL){
+    return;
+  }
+
+  entry = refresh_scheduler->entry;
+
+  while(entry != NULL){
+    if(AGS_REFRESH_ENTRY(entry->data)->widget == widget){
+      ags_refresh_entry_resolve(entry->data);
+
+      break;
+    }
+
+    entry = entry->next;
+  }
+}
+
+gboolean
+ags_refresh_scheduler_timeout(AgsRefreshScheduler *refresh_scheduler)
+{
+  AgsRefreshEntry *refresh_entry;
+  
+  GList *entry, *next;
+
+  /* refresh all widgets within one tick */
+  entry = refresh_scheduler->entry;
+
+  while(entry != NULL){
+    next = entry->next;
+    refresh_entry = AGS_REFRESH_ENTRY(entry->data);
+    
+    if(!refresh_entry->refresh(refresh_entry)){
+      ags_refresh_entry_free(refresh_entry);
+      refresh_scheduler->entry = g_list_delete_link(refresh_scheduler->entry,
+						    entry);
+    }
+
+    entry = next;
+  }
+
+  /* stop after idling for a while, the last ticks reset the indicators */
+  if(ags_refresh_scheduler_is_playing(refresh_scheduler)){
+    refresh_scheduler->idle_ticks = 0;
+  }else{
+    refresh_scheduler->idle_ticks += 1;
+
+    if(refresh_scheduler->idle_ticks >= AGS_REFRESH_SCHEDULER_IDLE_TICKS){
+      refresh_scheduler->flags &= (~AGS_REFRESH_SCHEDULER_RUNNING);
+      refresh_scheduler->timeout_id = 0;
+
+      return(FALSE);
+    }
+  }
+  
+  return(TRUE);
+}
+
+/**
+ * ags_refresh_scheduler_start:
+ * @refresh_scheduler: the #AgsRefreshScheduler
+ *
+ * Start ticking, call it as playback is about to start.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_refresh_scheduler_start(AgsRefreshScheduler *refresh_scheduler)
+{
+  if(refresh_scheduler == NULL){
+    return;
+  }
+
+  refresh_scheduler->idle_ticks = 0;
+
+  if((AGS_REFRESH_SCHEDULER_RUNNING & (refresh_scheduler->flags)) != 0){
+    return;
+  }
+
+  refresh_scheduler->flags |= AGS_REFRESH_SCHEDULER_RUNNING;
+  refresh_scheduler->timeout_id = g_timeout_add(1000 / refresh_scheduler->frequency,
+						(GSourceFunc) ags_refresh_scheduler_timeout,
+						(gpointer) refresh_scheduler);
+}
+
+/**
+ * ags_refresh_scheduler_stop:
+ * @refresh_scheduler: the #AgsRefreshScheduler
+ *
+ * Stop ticking.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_refresh_scheduler_stop(AgsRefreshScheduler *refresh_scheduler)
+{
+  if(refresh_scheduler == NULL ||
+     (AGS_REFRESH_SCHEDULER_RUNNING & (refresh_scheduler->flags)) == 0){
+    return;
+  }
+
+  g_source_remove(refresh_scheduler->timeout_id);
+
+  refresh_scheduler->flags &= (~AGS_REFRESH_SCHEDULER_RUNNING);
+  refresh_scheduler->timeout_id = 0;
+}
+
+/**
+ * ags_refresh_scheduler_is_playing:
+ * @refresh_scheduler: the #AgsRefreshScheduler
+ *
+ * Check if any soundcard of the application context is playing.
+ *
+ * Returns: %TRUE if playing, otherwise %FALSE
+ *
+ * Since: 0.7.136
+ */
+gboolean
+ags_refresh_scheduler_is_playing(AgsRefreshScheduler *refresh_scheduler)
+{
+  AgsApplicationContext *application_context;
+
+  GList *list;
+
+  application_context = ags_application_context_get_instance();
+
+  if(application_context == NULL){
+    return(FALSE);
+  }
+  
+  list = ags_sound_provider_get_soundcard(AGS_SOUND_PROVIDER(application_context));
+
+  while(list != NULL){
+    if(ags_soundcard_is_playing(AGS_SOUNDCARD(list->data))){
+      return(TRUE);
+    }
+
+    list = list->next;
+  }
+
+  return(FALSE);
+}
+
+/**
+ * ags_refresh_scheduler_get_instance:
+ *
+ * Get the #AgsRefreshScheduler singleton.
+ *
+ * Returns: the #AgsRefreshScheduler
+ *
+ * Since: 0.7.136
+ */
+AgsRefreshScheduler*
+ags_refresh_scheduler_get_instance()
+{
+  if(ags_refresh_scheduler == NULL){
+    ags_refresh_scheduler = ags_refresh_scheduler_new();
+  }
+
+  return(ags_refresh_scheduler);
+}
+
+/**
+ * ags_refresh_scheduler_new:
+ *
+ * Instantiate #AgsRefreshScheduler.
+ *
+ * Returns: the new #AgsRefreshScheduler
+ *
+ * Since: 0.7.136
+ */
+AgsRefreshScheduler*
+ags_refresh_scheduler_new()
+{
+  AgsRefreshScheduler *refresh_scheduler;
+
+  refresh_scheduler = (AgsRefreshScheduler *) g_object_new(AGS_TYPE_REFRESH_SCHEDULER,
+							   NULL);
+
+  return(refresh_scheduler);
+}
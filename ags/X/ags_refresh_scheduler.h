@@ -0,0 +1,115 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_REFRESH_SCHEDULER_H__
+#define __AGS_REFRESH_SCHEDULER_H__
+
+#include <glib.h>
+#include <glib-object.h>
+#include <gtk/gtk.h>
+
+#include <ags/lib/ags_conversion.h>
+
+#include <ags/audio/ags_port.h>
+
+#define AGS_TYPE_REFRESH_SCHEDULER                (ags_refresh_scheduler_get_type())
+#define AGS_REFRESH_SCHEDULER(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_REFRESH_SCHEDULER, AgsRefreshScheduler))
+#define AGS_REFRESH_SCHEDULER_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST(class, AGS_TYPE_REFRESH_SCHEDULER, AgsRefreshSchedulerClass))
+#define AGS_IS_REFRESH_SCHEDULER(obj)             (G_TYPE_CHECK_INSTANCE_TYPE ((obj), AGS_TYPE_REFRESH_SCHEDULER))
+#define AGS_IS_REFRESH_SCHEDULER_CLASS(class)     (G_TYPE_CHECK_CLASS_TYPE ((class), AGS_TYPE_REFRESH_SCHEDULER))
+#define AGS_REFRESH_SCHEDULER_GET_CLASS(obj)      (G_TYPE_INSTANCE_GET_CLASS(obj, AGS_TYPE_REFRESH_SCHEDULER, AgsRefreshSchedulerClass))
+
+#define AGS_REFRESH_ENTRY(ptr) ((AgsRefreshEntry *)(ptr))
+
+#define AGS_REFRESH_SCHEDULER_DEFAULT_FREQUENCY (30)
+#define AGS_REFRESH_SCHEDULER_IDLE_TICKS (30)
+
+typedef struct _AgsRefreshScheduler AgsRefreshScheduler;
+typedef struct _AgsRefreshSchedulerClass AgsRefreshSchedulerClass;
+typedef struct _AgsRefreshEntry AgsRefreshEntry;
+
+typedef enum{
+  AGS_REFRESH_SCHEDULER_RUNNING    = 1,
+}AgsRefreshSchedulerFlags;
+
+typedef enum{
+  AGS_REFRESH_ENTRY_PORT_TOGGLED          = 1,
+  AGS_REFRESH_ENTRY_RECALL_PORT_TOGGLED   = 1 <<  1,
+}AgsRefreshEntryFlags;
+
+struct _AgsRefreshScheduler
+{
+  GObject object;
+
+  guint flags;
+
+  guint frequency;
+  guint timeout_id;
+  
+  guint idle_ticks;
+  
+  GList *entry;
+};
+
+struct _AgsRefreshSchedulerClass
+{
+  GObjectClass object;
+};
+
+struct _AgsRefreshEntry
+{
+  guint flags;
+  
+  GtkWidget *widget;
+  GSourceFunc refresh;
+
+  GtkWidget *line_member;
+
+  AgsPort *port;
+  AgsPort *recall_port;
+
+  AgsConversion *conversion;
+  gdouble range;
+};
+
+GType ags_refresh_scheduler_get_type();
+
+AgsRefreshEntry* ags_refresh_entry_alloc(GtkWidget *widget,
+					 GSourceFunc refresh);
+void ags_refresh_entry_free(AgsRefreshEntry *refresh_entry);
+
+void ags_refresh_entry_resolve(AgsRefreshEntry *refresh_entry);
+
+void ags_refresh_scheduler_add(AgsRefreshScheduler *refresh_scheduler,
+			       GtkWidget *widget,
+			       GSourceFunc refresh);
+void ags_refresh_scheduler_remove(AgsRefreshScheduler *refresh_scheduler,
+				  GtkWidget *widget);
+void ags_refresh_scheduler_resolve(AgsRefreshScheduler *refresh_scheduler,
+				   GtkWidget *widget);
+
+void ags_refresh_scheduler_start(AgsRefreshScheduler *refresh_scheduler);
+void ags_refresh_scheduler_stop(AgsRefreshScheduler *refresh_scheduler);
+
+gboolean ags_refresh_scheduler_is_playing(AgsRefreshScheduler *refresh_scheduler);
+
+AgsRefreshScheduler* ags_refresh_scheduler_get_instance();
+AgsRefreshScheduler* ags_refresh_scheduler_new();
+
+#endif /*__AGS_REFRESH_SCHEDULER_H__*/
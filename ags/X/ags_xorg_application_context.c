@@ -41,6 +41,7 @@
 #include <ags/thread/ags_thread-posix.h>
 #include <ags/thread/ags_thread_pool.h>
 #include <ags/thread/ags_task_thread.h>
+#include <ags/thread/ags_history.h>
 #include <ags/thread/ags_destroy_worker.h>
 
 #include <ags/plugin/ags_ladspa_manager.h>
@@ -690,6 +691,9 @@ ags_xorg_application_context_init(AgsXorgApplicationContext *xorg_application_co
 				(AgsThread *) xorg_application_context->polling_thread,
 				TRUE, TRUE);
   
+  /* AgsHistory */
+  AGS_APPLICATION_CONTEXT(xorg_application_context)->history = (GObject *) ags_history_new();
+
   /* AgsTaskThread */
   AGS_APPLICATION_CONTEXT(xorg_application_context)->task_thread = (GObject *) ags_task_thread_new();
   ags_main_loop_set_async_queue(AGS_MAIN_LOOP(audio_loop),
@@ -787,16 +791,11 @@ ags_xorg_application_context_init(AgsXorgApplicationContext *xorg_application_co
   xorg_application_context->worker = NULL;
 
   /* AgsDestroyWorker */
-  /*
   destroy_worker = ags_destroy_worker_new();
   g_object_ref(destroy_worker);
-  ags_thread_add_child_extended(AGS_THREAD(audio_loop),
-				destroy_worker,
-				TRUE, TRUE);
   xorg_application_context->worker = g_list_prepend(xorg_application_context->worker,
 						    destroy_worker);
-  ags_thread_start(destroy_worker);
-  */
+  ags_thread_start((AgsThread *) destroy_worker);
   
   /* AgsThreadPool */
   xorg_application_context->thread_pool = AGS_TASK_THREAD(AGS_APPLICATION_CONTEXT(xorg_application_context)->task_thread)->thread_pool;
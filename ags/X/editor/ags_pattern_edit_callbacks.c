@@ -46,6 +46,7 @@
 #include <ags/audio/task/ags_add_audio_signal.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_editor.h>
 
 #include <ags/X/machine/ags_panel.h>
@@ -1296,6 +1297,10 @@ ags_pattern_edit_drawing_area_key_release_event(GtkWidget *widget, GdkEventKey *
 
     /* create start task */
     start_soundcard = ags_start_soundcard_new(application_context);
+
+    /* refresh indicators while playing */
+    ags_refresh_scheduler_start(ags_refresh_scheduler_get_instance());
+
     tasks = g_list_prepend(tasks,
 			   start_soundcard);
 
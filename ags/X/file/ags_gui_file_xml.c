@@ -3332,6 +3332,7 @@ ags_file_read_bulk_member(AgsFile *file, xmlNode *node, AgsBulkMember **bulk_mem
 	AgsFileLookup *file_lookup;
 	
 	GParameter *parameter;
+	GList *list;
 
 	gint n_params;
 	guint i;
@@ -3344,10 +3345,14 @@ ags_file_read_bulk_member(AgsFile *file, xmlNode *node, AgsBulkMember **bulk_mem
 				     &parameter, &n_params, NULL);
 
 	for(i = 0; i < n_params; i++){
-	  file_lookup = (AgsFileLookup *) ags_file_lookup_find_by_reference(file->lookup,
-									    &(parameter[i].value));
-	  g_signal_connect_after(G_OBJECT(file_lookup), "resolve\0",
-				 G_CALLBACK(ags_file_read_bulk_member_resolve_port), gobject);
+	  list = ags_file_find_lookup_by_reference(file,
+						   &(parameter[i].value));
+
+	  if(list != NULL){
+	    file_lookup = AGS_FILE_LOOKUP(list->data);
+	    g_signal_connect_after(G_OBJECT(file_lookup), "resolve\0",
+				   G_CALLBACK(ags_file_read_bulk_member_resolve_port), gobject);
+	  }
 	}
       }
     }
@@ -5146,7 +5151,7 @@ ags_file_read_machine_selector(AgsFile *file, xmlNode *node, AgsMachineSelector
 	    if(!xmlStrncmp(value_node->name,
 			   "ags-value\0",
 			   10)){
-	      list = ags_file_lookup_find_by_node(file->lookup,
+	      list = ags_file_find_lookup_by_node(file,
 						  value_node);
 	  
 	      if(list != NULL){
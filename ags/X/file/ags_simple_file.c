@@ -32,6 +32,7 @@
 #include <ags/file/ags_file_id_ref.h>
 #include <ags/file/ags_file_launch.h>
 #include <ags/file/ags_file_link.h>
+#include <ags/file/ags_file_util.h>
 
 #include <ags/thread/ags_thread-posix.h>
 
@@ -563,6 +564,16 @@ ags_simple_file_init(AgsSimpleFile *simple_file)
   simple_file->lookup = NULL;
   simple_file->launch = NULL;
 
+  simple_file->id_ref_by_node = g_hash_table_new(g_direct_hash,
+						 g_direct_equal);
+  simple_file->id_ref_by_reference = g_hash_table_new_full(g_direct_hash,
+							   g_direct_equal,
+							   NULL,
+							   (GDestroyNotify) g_list_free);
+  simple_file->node_by_id = NULL;
+
+  simple_file->xpath_context = NULL;
+
   simple_file->application_context = NULL;
 }
 
@@ -707,7 +718,25 @@ ags_simple_file_get_property(GObject *gobject,
 void
 ags_simple_file_finalize(GObject *gobject)
 {
+  AgsSimpleFile *simple_file;
+
+  simple_file = AGS_SIMPLE_FILE(gobject);
+
+  g_hash_table_destroy(simple_file->id_ref_by_node);
+  g_hash_table_destroy(simple_file->id_ref_by_reference);
+
+  if(simple_file->node_by_id != NULL){
+    g_hash_table_destroy(simple_file->node_by_id);
+  }
+
+  if(simple_file->xpath_context != NULL){
+    xmlXPathFreeContext(simple_file->xpath_context);
+  }
+  
   //TODO:JK: implement me
+
+  /* call parent */
+  G_OBJECT_CLASS(ags_simple_file_parent_class)->finalize(gobject);
 }
 
 gchar*
@@ -726,6 +755,10 @@ ags_simple_file_str2md5(gchar *content, guint content_length)
 void
 ags_simple_file_add_id_ref(AgsSimpleFile *simple_file, GObject *id_ref)
 {
+  AgsFileIdRef *file_id_ref;
+
+  GList *list;
+  
   if(simple_file == NULL ||
      id_ref == NULL){
     return;
@@ -734,44 +767,53 @@ ags_simple_file_add_id_ref(AgsSimpleFile *simple_file, GObject *id_ref)
   g_object_ref(id_ref);
   simple_file->id_ref = g_list_prepend(simple_file->id_ref,
 				       id_ref);
+
+  /* index */
+  file_id_ref = AGS_FILE_ID_REF(id_ref);
+  
+  if(file_id_ref->node != NULL){
+    g_hash_table_insert(simple_file->id_ref_by_node,
+			file_id_ref->node,
+			file_id_ref);
+  }
+
+  if(file_id_ref->ref != NULL){
+    list = g_hash_table_lookup(simple_file->id_ref_by_reference,
+			       file_id_ref->ref);
+    g_hash_table_steal(simple_file->id_ref_by_reference,
+		       file_id_ref->ref);
+
+    g_hash_table_insert(simple_file->id_ref_by_reference,
+			file_id_ref->ref,
+			g_list_prepend(list,
+				       file_id_ref));
+  }
 }
 
 GObject*
 ags_simple_file_find_id_ref_by_node(AgsSimpleFile *simple_file, xmlNode *node)
 {
-  AgsFileIdRef *file_id_ref;
-  GList *list;
-
   if(simple_file == NULL ||
      node == NULL){
     return(NULL);
   }
   
-  list = simple_file->id_ref;
-
-  while(list != NULL){
-    file_id_ref = AGS_FILE_ID_REF(list->data);
-
-    if(file_id_ref->node == node){
-      return((GObject *) file_id_ref);
-    }
-
-    list = list->next;
-  }
-
-  return(NULL);
+  return((GObject *) g_hash_table_lookup(simple_file->id_ref_by_node,
+					 node));
 }
 
 GList*
 ags_simple_file_find_id_ref_by_xpath(AgsSimpleFile *simple_file, gchar *xpath)
 {
-  AgsFileIdRef *file_id_ref;
-
-  xmlXPathContext *xpath_context; 
+  GObject *gobject;
+  
   xmlXPathObject *xpath_object;
   xmlNode **node;
+  xmlNode *id_node;
 
   GList *list;
+
+  gchar *node_name, *id;
   
   guint i;
 
@@ -781,45 +823,92 @@ ags_simple_file_find_id_ref_by_xpath(AgsSimpleFile *simple_file, gchar *xpath)
     return(NULL);
   }
 
-  xpath = &(xpath[6]);
+  /* Create xpath evaluation context or reuse it, the id index is bound to the same document */
+  if(simple_file->xpath_context != NULL &&
+     simple_file->xpath_context->doc != simple_file->doc){
+    xmlXPathFreeContext(simple_file->xpath_context);
+    simple_file->xpath_context = NULL;
 
-  /* Create xpath evaluation context */
-  xpath_context = xmlXPathNewContext(simple_file->doc);
+    if(simple_file->node_by_id != NULL){
+      g_hash_table_destroy(simple_file->node_by_id);
+      simple_file->node_by_id = NULL;
+    }
+  }
 
-  if(xpath_context == NULL) {
+  if(simple_file->xpath_context == NULL){
+    simple_file->xpath_context = xmlXPathNewContext(simple_file->doc);
+  }
+  
+  if(simple_file->xpath_context == NULL) {
     g_warning("Error: unable to create new XPath context\0");
 
     return(NULL);
   }
 
+  /* fast path by id */
+  if(ags_file_util_parse_id_xpath(xpath,
+				  &node_name, &id)){
+    if(simple_file->node_by_id == NULL){
+      simple_file->node_by_id = g_hash_table_new_full(g_str_hash,
+						      g_str_equal,
+						      (GDestroyNotify) xmlFree,
+						      NULL);
+      ags_file_util_index_node_by_id(simple_file->node_by_id,
+				     xmlDocGetRootElement(simple_file->doc));
+    }
+
+    id_node = g_hash_table_lookup(simple_file->node_by_id,
+				  id);
+    gobject = NULL;
+    
+    if(id_node != NULL &&
+       (node_name == NULL ||
+	!xmlStrcmp(id_node->name,
+		   node_name))){
+      gobject = ags_simple_file_find_id_ref_by_node(simple_file,
+						    id_node);
+    }
+
+    g_free(node_name);
+    g_free(id);
+    
+    if(gobject != NULL){
+      return(g_list_prepend(NULL,
+			    gobject));
+    }
+  }
+  
+  xpath = &(xpath[6]);
+
   /* Evaluate xpath expression */
-  xpath_object = xmlXPathEval(xpath, xpath_context);
+  xpath_object = xmlXPathEval(xpath, simple_file->xpath_context);
 
   if(xpath_object == NULL) {
     g_warning("Error: unable to evaluate xpath expression \"%s\"\0", xpath);
-    xmlXPathFreeContext(xpath_context); 
 
     return(NULL);
   }
 
-  node = xpath_object->nodesetval->nodeTab;
-
   list = NULL;
+
+  if(xpath_object->nodesetval != NULL){
+    node = xpath_object->nodesetval->nodeTab;
   
-  for(i = 0; i < xpath_object->nodesetval->nodeNr; i++){
-    if(node[i]->type == XML_ELEMENT_NODE){
-      GObject *gobject;
-      
-      gobject = ags_simple_file_find_id_ref_by_node(simple_file,
-						    node[i]);
+    for(i = 0; i < xpath_object->nodesetval->nodeNr; i++){
+      if(node[i]->type == XML_ELEMENT_NODE){
+	gobject = ags_simple_file_find_id_ref_by_node(simple_file,
+						      node[i]);
 
-      if(gobject != NULL){
-	list = g_list_prepend(list,
-			      gobject);
+	if(gobject != NULL){
+	  list = g_list_prepend(list,
+				gobject);
+	}
       }
     }
   }
 
+  xmlXPathFreeObject(xpath_object);
+  
   if(list == NULL){
     g_message("no xpath match: %s\0", xpath);
   }
@@ -830,30 +919,17 @@ ags_simple_file_find_id_ref_by_xpath(AgsSimpleFile *simple_file, gchar *xpath)
 GList*
 ags_simple_file_find_id_ref_by_reference(AgsSimpleFile *simple_file, gpointer ref)
 {
-  AgsFileIdRef *file_id_ref;
-  
   GList *list;
-  GList *ref_list;
   
   if(simple_file == NULL || ref == NULL){
     return(NULL);
   }
 
-  list = simple_file->id_ref;
-  ref_list = NULL;
+  /* the index keeps the most recent first, return the oldest first as the list scan did */
+  list = g_hash_table_lookup(simple_file->id_ref_by_reference,
+			     ref);
   
-  while(list != NULL){
-    file_id_ref = AGS_FILE_ID_REF(list->data);
-
-    if(file_id_ref->ref == ref){
-      ref_list = g_list_prepend(ref_list,
-				file_id_ref);
-    }
-
-    list = list->next;
-  }
-
-  return(ref_list);
+  return(g_list_reverse(g_list_copy(list)));
 }
 
 void
@@ -4292,6 +4368,8 @@ ags_simple_file_read_notation(AgsSimpleFile *simple_file, xmlNode *node, AgsNota
   AgsNote *note;
 
   xmlNode *child;
+
+  GList *note_list;
   
   xmlChar *str;
   
@@ -4335,6 +4413,8 @@ ags_simple_file_read_notation(AgsSimpleFile *simple_file, xmlNode *node, AgsNota
   /* children */
   child = node->children;
 
+  note_list = NULL;
+  
   while(child != NULL){
     if(child->type == XML_ELEMENT_NODE){
       if(!xmlStrncmp(child->name,
@@ -4419,14 +4499,21 @@ ags_simple_file_read_notation(AgsSimpleFile *simple_file, xmlNode *node, AgsNota
 
 	
 	/* add */
-	ags_notation_add_note(gobject,
-			      note,
-			      FALSE);
+	note_list = g_list_prepend(note_list,
+				   note);
       }
     }
 
     child = child->next;
   }
+
+  /* add all notes at once */
+  ags_notation_add_note_batch(gobject,
+			      note_list,
+			      FALSE);
+
+  g_list_free_full(note_list,
+		   g_object_unref);
 }
 
 void
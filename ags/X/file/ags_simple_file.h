@@ -24,6 +24,7 @@
 #include <glib-object.h>
 
 #include <libxml/tree.h>
+#include <libxml/xpath.h>
 
 #define AGS_TYPE_SIMPLE_FILE                (ags_simple_file_get_type())
 #define AGS_SIMPLE_FILE(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_SIMPLE_FILE, AgsSimpleFile))
@@ -81,6 +82,12 @@ struct _AgsSimpleFile
   GList *lookup;
   GList *launch;
 
+  GHashTable *id_ref_by_node;
+  GHashTable *id_ref_by_reference;
+  GHashTable *node_by_id;
+
+  xmlXPathContext *xpath_context;
+
   GObject *application_context;
 };
 
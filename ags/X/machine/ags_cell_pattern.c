@@ -37,6 +37,7 @@
 #include <ags/audio/thread/ags_audio_loop.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_machine.h>
 
 #include <ags/X/task/ags_blink_cell_pattern_cursor.h>
@@ -298,7 +299,9 @@ ags_cell_pattern_init(AgsCellPattern *cell_pattern)
 
   g_hash_table_insert(ags_cell_pattern_led_queue_draw,
 		      cell_pattern, ags_cell_pattern_led_queue_draw_timeout);
-  g_timeout_add(1000 / 30, (GSourceFunc) ags_cell_pattern_led_queue_draw_timeout, (gpointer) cell_pattern);
+  ags_refresh_scheduler_add(ags_refresh_scheduler_get_instance(),
+			    (GtkWidget *) cell_pattern,
+			    (GSourceFunc) ags_cell_pattern_led_queue_draw_timeout);
 }
 
 void
@@ -306,6 +309,8 @@ ags_cell_pattern_finalize(GObject *gobject)
 {
   g_hash_table_remove(ags_cell_pattern_led_queue_draw,
 		      gobject);
+  ags_refresh_scheduler_remove(ags_refresh_scheduler_get_instance(),
+			       (GtkWidget *) gobject);
 
   G_OBJECT_CLASS(ags_cell_pattern_parent_class)->finalize(gobject);
 }
@@ -928,7 +933,7 @@ ags_cell_pattern_blink_worker(void *data)
 
 /**
  * ags_cell_pattern_led_queue_draw_timeout:
- * @cell_pattern: the #AgsCellPattern
+ * @refresh_entry: the #AgsRefreshEntry of the #AgsCellPattern
  *
  * Queue draw led.
  *
@@ -937,8 +942,12 @@ ags_cell_pattern_blink_worker(void *data)
  * Since: 0.7.53
  */
 gboolean
-ags_cell_pattern_led_queue_draw_timeout(AgsCellPattern *cell_pattern)
+ags_cell_pattern_led_queue_draw_timeout(AgsRefreshEntry *refresh_entry)
 {
+  AgsCellPattern *cell_pattern;
+
+  cell_pattern = AGS_CELL_PATTERN(refresh_entry->widget);
+  
   if(g_hash_table_lookup(ags_cell_pattern_led_queue_draw,
 			 cell_pattern) != NULL){
     AgsMachine *machine;
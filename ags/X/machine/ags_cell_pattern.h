@@ -28,6 +28,8 @@
 
 #include <ags/widget/ags_hled_array.h>
 
+#include <ags/X/ags_refresh_scheduler.h>
+
 #define AGS_TYPE_CELL_PATTERN                (ags_cell_pattern_get_type())
 #define AGS_CELL_PATTERN(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_CELL_PATTERN, AgsCellPattern))
 #define AGS_CELL_PATTERN_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST((class), AGS_TYPE_CELL_PATTERN, AgsCellPatternClass))
@@ -110,7 +112,7 @@ void ags_cell_pattern_unpaint_gutter_point(AgsCellPattern *cell_pattern, guint j
 
 void* ags_cell_pattern_blink_worker(void *data);
 
-gboolean ags_cell_pattern_led_queue_draw_timeout(AgsCellPattern *cell_pattern);
+gboolean ags_cell_pattern_led_queue_draw_timeout(AgsRefreshEntry *refresh_entry);
 
 AgsCellPattern* ags_cell_pattern_new();
 
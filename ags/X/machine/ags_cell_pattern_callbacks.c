@@ -42,6 +42,7 @@
 #include <ags/audio/task/ags_toggle_pattern_bit.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_machine.h>
 
 #include <gdk/gdkkeysyms.h>
@@ -284,6 +285,10 @@ ags_cell_pattern_drawing_area_key_release_event(GtkWidget *widget, GdkEventKey *
 
     /* create start task */
     start_soundcard = ags_start_soundcard_new(application_context);
+
+    /* refresh indicators while playing */
+    ags_refresh_scheduler_start(ags_refresh_scheduler_get_instance());
+
     tasks = g_list_prepend(tasks,
 			   start_soundcard);
 
@@ -714,10 +714,10 @@ ags_drum_read(AgsFile *file, xmlNode *node, AgsPlugin *plugin)
 				   "reference\0", gobject,
 				   NULL));
 
-  list = file->lookup;
+  list = ags_file_find_lookup_by_node(file,
+				      node->parent);
 
-  while((list = ags_file_lookup_find_by_node(list,
-					     node->parent)) != NULL){
+  while(list != NULL){
     file_lookup = AGS_FILE_LOOKUP(list->data);
     
     if(g_signal_handler_find(list->data,
@@ -62,6 +62,7 @@
 #include <ags/widget/ags_vindicator.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_line_callbacks.h>
 #include <ags/X/ags_line_member.h>
 
@@ -213,7 +214,9 @@ ags_drum_input_line_init(AgsDrumInputLine *drum_input_line)
   AGS_LINE(drum_input_line)->indicator = widget;
   g_hash_table_insert(ags_line_indicator_queue_draw,
 		      widget, ags_line_indicator_queue_draw_timeout);
-  g_timeout_add(1000 / 30, (GSourceFunc) ags_line_indicator_queue_draw_timeout, (gpointer) widget);
+  ags_refresh_scheduler_add(ags_refresh_scheduler_get_instance(),
+			    (GtkWidget *) widget,
+			    (GSourceFunc) ags_line_indicator_queue_draw_timeout);
 
   adjustment = (GtkAdjustment *) gtk_adjustment_new(0.0, 0.0, 10.0, 1.0, 1.0, 10.0);
   g_object_set(widget,
@@ -413,6 +416,13 @@ ags_drum_input_line_map_recall(AgsLine *line,
   AgsStreamChannelRun *stream_channel_run;
 
   GList *list;
+
+  gchar *plugin_name[] = {
+    "ags-volume\0",
+    "ags-stream\0",
+    NULL,
+  };
+  
   guint i;
 
   if((AGS_LINE_MAPPED_RECALL & (line->flags)) != 0 ||
@@ -488,29 +498,16 @@ ags_drum_input_line_map_recall(AgsLine *line,
     list = list->next;
   }
 
-  /* ags-volume */
-  ags_recall_factory_create(audio,
-			    NULL, NULL,
-			    "ags-volume\0",
-			    source->audio_channel, source->audio_channel + 1, 
-			    source->pad, source->pad + 1,
-			    (AGS_RECALL_FACTORY_INPUT |
-			     AGS_RECALL_FACTORY_PLAY |
-			     AGS_RECALL_FACTORY_RECALL |
-			     AGS_RECALL_FACTORY_ADD),
-			    0);
-
-  /* ags-stream */
-  ags_recall_factory_create(audio,
-			    NULL, NULL,
-			    "ags-stream\0",
-			    source->audio_channel, source->audio_channel + 1, 
-			    source->pad, source->pad + 1,
-			    (AGS_RECALL_FACTORY_INPUT |
-			     AGS_RECALL_FACTORY_PLAY |
-			     AGS_RECALL_FACTORY_RECALL | 
-			     AGS_RECALL_FACTORY_ADD),
-			    0);
+  /* ags-volume and ags-stream */
+  g_list_free(ags_recall_factory_create_batch(audio,
+					      plugin_name,
+					      source->audio_channel, source->audio_channel + 1, 
+					      source->pad, source->pad + 1,
+					      (AGS_RECALL_FACTORY_INPUT |
+					       AGS_RECALL_FACTORY_PLAY |
+					       AGS_RECALL_FACTORY_RECALL |
+					       AGS_RECALL_FACTORY_ADD),
+					      0));
 
   /* set up dependencies */
   list = ags_recall_find_type(source->play, AGS_TYPE_PLAY_CHANNEL_RUN);
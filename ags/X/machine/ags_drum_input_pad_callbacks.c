@@ -52,6 +52,7 @@
 #include <ags/audio/file/ags_audio_file.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_line_callbacks.h>
 
 #include <math.h>
@@ -276,6 +277,10 @@ ags_drum_input_pad_open_play_callback(GtkToggleButton *toggle_button, AgsDrumInp
 
     /* create start task */
     start_soundcard = ags_start_soundcard_new(application_context);
+
+    /* refresh indicators while playing */
+    ags_refresh_scheduler_start(ags_refresh_scheduler_get_instance());
+
     tasks = g_list_prepend(tasks, start_soundcard);
 
     ags_task_thread_append_tasks(task_thread,
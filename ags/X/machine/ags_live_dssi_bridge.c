@@ -62,6 +62,7 @@
 #include <ags/widget/ags_dial.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_effect_bridge.h>
 #include <ags/X/ags_effect_bulk.h>
 #include <ags/X/ags_bulk_member.h>
@@ -1468,7 +1469,9 @@ ags_live_dssi_bridge_load(AgsLiveDssiBridge *live_dssi_bridge)
 			    child_widget, ags_effect_bulk_indicator_queue_draw_timeout);
 	effect_bulk->queued_drawing = g_list_prepend(effect_bulk->queued_drawing,
 						     child_widget);
-	g_timeout_add(1000 / 30, (GSourceFunc) ags_effect_bulk_indicator_queue_draw_timeout, (gpointer) child_widget);
+	ags_refresh_scheduler_add(ags_refresh_scheduler_get_instance(),
+				  (GtkWidget *) child_widget,
+				  (GSourceFunc) ags_effect_bulk_indicator_queue_draw_timeout);
       }
 
       gtk_table_attach(effect_bulk->table,
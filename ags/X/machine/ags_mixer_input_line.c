@@ -34,6 +34,7 @@
 #include <ags/widget/ags_vindicator.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_line_callbacks.h>
 #include <ags/X/ags_line_member.h>
 
@@ -147,7 +148,9 @@ ags_mixer_input_line_init(AgsMixerInputLine *mixer_input_line)
   AGS_LINE(mixer_input_line)->indicator = widget;
   g_hash_table_insert(ags_line_indicator_queue_draw,
 		      widget, ags_line_indicator_queue_draw_timeout);
-  g_timeout_add(1000 / 30, (GSourceFunc) ags_line_indicator_queue_draw_timeout, (gpointer) widget);
+  ags_refresh_scheduler_add(ags_refresh_scheduler_get_instance(),
+			    (GtkWidget *) widget,
+			    (GSourceFunc) ags_line_indicator_queue_draw_timeout);
 
   adjustment = (GtkAdjustment *) gtk_adjustment_new(0.0, 0.0, 10.0, 1.0, 1.0, 10.0);
   g_object_set(widget,
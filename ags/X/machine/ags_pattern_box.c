@@ -37,6 +37,7 @@
 #include <ags/audio/thread/ags_audio_loop.h>
 
 #include <ags/X/ags_window.h>
+#include <ags/X/ags_refresh_scheduler.h>
 #include <ags/X/ags_machine.h>
 #include <ags/X/ags_pad.h>
 #include <ags/X/ags_line.h>
@@ -262,7 +263,9 @@ ags_pattern_box_init(AgsPatternBox *pattern_box)
 
   g_hash_table_insert(ags_pattern_box_led_queue_draw,
 		      pattern_box, ags_pattern_box_led_queue_draw_timeout);
-  g_timeout_add(1000 / 30, (GSourceFunc) ags_pattern_box_led_queue_draw_timeout, (gpointer) pattern_box);
+  ags_refresh_scheduler_add(ags_refresh_scheduler_get_instance(),
+			    (GtkWidget *) pattern_box,
+			    (GSourceFunc) ags_pattern_box_led_queue_draw_timeout);
 
   /* pattern */
   pattern_box->pattern = (GtkHBox *) gtk_hbox_new(FALSE, 0);
@@ -314,6 +317,8 @@ ags_pattern_box_finalize(GObject *gobject)
 {
   g_hash_table_remove(ags_pattern_box_led_queue_draw,
 		      gobject);
+  ags_refresh_scheduler_remove(ags_refresh_scheduler_get_instance(),
+			       (GtkWidget *) gobject);
 
   G_OBJECT_CLASS(ags_pattern_box_parent_class)->finalize(gobject);
 }
@@ -768,7 +773,7 @@ ags_pattern_box_set_pattern(AgsPatternBox *pattern_box)
 
 /**
  * ags_pattern_box_led_queue_draw_timeout:
- * @pattern_box: the #AgsPatternBox
+ * @refresh_entry: the #AgsRefreshEntry of the #AgsPatternBox
  *
  * Queue draw led.
  *
@@ -777,8 +782,12 @@ ags_pattern_box_set_pattern(AgsPatternBox *pattern_box)
  * Since: 0.7.53
  */
 gboolean
-ags_pattern_box_led_queue_draw_timeout(AgsPatternBox *pattern_box)
+ags_pattern_box_led_queue_draw_timeout(AgsRefreshEntry *refresh_entry)
 {
+  AgsPatternBox *pattern_box;
+
+  pattern_box = AGS_PATTERN_BOX(refresh_entry->widget);
+  
   if(g_hash_table_lookup(ags_pattern_box_led_queue_draw,
 			 pattern_box) != NULL){
     AgsMachine *machine;
@@ -26,6 +26,8 @@
 
 #include <ags/widget/ags_hled_array.h>
 
+#include <ags/X/ags_refresh_scheduler.h>
+
 #define AGS_TYPE_PATTERN_BOX                (ags_pattern_box_get_type())
 #define AGS_PATTERN_BOX(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_PATTERN_BOX, AgsPatternBox))
 #define AGS_PATTERN_BOX_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST((class), AGS_TYPE_PATTERN_BOX, AgsPatternBoxClass))
@@ -93,7 +95,7 @@ struct _AgsPatternBoxClass
 
 GType ags_pattern_box_get_type(void);
 
-gboolean ags_pattern_box_led_queue_draw_timeout(AgsPatternBox *pattern_box);
+gboolean ags_pattern_box_led_queue_draw_timeout(AgsRefreshEntry *refresh_entry);
 
 void ags_pattern_box_set_pattern(AgsPatternBox *pattern_box);
 
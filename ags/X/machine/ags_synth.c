@@ -52,6 +52,7 @@
 #include <ags/audio/recall/ags_count_beats_audio.h>
 #include <ags/audio/recall/ags_count_beats_audio_run.h>
 #include <ags/audio/recall/ags_play_notation_audio_run.h>
+#include <ags/audio/recall/ags_oscillator_channel.h>
 
 #include <ags/audio/task/ags_clear_audio_signal.h>
 #include <ags/audio/task/ags_apply_synth.h>
@@ -409,6 +410,24 @@ ags_synth_map_recall(AgsMachine *machine)
      (AGS_MACHINE_PREMAPPED_RECALL & (machine->flags)) != 0){
     return;
   }
+
+  synth = AGS_SYNTH(machine);
+  
+  audio = machine->audio;
+
+  /* ags-oscillator */
+  ags_recall_factory_create(audio,
+			    NULL, NULL,
+			    "ags-oscillator\0",
+			    0, audio->audio_channels,
+			    0, audio->output_pads,
+			    (AGS_RECALL_FACTORY_OUTPUT |
+			     AGS_RECALL_FACTORY_PLAY |
+			     AGS_RECALL_FACTORY_RECALL | 
+			     AGS_RECALL_FACTORY_ADD),
+			    0);
+
+  ags_synth_update_lower(synth);
   
   AGS_MACHINE_CLASS(ags_synth_parent_class)->map_recall(machine);
 }
@@ -458,10 +477,10 @@ ags_synth_read(AgsFile *file, xmlNode *node, AgsPlugin *plugin)
   /* fix wrong flag */
   AGS_MACHINE(gobject)->flags &= (~AGS_MACHINE_IS_SYNTHESIZER);
   
-  list = file->lookup;
+  list = ags_file_find_lookup_by_node(file,
+				      node->parent);
 
-  while((list = ags_file_lookup_find_by_node(list,
-					     node->parent)) != NULL){
+  while(list != NULL){
     file_lookup = AGS_FILE_LOOKUP(list->data);
     
     if(g_signal_handler_find(list->data,
@@ -577,7 +596,25 @@ ags_synth_set_pads(AgsAudio *audio, GType type,
 		   guint pads, guint pads_old,
 		   AgsSynth *synth)
 {
-  /* empty */
+  if(type != AGS_TYPE_OUTPUT ||
+     pads <= pads_old ||
+     (AGS_MACHINE_MAPPED_RECALL & (AGS_MACHINE(synth)->flags)) == 0){
+    return;
+  }
+
+  /* ags-oscillator */
+  ags_recall_factory_create(audio,
+			    NULL, NULL,
+			    "ags-oscillator\0",
+			    0, audio->audio_channels,
+			    pads_old, pads,
+			    (AGS_RECALL_FACTORY_OUTPUT |
+			     AGS_RECALL_FACTORY_PLAY |
+			     AGS_RECALL_FACTORY_RECALL | 
+			     AGS_RECALL_FACTORY_ADD),
+			    0);
+
+  ags_synth_update_lower(synth);
 }
 
 void
@@ -608,6 +645,7 @@ ags_synth_update(AgsSynth *synth)
   gdouble frequency, phase, start_frequency;
   guint loop_start, loop_end;
   gdouble volume;
+  gboolean realtime;
 
   pthread_mutex_t *audio_mutex;
   pthread_mutex_t *channel_mutex;
@@ -710,11 +748,17 @@ ags_synth_update(AgsSynth *synth)
   channel = audio->output;
   output_lines = audio->output_lines;
 
+  /* voices rendered per period don't need the templates to be cleared */
+  realtime = (channel != NULL &&
+	      ags_recall_find_type(channel->play,
+				   AGS_TYPE_OSCILLATOR_CHANNEL) != NULL) ? TRUE: FALSE;
+  
   pthread_mutex_unlock(audio_mutex);
 
   task = NULL;
 
-  while(channel != NULL){
+  while(!realtime &&
+	channel != NULL){
     AgsAudioSignal *template;
     
     /* lookup channel mutex */
@@ -777,12 +821,68 @@ ags_synth_update(AgsSynth *synth)
   
   g_list_free(input_pad_start);
   
+  ags_synth_update_lower(synth);
+  
   gdk_threads_leave();
 
   ags_task_thread_append_tasks(task_thread,
 			       g_list_reverse(task));
 }
 
+/**
+ * ags_synth_update_lower:
+ * @synth: the #AgsSynth
+ *
+ * Apply the lower key of @synth to the ports of the ags-oscillator recalls,
+ * the voices pick it up with the next period.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_synth_update_lower(AgsSynth *synth)
+{
+  AgsOscillatorChannel *oscillator_channel;
+  AgsChannel *channel;
+
+  GList *list;
+
+  GValue value = {0,};
+
+  g_value_init(&value, G_TYPE_FLOAT);
+  g_value_set_float(&value,
+		    (gfloat) gtk_spin_button_get_value(synth->lower));
+
+  channel = AGS_MACHINE(synth)->audio->output;
+
+  while(channel != NULL){
+    /* play */
+    list = channel->play;
+
+    while((list = ags_recall_find_type(list, AGS_TYPE_OSCILLATOR_CHANNEL)) != NULL){
+      oscillator_channel = AGS_OSCILLATOR_CHANNEL(list->data);
+      ags_port_safe_write(oscillator_channel->lower,
+			  &value);
+
+      list = list->next;
+    }
+
+    /* recall */
+    list = channel->recall;
+
+    while((list = ags_recall_find_type(list, AGS_TYPE_OSCILLATOR_CHANNEL)) != NULL){
+      oscillator_channel = AGS_OSCILLATOR_CHANNEL(list->data);
+      ags_port_safe_write(oscillator_channel->lower,
+			  &value);
+
+      list = list->next;
+    }
+
+    channel = channel->next;
+  }
+
+  g_value_unset(&value);
+}
+
 /**
  * ags_synth_new:
  * @soundcard: the assigned soundcard.
@@ -70,6 +70,7 @@ struct _AgsSynthClass
 GType ags_synth_get_type(void);
 
 void ags_synth_update(AgsSynth *synth);
+void ags_synth_update_lower(AgsSynth *synth);
 
 AgsSynth* ags_synth_new(GObject *soundcard);
 
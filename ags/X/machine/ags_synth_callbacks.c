@@ -45,6 +45,7 @@ ags_synth_parent_set_callback(GtkWidget *widget, GtkObject *old_parent, AgsSynth
 void
 ags_synth_lower_callback(GtkSpinButton *spin_button, AgsSynth *synth)
 {
+  ags_synth_update_lower(synth);
 }
 
 void
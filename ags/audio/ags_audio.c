@@ -1903,10 +1903,13 @@ ags_audio_add_to_registry(AgsConnectable *connectable)
   server = ags_service_provider_get_server(AGS_SERVICE_PROVIDER(application_context));
 
   entry = ags_registry_entry_alloc(server->registry);
-  g_value_set_object(&(entry->entry),
-		     (gpointer) audio);
-  ags_registry_add(server->registry,
-		   entry);
+
+  if(entry != NULL){
+    g_value_set_object(&(entry->entry),
+		       (gpointer) audio);
+    ags_registry_add(server->registry,
+		     entry);
+  }
 
   /* add play */
   list = audio->play;
@@ -2429,6 +2432,9 @@ ags_audio_real_set_audio_channels(AgsAudio *audio,
   auto void ags_audio_set_audio_channels_shrink_automation();
   
   void ags_audio_set_audio_channels_init_parameters(GType type){
+    set_sync_link = FALSE;
+    set_async_link = FALSE;
+
     if(type == AGS_TYPE_OUTPUT){
       link_recycling = FALSE;
 
@@ -2472,7 +2478,8 @@ ags_audio_real_set_audio_channels(AgsAudio *audio,
   }
   
   void ags_audio_set_audio_channels_grow(GType type){
-    AgsChannel *channel, *start, *current, *pad_next;
+    AgsChannel *channel, *start, *current, *prev, *pad_next, *input;
+    AgsChannel **pad_prev, **input_first, **input_last;
     AgsRecycling *first_recycling, *last_recycling;
 	  
     guint pads;
@@ -2490,14 +2497,58 @@ ags_audio_real_set_audio_channels(AgsAudio *audio,
       start = audio->input;
     }
 
+    /* the neighbours are tracked while walking, the list is never searched */
+    pad_prev = (AgsChannel **) malloc(audio_channels * sizeof(AgsChannel *));
+
+    for(i = 0; i < audio_channels; i++){
+      pad_prev[i] = NULL;
+    }
+
+    input_first = NULL;
+    input_last = NULL;
+
+    input = NULL;
+
+    if(set_sync_link){
+      input = audio->input;
+    }else if(set_async_link){
+      input_first = (AgsChannel **) malloc(audio_channels * sizeof(AgsChannel *));
+      input_last = (AgsChannel **) malloc(audio_channels * sizeof(AgsChannel *));
+
+      current = audio->input;
+
+      for(i = 0; i < audio_channels; i++){
+	input_first[i] = current;
+
+	if(current != NULL){
+	  input_last[i] = ags_channel_pad_last(current);
+
+	  current = current->next;
+	}else{
+	  input_last[i] = NULL;
+	}
+      }
+    }
+
+    current = start;
+    prev = NULL;
+    
     /* grow */
     for(j = 0; j < pads; j++){
-      if(audio_channels_old != 0){
-	pad_next = ags_channel_nth(start, j * audio_channels)->next_pad;
-      }else{
-	pad_next = NULL;
+      /* skip present channels of pad */
+      for(i = 0; i < audio_channels_old && current != NULL; i++){
+	current->line = j * audio_channels + i;
+
+	prev = current;
+	current = current->next;
+
+	if(input != NULL){
+	  input = input->next;
+	}
       }
 
+      pad_next = current;
+
       for(i = audio_channels_old; i < audio_channels; i++){
 	channel = (AgsChannel *) g_object_new(type,
 					      "audio\0", (GObject *) audio,
@@ -2517,34 +2568,32 @@ ags_audio_real_set_audio_channels(AgsAudio *audio,
 	  }
 	}
 
-	if(j * audio_channels + i != 0){
+	if(i == audio_channels - 1){
+	  channel->next = pad_next;
+	}
+
+	if(prev != NULL){
 	  /* set prev */
-	  channel->prev = ags_channel_nth(start, j * audio_channels + i - 1);
+	  channel->prev = prev;
 
 	  pthread_mutex_lock(application_mutex);
 	  
 	  prev_mutex = ags_mutex_manager_lookup(mutex_manager,
-						(GObject *) channel->prev);
+						(GObject *) prev);
 	  
 	  pthread_mutex_unlock(application_mutex);
 	  
 	  pthread_mutex_lock(prev_mutex);  
 
-	  if(audio_channels_old != 0 &&
-	     i == audio_channels - 1){
-	    channel->next = pad_next;
-	  }
-	  
-	  channel->prev->next = channel;
+	  prev->next = channel;
 
 	  pthread_mutex_unlock(prev_mutex);
 	}
 
-	if(j != 0){
+	if(j != 0 &&
+	   pad_prev[i] != NULL){
 	  /* set prev pad */
-	  channel->prev_pad = ags_channel_pad_nth(ags_channel_nth(start,
-								  i),
-						  j - 1);
+	  channel->prev_pad = pad_prev[i];
 
 	  pthread_mutex_lock(application_mutex);
 	  
@@ -2560,10 +2609,13 @@ ags_audio_real_set_audio_channels(AgsAudio *audio,
 	  pthread_mutex_unlock(prev_pad_mutex);
 	}
 
+	pad_prev[i] = channel;
+	prev = channel;
+
 	/* set indices */
 	channel->pad = j;
 	channel->audio_channel = i;
-	channel->line = j * audio->audio_channels + i;
+	channel->line = j * audio_channels + i;
 
 	/* reset nested AgsRecycling tree */
 	if(alloc_recycling){
@@ -2578,11 +2630,6 @@ ags_audio_real_set_audio_channels(AgsAudio *audio,
 				    first_recycling, last_recycling,
 				    TRUE, TRUE);
 	}else if(set_sync_link){
-	  AgsChannel *input;
-
-	  input = ags_channel_nth(audio->input,
-				  channel->line);
-	  
 	  /* set sync link */
 	  if(input != NULL){
 	    first_recycling = input->first_recycling;
@@ -2591,19 +2638,14 @@ ags_audio_real_set_audio_channels(AgsAudio *audio,
 	    ags_channel_set_recycling(channel,
 				      first_recycling, last_recycling,
 				      TRUE, TRUE);
+
+	    input = input->next;
 	  }
 	}else if(set_async_link){
-	  AgsChannel *input, *input_pad_last;
-
-	  input = ags_channel_nth(audio->input,
-				  i);
-
 	  /* set async link */
-	  if(input != NULL){
-	    input_pad_last = ags_channel_pad_last(input);
-
-	    first_recycling = input->first_recycling;
-	    last_recycling = input_pad_last->last_recycling;
+	  if(input_first[i] != NULL){
+	    first_recycling = input_first[i]->first_recycling;
+	    last_recycling = input_last[i]->last_recycling;
 	    
 	    ags_channel_set_recycling(channel,
 				      first_recycling, last_recycling,
@@ -2611,7 +2653,28 @@ ags_audio_real_set_audio_channels(AgsAudio *audio,
 	  }
 	}
       }
+
+      /* splice the present channels of the next pad */
+      if(pad_next != NULL){
+	pthread_mutex_lock(application_mutex);
+	  
+	current_mutex = ags_mutex_manager_lookup(mutex_manager,
+						 (GObject *) pad_next);
+	  
+	pthread_mutex_unlock(application_mutex);
+
+	pthread_mutex_lock(current_mutex);
+	
+	pad_next->prev = prev;
+
+	pthread_mutex_unlock(current_mutex);
+      }
     }
+
+    free(pad_prev);
+
+    free(input_first);
+    free(input_last);
   }
   
   void ags_audio_set_audio_channels_shrink_zero(){
@@ -3015,7 +3078,8 @@ ags_audio_real_set_pads(AgsAudio *audio,
   }
 
   void ags_audio_set_pads_grow(){
-    AgsChannel *start, *channel;
+    AgsChannel *start, *channel, *prev, *current, *input;
+    AgsChannel **pad_prev, **input_first, **input_last;
     AgsRecycling *first_recycling, *last_recycling;
 
     guint i, j;
@@ -3026,6 +3090,54 @@ ags_audio_real_set_pads(AgsAudio *audio,
       start = audio->input;
     }
 
+    /* find the last pad once, the neighbours are tracked while appending */
+    pad_prev = (AgsChannel **) malloc(audio->audio_channels * sizeof(AgsChannel *));
+
+    prev = NULL;
+    current = NULL;
+
+    if(start != NULL &&
+       pads_old > 0){
+      current = ags_channel_pad_nth(start,
+				    pads_old - 1);
+    }
+    
+    for(i = 0; i < audio->audio_channels; i++){
+      pad_prev[i] = current;
+
+      if(current != NULL){
+	prev = current;
+	current = current->next;
+      }
+    }
+
+    input_first = NULL;
+    input_last = NULL;
+
+    input = NULL;
+
+    if(set_sync_link){
+      input = ags_channel_nth(audio->input,
+			      pads_old * audio->audio_channels);
+    }else if(set_async_link){
+      input_first = (AgsChannel **) malloc(audio->audio_channels * sizeof(AgsChannel *));
+      input_last = (AgsChannel **) malloc(audio->audio_channels * sizeof(AgsChannel *));
+
+      current = audio->input;
+
+      for(i = 0; i < audio->audio_channels; i++){
+	input_first[i] = current;
+
+	if(current != NULL){
+	  input_last[i] = ags_channel_pad_last(current);
+
+	  current = current->next;
+	}else{
+	  input_last[i] = NULL;
+	}
+      }
+    }
+
     for(j = pads_old; j < pads; j++){
       for(i = 0; i < audio->audio_channels; i++){
 	channel = (AgsChannel *) g_object_new(type,
@@ -3047,29 +3159,28 @@ ags_audio_real_set_pads(AgsAudio *audio,
 	  }
 	}
 
-	if(j * audio->audio_channels + i != 0){
+	if(prev != NULL){
 	  /* set prev */
-	  channel->prev = ags_channel_nth(start, j * audio->audio_channels + i - 1);
+	  channel->prev = prev;
 	  
 	  pthread_mutex_lock(application_mutex);
 	  
 	  prev_mutex = ags_mutex_manager_lookup(mutex_manager,
-						(GObject *) channel->prev);
+						(GObject *) prev);
 	  
 	  pthread_mutex_unlock(application_mutex);
 	  
 	  pthread_mutex_lock(prev_mutex);
 	  
-	  channel->prev->next = channel;
+	  prev->next = channel;
 
 	  pthread_mutex_unlock(prev_mutex);
 	}
 	
-	if(j != 0){
+	if(j != 0 &&
+	   pad_prev[i] != NULL){
 	  /* set prev pad */
-	  channel->prev_pad = ags_channel_pad_nth(ags_channel_nth(start,
-								  i),
-						  j - 1);
+	  channel->prev_pad = pad_prev[i];
 
 	  pthread_mutex_lock(application_mutex);
 	  
@@ -3085,6 +3196,9 @@ ags_audio_real_set_pads(AgsAudio *audio,
 	  pthread_mutex_unlock(prev_pad_mutex);
 	}
 
+	pad_prev[i] = channel;
+	prev = channel;
+
 	/* set indices */
 	channel->pad = j;
 	channel->audio_channel = i;
@@ -3103,11 +3217,6 @@ ags_audio_real_set_pads(AgsAudio *audio,
 				    first_recycling, last_recycling,
 				    TRUE, TRUE);
 	}else if(set_sync_link){
-	  AgsChannel *input;
-
-	  input = ags_channel_nth(audio->input,
-				  channel->line);
-	  
 	  /* set sync link */
 	  if(input != NULL){
 	    first_recycling = input->first_recycling;
@@ -3116,19 +3225,14 @@ ags_audio_real_set_pads(AgsAudio *audio,
 	    ags_channel_set_recycling(channel,
 				      first_recycling, last_recycling,
 				      TRUE, TRUE);
+
+	    input = input->next;
 	  }
 	}else if(set_async_link){
-	  AgsChannel *input, *input_pad_last;
-
-	  input = ags_channel_nth(audio->input,
-				  i);
-
 	  /* set async link */
-	  if(input != NULL){
-	    input_pad_last = ags_channel_pad_last(input);
-
-	    first_recycling = input->first_recycling;
-	    last_recycling = input_pad_last->last_recycling;
+	  if(input_first[i] != NULL){
+	    first_recycling = input_first[i]->first_recycling;
+	    last_recycling = input_last[i]->last_recycling;
 	    
 	    ags_channel_set_recycling(channel,
 				      first_recycling, last_recycling,
@@ -3137,6 +3241,11 @@ ags_audio_real_set_pads(AgsAudio *audio,
 	}
       }
     }
+
+    free(pad_prev);
+
+    free(input_first);
+    free(input_last);
   }
 
   void ags_audio_set_pads_unlink_all(AgsChannel *channel){
@@ -3304,6 +3413,8 @@ ags_audio_real_set_pads(AgsAudio *audio,
 	note = note_next;
       }
 
+      notation->flags &= (~AGS_NOTATION_INDEXED);
+
       notation_i = notation_i->next;
     }
   }
@@ -3351,6 +3462,8 @@ ags_audio_real_set_pads(AgsAudio *audio,
       AgsPlaybackDomain *playback_domain;
       AgsChannel *current;
 
+      GList *list;
+
       guint i, j;
 
       /* instantiate notation */
@@ -3371,14 +3484,19 @@ ags_audio_real_set_pads(AgsAudio *audio,
 	current = ags_channel_pad_nth(current,
 				      pads_old);
 
+	list = NULL;
+	
 	for(j = pads_old; j < pads; j++){
 	  for(i = 0; i < audio->audio_channels; i++){
-	    playback_domain->playback = g_list_append(playback_domain->playback,
-						      current->playback);
+	    list = g_list_prepend(list,
+				  current->playback);
 	
 	    current = current->next;
 	  }
 	}
+
+	playback_domain->playback = g_list_concat(playback_domain->playback,
+						  g_list_reverse(list));
       }
     }else if(pads == 0){
       GList *list;
@@ -3416,6 +3534,8 @@ ags_audio_real_set_pads(AgsAudio *audio,
     }else if(pads < audio->output_pads){
       AgsPlaybackDomain *playback_domain;
 
+      GList *list;
+
       guint i;
       
       channel = audio->output;
@@ -3432,19 +3552,21 @@ ags_audio_real_set_pads(AgsAudio *audio,
 
 	playback_domain = AGS_PLAYBACK_DOMAIN(audio->playback_domain);
 
-	for(i = 0; i < audio->output_pads - pads; i++){
+	list = g_list_last(playback_domain->playback);
+	
+	for(i = 0; i < audio->output_pads - pads && list != NULL; i++){
 	  AgsPlayback *playback;
-	  GList *list;
+	  GList *list_prev;
 
-	  list = g_list_last(playback_domain->playback);
+	  list_prev = list->prev;
+	  
+	  playback = list->data;
+	  playback_domain->playback = g_list_delete_link(playback_domain->playback,
+							 list);
+	  g_object_run_dispose(playback);
+	  g_object_unref(playback);
 
-	  if(list != NULL){
-	    playback = list->data;
-	    playback_domain->playback = g_list_remove(playback_domain->playback,
-						      playback);
-	    g_object_run_dispose(playback);
-	    g_object_unref(playback);
-	  }
+	  list = list_prev;
 	}
       }
     }
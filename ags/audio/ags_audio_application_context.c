@@ -40,6 +40,8 @@
 #include <ags/thread/ags_thread-posix.h>
 #include <ags/thread/ags_thread_pool.h>
 #include <ags/thread/ags_task_thread.h>
+#include <ags/thread/ags_history.h>
+#include <ags/thread/ags_destroy_worker.h>
 
 #include <ags/audio/ags_sound_provider.h>
 #include <ags/audio/ags_devout.h>
@@ -307,6 +309,7 @@ ags_audio_application_context_init(AgsAudioApplicationContext *audio_application
   AgsThread *soundcard_thread;
   AgsThread *sequencer_thread;
   AgsThread *export_thread;
+  AgsDestroyWorker *destroy_worker;
   
   AgsConfig *config;
 
@@ -613,6 +616,9 @@ ags_audio_application_context_init(AgsAudioApplicationContext *audio_application
   g_object_ref(audio_loop);
   ags_connectable_connect(AGS_CONNECTABLE(audio_loop));
 
+  /* AgsHistory */
+  AGS_APPLICATION_CONTEXT(audio_application_context)->history = (GObject *) ags_history_new();
+
   /* AgsTaskThread */
   AGS_APPLICATION_CONTEXT(audio_application_context)->task_thread = (GObject *) ags_task_thread_new();
   ags_main_loop_set_async_queue(AGS_MAIN_LOOP(audio_loop),
@@ -623,6 +629,13 @@ ags_audio_application_context_init(AgsAudioApplicationContext *audio_application
 
   /* AgsWorkerThread */
   audio_application_context->worker = NULL;
+
+  /* AgsDestroyWorker */
+  destroy_worker = ags_destroy_worker_new();
+  g_object_ref(destroy_worker);
+  audio_application_context->worker = g_list_prepend(audio_application_context->worker,
+						     destroy_worker);
+  ags_thread_start((AgsThread *) destroy_worker);
   
   /* AgsSoundcardThread */
   audio_application_context->soundcard_thread = NULL;
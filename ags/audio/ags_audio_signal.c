@@ -34,6 +34,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include <string.h>
+#include <pthread.h>
 
 /**
  * SECTION:ags_audio_signal
@@ -64,6 +65,11 @@ void ags_audio_signal_finalize(GObject *gobject);
 
 void ags_audio_signal_real_realloc_buffer_size(AgsAudioSignal *audio_signal, guint buffer_size);
 
+GList* ags_audio_signal_cursor_seek(AgsAudioSignal *audio_signal,
+				    guint position);
+void ags_audio_signal_cursor_fill(AgsAudioSignal *audio_signal,
+				  void *buffer);
+
 enum{
   PROP_0,
   PROP_SOUNDCARD,
@@ -95,6 +101,9 @@ enum{
 static gpointer ags_audio_signal_parent_class = NULL;
 static guint audio_signal_signals[LAST_SIGNAL];
 
+static pthread_mutex_t ags_audio_signal_stream_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t ags_audio_signal_stream_cond = PTHREAD_COND_INITIALIZER;
+
 GType
 ags_audio_signal_get_type(void)
 {
@@ -511,8 +520,7 @@ void
 ags_audio_signal_init(AgsAudioSignal *audio_signal)
 {
   AgsConfig *config;
-  
-  gchar *str;
+  AgsConfigSnapshot *snapshot;
   
   audio_signal->flags = 0;
 
@@ -523,65 +531,15 @@ ags_audio_signal_init(AgsAudioSignal *audio_signal)
 
   config = ags_config_get_instance();
 
-  /* samplerate */
-  str = ags_config_get_value(config,
-			     AGS_CONFIG_SOUNDCARD,
-			     "samplerate\0");
+  /* samplerate, buffer-size and format */
+  snapshot = ags_config_get_snapshot(config);
   
-  if(str == NULL){
-    str = ags_config_get_value(config,
-			       AGS_CONFIG_SOUNDCARD_0,
-			       "samplerate\0");
-  }  
-
-  if(str != NULL){
-    audio_signal->samplerate = g_ascii_strtoull(str,
-						NULL,
-						10);
-    free(str);
-  }else{
-    audio_signal->samplerate = AGS_SOUNDCARD_DEFAULT_SAMPLERATE;
-  }
+  audio_signal->samplerate = snapshot->samplerate;
+  audio_signal->buffer_size = snapshot->buffer_size;
+  audio_signal->format = snapshot->format;
 
-  /* buffer-size */
-  str = ags_config_get_value(config,
-			     AGS_CONFIG_SOUNDCARD,
-			     "buffer-size\0");
-
-  if(str == NULL){
-    str = ags_config_get_value(config,
-			       AGS_CONFIG_SOUNDCARD_0,
-			       "buffer-size\0");
-  }
-  
-  if(str != NULL){
-    audio_signal->buffer_size = g_ascii_strtoull(str,
-						 NULL,
-						 10);
-    free(str);
-  }else{
-    audio_signal->buffer_size = AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE;
-  }
-
-  /* format */
-  str = ags_config_get_value(config,
-			     AGS_CONFIG_SOUNDCARD,
-			     "format\0");
-
-  if(str == NULL){
-    str = ags_config_get_value(config,
-			       AGS_CONFIG_SOUNDCARD_0,
-			       "format\0");
-  }
-  
-  if(str != NULL){
-    audio_signal->format = g_ascii_strtoull(str,
-					    NULL,
-					    10);
-    free(str);
-  }else{
-    audio_signal->format = AGS_SOUNDCARD_SIGNED_16_BIT;
-  }
+  ags_config_release_snapshot(config,
+			      snapshot);
 
   /*  */
   audio_signal->length = 0;
@@ -597,6 +555,18 @@ ags_audio_signal_init(AgsAudioSignal *audio_signal)
   audio_signal->stream_beginning = NULL;
   audio_signal->stream_current = NULL;
   audio_signal->stream_end = NULL;
+  audio_signal->stream_generation = 0;
+  audio_signal->stream_loaded = 0;
+
+  audio_signal->template = NULL;
+  
+  audio_signal->cursor_offset = 0;
+  audio_signal->cursor_frame = 0;
+
+  audio_signal->cursor_stream = NULL;
+  audio_signal->cursor_position = 0;
+  audio_signal->cursor_loop = NULL;
+  audio_signal->cursor_generation = 0;
 
   audio_signal->note = NULL;
 }
@@ -687,6 +657,11 @@ ags_audio_signal_set_property(GObject *gobject,
 	g_object_ref(recall_id);
 
       audio_signal->recall_id = recall_id;
+
+      if(audio_signal->recycling != NULL){
+	ags_recycling_reindex_audio_signal(AGS_RECYCLING(audio_signal->recycling),
+					   audio_signal);
+      }
     }
     break;
   case PROP_SAMPLERATE:
@@ -1003,6 +978,13 @@ ags_audio_signal_dispose(GObject *gobject)
     audio_signal->recall_id = NULL;
   }
 
+  /* template */
+  if(audio_signal->template != NULL){
+    g_object_unref(audio_signal->template);
+
+    audio_signal->template = NULL;
+  }
+
   /* note */
   if(audio_signal->note != NULL){
     g_object_unref(audio_signal->note);
@@ -1066,6 +1048,11 @@ ags_audio_signal_finalize(GObject *gobject)
 		     (GDestroyNotify) ags_stream_free);
   }
 
+  /* template */
+  if(audio_signal->template != NULL){
+    g_object_unref(audio_signal->template);
+  }
+
   /* note */
   if(audio_signal->note != NULL){
     g_object_unref(audio_signal->note);
@@ -1169,6 +1156,9 @@ ags_audio_signal_set_buffer_size(AgsAudioSignal *audio_signal, guint buffer_size
 {
   GList *stream;
 
+  ags_audio_signal_wait_stream(audio_signal,
+			       audio_signal->length);
+
   stream = audio_signal->stream_beginning;
 
   while(stream != NULL){
@@ -1227,6 +1217,9 @@ ags_audio_signal_set_format(AgsAudioSignal *audio_signal, guint format)
 {
   GList *stream;
 
+  ags_audio_signal_wait_stream(audio_signal,
+			       audio_signal->length);
+
   stream = audio_signal->stream_beginning;
 
   while(stream != NULL){
@@ -1357,6 +1350,9 @@ ags_audio_signal_stream_resize(AgsAudioSignal *audio_signal, guint length)
 {
   guint i;
 
+  ags_audio_signal_wait_stream(audio_signal,
+			       audio_signal->length);
+
   if(audio_signal->length < length){
     GList *stream, *end_old;
     signed short *buffer;
@@ -1415,6 +1411,11 @@ ags_audio_signal_stream_resize(AgsAudioSignal *audio_signal, guint length)
 		     g_free);
   }
 
+  /* invalidate the nodes cached by cursors */
+  if(audio_signal->length != length){
+    audio_signal->stream_generation++;
+  }
+  
   audio_signal->length = length;
 }
 
@@ -1452,6 +1453,9 @@ ags_audio_signal_real_realloc_buffer_size(AgsAudioSignal *audio_signal, guint bu
   guint counter;
   guint i_old, i_current;
   
+  ags_audio_signal_wait_stream(audio_signal,
+			       audio_signal->length);
+
   old = audio_signal->stream_beginning;
   old_buffer_size = audio_signal->buffer_size;
 
@@ -1495,6 +1499,8 @@ ags_audio_signal_real_realloc_buffer_size(AgsAudioSignal *audio_signal, guint bu
   
   audio_signal->stream_end = current;
   audio_signal->stream_beginning = g_list_reverse(current);
+
+  audio_signal->stream_generation++;
 }
 
 /**
@@ -1565,6 +1571,9 @@ ags_audio_signal_duplicate_stream(AgsAudioSignal *audio_signal,
     }
   }
 
+  ags_audio_signal_wait_stream(template,
+			       template->length);
+
   if(template->stream_beginning == NULL){
     ags_audio_signal_stream_resize(audio_signal,
 				   0);
@@ -1626,6 +1635,410 @@ ags_audio_signal_duplicate_stream(AgsAudioSignal *audio_signal,
   }
 }
 
+/**
+ * ags_audio_signal_duplicate_stream_with_offset:
+ * @audio_signal: destination #AgsAudioSignal
+ * @template: source #AgsAudioSignal
+ * @offset: the frame the copy starts at
+ * 
+ * Copy stream of one audio signal to another, delayed by @offset frames. The
+ * leading frames stay silent and the stream grows by the buffers needed to
+ * hold the shifted data.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_audio_signal_duplicate_stream_with_offset(AgsAudioSignal *audio_signal,
+					      AgsAudioSignal *template,
+					      guint offset)
+{
+  GList *template_stream, *stream;
+
+  guint buffer_size;
+  guint frame;
+  guint copy_mode;
+
+  if(offset == 0 ||
+     template == NULL ||
+     template->stream_beginning == NULL){
+    ags_audio_signal_duplicate_stream(audio_signal,
+				      template);
+    
+    return;
+  }
+
+  ags_audio_signal_wait_stream(template,
+			       template->length);
+
+  buffer_size = template->buffer_size;
+  
+  audio_signal->buffer_size = buffer_size;
+  ags_audio_signal_stream_resize(audio_signal,
+				 (template->length * buffer_size + offset + buffer_size - 1) / buffer_size);
+
+  stream = g_list_nth(audio_signal->stream_beginning,
+		      offset / buffer_size);
+  template_stream = template->stream_beginning;
+
+  frame = offset % buffer_size;
+  
+  copy_mode = ags_audio_buffer_util_get_copy_mode(ags_audio_buffer_util_format_from_soundcard(audio_signal->format),
+						  ags_audio_buffer_util_format_from_soundcard(template->format));
+
+  /* each template buffer spans the tail of one and the head of the next buffer */
+  while(template_stream != NULL &&
+	stream != NULL){
+    ags_audio_buffer_util_copy_buffer_to_buffer(stream->data, 1, frame,
+						template_stream->data, 1, 0,
+						buffer_size - frame, copy_mode);
+
+    if(frame != 0 &&
+       stream->next != NULL){
+      ags_audio_buffer_util_copy_buffer_to_buffer(stream->next->data, 1, 0,
+						  template_stream->data, 1, buffer_size - frame,
+						  frame, copy_mode);
+    }
+    
+    stream = stream->next;
+    template_stream = template_stream->next;
+  }
+}
+
+GList*
+ags_audio_signal_cursor_seek(AgsAudioSignal *audio_signal,
+			     guint position)
+{
+  AgsAudioSignal *template;
+  
+  template = audio_signal->template;
+
+  /* the template was resized, cached nodes might be freed */
+  if(audio_signal->cursor_generation != template->stream_generation){
+    audio_signal->cursor_stream = NULL;
+
+    if(audio_signal->loop_end > audio_signal->loop_start){
+      audio_signal->cursor_loop = g_list_nth(template->stream_beginning,
+					     (audio_signal->loop_start - audio_signal->cursor_offset) / template->buffer_size);
+    }
+    
+    audio_signal->cursor_generation = template->stream_generation;
+  }
+  
+  if(audio_signal->cursor_stream != NULL){
+    if(audio_signal->cursor_position == position){
+      return(audio_signal->cursor_stream);
+    }
+
+    if(audio_signal->cursor_position + 1 == position){
+      audio_signal->cursor_stream = audio_signal->cursor_stream->next;
+      audio_signal->cursor_position = position;
+
+      return(audio_signal->cursor_stream);
+    }
+  }
+
+  /* wrap to the loop start */
+  if(audio_signal->cursor_loop != NULL &&
+     (audio_signal->loop_start - audio_signal->cursor_offset) / template->buffer_size == position){
+    audio_signal->cursor_stream = audio_signal->cursor_loop;
+  }else{
+    audio_signal->cursor_stream = g_list_nth(template->stream_beginning,
+					     position);
+  }
+  
+  audio_signal->cursor_position = position;
+
+  return(audio_signal->cursor_stream);
+}
+
+void
+ags_audio_signal_cursor_fill(AgsAudioSignal *audio_signal,
+			     void *buffer)
+{
+  AgsAudioSignal *template;
+
+  GList *template_stream;
+  
+  guint buffer_size;
+  guint template_frame_count;
+  guint loop_start, loop_end;
+  guint end;
+  guint frame, position, template_frame;
+  guint copy_n_frames;
+  guint copy_mode;
+  guint i;
+  gboolean do_loop;
+  
+  template = audio_signal->template;
+  buffer_size = audio_signal->buffer_size;
+
+  template_frame_count = template->length * template->buffer_size;
+  end = audio_signal->cursor_offset + audio_signal->frame_count;
+
+  /* loop region relative to the template */
+  do_loop = (audio_signal->loop_end > audio_signal->loop_start) ? TRUE: FALSE;
+
+  loop_start = audio_signal->loop_start - audio_signal->cursor_offset;
+  loop_end = audio_signal->loop_end - audio_signal->cursor_offset;
+
+  copy_mode = ags_audio_buffer_util_get_copy_mode(ags_audio_buffer_util_format_from_soundcard(audio_signal->format),
+						  ags_audio_buffer_util_format_from_soundcard(template->format));
+  
+  for(i = 0; i < buffer_size;){
+    frame = audio_signal->cursor_frame + i;
+
+    if(frame >= end){
+      break;
+    }
+
+    /* silence till the offset */
+    if(frame < audio_signal->cursor_offset){
+      i += ((audio_signal->cursor_offset - frame < buffer_size - i) ? audio_signal->cursor_offset - frame: buffer_size - i);
+
+      continue;
+    }
+
+    position = frame - audio_signal->cursor_offset;
+
+    if(do_loop &&
+       position >= loop_end){
+      template_frame = loop_start + ((position - loop_start) % (loop_end - loop_start));
+    }else{
+      template_frame = position;
+    }
+
+    if(template_frame >= template_frame_count){
+      break;
+    }
+
+    /* compute count of frames to copy */
+    copy_n_frames = buffer_size - i;
+
+    if(end - frame < copy_n_frames){
+      copy_n_frames = end - frame;
+    }
+
+    if(template_frame_count - template_frame < copy_n_frames){
+      copy_n_frames = template_frame_count - template_frame;
+    }
+    
+    if(do_loop &&
+       template_frame < loop_end &&
+       loop_end - template_frame < copy_n_frames){
+      copy_n_frames = loop_end - template_frame;
+    }
+
+    if(template->buffer_size - (template_frame % template->buffer_size) < copy_n_frames){
+      copy_n_frames = template->buffer_size - (template_frame % template->buffer_size);
+    }
+
+    /* copy, the tail of a streamed template might not be read yet */
+    ags_audio_signal_wait_stream(template,
+				 template_frame / template->buffer_size + 1);
+    
+    template_stream = ags_audio_signal_cursor_seek(audio_signal,
+						   template_frame / template->buffer_size);
+
+    if(template_stream == NULL){
+      break;
+    }
+    
+    ags_audio_buffer_util_copy_buffer_to_buffer(buffer, 1, i,
+						template_stream->data, 1, template_frame % template->buffer_size,
+						copy_n_frames, copy_mode);
+
+    i += copy_n_frames;
+  }
+
+  audio_signal->cursor_frame += buffer_size;
+}
+
+/**
+ * ags_audio_signal_open_cursor:
+ * @audio_signal: destination #AgsAudioSignal
+ * @template: source #AgsAudioSignal
+ * @offset: the frame the template starts at
+ * @frame_count: the count of frames to play after @offset
+ *
+ * Reference @template instead of copying it. The stream of @audio_signal is
+ * reduced to its first buffer, further buffers are filled on demand by
+ * ags_audio_signal_pull_stream(). The loop of @template is repeated until
+ * @frame_count is reached. The template's buffers are looked up again after
+ * it was resized, so hold the recycling's mutex while resizing or pulling.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_audio_signal_open_cursor(AgsAudioSignal *audio_signal,
+			     AgsAudioSignal *template,
+			     guint offset,
+			     guint frame_count)
+{
+  if(audio_signal == NULL ||
+     template == NULL){
+    return;
+  }
+
+  g_object_ref(template);
+  
+  if(audio_signal->template != NULL){
+    g_object_unref(audio_signal->template);
+  }
+
+  audio_signal->flags |= AGS_AUDIO_SIGNAL_CURSOR;
+
+  audio_signal->template = template;
+  
+  audio_signal->cursor_offset = offset;
+  audio_signal->cursor_frame = 0;
+
+  audio_signal->frame_count = frame_count;
+
+  /* loop */
+  if(template->loop_end > template->loop_start){
+    audio_signal->loop_start = offset + template->loop_start;
+    audio_signal->loop_end = offset + template->loop_end;
+  }else{
+    audio_signal->loop_start = 0;
+    audio_signal->loop_end = 0;
+  }
+
+  audio_signal->cursor_stream = NULL;
+  audio_signal->cursor_position = 0;
+  audio_signal->cursor_loop = NULL;
+  audio_signal->cursor_generation = template->stream_generation;
+
+  if(audio_signal->loop_end > audio_signal->loop_start){
+    audio_signal->cursor_loop = g_list_nth(template->stream_beginning,
+					   template->loop_start / template->buffer_size);
+  }
+
+  /* first buffer */
+  ags_audio_signal_stream_resize(audio_signal,
+				 1);
+
+  ags_audio_buffer_util_clear_buffer(audio_signal->stream_beginning->data, 1,
+				     audio_signal->buffer_size, ags_audio_buffer_util_format_from_soundcard(audio_signal->format));
+  ags_audio_signal_cursor_fill(audio_signal,
+			       audio_signal->stream_beginning->data);
+}
+
+/**
+ * ags_audio_signal_pull_stream:
+ * @audio_signal: the #AgsAudioSignal
+ *
+ * Fill the next buffer of an @audio_signal opened by
+ * ags_audio_signal_open_cursor(). Buffers already played are reused,
+ * so the stream stays a few buffers long.
+ *
+ * Returns: %TRUE if a buffer was appended, otherwise %FALSE
+ *
+ * Since: 0.7.136
+ */
+gboolean
+ags_audio_signal_pull_stream(AgsAudioSignal *audio_signal)
+{
+  GList *stream;
+  
+  if(audio_signal == NULL ||
+     (AGS_AUDIO_SIGNAL_CURSOR & (audio_signal->flags)) == 0 ||
+     audio_signal->template == NULL ||
+     audio_signal->cursor_frame >= audio_signal->cursor_offset + audio_signal->frame_count){
+    return(FALSE);
+  }
+
+  stream = audio_signal->stream_beginning;
+  
+  if(stream != NULL &&
+     audio_signal->stream_current != NULL &&
+     stream != audio_signal->stream_current &&
+     stream != audio_signal->stream_current->prev){
+    /* move a played buffer to the end */
+    audio_signal->stream_beginning = stream->next;
+    audio_signal->stream_beginning->prev = NULL;
+
+    stream->prev = audio_signal->stream_end;
+    stream->next = NULL;
+    
+    audio_signal->stream_end->next = stream;
+    audio_signal->stream_end = stream;
+
+    ags_audio_buffer_util_clear_buffer(stream->data, 1,
+				       audio_signal->buffer_size, ags_audio_buffer_util_format_from_soundcard(audio_signal->format));
+  }else{
+    ags_audio_signal_add_stream(audio_signal);
+  }
+
+  ags_audio_signal_cursor_fill(audio_signal,
+			       audio_signal->stream_end->data);
+
+  return(TRUE);
+}
+
+/**
+ * ags_audio_signal_set_stream_loaded:
+ * @audio_signal: the template #AgsAudioSignal
+ * @stream_loaded: the count of buffers filled from the beginning
+ *
+ * Publish the buffers of a template filled in the background while
+ * %AGS_AUDIO_SIGNAL_STREAM is set. As @stream_loaded reaches the length
+ * the flag is cleared. Threads blocked in ags_audio_signal_wait_stream()
+ * are woken up.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_audio_signal_set_stream_loaded(AgsAudioSignal *audio_signal,
+				   guint stream_loaded)
+{
+  pthread_mutex_lock(&ags_audio_signal_stream_mutex);
+
+  g_atomic_int_set(&(audio_signal->stream_loaded),
+		   stream_loaded);
+
+  if(stream_loaded >= audio_signal->length){
+    g_atomic_int_and(&(audio_signal->flags),
+		     (~AGS_AUDIO_SIGNAL_STREAM));
+  }
+
+  pthread_cond_broadcast(&ags_audio_signal_stream_cond);
+  
+  pthread_mutex_unlock(&ags_audio_signal_stream_mutex);
+}
+
+/**
+ * ags_audio_signal_wait_stream:
+ * @audio_signal: the template #AgsAudioSignal
+ * @stream_loaded: the count of buffers needed from the beginning
+ *
+ * Block until the first @stream_loaded buffers of a template filled in the
+ * background are readable. Returns at once if %AGS_AUDIO_SIGNAL_STREAM
+ * isn't set. Pass the length to wait for the whole stream before resizing
+ * or copying it.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_audio_signal_wait_stream(AgsAudioSignal *audio_signal,
+			     guint stream_loaded)
+{
+  if(audio_signal == NULL ||
+     (AGS_AUDIO_SIGNAL_STREAM & (g_atomic_int_get(&(audio_signal->flags)))) == 0 ||
+     g_atomic_int_get(&(audio_signal->stream_loaded)) >= stream_loaded){
+    return;
+  }
+
+  pthread_mutex_lock(&ags_audio_signal_stream_mutex);
+
+  while((AGS_AUDIO_SIGNAL_STREAM & (g_atomic_int_get(&(audio_signal->flags)))) != 0 &&
+	g_atomic_int_get(&(audio_signal->stream_loaded)) < stream_loaded){
+    pthread_cond_wait(&ags_audio_signal_stream_cond,
+		      &ags_audio_signal_stream_mutex);
+  }
+  
+  pthread_mutex_unlock(&ags_audio_signal_stream_mutex);
+}
+
 /**
  * ags_audio_signal_get_template:
  * @audio_signal: a #GList containing #AgsAudioSignal
@@ -1755,6 +2168,9 @@ ags_audio_signal_tile(AgsAudioSignal *audio_signal,
   soundcard = audio_signal->soundcard;
 
   audio_signal_stream = NULL;
+  ags_audio_signal_wait_stream(template,
+			       template->length);
+
   template_stream = template->stream_beginning;
 
   if(template_stream == NULL){
@@ -2338,6 +2754,9 @@ ags_audio_signal_scale(AgsAudioSignal *audio_signal,
     }
   }
 
+  ags_audio_signal_wait_stream(template,
+			       template->length);
+
   source = template->stream_beginning;
 
   if(template->samplerate < audio_signal->samplerate){
@@ -2544,6 +2963,9 @@ ags_audio_signal_feed(AgsAudioSignal *audio_signal,
     return;
   }
   
+  ags_audio_signal_wait_stream(template,
+			       template->length);
+
   old_length = audio_signal->length;
   old_last_frame = audio_signal->last_frame;
   old_frame_count = old_last_frame + (old_length * audio_signal->buffer_size) - audio_signal->first_frame;
@@ -2814,7 +3236,7 @@ ags_audio_signal_new_with_length(GObject *soundcard,
 						 "recall-id\0", recall_id,
 						 NULL);
 
-  template = ags_audio_signal_get_template(AGS_RECYCLING(recycling)->audio_signal);
+  template = ags_recycling_get_template(AGS_RECYCLING(recycling));
 
   if(template != NULL){
     ags_audio_signal_tile(audio_signal,
@@ -38,6 +38,8 @@ typedef enum{
   AGS_AUDIO_SIGNAL_TEMPLATE             = 1 <<  1,
   AGS_AUDIO_SIGNAL_PLAY_DONE            = 1 <<  2,
   AGS_AUDIO_SIGNAL_STANDALONE           = 1 <<  3,
+  AGS_AUDIO_SIGNAL_CURSOR               = 1 <<  4,
+  AGS_AUDIO_SIGNAL_STREAM               = 1 <<  5,
 }AgsAudioSignalFlags;
 
 struct _AgsAudioSignal
@@ -70,7 +72,19 @@ struct _AgsAudioSignal
   GList *stream_beginning;
   GList *stream_current;
   GList *stream_end;
+  guint stream_generation;
+  volatile guint stream_loaded;
 
+  AgsAudioSignal *template;
+  
+  guint cursor_offset;
+  guint cursor_frame;
+
+  GList *cursor_stream;
+  guint cursor_position;
+  GList *cursor_loop;
+  guint cursor_generation;
+  
   GObject *note;
 };
 
@@ -102,6 +116,20 @@ void ags_audio_signal_realloc_buffer_size(AgsAudioSignal *audio_signal, guint bu
 
 void ags_audio_signal_duplicate_stream(AgsAudioSignal *audio_signal,
 				       AgsAudioSignal *template);
+void ags_audio_signal_duplicate_stream_with_offset(AgsAudioSignal *audio_signal,
+						   AgsAudioSignal *template,
+						   guint offset);
+
+void ags_audio_signal_open_cursor(AgsAudioSignal *audio_signal,
+				  AgsAudioSignal *template,
+				  guint offset,
+				  guint frame_count);
+gboolean ags_audio_signal_pull_stream(AgsAudioSignal *audio_signal);
+
+void ags_audio_signal_set_stream_loaded(AgsAudioSignal *audio_signal,
+					guint stream_loaded);
+void ags_audio_signal_wait_stream(AgsAudioSignal *audio_signal,
+				  guint stream_loaded);
 
 //TODO:JK: rename these functions name it rather find than get
 AgsAudioSignal* ags_audio_signal_get_template(GList *audio_signal);
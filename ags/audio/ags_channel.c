@@ -1173,10 +1173,13 @@ ags_channel_add_to_registry(AgsConnectable *connectable)
   registry = ags_service_provider_get_registry(AGS_SERVICE_PROVIDER(application_context));
 
   entry = ags_registry_entry_alloc(registry);
-  g_value_set_object(&(entry->entry),
-		     (gpointer) channel);
-  ags_registry_add(registry,
-		   entry);
+
+  if(entry != NULL){
+    g_value_set_object(&(entry->entry),
+		       (gpointer) channel);
+    ags_registry_add(registry,
+		     entry);
+  }
 
   /* add play */
   list = channel->play;
@@ -2993,6 +2996,8 @@ ags_channel_add_pattern(AgsChannel *channel, GObject *pattern)
   g_object_ref(pattern);
   channel->pattern = g_list_prepend(channel->pattern, pattern);
 
+  AGS_PATTERN(pattern)->channel = (GObject *) channel;
+
   pthread_mutex_unlock(mutex);
 }
 
@@ -3032,6 +3037,10 @@ ags_channel_remove_pattern(AgsChannel *channel, GObject *pattern)
   /* remove pattern */
   pthread_mutex_lock(mutex);
 
+  if(AGS_PATTERN(pattern)->channel == (GObject *) channel){
+    AGS_PATTERN(pattern)->channel = NULL;
+  }
+  
   channel->pattern = g_list_remove(channel->pattern, pattern);
   g_object_unref(G_OBJECT(pattern));
 
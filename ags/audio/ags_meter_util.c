@@ -0,0 +1,507 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/audio/ags_meter_util.h>
+
+#include <ags/object/ags_soundcard.h>
+
+#include <stdlib.h>
+#include <math.h>
+
+#define AGS_METER_UTIL_LANES (8)
+
+/**
+ * SECTION:ags_meter_util
+ * @short_description: metering kernels
+ * @title: AgsMeterUtil
+ * @section_id:
+ * @include: ags/audio/ags_meter_util.h
+ *
+ * The meter util tap mixes the audio signals of a channel into a float
+ * buffer and measures peak, RMS and true-peak of it. The results are
+ * published to an #AgsMeterSlot, that the GUI reads without taking any
+ * lock.
+ */
+
+/**
+ * ags_meter_util_mix_s8:
+ * @destination: the float buffer
+ * @source: the audio buffer
+ * @buffer_size: the count of frames
+ *
+ * Add @source normalized to [-1.0, 1.0] to @destination.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_meter_util_mix_s8(gfloat *destination,
+		      signed char *source,
+		      guint buffer_size)
+{
+  static const gfloat scale = 1.0 / 127.0;
+
+  guint i;
+
+  for(i = 0; i < buffer_size; i++){
+    destination[i] += scale * (gfloat) source[i];
+  }
+}
+
+/**
+ * ags_meter_util_mix_s16:
+ * @destination: the float buffer
+ * @source: the audio buffer
+ * @buffer_size: the count of frames
+ *
+ * Add @source normalized to [-1.0, 1.0] to @destination.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_meter_util_mix_s16(gfloat *destination,
+		       signed short *source,
+		       guint buffer_size)
+{
+  static const gfloat scale = 1.0 / 32767.0;
+
+  guint i;
+
+  for(i = 0; i < buffer_size; i++){
+    destination[i] += scale * (gfloat) source[i];
+  }
+}
+
+/**
+ * ags_meter_util_mix_s24:
+ * @destination: the float buffer
+ * @source: the audio buffer
+ * @buffer_size: the count of frames
+ *
+ * Add @source normalized to [-1.0, 1.0] to @destination.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_meter_util_mix_s24(gfloat *destination,
+		       signed long *source,
+		       guint buffer_size)
+{
+  static const gfloat scale = 1.0 / 8388607.0;
+
+  guint i;
+
+  for(i = 0; i < buffer_size; i++){
+    destination[i] += scale * (gfloat) source[i];
+  }
+}
+
+/**
+ * ags_meter_util_mix_s32:
+ * @destination: the float buffer
+ * @source: the audio buffer
+ * @buffer_size: the count of frames
+ *
+ * Add @source normalized to [-1.0, 1.0] to @destination.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_meter_util_mix_s32(gfloat *destination,
+		       signed long *source,
+		       guint buffer_size)
+{
+  static const gfloat scale = 1.0 / 2147483647.0;
+
+  guint i;
+
+  for(i = 0; i < buffer_size; i++){
+    destination[i] += scale * (gfloat) source[i];
+  }
+}
+
+/**
+ * ags_meter_util_mix_s64:
+ * @destination: the float buffer
+ * @source: the audio buffer
+ * @buffer_size: the count of frames
+ *
+ * Add @source normalized to [-1.0, 1.0] to @destination.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_meter_util_mix_s64(gfloat *destination,
+		       signed long long *source,
+		       guint buffer_size)
+{
+  static const gfloat scale = 1.0 / 9223372036854775807.0;
+
+  guint i;
+
+  for(i = 0; i < buffer_size; i++){
+    destination[i] += scale * (gfloat) source[i];
+  }
+}
+
+/**
+ * ags_meter_util_mix:
+ * @destination: the float buffer
+ * @source: the audio buffer
+ * @format: the #AgsSoundcardFormat of @source
+ * @buffer_size: the count of frames
+ *
+ * Add @source normalized to [-1.0, 1.0] to @destination.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_meter_util_mix(gfloat *destination,
+		   void *source, guint format,
+		   guint buffer_size)
+{
+  switch(format){
+  case AGS_SOUNDCARD_SIGNED_8_BIT:
+    {
+      ags_meter_util_mix_s8(destination,
+			    (signed char *) source,
+			    buffer_size);
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_16_BIT:
+    {
+      ags_meter_util_mix_s16(destination,
+			     (signed short *) source,
+			     buffer_size);
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_24_BIT:
+    {
+      ags_meter_util_mix_s24(destination,
+			     (signed long *) source,
+			     buffer_size);
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_32_BIT:
+    {
+      ags_meter_util_mix_s32(destination,
+			     (signed long *) source,
+			     buffer_size);
+    }
+    break;
+  case AGS_SOUNDCARD_SIGNED_64_BIT:
+    {
+      ags_meter_util_mix_s64(destination,
+			     (signed long long *) source,
+			     buffer_size);
+    }
+    break;
+  default:
+    g_warning("ags_meter_util_mix() - unsupported format\0");
+  }
+}
+
+/**
+ * ags_meter_util_peak_rms:
+ * @buffer: the float buffer
+ * @buffer_size: the count of frames
+ * @peak: return location of the sample peak
+ * @rms: return location of the root mean square
+ *
+ * Measure the absolute sample peak and the RMS of @buffer. Each of the
+ * 8 lanes keeps its own maximum and sum, so the loop doesn't depend on
+ * the previous frame and the compiler is free to vectorize it.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_meter_util_peak_rms(gfloat *buffer,
+			guint buffer_size,
+			gfloat *peak, gfloat *rms)
+{
+  gfloat max_lane[AGS_METER_UTIL_LANES];
+  gfloat sum_lane[AGS_METER_UTIL_LANES];
+  gfloat current_max, current_sum;
+  gfloat value;
+  guint limit;
+  guint i, k;
+
+  for(k = 0; k < AGS_METER_UTIL_LANES; k++){
+    max_lane[k] = 0.0;
+    sum_lane[k] = 0.0;
+  }
+
+  limit = buffer_size - (buffer_size % AGS_METER_UTIL_LANES);
+
+  for(i = 0; i < limit; i += AGS_METER_UTIL_LANES){
+    for(k = 0; k < AGS_METER_UTIL_LANES; k++){
+      value = fabsf(buffer[i + k]);
+
+      max_lane[k] = (value > max_lane[k]) ? value: max_lane[k];
+      sum_lane[k] += value * value;
+    }
+  }
+
+  current_max = 0.0;
+  current_sum = 0.0;
+
+  for(k = 0; k < AGS_METER_UTIL_LANES; k++){
+    if(max_lane[k] > current_max){
+      current_max = max_lane[k];
+    }
+
+    current_sum += sum_lane[k];
+  }
+
+  for(; i < buffer_size; i++){
+    value = fabsf(buffer[i]);
+
+    if(value > current_max){
+      current_max = value;
+    }
+
+    current_sum += value * value;
+  }
+
+  if(peak != NULL){
+    *peak = current_max;
+  }
+
+  if(rms != NULL){
+    *rms = (buffer_size != 0) ? sqrtf(current_sum / (gfloat) buffer_size): 0.0;
+  }
+}
+
+/**
+ * ags_meter_util_true_peak:
+ * @buffer: the float buffer
+ * @buffer_size: the count of frames
+ * @history: the last %AGS_METER_UTIL_TRUE_PEAK_HISTORY frames of the
+ *   previous call, updated on return
+ *
+ * Estimate the true-peak of @buffer by 4 times oversampling with a
+ * cubic Catmull-Rom interpolator. This catches inter-sample peaks the
+ * sample peak misses and is an approximation of the ITU-R BS.1770
+ * measurement.
+ *
+ * Returns: the absolute true-peak
+ *
+ * Since: 0.7.136
+ */
+gfloat
+ags_meter_util_true_peak(gfloat *buffer,
+			 guint buffer_size,
+			 gfloat *history)
+{
+  gfloat x0, x1, x2, x3;
+  gfloat current_max;
+  gfloat value;
+  guint i;
+
+  x0 = history[0];
+  x1 = history[1];
+  x2 = history[2];
+
+  current_max = 0.0;
+
+  for(i = 0; i < buffer_size; i++){
+    x3 = buffer[i];
+
+    /* interpolate between x1 and x2 at 1/4, 1/2 and 3/4 */
+    value = fabsf(-0.0703125 * x0 + 0.8671875 * x1 + 0.2265625 * x2 - 0.0234375 * x3);
+    current_max = (value > current_max) ? value: current_max;
+
+    value = fabsf(0.0625 * (-x0 + 9.0 * x1 + 9.0 * x2 - x3));
+    current_max = (value > current_max) ? value: current_max;
+
+    value = fabsf(-0.0234375 * x0 + 0.2265625 * x1 + 0.8671875 * x2 - 0.0703125 * x3);
+    current_max = (value > current_max) ? value: current_max;
+
+    value = fabsf(x3);
+    current_max = (value > current_max) ? value: current_max;
+
+    x0 = x1;
+    x1 = x2;
+    x2 = x3;
+  }
+
+  history[0] = x0;
+  history[1] = x1;
+  history[2] = x2;
+
+  return(current_max);
+}
+
+/**
+ * ags_meter_slot_alloc:
+ *
+ * Allocate #AgsMeterSlot with a reference count of 1.
+ *
+ * Returns: the new #AgsMeterSlot
+ *
+ * Since: 0.7.136
+ */
+AgsMeterSlot*
+ags_meter_slot_alloc()
+{
+  AgsMeterSlot *meter_slot;
+
+  meter_slot = (AgsMeterSlot *) malloc(sizeof(AgsMeterSlot));
+
+  meter_slot->ref_count = 1;
+  meter_slot->sequence = 0;
+
+  meter_slot->peak = 0;
+  meter_slot->rms = 0;
+  meter_slot->true_peak = 0;
+
+  return(meter_slot);
+}
+
+/**
+ * ags_meter_slot_ref:
+ * @meter_slot: the #AgsMeterSlot
+ *
+ * Increase the reference count of @meter_slot.
+ *
+ * Returns: @meter_slot
+ *
+ * Since: 0.7.136
+ */
+AgsMeterSlot*
+ags_meter_slot_ref(AgsMeterSlot *meter_slot)
+{
+  if(meter_slot == NULL){
+    return(NULL);
+  }
+
+  g_atomic_int_inc(&(meter_slot->ref_count));
+
+  return(meter_slot);
+}
+
+/**
+ * ags_meter_slot_unref:
+ * @meter_slot: the #AgsMeterSlot
+ *
+ * Decrease the reference count of @meter_slot and free it as the count
+ * drops to 0.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_meter_slot_unref(AgsMeterSlot *meter_slot)
+{
+  if(meter_slot == NULL){
+    return;
+  }
+
+  if(g_atomic_int_dec_and_test(&(meter_slot->ref_count))){
+    free(meter_slot);
+  }
+}
+
+/**
+ * ags_meter_slot_publish:
+ * @meter_slot: the #AgsMeterSlot
+ * @peak: the sample peak
+ * @rms: the RMS
+ * @true_peak: the true-peak
+ *
+ * Publish a new measurement. There must be only one writer, it marks
+ * the slot busy by an odd sequence number while it writes.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_meter_slot_publish(AgsMeterSlot *meter_slot,
+		       gfloat peak, gfloat rms, gfloat true_peak)
+{
+  union{
+    gfloat value;
+    gint bits;
+  }peak_bits, rms_bits, true_peak_bits;
+
+  if(meter_slot == NULL){
+    return;
+  }
+
+  peak_bits.value = peak;
+  rms_bits.value = rms;
+  true_peak_bits.value = true_peak;
+
+  g_atomic_int_inc(&(meter_slot->sequence));
+
+  g_atomic_int_set(&(meter_slot->peak),
+		   peak_bits.bits);
+  g_atomic_int_set(&(meter_slot->rms),
+		   rms_bits.bits);
+  g_atomic_int_set(&(meter_slot->true_peak),
+		   true_peak_bits.bits);
+
+  g_atomic_int_inc(&(meter_slot->sequence));
+}
+
+/**
+ * ags_meter_slot_read:
+ * @meter_slot: the #AgsMeterSlot
+ * @peak: return location of the sample peak or %NULL
+ * @rms: return location of the RMS or %NULL
+ * @true_peak: return location of the true-peak or %NULL
+ *
+ * Read the last measurement published, retrying as the writer
+ * published concurrently. It never blocks the writer.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_meter_slot_read(AgsMeterSlot *meter_slot,
+		    gfloat *peak, gfloat *rms, gfloat *true_peak)
+{
+  union{
+    gfloat value;
+    gint bits;
+  }peak_bits, rms_bits, true_peak_bits;
+
+  gint sequence;
+
+  if(meter_slot == NULL){
+    return;
+  }
+
+  do{
+    sequence = g_atomic_int_get(&(meter_slot->sequence));
+
+    peak_bits.bits = g_atomic_int_get(&(meter_slot->peak));
+    rms_bits.bits = g_atomic_int_get(&(meter_slot->rms));
+    true_peak_bits.bits = g_atomic_int_get(&(meter_slot->true_peak));
+  }while((sequence & 1) != 0 ||
+	 sequence != g_atomic_int_get(&(meter_slot->sequence)));
+
+  if(peak != NULL){
+    *peak = peak_bits.value;
+  }
+
+  if(rms != NULL){
+    *rms = rms_bits.value;
+  }
+
+  if(true_peak != NULL){
+    *true_peak = true_peak_bits.value;
+  }
+}
@@ -0,0 +1,80 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_METER_UTIL_H__
+#define __AGS_METER_UTIL_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#define AGS_METER_SLOT(ptr) ((AgsMeterSlot *)(ptr))
+
+#define AGS_METER_UTIL_TRUE_PEAK_HISTORY (3)
+
+typedef struct _AgsMeterSlot AgsMeterSlot;
+
+struct _AgsMeterSlot
+{
+  volatile gint ref_count;
+  volatile gint sequence;
+
+  volatile gint peak;
+  volatile gint rms;
+  volatile gint true_peak;
+};
+
+/* tap */
+void ags_meter_util_mix_s8(gfloat *destination,
+			   signed char *source,
+			   guint buffer_size);
+void ags_meter_util_mix_s16(gfloat *destination,
+			    signed short *source,
+			    guint buffer_size);
+void ags_meter_util_mix_s24(gfloat *destination,
+			    signed long *source,
+			    guint buffer_size);
+void ags_meter_util_mix_s32(gfloat *destination,
+			    signed long *source,
+			    guint buffer_size);
+void ags_meter_util_mix_s64(gfloat *destination,
+			    signed long long *source,
+			    guint buffer_size);
+void ags_meter_util_mix(gfloat *destination,
+			void *source, guint format,
+			guint buffer_size);
+
+/* measure */
+void ags_meter_util_peak_rms(gfloat *buffer,
+			     guint buffer_size,
+			     gfloat *peak, gfloat *rms);
+gfloat ags_meter_util_true_peak(gfloat *buffer,
+				guint buffer_size,
+				gfloat *history);
+
+/* slot */
+AgsMeterSlot* ags_meter_slot_alloc();
+AgsMeterSlot* ags_meter_slot_ref(AgsMeterSlot *meter_slot);
+void ags_meter_slot_unref(AgsMeterSlot *meter_slot);
+
+void ags_meter_slot_publish(AgsMeterSlot *meter_slot,
+			    gfloat peak, gfloat rms, gfloat true_peak);
+void ags_meter_slot_read(AgsMeterSlot *meter_slot,
+			 gfloat *peak, gfloat *rms, gfloat *true_peak);
+
+#endif /*__AGS_METER_UTIL_H__*/
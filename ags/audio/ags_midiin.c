@@ -24,6 +24,7 @@
 
 #include <ags/object/ags_config.h>
 #include <ags/object/ags_sequencer.h>
+#include <ags/object/ags_soundcard.h>
 
 #include <ags/thread/ags_mutex_manager.h>
 #include <ags/thread/ags_task_thread.h>
@@ -41,6 +42,7 @@
 #include <sys/utsname.h>
 #include <alsa/rawmidi.h>
 #include <errno.h>
+#include <poll.h>
 
 #include <string.h>
 #include <math.h>
@@ -139,6 +141,8 @@ GList* ags_midiin_get_audio(AgsSequencer *sequencer);
 void* ags_midiin_oss_poll(void *ptr);
 void* ags_midiin_alsa_poll(void *ptr);
 
+guint64 ags_midiin_get_frame(AgsMidiin *midiin);
+
 enum{
   PROP_0,
   PROP_APPLICATION_CONTEXT,
@@ -514,6 +518,67 @@ ags_midiin_init(AgsMidiin *midiin)
   midiin->buffer_size[2] = 0;
   midiin->buffer_size[3] = 0;
 
+  /* event ring */
+  midiin->event_ring = ags_midi_event_ring_alloc(AGS_MIDI_EVENT_RING_DEFAULT_SIZE);
+
+  /* events */
+  midiin->event = (AgsMidiEvent **) malloc(4 * sizeof(AgsMidiEvent *));
+
+  midiin->event[0] = NULL;
+  midiin->event[1] = NULL;
+  midiin->event[2] = NULL;
+  midiin->event[3] = NULL;
+
+  midiin->event_count[0] = 0;
+  midiin->event_count[1] = 0;
+  midiin->event_count[2] = 0;
+  midiin->event_count[3] = 0;
+
+  /* time stamps */
+  midiin->samplerate = AGS_SOUNDCARD_DEFAULT_SAMPLERATE;
+  midiin->period_size = AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE;
+
+  str = ags_config_get_value(config,
+			     AGS_CONFIG_SOUNDCARD,
+			     "samplerate\0");
+
+  if(str == NULL){
+    str = ags_config_get_value(config,
+			       AGS_CONFIG_SOUNDCARD_0,
+			       "samplerate\0");
+  }
+  
+  if(str != NULL){
+    midiin->samplerate = g_ascii_strtoull(str,
+					  NULL,
+					  10);
+    free(str);
+  }
+
+  str = ags_config_get_value(config,
+			     AGS_CONFIG_SOUNDCARD,
+			     "buffer-size\0");
+
+  if(str == NULL){
+    str = ags_config_get_value(config,
+			       AGS_CONFIG_SOUNDCARD_0,
+			       "buffer-size\0");
+  }
+  
+  if(str != NULL){
+    midiin->period_size = g_ascii_strtoull(str,
+					   NULL,
+					   10);
+    free(str);
+  }
+
+  midiin->start_time = (struct timespec *) malloc(sizeof(struct timespec));
+
+  midiin->start_time->tv_sec = 0;
+  midiin->start_time->tv_nsec = 0;
+
+  midiin->period_frame = 0;
+
   /* bpm */
   midiin->bpm = AGS_SEQUENCER_DEFAULT_BPM;
 
@@ -773,6 +838,29 @@ ags_midiin_finalize(GObject *gobject)
   /* free buffer array */
   free(midiin->buffer);
 
+  /* free events */
+  ags_midi_event_ring_free(midiin->event_ring);
+
+  if(midiin->event[0] != NULL){
+    free(midiin->event[0]);
+  }
+
+  if(midiin->event[1] != NULL){
+    free(midiin->event[1]);
+  }
+
+  if(midiin->event[2] != NULL){
+    free(midiin->event[2]);
+  }
+
+  if(midiin->event[3] != NULL){
+    free(midiin->event[3]);
+  }
+
+  free(midiin->event);
+
+  free(midiin->start_time);
+
   /* audio */
   if(midiin->audio != NULL){
     list = midiin->audio;
@@ -1471,6 +1559,7 @@ ags_midiin_alsa_init(AgsSequencer *sequencer,
 #endif
 
   int err;
+  guint i;
   
   pthread_mutex_t *mutex;
   
@@ -1496,9 +1585,6 @@ ags_midiin_alsa_init(AgsSequencer *sequencer,
 		    AGS_MIDIIN_RECORD |
 		    AGS_MIDIIN_NONBLOCKING);
 
-  g_atomic_int_or(&(midiin->sync_flags),
-		  AGS_MIDIIN_INITIAL_POLL);
-  
   g_atomic_int_and(&(midiin->sync_flags),
 		   (~AGS_MIDIIN_PASS_THROUGH));
 
@@ -1529,6 +1615,26 @@ ags_midiin_alsa_init(AgsSequencer *sequencer,
   midiin->delay_counter = 0.0;
   midiin->tic_counter = 0;
 
+  /* preallocate buffers and events of all periods */
+  for(i = 0; i < 4; i++){
+    if(midiin->buffer[i] == NULL){
+      midiin->buffer[i] = (char *) malloc(AGS_MIDIIN_DEFAULT_BUFFER_SIZE * sizeof(char));
+    }
+
+    if(midiin->event[i] == NULL){
+      midiin->event[i] = (AgsMidiEvent *) malloc(AGS_MIDI_EVENT_RING_DEFAULT_SIZE * sizeof(AgsMidiEvent));
+    }
+
+    midiin->buffer_size[i] = 0;
+    midiin->event_count[i] = 0;
+  }
+
+  /* time stamps start now */
+  ags_midi_event_ring_reset(midiin->event_ring);
+
+  clock_gettime(CLOCK_MONOTONIC, midiin->start_time);
+  midiin->period_frame = 0;
+
   midiin->flags |= AGS_MIDIIN_INITIALIZED;
 
   pthread_mutex_unlock(mutex);
@@ -1551,11 +1657,18 @@ ags_midiin_alsa_record(AgsSequencer *sequencer,
 
   AgsApplicationContext *application_context;
 
+  AgsMidiEvent *midi_event, *event;
+
   GList *task;
+
+  char *buffer;
+
+  guint64 frame, period_frame, period_length;
+  guint nth_buffer;
+  guint buffer_length;
+  guint event_count;
   
   pthread_mutex_t *mutex;
-  pthread_mutex_t *poll_mutex;
-  pthread_mutex_t *poll_finish_mutex;
   
   midiin = AGS_MIDIIN(sequencer);
 
@@ -1576,55 +1689,76 @@ ags_midiin_alsa_record(AgsSequencer *sequencer,
 
   midiin->flags &= (~AGS_MIDIIN_START_RECORD);
 
-  poll_mutex = midiin->poll_mutex;
-  poll_finish_mutex = midiin->poll_finish_mutex;
-
   if((AGS_MIDIIN_INITIALIZED & (midiin->flags)) == 0){
     pthread_mutex_unlock(mutex);
     
     return;
   }
 
-  pthread_mutex_unlock(mutex);  
+  /* switch buffer */
+  ags_midiin_switch_buffer_flag(midiin);
 
-  /* wait poll */	
-  if((AGS_MIDIIN_INITIAL_POLL & (g_atomic_int_get(&(midiin->sync_flags)))) == 0){
-    pthread_mutex_lock(poll_finish_mutex);
-    
-    if((AGS_MIDIIN_POLL_FINISH_DONE & (g_atomic_int_get(&(midiin->sync_flags)))) == 0){
-      g_atomic_int_or(&(midiin->sync_flags),
-		      AGS_MIDIIN_POLL_FINISH_WAIT);
-    
-      while((AGS_MIDIIN_POLL_FINISH_DONE & (g_atomic_int_get(&(midiin->sync_flags)))) == 0 &&
-	    (AGS_MIDIIN_POLL_FINISH_WAIT & (g_atomic_int_get(&(midiin->sync_flags)))) != 0){
-	pthread_cond_wait(midiin->poll_finish_cond,
-			  poll_finish_mutex);
-      }
-    }
-    
-    g_atomic_int_and(&(midiin->sync_flags),
-		     (~(AGS_MIDIIN_POLL_FINISH_WAIT |
-			AGS_MIDIIN_POLL_FINISH_DONE)));
-    
-    pthread_mutex_unlock(poll_finish_mutex);
+  if((AGS_MIDIIN_BUFFER0 & (midiin->flags)) != 0){
+    nth_buffer = 0;
+  }else if((AGS_MIDIIN_BUFFER1 & (midiin->flags)) != 0){
+    nth_buffer = 1;
+  }else if((AGS_MIDIIN_BUFFER2 & (midiin->flags)) != 0){
+    nth_buffer = 2;
   }else{
-    g_atomic_int_and(&(midiin->sync_flags),
-		     (~AGS_MIDIIN_INITIAL_POLL));
+    nth_buffer = 3;
   }
 
-  /* signal poll */
-  if((AGS_MIDIIN_INITIAL_POLL & (g_atomic_int_get(&(midiin->sync_flags)))) == 0){
-    pthread_mutex_lock(poll_mutex);
+  /* take the events of the elapsed period out of the ring */
+  frame = ags_midiin_get_frame(midiin);
 
-    g_atomic_int_or(&(midiin->sync_flags),
-		    AGS_MIDIIN_POLL_DONE);
-    
-    if((AGS_MIDIIN_POLL_WAIT & (g_atomic_int_get(&(midiin->sync_flags)))) != 0){
-      pthread_cond_signal(midiin->poll_cond);
+  period_frame = midiin->period_frame;
+  period_length = frame - period_frame;
+
+  if(period_length == 0){
+    period_length = 1;
+  }
+  
+  buffer = midiin->buffer[nth_buffer];
+  event = midiin->event[nth_buffer];
+
+  buffer_length = 0;
+  event_count = 0;
+  
+  while((midi_event = ags_midi_event_ring_peek(midiin->event_ring)) != NULL &&
+	midi_event->frame < frame &&
+	buffer_length + midi_event->length <= AGS_MIDIIN_DEFAULT_BUFFER_SIZE &&
+	event_count < AGS_MIDI_EVENT_RING_DEFAULT_SIZE){
+    memcpy(buffer + buffer_length,
+	   midi_event->data,
+	   midi_event->length * sizeof(char));
+    buffer_length += midi_event->length;
+
+    /* place relative to the period */
+    memcpy(&(event[event_count]),
+	   midi_event,
+	   sizeof(AgsMidiEvent));
+
+    if(midi_event->frame > period_frame){
+      event[event_count].offset = (midi_event->frame - period_frame) * midiin->period_size / period_length;
+
+      if(event[event_count].offset >= midiin->period_size){
+	event[event_count].offset = midiin->period_size - 1;
+      }
+    }else{
+      event[event_count].offset = 0;
     }
+    
+    event_count++;
 
-    pthread_mutex_unlock(poll_mutex);
+    ags_midi_event_ring_pop(midiin->event_ring);
   }
+
+  midiin->buffer_size[nth_buffer] = buffer_length;
+  midiin->event_count[nth_buffer] = event_count;
+
+  midiin->period_frame = frame;
+  
+  pthread_mutex_unlock(mutex);  
     
   /* update sequencer */
   task_thread = ags_thread_find_type((AgsThread *) application_context->main_loop,
@@ -1656,8 +1790,6 @@ ags_midiin_alsa_free(AgsSequencer *sequencer)
   AgsApplicationContext *application_context;
 
   pthread_mutex_t *mutex;
-  pthread_mutex_t *poll_mutex;
-  pthread_mutex_t *poll_finish_mutex;
   
   midiin = AGS_MIDIIN(sequencer);
 
@@ -1684,37 +1816,11 @@ ags_midiin_alsa_free(AgsSequencer *sequencer)
   midiin->flags &= (~(AGS_MIDIIN_RECORD |
 		      AGS_MIDIIN_INITIALIZED));
 
-  poll_mutex = midiin->poll_mutex;
-  poll_finish_mutex = midiin->poll_finish_mutex;
-
   pthread_mutex_unlock(mutex);
 
-  g_atomic_int_or(&(midiin->sync_flags),
-		  AGS_MIDIIN_POLL_FINISH_WAIT);
-  
-  /* signal poll */
-  pthread_mutex_lock(poll_mutex);
-
-  g_atomic_int_or(&(midiin->sync_flags),
-		  AGS_MIDIIN_POLL_DONE);
-    
-  if((AGS_MIDIIN_POLL_WAIT & (g_atomic_int_get(&(midiin->sync_flags)))) != 0){
-    pthread_cond_signal(midiin->poll_cond);
-  }
-
-  pthread_mutex_unlock(poll_mutex);
-
-  /* signal finish */
-  pthread_mutex_lock(poll_finish_mutex);
-
-  g_atomic_int_or(&(midiin->sync_flags),
-		  AGS_MIDIIN_POLL_FINISH_DONE);
-    
-  if((AGS_MIDIIN_POLL_FINISH_WAIT & (g_atomic_int_get(&(midiin->sync_flags)))) != 0){
-    pthread_cond_signal(midiin->poll_finish_cond);
-  }
-
-  pthread_mutex_unlock(poll_finish_mutex);
+  /* the poll thread notices within its poll timeout */
+  pthread_join(*(midiin->poll_thread),
+	       NULL);
 
   /*  */
   pthread_mutex_lock(mutex);
@@ -1734,21 +1840,29 @@ ags_midiin_alsa_free(AgsSequencer *sequencer)
 
   if(midiin->buffer[1] != NULL){
     free(midiin->buffer[1]);
+
+    midiin->buffer[1] = NULL;
     midiin->buffer_size[1] = 0;
   }
 
   if(midiin->buffer[2] != NULL){
     free(midiin->buffer[2]);
+
+    midiin->buffer[2] = NULL;
     midiin->buffer_size[2] = 0;
   }
 
   if(midiin->buffer[3] != NULL){
     free(midiin->buffer[3]);
+
+    midiin->buffer[3] = NULL;
     midiin->buffer_size[3] = 0;
   }
 
   if(midiin->buffer[0] != NULL){
     free(midiin->buffer[0]);
+
+    midiin->buffer[0] = NULL;
     midiin->buffer_size[0] = 0;
   }
 
@@ -2154,20 +2268,22 @@ ags_midiin_alsa_poll(void *ptr)
 
   AgsApplicationContext *application_context;
 
+#ifdef AGS_WITH_ALSA
   snd_rawmidi_t *device_handle;
 
-  char **ring_buffer;
+  struct pollfd *fds;
+
+  unsigned short revents;
+  int count;
+#endif
   
-  gboolean no_event;
-  guint nth_buffer;
-  guint nth_ring_buffer;
-  guint ring_buffer_size;
+  unsigned char buffer[AGS_MIDIIN_DEFAULT_BUFFER_SIZE];
+  
+  guint64 frame;
+  gboolean do_record;
   int status;
-  unsigned char c;
   
   pthread_mutex_t *mutex;
-  pthread_mutex_t *poll_mutex;
-  pthread_mutex_t *poll_finish_mutex;
   
   midiin = AGS_MIDIIN(ptr);
   
@@ -2186,186 +2302,133 @@ ags_midiin_alsa_poll(void *ptr)
   /* prepare poll */
   pthread_mutex_lock(mutex);
 
+#ifdef AGS_WITH_ALSA
   device_handle = midiin->in.alsa.handle;
-      
-  /* nth buffer */
-  if((AGS_MIDIIN_BUFFER0 & (midiin->flags)) != 0){
-    nth_buffer = 1;
-    nth_ring_buffer = 0;
-  }else if((AGS_MIDIIN_BUFFER1 & (midiin->flags)) != 0){
-    nth_buffer = 2;
-    nth_ring_buffer = 1;
-  }else if((AGS_MIDIIN_BUFFER2 & (midiin->flags)) != 0){
-    nth_buffer = 3;
-    nth_ring_buffer = 0;
-  }else if((AGS_MIDIIN_BUFFER3 & midiin->flags) != 0){
-    nth_buffer = 0;
-    nth_ring_buffer = 1;
-  }
 
-  if(midiin->ring_buffer[nth_ring_buffer] != NULL){
-    free(midiin->ring_buffer[nth_ring_buffer]);
-  }
-      
-  midiin->ring_buffer[nth_ring_buffer] = NULL;
-  midiin->ring_buffer_size[nth_ring_buffer] = 0;
-      
-  ring_buffer = midiin->ring_buffer;
-  ring_buffer_size = midiin->ring_buffer_size[nth_ring_buffer];
+  count = snd_rawmidi_poll_descriptors_count(device_handle);
 
-  no_event = FALSE;
+  fds = (struct pollfd *) malloc(count * sizeof(struct pollfd));
+  snd_rawmidi_poll_descriptors(device_handle,
+			       fds,
+			       count);
+#endif
   
-  /* poll MIDI device */
-  while((AGS_MIDIIN_RECORD & (midiin->flags)) != 0){
-    pthread_mutex_unlock(mutex);
+  do_record = ((AGS_MIDIIN_RECORD & (midiin->flags)) != 0) ? TRUE: FALSE;
+  
+  pthread_mutex_unlock(mutex);
+  
+  /* poll MIDI device and read all available bytes at once */
+  while(do_record){
+#ifdef AGS_WITH_ALSA
+    status = poll(fds,
+		  count,
+		  AGS_MIDIIN_DEFAULT_POLL_TIMEOUT);
 
-    /*  */
-    if(!no_event){
-      while((AGS_MIDIIN_POLL_FINISH_WAIT & (g_atomic_int_get(&(midiin->sync_flags)))) == 0){
-	status = 0;
+    if(status > 0){
+      snd_rawmidi_poll_descriptors_revents(device_handle,
+					   fds,
+					   count,
+					   &revents);
 
-#ifdef AGS_WITH_ALSA
-	status = snd_rawmidi_read(device_handle, &c, 1);
+      if((POLLIN & revents) != 0){
+	status = snd_rawmidi_read(device_handle,
+				  buffer,
+				  AGS_MIDIIN_DEFAULT_BUFFER_SIZE);
 
 	if((status < 0) && (status != -EBUSY) && (status != -EAGAIN)){
 	  g_warning("Problem reading MIDI input: %s\0", snd_strerror(status));
 	}
 
-	if(status >= 0){
-	  if(ring_buffer_size % AGS_MIDIIN_DEFAULT_BUFFER_SIZE == 0){
-	    if(ring_buffer[nth_ring_buffer] == NULL){
-	      ring_buffer[nth_ring_buffer] = (char *) malloc(AGS_MIDIIN_DEFAULT_BUFFER_SIZE * sizeof(char));
-	    }else{
-	      ring_buffer[nth_ring_buffer] = (char *) realloc(ring_buffer[nth_ring_buffer],
-							      (ring_buffer_size + AGS_MIDIIN_DEFAULT_BUFFER_SIZE) * sizeof(char));
-	    }
-	  }
+	if(status > 0){
+	  /* stamp the events with their arrival */
+	  frame = ags_midiin_get_frame(midiin);
 
-	  ring_buffer[nth_ring_buffer][ring_buffer_size] = (unsigned char) c;
-	  ring_buffer_size += 1;
+	  ags_midi_event_ring_parse(midiin->event_ring,
+				    buffer, status,
+				    frame);
 	}
-#endif
-      }
-
-      /* switch buffer */
-      pthread_mutex_lock(mutex);
-
-      /* update byte array and buffer size */
-      if(midiin->buffer[nth_buffer] != NULL){
-	free(midiin->buffer[nth_buffer]);
       }
-      
-      midiin->buffer[nth_buffer] = NULL;
-
-      midiin->ring_buffer_size[nth_ring_buffer] = ring_buffer_size;
-      
-      midiin->buffer_size[nth_buffer] = ring_buffer_size;
-      
-      /* fill buffer */
-      if(ring_buffer_size > 0){
-	midiin->buffer[nth_buffer] = (char *) malloc(ring_buffer_size * sizeof(char));
-	
-	memcpy(midiin->buffer[nth_buffer], ring_buffer[nth_ring_buffer], ring_buffer_size * sizeof(char));
-      }
-      
-      pthread_mutex_unlock(mutex);
     }
-
+#else
+    break;
+#endif
+    
     /*  */
     pthread_mutex_lock(mutex);
-
-    ags_midiin_switch_buffer_flag(midiin);
-
-    device_handle = midiin->in.alsa.handle;
-      
-    /* nth buffer */
-    if((AGS_MIDIIN_BUFFER0 & (midiin->flags)) != 0){
-      nth_buffer = 1;
-      nth_ring_buffer = 0;
-    }else if((AGS_MIDIIN_BUFFER1 & (midiin->flags)) != 0){
-      nth_buffer = 2;
-      nth_ring_buffer = 1;
-    }else if((AGS_MIDIIN_BUFFER2 & (midiin->flags)) != 0){
-      nth_buffer = 3;
-      nth_ring_buffer = 0;
-    }else if((AGS_MIDIIN_BUFFER3 & midiin->flags) != 0){
-      nth_buffer = 0;
-      nth_ring_buffer = 1;
-    }
-
-    if(midiin->ring_buffer[nth_ring_buffer] != NULL){
-      free(midiin->ring_buffer[nth_ring_buffer]);
-    }
-      
-    midiin->ring_buffer[nth_ring_buffer] = NULL;
-    midiin->ring_buffer_size[nth_ring_buffer] = 0;
-      
-    ring_buffer = midiin->ring_buffer;
-    ring_buffer_size = midiin->ring_buffer_size[nth_ring_buffer];
+  
+    do_record = ((AGS_MIDIIN_RECORD & (midiin->flags)) != 0) ? TRUE: FALSE;
 
     pthread_mutex_unlock(mutex);
+  }
 
-    /* signal finish */
-    pthread_mutex_lock(mutex);
+#ifdef AGS_WITH_ALSA
+  free(fds);
+#endif
+  
+  /* exit thread */
+  pthread_exit(NULL);
+}
 
-    poll_finish_mutex = midiin->poll_finish_mutex;
+guint64
+ags_midiin_get_frame(AgsMidiin *midiin)
+{
+  struct timespec time_now;
 
-    pthread_mutex_unlock(mutex);
-	
-    pthread_mutex_lock(poll_finish_mutex);
+  guint64 nsec;
 
-    g_atomic_int_or(&(midiin->sync_flags),
-		    AGS_MIDIIN_POLL_FINISH_DONE);
-    
-    if((AGS_MIDIIN_POLL_FINISH_WAIT & (g_atomic_int_get(&(midiin->sync_flags)))) != 0){
-      pthread_cond_signal(midiin->poll_finish_cond);
-    }
+  clock_gettime(CLOCK_MONOTONIC, &time_now);
 
-    pthread_mutex_unlock(poll_finish_mutex);
+  nsec = (guint64) (time_now.tv_sec - midiin->start_time->tv_sec) * NSEC_PER_SEC + time_now.tv_nsec - midiin->start_time->tv_nsec;
 
-    /* wait poll */
-    pthread_mutex_lock(mutex);
+  return(nsec * midiin->samplerate / NSEC_PER_SEC);
+}
 
-    no_event = TRUE;
-      
-    if((AGS_MIDIIN_PASS_THROUGH & (g_atomic_int_get(&(midiin->sync_flags)))) == 0){
-      poll_mutex = midiin->poll_mutex;
+/**
+ * ags_midiin_get_event:
+ * @midiin: the #AgsMidiin
+ * @event_count: the return location of the count of events
+ *
+ * Get the events of the current buffer. They are in the same order as the
+ * bytes returned by ags_sequencer_get_buffer() and their offset field is
+ * the frame within the period they arrived at.
+ *
+ * Returns: the #AgsMidiEvent array or %NULL
+ *
+ * Since: 0.7.136
+ */
+AgsMidiEvent*
+ags_midiin_get_event(AgsMidiin *midiin,
+		     guint *event_count)
+{
+  AgsMidiEvent *event;
 
-      pthread_mutex_unlock(mutex);
-	
-      /* give back computing time until ready */
-      pthread_mutex_lock(poll_mutex);
-    
-      if((AGS_MIDIIN_POLL_DONE & (g_atomic_int_get(&(midiin->sync_flags)))) == 0){
-	g_atomic_int_or(&(midiin->sync_flags),
-			AGS_MIDIIN_POLL_WAIT);
-    
-	while((AGS_MIDIIN_POLL_DONE & (g_atomic_int_get(&(midiin->sync_flags)))) == 0 &&
-	      (AGS_MIDIIN_POLL_WAIT & (g_atomic_int_get(&(midiin->sync_flags)))) != 0){
-	  pthread_cond_wait(midiin->poll_cond,
-			    poll_mutex);
-	}
-      }
+  guint nth_buffer;
+  
+  /* get events */
+  if((AGS_MIDIIN_BUFFER0 & (midiin->flags)) != 0){
+    nth_buffer = 0;
+  }else if((AGS_MIDIIN_BUFFER1 & (midiin->flags)) != 0){
+    nth_buffer = 1;
+  }else if((AGS_MIDIIN_BUFFER2 & (midiin->flags)) != 0){
+    nth_buffer = 2;
+  }else if((AGS_MIDIIN_BUFFER3 & (midiin->flags)) != 0){
+    nth_buffer = 3;
+  }else{
+    if(event_count != NULL){
+      *event_count = 0;
+    }
     
-      g_atomic_int_and(&(midiin->sync_flags),
-		       (~(AGS_MIDIIN_POLL_WAIT |
-			  AGS_MIDIIN_POLL_DONE)));
-	  
-      pthread_mutex_unlock(poll_mutex);
+    return(NULL);
+  }
 
-      no_event = FALSE;	
-    }else{
-      pthread_mutex_unlock(mutex);
-    }
+  event = midiin->event[nth_buffer];
 
-    /*  */    
-    pthread_mutex_lock(mutex);
+  /* return the count of events */
+  if(event_count != NULL){
+    *event_count = (event != NULL) ? midiin->event_count[nth_buffer]: 0;
   }
   
-  pthread_mutex_unlock(mutex);
-
-  /* exit thread */
-  pthread_exit(NULL);
+  return(event);
 }
 
 /**
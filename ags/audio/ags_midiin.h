@@ -25,10 +25,14 @@
 
 #include <sys/types.h>
 
+#include <time.h>
+
 #include <pthread.h>
 
 #include <alsa/asoundlib.h>
 
+#include <ags/audio/midi/ags_midi_event_ring.h>
+
 #define AGS_TYPE_MIDIIN                (ags_midiin_get_type())
 #define AGS_MIDIIN(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_MIDIIN, AgsMidiin))
 #define AGS_MIDIIN_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST(class, AGS_TYPE_MIDIIN, AgsMidiin))
@@ -39,6 +43,7 @@
 #define AGS_MIDIIN_DEFAULT_ALSA_DEVICE "hw:0,0\0"
 #define AGS_MIDIIN_DEFAULT_OSS_DEVICE "/dev/midi00\0"
 #define AGS_MIDIIN_DEFAULT_BUFFER_SIZE (4096)
+#define AGS_MIDIIN_DEFAULT_POLL_TIMEOUT (10)
 
 typedef struct _AgsMidiin AgsMidiin;
 typedef struct _AgsMidiinClass AgsMidiinClass;
@@ -92,6 +97,17 @@ struct _AgsMidiin
   char **buffer;
   guint buffer_size[4];
 
+  AgsMidiEventRing *event_ring;
+  
+  AgsMidiEvent **event;
+  guint event_count[4];
+
+  guint samplerate;
+  guint period_size;
+  
+  struct timespec *start_time;
+  guint64 period_frame;
+
   double bpm; // beats per minute
 
   gdouble delay;
@@ -139,6 +155,9 @@ GType ags_midiin_get_type();
 
 GQuark ags_midiin_error_quark();
 
+AgsMidiEvent* ags_midiin_get_event(AgsMidiin *midiin,
+				   guint *event_count);
+
 AgsMidiin* ags_midiin_new(GObject *application_context);
 
 #endif /*__AGS_MIDIIN_H__*/
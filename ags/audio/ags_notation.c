@@ -66,6 +66,13 @@ void ags_notation_insert_native_piano_from_clipboard(AgsNotation *notation,
 						     gboolean from_x_offset, guint x_offset,
 						     gboolean from_y_offset, guint y_offset);
 
+gint ags_notation_note_compare(gconstpointer a, gconstpointer b);
+GList* ags_notation_merge_notes(GList *notes, GList *batch);
+
+void ags_notation_update_note_index(AgsNotation *notation);
+GList* ags_notation_find_note_link(AgsNotation *notation,
+				   guint x);
+
 /**
  * SECTION:ags_notation
  * @short_description: Notation class supporting selection and clipboard.
@@ -324,6 +331,9 @@ ags_notation_init(AgsNotation *notation)
 
   notation->notes = NULL;
 
+  notation->note_index = NULL;
+  notation->note_index_length = 0;
+
   notation->loop_start = 0.0;
   notation->loop_end = 0.0;
   notation->offset = 0.0;
@@ -701,6 +711,13 @@ ags_notation_dispose(GObject *gobject)
 
   notation->notes = NULL;
   notation->selection = NULL;
+
+  g_free(notation->note_index);
+
+  notation->note_index = NULL;
+  notation->note_index_length = 0;
+  
+  notation->flags &= (~AGS_NOTATION_INDEXED);
   
   /* port */
   if(notation->port != NULL){
@@ -745,6 +762,8 @@ ags_notation_finalize(GObject *gobject)
 
   g_list_free(notation->selection);
 
+  g_free(notation->note_index);
+  
   /* port */
   if(notation->port != NULL){
     g_object_unref(notation->port);
@@ -879,49 +898,215 @@ ags_notation_add_note(AgsNotation *notation,
 		      AgsNote *note,
 		      gboolean use_selection_list)
 {
-  GList *list, *list_new;
+  if(note == NULL){
+    return;
+  }
 
-  auto gint ags_notation_add_note_compare_function(gpointer a, gpointer b);
+  g_object_ref(note);
+  
+  if(use_selection_list){
+    notation->selection = g_list_insert_sorted(notation->selection,
+					       note,
+					       (GCompareFunc) ags_notation_note_compare);
+  }else{
+    notation->notes = g_list_insert_sorted(notation->notes,
+					   note,
+					   (GCompareFunc) ags_notation_note_compare);
 
-  gint ags_notation_add_note_compare_function(gpointer a, gpointer b){
-    if(a == NULL || b == NULL){
-      return(0);
+    notation->flags &= (~AGS_NOTATION_INDEXED);
+  }
+}
+
+/**
+ * ags_notation_add_note_batch:
+ * @notation: an #AgsNotation
+ * @note: a #GList containing #AgsNote to add, in any order
+ * @use_selection_list: if %TRUE add to selection, else to default notation
+ *
+ * Adds many notes to notation at once. The notes are sorted once and merged
+ * with the existing notes, so adding n notes to m notes takes O(n log n + m)
+ * instead of O(n * m) by calling ags_notation_add_note() for each of them.
+ * The resulting order is the same as adding @note one by one. @note is
+ * not modified and remains owned by the caller.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_notation_add_note_batch(AgsNotation *notation,
+			    GList *note,
+			    gboolean use_selection_list)
+{
+  GList *batch, *list;
+
+  if(notation == NULL ||
+     note == NULL){
+    return;
+  }
+
+  /* reverse first, so equal notes end up in the order repeated insertion would give */
+  batch = NULL;
+  list = note;
+
+  while(list != NULL){
+    if(list->data != NULL){
+      g_object_ref(list->data);
+      
+      batch = g_list_prepend(batch,
+			     list->data);
     }
     
-    if(AGS_NOTE(a)->x[0] == AGS_NOTE(b)->x[0]){
-      if(AGS_NOTE(a)->y == AGS_NOTE(b)->y){
-	return(0);
-      }
+    list = list->next;
+  }
 
-      if(AGS_NOTE(a)->y < AGS_NOTE(b)->y){
-	return(-1);
-      }else{
-	return(1);
-      }
+  batch = g_list_sort(batch,
+		      (GCompareFunc) ags_notation_note_compare);
+  
+  if(use_selection_list){
+    notation->selection = ags_notation_merge_notes(notation->selection,
+						   batch);
+  }else{
+    notation->notes = ags_notation_merge_notes(notation->notes,
+					       batch);
+
+    notation->flags &= (~AGS_NOTATION_INDEXED);
+  }
+}
+
+gint
+ags_notation_note_compare(gconstpointer a, gconstpointer b)
+{
+  if(a == NULL || b == NULL){
+    return(0);
+  }
+    
+  if(AGS_NOTE(a)->x[0] == AGS_NOTE(b)->x[0]){
+    if(AGS_NOTE(a)->y == AGS_NOTE(b)->y){
+      return(0);
     }
 
-    if(AGS_NOTE(a)->x[0] < AGS_NOTE(b)->x[0]){
+    if(AGS_NOTE(a)->y < AGS_NOTE(b)->y){
       return(-1);
     }else{
       return(1);
     }
   }
 
-  if(note == NULL){
-    return;
+  if(AGS_NOTE(a)->x[0] < AGS_NOTE(b)->x[0]){
+    return(-1);
+  }else{
+    return(1);
   }
+}
 
-  g_object_ref(note);
+GList*
+ags_notation_merge_notes(GList *notes, GList *batch)
+{
+  GList *start, *end;
+  GList *current;
   
-  if(use_selection_list){
-    notation->selection = g_list_insert_sorted(notation->selection,
-					       note,
-					       (GCompareFunc) ags_notation_add_note_compare_function);
-  }else{
-    notation->notes = g_list_insert_sorted(notation->notes,
-					   note,
-					   (GCompareFunc) ags_notation_add_note_compare_function);
+  if(notes == NULL){
+    return(batch);
+  }
+
+  if(batch == NULL){
+    return(notes);
   }
+
+  /* merge two sorted lists by relinking, batch goes first on equal notes */
+  start = NULL;
+  end = NULL;
+  
+  while(notes != NULL && batch != NULL){
+    if(ags_notation_note_compare(batch->data, notes->data) <= 0){
+      current = batch;
+      batch = batch->next;
+    }else{
+      current = notes;
+      notes = notes->next;
+    }
+
+    current->prev = end;
+
+    if(end != NULL){
+      end->next = current;
+    }else{
+      start = current;
+    }
+
+    end = current;
+  }
+
+  current = (notes != NULL) ? notes: batch;
+  end->next = current;
+  current->prev = end;
+  
+  return(start);
+}
+
+void
+ags_notation_update_note_index(AgsNotation *notation)
+{
+  GList *list;
+
+  guint length;
+  guint i;
+
+  /* the notes might have been replaced without using the API */
+  if((AGS_NOTATION_INDEXED & (notation->flags)) != 0){
+    if(notation->note_index_length == 0){
+      if(notation->notes == NULL){
+	return;
+      }
+    }else if(notation->note_index[0] == notation->notes &&
+	     notation->note_index[notation->note_index_length - 1]->next == NULL){
+      return;
+    }
+  }
+  
+  length = g_list_length(notation->notes);
+
+  notation->note_index = (GList **) g_realloc(notation->note_index,
+					      length * sizeof(GList *));
+  notation->note_index_length = length;
+  
+  list = notation->notes;
+  
+  for(i = 0; i < length; i++){
+    notation->note_index[i] = list;
+
+    list = list->next;
+  }
+
+  notation->flags |= AGS_NOTATION_INDEXED;
+}
+
+GList*
+ags_notation_find_note_link(AgsNotation *notation,
+			    guint x)
+{
+  guint lower, upper, middle;
+
+  ags_notation_update_note_index(notation);
+
+  /* lower bound of x */
+  lower = 0;
+  upper = notation->note_index_length;
+
+  while(lower < upper){
+    middle = lower + (upper - lower) / 2;
+
+    if(AGS_NOTE(notation->note_index[middle]->data)->x[0] < x){
+      lower = middle + 1;
+    }else{
+      upper = middle;
+    }
+  }
+
+  if(lower == notation->note_index_length){
+    return(NULL);
+  }
+
+  return(notation->note_index[lower]);
 }
 
 /**
@@ -952,8 +1137,11 @@ ags_notation_remove_note_at_position(AgsNotation *notation,
   }
 
   /* get entry point */
-  while(notes->next != NULL && (note = AGS_NOTE(notes->data))->x[0] < x){
-    notes = notes->next;
+  notes = ags_notation_find_note_link(notation,
+				      x);
+
+  if(notes == NULL){
+    notes = notation->note_index[notation->note_index_length - 1];
   }
 
   notes_end_region = notes;
@@ -988,6 +1176,8 @@ ags_notation_remove_note_at_position(AgsNotation *notation,
 	
 	g_object_unref(note);
 
+	notation->flags &= (~AGS_NOTATION_INDEXED);
+	
 	return(TRUE);
       } 
 
@@ -1029,6 +1219,8 @@ ags_notation_remove_note_at_position(AgsNotation *notation,
 	g_list_free_1(notes);
 
 	g_object_unref(note);
+
+	notation->flags &= (~AGS_NOTATION_INDEXED);
 	
 	return(TRUE);
       }
@@ -1107,12 +1299,13 @@ ags_notation_find_point(AgsNotation *notation,
 
   if(use_selection_list){
     notes = notation->selection;
-  }else{
-    notes = notation->notes;
-  }
 
-  while(notes != NULL && AGS_NOTE(notes->data)->x[0] < x){
-    notes = notes->next;
+    while(notes != NULL && AGS_NOTE(notes->data)->x[0] < x){
+      notes = notes->next;
+    }
+  }else{
+    notes = ags_notation_find_note_link(notation,
+					x);
   }
 
   if(notes == NULL)
@@ -1183,12 +1376,13 @@ ags_notation_find_region(AgsNotation *notation,
   
   if(use_selection_list){
     notes = notation->selection;
-  }else{
-    notes = notation->notes;
-  }
 
-  while(notes != NULL && AGS_NOTE(notes->data)->x[0] < x0){
-    notes = notes->next;
+    while(notes != NULL && AGS_NOTE(notes->data)->x[0] < x0){
+      notes = notes->next;
+    }
+  }else{
+    notes = ags_notation_find_note_link(notation,
+					x0);
   }
 
   region = NULL;
@@ -1547,6 +1741,8 @@ ags_notation_cut_selection(AgsNotation *notation)
     selection = selection_next;
   }
 
+  notation->flags &= (~AGS_NOTATION_INDEXED);
+  
   ags_notation_free_selection(notation);
 
   return(notation_node);
@@ -1580,6 +1776,7 @@ ags_notation_insert_native_piano_from_clipboard(AgsNotation *notation,
   void ags_notation_insert_native_piano_from_clipboard_version_0_3_12(){
     AgsNote *note;
     xmlNodePtr node;
+    GList *note_list;
     char *endptr;
     guint x_boundary_val, y_boundary_val;
     char *x0, *x1, *y;
@@ -1643,6 +1840,8 @@ ags_notation_insert_native_piano_from_clipboard(AgsNotation *notation,
       }
     }
     
+    note_list = NULL;
+    
     for(; node != NULL; ){
       if(node->type == XML_ELEMENT_NODE && !xmlStrncmp("note\0", node->name, 5)){
 	/* retrieve x0 offset */
@@ -1785,13 +1984,20 @@ ags_notation_insert_native_piano_from_clipboard(AgsNotation *notation,
 
 	g_message("adding note at: [%u,%u|%u]\n\0", x0_val, x1_val, y_val);
 
-	ags_notation_add_note(notation,
-			      note,
-			      FALSE);
+	note_list = g_list_prepend(note_list,
+				   note);
       }
 
       node = node->next;
     }
+
+    /* add notes sorting them once */
+    ags_notation_add_note_batch(notation,
+				note_list,
+				FALSE);
+
+    g_list_free_full(note_list,
+		     g_object_unref);
   }
 
   if(!xmlStrncmp("0.3.12\0", version, 7)){
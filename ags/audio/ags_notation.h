@@ -56,6 +56,7 @@ typedef enum{
   AGS_NOTATION_CONNECTED           = 1,
   AGS_NOTATION_STICKY              = 1 <<  1,
   AGS_NOTATION_PATTERN_MODE        = 1 <<  2,
+  AGS_NOTATION_INDEXED             = 1 <<  3,
 }AgsNotationFlags;
 
 struct _AgsNotation
@@ -79,6 +80,9 @@ struct _AgsNotation
   gdouble maximum_note_length;
 
   GList *notes;
+
+  GList **note_index;
+  guint note_index_length;
   
   gdouble loop_start;
   gdouble loop_end;
@@ -105,6 +109,9 @@ GList* ags_notation_find_near_timestamp(GList *notation, guint audio_channel,
 void ags_notation_add_note(AgsNotation *notation,
 			   AgsNote *note,
 			   gboolean use_selection_list);
+void ags_notation_add_note_batch(AgsNotation *notation,
+				 GList *note,
+				 gboolean use_selection_list);
 
 gboolean ags_notation_remove_note_at_position(AgsNotation *notation,
 					      guint x, guint y);
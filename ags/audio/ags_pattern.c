@@ -25,8 +25,10 @@
 
 #include <ags/thread/ags_mutex_manager.h>
 
+#include <ags/audio/ags_channel.h>
 #include <ags/audio/ags_port.h>
 
+#include <stdlib.h>
 #include <stdarg.h>
 #include <math.h>
 #include <string.h>
@@ -57,6 +59,8 @@ GList* ags_pattern_list_safe_properties(AgsPortlet *portlet);
 void ags_pattern_safe_set_property(AgsPortlet *portlet, gchar *property_name, GValue *value);
 void ags_pattern_safe_get_property(AgsPortlet *portlet, gchar *property_name, GValue *value);
 
+void ags_pattern_index_bitmap(AgsPattern *pattern);
+
 /**
  * SECTION:ags_pattern
  * @short_description: Pattern representing tones
@@ -312,6 +316,9 @@ ags_pattern_init(AgsPattern *pattern)
   /* base initialization */
   pattern->flags = 0;
 
+  /* channel, not referenced */
+  pattern->channel = NULL;
+
   /* timestamp */
   pattern->timestamp = NULL;
 
@@ -320,6 +327,10 @@ ags_pattern_init(AgsPattern *pattern)
   pattern->dim[1] = 0;
   pattern->dim[2] = 0;
 
+  pattern->stride = 0;
+  pattern->bitmap = NULL;
+  pattern->bitmap_row = NULL;
+
   pattern->pattern = NULL;
 
   /* port */
@@ -573,8 +584,6 @@ void
 ags_pattern_finalize(GObject *gobject)
 {
   AgsPattern *pattern;
-  
-  guint i, j;
 
   pattern = AGS_PATTERN(gobject);
 
@@ -584,21 +593,9 @@ ags_pattern_finalize(GObject *gobject)
   }
 
   /* pattern */
-  if(pattern->pattern != NULL){
-    for(i = 0; i < pattern->dim[0]; i++){
-      if(pattern->pattern[i] != NULL){
-	for(j = 0; j < pattern->dim[1]; j++){
-	  if(pattern->pattern[i][j] != NULL){
-	    free(pattern->pattern[i][j]);
-	  }
-	}
-
-	free(pattern->pattern[i]);
-      }
-    }
-
-    free(pattern->pattern);
-  }
+  free(pattern->bitmap);
+  free(pattern->bitmap_row);
+  free(pattern->pattern);
  
   /* port */
   if(pattern->port != NULL){
@@ -712,6 +709,34 @@ ags_pattern_find_near_timestamp(GList *pattern, GObject *timestamp)
   return(NULL);
 }
 
+void
+ags_pattern_index_bitmap(AgsPattern *pattern)
+{
+  guint i, j;
+
+  free(pattern->bitmap_row);
+  free(pattern->pattern);
+
+  pattern->bitmap_row = NULL;
+  pattern->pattern = NULL;
+
+  if(pattern->bitmap == NULL){
+    return;
+  }
+
+  /* the rows point into the contiguous bitmap */
+  pattern->bitmap_row = (guint **) malloc(pattern->dim[0] * pattern->dim[1] * sizeof(guint *));
+  pattern->pattern = (guint ***) malloc(pattern->dim[0] * sizeof(guint **));
+
+  for(i = 0; i < pattern->dim[0]; i++){
+    pattern->pattern[i] = &(pattern->bitmap_row[i * pattern->dim[1]]);
+
+    for(j = 0; j < pattern->dim[1]; j++){
+      pattern->pattern[i][j] = &(pattern->bitmap[(i * pattern->dim[1] + j) * pattern->stride]);
+    }
+  }
+}
+
 /**
  * ags_pattern_set_dim:
  * @pattern: an #AgsPattern
@@ -719,179 +744,135 @@ ags_pattern_find_near_timestamp(GList *pattern, GObject *timestamp)
  * @dim1: bank 1 size
  * @length: amount of beats
  *
- * Reallocates the pattern's dimensions.
+ * Reallocates the pattern's dimensions. All banks are stored in one contiguous
+ * bitmap, the tics within the new dimensions are kept. The bitmap is swapped
+ * while holding the pattern's mutex and, if the pattern was added to a channel
+ * of an #AgsAudio, the audio's mutex.
  *
  * Since: 0.3
  */
 void 
 ags_pattern_set_dim(AgsPattern *pattern, guint dim0, guint dim1, guint length)
 {
-  guint ***index0, **index1, *bitmap;
-  guint i, j, k, j_set, k_set;
-  guint bitmap_size;
+  AgsMutexManager *mutex_manager;
 
-  if(dim0 == 0 && pattern->pattern == NULL){
-    return;
-  }
+  guint *bitmap;
   
-  // shrink
-  if(pattern->dim[0] > dim0){
-    for(i = dim0; i < pattern->dim[0]; i++){
-      for(j = 0; j < pattern->dim[1]; j++){
-	free(pattern->pattern[i][j]);
-      }
+  guint stride;
+  guint copy_dim0, copy_dim1, copy_stride;
+  guint i, j;
 
-      free(pattern->pattern[i]);
-    }
+  pthread_mutex_t *application_mutex;
+  pthread_mutex_t *audio_mutex;
+  pthread_mutex_t *pattern_mutex;
 
-    if(dim0 == 0){
-      free(pattern->pattern);
-      
-      pattern->pattern = NULL;
-      pattern->dim[0] = 0;
+  static const guint word_size = sizeof(guint) * 8;
+  
+  /* lookup audio and pattern mutex */
+  mutex_manager = ags_mutex_manager_get_instance();
+  application_mutex = ags_mutex_manager_get_application_mutex(mutex_manager);
 
-      return;
-    }else{
-      pattern->pattern = (guint ***) realloc(pattern->pattern,
-					     (int) dim0 * sizeof(guint **));
+  audio_mutex = NULL;
+  
+  pthread_mutex_lock(application_mutex);
 
-      pattern->dim[0] = dim0;
-    }
+  if(pattern->channel != NULL &&
+     AGS_CHANNEL(pattern->channel)->audio != NULL){
+    audio_mutex = ags_mutex_manager_lookup(mutex_manager,
+					   AGS_CHANNEL(pattern->channel)->audio);
   }
+  
+  pattern_mutex = ags_mutex_manager_lookup(mutex_manager,
+					   (GObject *) pattern);
+  
+  pthread_mutex_unlock(application_mutex);
 
-  if(pattern->dim[1] > dim1){
-    if(dim1 == 0){
-      for(i = 0; i < pattern->dim[0]; i++){
-	for(j = dim1; j < pattern->dim[1]; j++){
-	  free(pattern->pattern[i][j]);
-	}
-
-	pattern->pattern[i] = NULL;
-      }
-
-      pattern->dim[1] = 0;
-      
-      return;
-    }else{
-      for(i = 0; i < pattern->dim[0]; i++){
-	for(j = dim1; j < pattern->dim[1]; j++){
-	  free(pattern->pattern[i][j]);
-	}
-      }
-
-      for(i = 0; pattern->dim[0]; i++){
-	pattern->pattern[i] = (guint **) realloc(pattern->pattern[i],
-						 dim1 * sizeof(guint *));
-      }
-
-      pattern->dim[1] = dim1;
-    }
+  /* the audio thread scans the bitmap holding only the audio mutex */
+  if(audio_mutex != NULL){
+    pthread_mutex_lock(audio_mutex);
   }
+  
+  pthread_mutex_lock(pattern_mutex);
+  
+  if(dim0 == 0 && pattern->pattern == NULL){
+    pthread_mutex_unlock(pattern_mutex);
 
-  if(pattern->dim[2] > length){
-    if(length == 0){
-      for(i = 0; i < pattern->dim[0]; i++){
-	for(j = 0; j < pattern->dim[1]; j++){
-      	  free(pattern->pattern[i][j]);
-	  
-	  pattern->pattern[i][j] = NULL;
-	}
-      }
-
-      pattern->dim[2] = 0;
-    }else{
-      for(i = 0; i < pattern->dim[0]; i++){
-	for(j = 0; j < pattern->dim[1]; j++){
-	  pattern->pattern[i][j] = (guint *) realloc(pattern->pattern[i][j],
-						     (int) ceil((double) length / (double) (sizeof(guint) * 8)) * sizeof(guint));
-	}
-      }
-
-      pattern->dim[2] = length;
+    if(audio_mutex != NULL){
+      pthread_mutex_unlock(audio_mutex);
     }
-  }
-
-  // grow
-  bitmap_size = (int) ceil((double) pattern->dim[2] / (double) (sizeof(guint) * 8)) * sizeof(guint);
     
-  if(pattern->dim[0] < dim0){
-    if(pattern->pattern == NULL){
-      pattern->pattern = (guint ***) malloc(dim0 * sizeof(guint **));
-    }else{
-      pattern->pattern = (guint ***) realloc(pattern->pattern,
-					     dim0 * sizeof(guint **));
-    }
+    return;
+  }
 
-    for(i = pattern->dim[0]; i < dim0; i++){
-      pattern->pattern[i] = (guint **) malloc(pattern->dim[1] * sizeof(guint *));
+  /* keep at least one word per bank, so a zero length still has rows */
+  stride = (length + word_size - 1) / word_size;
 
-      for(j = 0; j < pattern->dim[1]; j++){
-	if(bitmap_size == 0){
-	  pattern->pattern[i][j] = NULL;
-	}else{
-	  pattern->pattern[i][j] = (guint *) malloc(bitmap_size);
-	  memset(pattern->pattern[i][j], 0, bitmap_size);
+  if(stride == 0){
+    stride = 1;
+  }
+  
+  /* allocate new bitmap and copy the intersection */
+  bitmap = NULL;
+  
+  if(dim0 * dim1 != 0){
+    bitmap = (guint *) malloc(dim0 * dim1 * stride * sizeof(guint));
+    memset(bitmap, 0, dim0 * dim1 * stride * sizeof(guint));
+
+    if(pattern->bitmap != NULL){
+      copy_dim0 = (pattern->dim[0] < dim0) ? pattern->dim[0]: dim0;
+      copy_dim1 = (pattern->dim[1] < dim1) ? pattern->dim[1]: dim1;
+      copy_stride = (pattern->stride < stride) ? pattern->stride: stride;
+      
+      for(i = 0; i < copy_dim0; i++){
+	for(j = 0; j < copy_dim1; j++){
+	  memcpy(&(bitmap[(i * dim1 + j) * stride]),
+		 &(pattern->bitmap[(i * pattern->dim[1] + j) * pattern->stride]),
+		 copy_stride * sizeof(guint));
+
+	  /* clear the tics beyond length */
+	  if(length < pattern->dim[2] &&
+	     length % word_size != 0){
+	    bitmap[(i * dim1 + j) * stride + stride - 1] &= ((1U << (length % word_size)) - 1);
+	  }else if(length == 0){
+	    bitmap[(i * dim1 + j) * stride] = 0;
+	  }
 	}
       }
     }
-
-    pattern->dim[0] = dim0;
   }
 
-  if(pattern->dim[1] < dim1){  
-    for(i = 0; i < pattern->dim[0]; i++){
-      if(pattern->pattern[i] == NULL){
-	pattern->pattern[i] = (guint **) malloc(dim1 * sizeof(guint *));
-      }else{
-	pattern->pattern[i] = (guint **) realloc(pattern->pattern[i],
-						 dim1 * sizeof(guint *));
-      }
+  free(pattern->bitmap);
 
-      for(j = pattern->dim[1]; j < dim1; j++){
-	if(bitmap_size == 0){
-	  pattern->pattern[i][j] = NULL;
-	}else{
-	  pattern->pattern[i][j] = (guint *) malloc(bitmap_size);
-	  memset(pattern->pattern[i][j], 0, bitmap_size);
-	}
-      }
-    }
+  pattern->bitmap = bitmap;
+  pattern->stride = stride;
+  
+  pattern->dim[0] = dim0;
+  pattern->dim[1] = dim1;
+  pattern->dim[2] = length;
 
-    pattern->dim[1] = dim1;
-  }
+  ags_pattern_index_bitmap(pattern);
 
-  if(pattern->dim[2] < length){
-    guint new_bitmap_size;
-    
-    new_bitmap_size = (int) ceil((double) length / (double) (sizeof(guint) * 8)) * sizeof(guint);
-    
-    for(i = 0; i < pattern->dim[0]; i++){
-      for(j = 0; j < pattern->dim[1]; j++){
-	if(pattern->pattern[i][j] == NULL){
-	  pattern->pattern[i][j] = (guint *) malloc(new_bitmap_size);
-	  memset(pattern->pattern[i][j], 0, new_bitmap_size);
-	}else{
-	  pattern->pattern[i][j] =(guint *) realloc(pattern->pattern[i][j],
-						    new_bitmap_size);
-	  memset(pattern->pattern[i][j] + bitmap_size, 0, new_bitmap_size - bitmap_size);
-	}
-      }
-    }
+  pthread_mutex_unlock(pattern_mutex);
 
-    pattern->dim[2] = length;
+  if(audio_mutex != NULL){
+    pthread_mutex_unlock(audio_mutex);
   }
 }
 
 gboolean
 ags_pattern_is_empty(AgsPattern *pattern, guint i, guint j)
 {
-  guint bitmap_length;
+  guint *row;
   guint n;
 
-  bitmap_length = (guint) ceil((double) pattern->dim[2] / (double) (sizeof(guint) * 8));
+  if(pattern->bitmap == NULL){
+    return(TRUE);
+  }
+  
+  row = &(pattern->bitmap[(i * pattern->dim[1] + j) * pattern->stride]);
 
-  for(n = 0; n < bitmap_length; n++){
-    if(pattern->pattern[i][j][n] != 0){
+  for(n = 0; n < pattern->stride; n++){
+    if(row[n] != 0){
       return(FALSE);
     }
   }
@@ -917,14 +898,20 @@ ags_pattern_get_bit(AgsPattern *pattern, guint i, guint j, guint bit)
 {
   guint k, value;
 
-  k = (guint) floor((double) bit / (double) (sizeof(guint) * 8));
-  value = 1 << (bit % (sizeof(guint) * 8));
+  static const guint word_size = sizeof(guint) * 8;
+
+  if(pattern->bitmap == NULL){
+    return(FALSE);
+  }
+  
+  k = (i * pattern->dim[1] + j) * pattern->stride + bit / word_size;
+  value = 1U << (bit % word_size);
 
-  //((1 << (bit % (sizeof(guint) *8))) & (pattern->pattern[i][j][(guint) floor((double) bit / (double) (sizeof(guint) * 8))])) != 0
-  if((value & (pattern->pattern[i][j][k])) != 0)
+  if((value & (pattern->bitmap[k])) != 0){
     return(TRUE);
-  else
+  }else{
     return(FALSE);
+  }
 }
 
 /**
@@ -943,14 +930,184 @@ ags_pattern_toggle_bit(AgsPattern *pattern, guint i, guint j, guint bit)
 {
   guint k, value;
 
-  k = (guint) floor((double) bit / (double) (sizeof(guint) * 8));
-  value = 1 << (bit % (sizeof(guint) * 8));
+  static const guint word_size = sizeof(guint) * 8;
+
+  if(pattern->bitmap == NULL){
+    return;
+  }
+  
+  k = (i * pattern->dim[1] + j) * pattern->stride + bit / word_size;
+  value = 1U << (bit % word_size);
+
+  pattern->bitmap[k] ^= value;
+}
+
+/**
+ * ags_pattern_clear:
+ * @pattern: an #AgsPattern
+ * @i: bank index 0
+ * @j: bank index 1
+ *
+ * Clear all tics of bank @i, @j.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_pattern_clear(AgsPattern *pattern, guint i, guint j)
+{
+  if(pattern->bitmap == NULL){
+    return;
+  }
+  
+  memset(&(pattern->bitmap[(i * pattern->dim[1] + j) * pattern->stride]), 0,
+	 pattern->stride * sizeof(guint));
+}
+
+/**
+ * ags_pattern_copy_bank:
+ * @pattern: an #AgsPattern
+ * @src_i: source bank index 0
+ * @src_j: source bank index 1
+ * @dst_i: destination bank index 0
+ * @dst_j: destination bank index 1
+ *
+ * Copy all tics of bank @src_i, @src_j to bank @dst_i, @dst_j.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_pattern_copy_bank(AgsPattern *pattern,
+		      guint src_i, guint src_j,
+		      guint dst_i, guint dst_j)
+{
+  if(pattern->bitmap == NULL ||
+     (src_i == dst_i && src_j == dst_j)){
+    return;
+  }
+  
+  memcpy(&(pattern->bitmap[(dst_i * pattern->dim[1] + dst_j) * pattern->stride]),
+	 &(pattern->bitmap[(src_i * pattern->dim[1] + src_j) * pattern->stride]),
+	 pattern->stride * sizeof(guint));
+}
+
+/**
+ * ags_pattern_shift:
+ * @pattern: an #AgsPattern
+ * @i: bank index 0
+ * @j: bank index 1
+ * @n_tics: the count of tics to shift, positive values move towards the end
+ *
+ * Shift all tics of bank @i, @j by @n_tics. Tics moved beyond the pattern's
+ * length are dropped and the vacated tics are cleared.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_pattern_shift(AgsPattern *pattern, guint i, guint j, gint n_tics)
+{
+  guint *row;
+  
+  guint word_shift, bit_shift;
+  guint value;
+  gint k;
+  
+  static const guint word_size = sizeof(guint) * 8;
+
+  if(pattern->bitmap == NULL ||
+     n_tics == 0){
+    return;
+  }
+
+  row = &(pattern->bitmap[(i * pattern->dim[1] + j) * pattern->stride]);
+
+  if((guint) abs(n_tics) >= pattern->dim[2]){
+    memset(row, 0,
+	   pattern->stride * sizeof(guint));
+
+    return;
+  }
+  
+  word_shift = (guint) abs(n_tics) / word_size;
+  bit_shift = (guint) abs(n_tics) % word_size;
+
+  if(n_tics > 0){
+    /* towards the end */
+    for(k = pattern->stride - 1; k >= 0; k--){
+      value = 0;
+      
+      if((guint) k >= word_shift){
+	value = row[k - word_shift] << bit_shift;
+
+	if(bit_shift != 0 &&
+	   (guint) k > word_shift){
+	  value |= (row[k - word_shift - 1] >> (word_size - bit_shift));
+	}
+      }
+
+      row[k] = value;
+    }
+
+    /* clear the tics beyond length */
+    if(pattern->dim[2] % word_size != 0){
+      row[pattern->stride - 1] &= ((1U << (pattern->dim[2] % word_size)) - 1);
+    }
+  }else{
+    /* towards the beginning */
+    for(k = 0; k < pattern->stride; k++){
+      value = 0;
+
+      if(k + word_shift < pattern->stride){
+	value = row[k + word_shift] >> bit_shift;
+
+	if(bit_shift != 0 &&
+	   k + word_shift + 1 < pattern->stride){
+	  value |= (row[k + word_shift + 1] << (word_size - bit_shift));
+	}
+      }
+
+      row[k] = value;
+    }
+  }
+}
 
+/**
+ * ags_pattern_count_bits:
+ * @pattern: an #AgsPattern
+ * @i: bank index 0
+ * @j: bank index 1
+ *
+ * Count the tics set in bank @i, @j.
+ *
+ * Returns: the count of tics set
+ *
+ * Since: 0.7.136
+ */
+guint
+ags_pattern_count_bits(AgsPattern *pattern, guint i, guint j)
+{
+  guint *row;
+  
+  guint count;
+  guint value;
+  guint n;
+
+  if(pattern->bitmap == NULL){
+    return(0);
+  }
+  
+  row = &(pattern->bitmap[(i * pattern->dim[1] + j) * pattern->stride]);
+  count = 0;
+  
+  for(n = 0; n < pattern->stride; n++){
+    value = row[n];
+
+    while(value != 0){
+      value &= (value - 1);
+      count++;
+    }
+  }
 
-  if(value & (pattern->pattern[i][j][k]))
-    pattern->pattern[i][j][k] &= (~value);
-  else
-    pattern->pattern[i][j][k] |= value;
+  return(count);
 }
 
 /**
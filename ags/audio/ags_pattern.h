@@ -55,10 +55,17 @@ struct _AgsPattern
   GObject gobject;
 
   guint flags;
+
+  GObject *channel;
   
   GObject *timestamp;
 
   guint dim[3];
+
+  guint stride;
+  guint *bitmap;
+  guint **bitmap_row;
+  
   guint ***pattern;
 
   GObject *port;
@@ -84,6 +91,13 @@ gboolean ags_pattern_is_empty(AgsPattern *pattern, guint i, guint j);
 gboolean ags_pattern_get_bit(AgsPattern *pattern, guint i, guint j, guint bit);
 void ags_pattern_toggle_bit(AgsPattern *pattern, guint i, guint j, guint bit);
 
+void ags_pattern_clear(AgsPattern *pattern, guint i, guint j);
+void ags_pattern_copy_bank(AgsPattern *pattern,
+			   guint src_i, guint src_j,
+			   guint dst_i, guint dst_j);
+void ags_pattern_shift(AgsPattern *pattern, guint i, guint j, gint n_tics);
+guint ags_pattern_count_bits(AgsPattern *pattern, guint i, guint j);
+
 AgsPattern* ags_pattern_new();
 
 #endif /*__AGS_PATTERN_H__*/
@@ -27,10 +27,39 @@
 #include <ags/audio/ags_audio_signal.h>
 #include <ags/audio/ags_audio_buffer_util.h>
 
+#include <stdlib.h>
 #include <math.h>
+#include <pthread.h>
+#include <sched.h>
+
+typedef struct _AgsPlayableStreamJob AgsPlayableStreamJob;
+
+struct _AgsPlayableStreamJob
+{
+  AgsPlayable *playable;
+  GList *audio_signal;
+  
+  GList **current;
+
+  guint start_channel;
+  guint channels;
+  guint format;
+  guint buffer_size;
+  guint frames;
+  guint length;
+  guint position;
+
+  gboolean do_close;
+};
 
 void ags_playable_base_init(AgsPlayableInterface *interface);
 
+void ags_playable_stream_create_thread();
+void* ags_playable_stream_thread_loop(void *ptr);
+gboolean ags_playable_stream_read_chunk(AgsPlayableStreamJob *job);
+void ags_playable_stream_job_free(AgsPlayableStreamJob *job);
+void ags_playable_stream_finish(AgsPlayable *playable);
+
 /**
  * SECTION:ags_playable
  * @short_description: read/write audio
@@ -40,8 +69,19 @@ void ags_playable_base_init(AgsPlayableInterface *interface);
  *
  * The #AgsPlayable interface gives you a unique access to file related
  * IO operations.
+ *
+ * The tail of a sample read by ags_playable_read_audio_signal() is read by
+ * a low priority thread. Functions changing the position or selection of
+ * the playable finish pending reads in the calling thread first.
  */
 
+static GList *ags_playable_stream_job = NULL;
+
+static pthread_t ags_playable_stream_thread;
+static pthread_once_t ags_playable_stream_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t ags_playable_stream_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t ags_playable_stream_cond = PTHREAD_COND_INITIALIZER;
+
 GType
 ags_playable_get_type()
 {
@@ -255,6 +295,8 @@ ags_playable_level_select(AgsPlayable *playable,
   AgsPlayableInterface *playable_interface;
 
   g_return_if_fail(AGS_IS_PLAYABLE(playable));
+  ags_playable_stream_finish(playable);
+
   playable_interface = AGS_PLAYABLE_GET_INTERFACE(playable);
   g_return_if_fail(playable_interface->level_select);
   playable_interface->level_select(playable, nth_level, sublevel_name, error);
@@ -278,6 +320,8 @@ ags_playable_level_up(AgsPlayable *playable,
   AgsPlayableInterface *playable_interface;
 
   g_return_if_fail(AGS_IS_PLAYABLE(playable));
+  ags_playable_stream_finish(playable);
+
   playable_interface = AGS_PLAYABLE_GET_INTERFACE(playable);
   g_return_if_fail(playable_interface->level_up);
   playable_interface->level_up(playable, levels, error);
@@ -297,6 +341,8 @@ ags_playable_iter_start(AgsPlayable *playable)
   AgsPlayableInterface *playable_interface;
 
   g_return_if_fail(AGS_IS_PLAYABLE(playable));
+  ags_playable_stream_finish(playable);
+
   playable_interface = AGS_PLAYABLE_GET_INTERFACE(playable);
   g_return_if_fail(playable_interface->iter_start);
   playable_interface->iter_start(playable);
@@ -319,6 +365,8 @@ ags_playable_iter_next(AgsPlayable *playable)
   gboolean ret_val;
 
   g_return_val_if_fail(AGS_IS_PLAYABLE(playable), FALSE);
+  ags_playable_stream_finish(playable);
+
   playable_interface = AGS_PLAYABLE_GET_INTERFACE(playable);
   g_return_val_if_fail(playable_interface->iter_next, FALSE);
   ret_val = playable_interface->iter_next(playable);
@@ -420,12 +468,58 @@ ags_playable_read(AgsPlayable *playable,
 
   g_return_val_if_fail(AGS_IS_PLAYABLE(playable),
 		       NULL);
+  ags_playable_stream_finish(playable);
+
   playable_interface = AGS_PLAYABLE_GET_INTERFACE(playable);
   g_return_val_if_fail(playable_interface->read,
 		       NULL);
   playable_interface->read(playable, channel, error);
 }
 
+/**
+ * ags_playable_read_chunk:
+ * @playable: an #AgsPlayable
+ * @channel: nth channel
+ * @buffer: the audio buffer to fill
+ * @format: the #AgsSoundcardFormat of @buffer
+ * @offset: the first frame to read
+ * @n_frames: the count of frames to read
+ * @error: returned error
+ *
+ * Read @n_frames of @channel starting at @offset directly into @buffer,
+ * converted to @format. Like ags_audio_buffer_util_copy_buffer_to_buffer()
+ * the frames are added to @buffer. Implementations read no more than the
+ * requested frames from their source, so a whole file or sample doesn't
+ * need to be kept in memory.
+ *
+ * Returns: the count of frames read
+ *
+ * Since: 0.7.136
+ */
+guint
+ags_playable_read_chunk(AgsPlayable *playable,
+			guint channel,
+			void *buffer, guint format,
+			guint offset, guint n_frames,
+			GError **error)
+{
+  AgsPlayableInterface *playable_interface;
+
+  g_return_val_if_fail(AGS_IS_PLAYABLE(playable),
+		       0);
+  ags_playable_stream_finish(playable);
+
+  playable_interface = AGS_PLAYABLE_GET_INTERFACE(playable);
+  g_return_val_if_fail(playable_interface->read_chunk,
+		       0);
+
+  return(playable_interface->read_chunk(playable,
+					channel,
+					buffer, format,
+					offset, n_frames,
+					error));
+}
+
 /**
  * ags_playable_write:
  * @playable: an #AgsPlayable
@@ -443,6 +537,8 @@ ags_playable_write(AgsPlayable *playable,
   AgsPlayableInterface *playable_interface;
 
   g_return_if_fail(AGS_IS_PLAYABLE(playable));
+  ags_playable_stream_finish(playable);
+
   playable_interface = AGS_PLAYABLE_GET_INTERFACE(playable);
   g_return_if_fail(playable_interface->write);
   playable_interface->write(playable, buffer, buffer_length);
@@ -462,6 +558,8 @@ ags_playable_flush(AgsPlayable *playable)
   AgsPlayableInterface *playable_interface;
 
   g_return_if_fail(AGS_IS_PLAYABLE(playable));
+  ags_playable_stream_finish(playable);
+
   playable_interface = AGS_PLAYABLE_GET_INTERFACE(playable);
   g_return_if_fail(playable_interface->flush);
   playable_interface->flush(playable);
@@ -484,6 +582,8 @@ ags_playable_seek(AgsPlayable *playable,
   AgsPlayableInterface *playable_interface;
 
   g_return_if_fail(AGS_IS_PLAYABLE(playable));
+  ags_playable_stream_finish(playable);
+
   playable_interface = AGS_PLAYABLE_GET_INTERFACE(playable);
   g_return_if_fail(playable_interface->seek);
   playable_interface->seek(playable, frames, whence);
@@ -493,7 +593,8 @@ ags_playable_seek(AgsPlayable *playable,
  * ags_playable_close:
  * @playable: an #AgsPlayable
  *
- * Close audio file.
+ * Close audio file. If the tail of a sample is still read in the background
+ * the file is closed as soon as it is complete.
  *
  * Since: 0.4.2
  */
@@ -502,7 +603,29 @@ ags_playable_close(AgsPlayable *playable)
 {
   AgsPlayableInterface *playable_interface;
 
+  GList *list;
+
   g_return_if_fail(AGS_IS_PLAYABLE(playable));
+
+  /* defer to the stream thread */
+  pthread_mutex_lock(&ags_playable_stream_mutex);
+
+  list = ags_playable_stream_job;
+
+  while(list != NULL){
+    if(((AgsPlayableStreamJob *) list->data)->playable == playable){
+      ((AgsPlayableStreamJob *) list->data)->do_close = TRUE;
+
+      pthread_mutex_unlock(&ags_playable_stream_mutex);
+      
+      return;
+    }
+
+    list = list->next;
+  }
+
+  pthread_mutex_unlock(&ags_playable_stream_mutex);
+
   playable_interface = AGS_PLAYABLE_GET_INTERFACE(playable);
   g_return_if_fail(playable_interface->close);
   playable_interface->close(playable);
@@ -515,7 +638,13 @@ ags_playable_close(AgsPlayable *playable)
  * @start_channel: read from channel
  * @channels_to_read: n-times
  *
- * Read the audio signal of @AgsPlayable.
+ * Read the audio signal of @AgsPlayable. If no resampling is needed and
+ * @playable implements read_chunk(), the streams are filled one buffer at a
+ * time and a sample narrower than the soundcard's format is kept in its own
+ * format, the recalls convert it while mixing. Only the first
+ * %AGS_PLAYABLE_STREAM_HEAD_LENGTH buffers are read before returning, the
+ * tail is read by a low priority thread while %AGS_AUDIO_SIGNAL_STREAM is
+ * set on the returned audio signals.
  *
  * Returns: a #GList of #AgsAudioSignal
  *
@@ -546,6 +675,7 @@ ags_playable_read_audio_signal(AgsPlayable *playable,
   guint samplerate;
   guint buffer_size;
   guint format;
+  guint stream_format;
   guint target_samplerate;
   guint i, j, k, i_stop, j_stop;
   gboolean resample;
@@ -558,6 +688,8 @@ ags_playable_read_audio_signal(AgsPlayable *playable,
   g_return_val_if_fail(AGS_IS_PLAYABLE(playable),
 		       NULL);
 
+  ags_playable_stream_finish(playable);
+  
   error = NULL;
   ags_playable_info(playable,
 		    &channels, &frames,
@@ -666,6 +798,29 @@ ags_playable_read_audio_signal(AgsPlayable *playable,
     resample = TRUE;
   }else{
     resampled_frames = frames;
+    resample = FALSE;
+  }
+
+  /* keep a narrower native bit depth, S8 is skipped because unknown formats are reported as 0 */
+  stream_format = format;
+
+  if(!resample &&
+     AGS_PLAYABLE_GET_INTERFACE(playable)->read_chunk != NULL){
+    switch(ags_playable_get_format(playable)){
+    case AGS_AUDIO_BUFFER_UTIL_S16:
+      stream_format = AGS_SOUNDCARD_SIGNED_16_BIT;
+      break;
+    case AGS_AUDIO_BUFFER_UTIL_S24:
+      stream_format = AGS_SOUNDCARD_SIGNED_24_BIT;
+      break;
+    case AGS_AUDIO_BUFFER_UTIL_S32:
+      stream_format = AGS_SOUNDCARD_SIGNED_32_BIT;
+      break;
+    }
+
+    if(stream_format > format){
+      stream_format = format;
+    }
   }
   
   length = (guint) ceil((double)(resampled_frames) / (double)(buffer_size));
@@ -687,7 +842,7 @@ ags_playable_read_audio_signal(AgsPlayable *playable,
     g_object_set(audio_signal,
 		 "samplerate\0", target_samplerate,
 		 "buffer-size\0", buffer_size,
-		 "format\0", format,
+		 "format\0", stream_format,
 		 NULL);
     
     list = g_list_prepend(list, audio_signal);
@@ -699,6 +854,78 @@ ags_playable_read_audio_signal(AgsPlayable *playable,
 
   j_stop = (guint) floor((double)(resampled_frames) / (double)(buffer_size));
   
+  /* read chunk by chunk in the stream's format */
+  if(!resample &&
+     AGS_PLAYABLE_GET_INTERFACE(playable)->read_chunk != NULL){
+    AgsPlayableStreamJob *job;
+
+    job = (AgsPlayableStreamJob *) malloc(sizeof(AgsPlayableStreamJob));
+
+    job->playable = playable;
+    g_object_ref(playable);
+    
+    job->audio_signal = g_list_copy(list_beginning);
+    g_list_foreach(job->audio_signal,
+		   (GFunc) g_object_ref,
+		   NULL);
+
+    job->current = (GList **) malloc(channels_to_read * sizeof(GList *));
+
+    job->start_channel = start_channel;
+    job->channels = channels_to_read;
+    job->format = stream_format;
+    job->buffer_size = buffer_size;
+    job->frames = resampled_frames;
+    job->length = length;
+    job->position = 0;
+
+    job->do_close = FALSE;
+    
+    for(k = 0; list != NULL; k++){
+      audio_signal = AGS_AUDIO_SIGNAL(list->data);
+      ags_audio_signal_stream_resize(audio_signal, length);
+      audio_signal->loop_start = loop_start;
+      audio_signal->loop_end = loop_end;
+
+      job->current[k] = audio_signal->stream_beginning;
+      
+      list = list->next;
+    }
+
+    /* read the head */
+    while(job->position < AGS_PLAYABLE_STREAM_HEAD_LENGTH &&
+	  ags_playable_stream_read_chunk(job));
+
+    if(job->position >= length){
+      ags_playable_stream_job_free(job);
+      
+      return(list_beginning);
+    }
+
+    /* queue the tail */
+    list = list_beginning;
+
+    while(list != NULL){
+      g_atomic_int_or(&(AGS_AUDIO_SIGNAL(list->data)->flags),
+		      AGS_AUDIO_SIGNAL_STREAM);
+
+      list = list->next;
+    }
+    
+    pthread_once(&ags_playable_stream_once,
+		 ags_playable_stream_create_thread);
+
+    pthread_mutex_lock(&ags_playable_stream_mutex);
+
+    ags_playable_stream_job = g_list_append(ags_playable_stream_job,
+					    job);
+    pthread_cond_signal(&ags_playable_stream_cond);
+    
+    pthread_mutex_unlock(&ags_playable_stream_mutex);
+    
+    return(list_beginning);
+  }
+  
   for(i = start_channel; list != NULL; i++){
     audio_signal = AGS_AUDIO_SIGNAL(list->data);
     ags_audio_signal_stream_resize(audio_signal, length);
@@ -752,3 +979,171 @@ ags_playable_read_audio_signal(AgsPlayable *playable,
 
   return(list_beginning);
 }
+
+void
+ags_playable_stream_create_thread()
+{
+  pthread_attr_t attr;
+  struct sched_param param;
+
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr,
+			      PTHREAD_CREATE_DETACHED);
+
+  /* don't inherit the realtime scheduling of the audio threads */
+  param.sched_priority = 0;
+  
+  pthread_attr_setinheritsched(&attr,
+			       PTHREAD_EXPLICIT_SCHED);
+  pthread_attr_setschedpolicy(&attr,
+			      SCHED_OTHER);
+  pthread_attr_setschedparam(&attr,
+			     &param);
+  
+  pthread_create(&ags_playable_stream_thread, &attr,
+		 ags_playable_stream_thread_loop, NULL);
+
+  pthread_attr_destroy(&attr);
+}
+
+void*
+ags_playable_stream_thread_loop(void *ptr)
+{
+  AgsPlayableStreamJob *job;
+
+  pthread_mutex_lock(&ags_playable_stream_mutex);
+  
+  while(TRUE){
+    while(ags_playable_stream_job == NULL){
+      pthread_cond_wait(&ags_playable_stream_cond,
+			&ags_playable_stream_mutex);
+    }
+
+    /* one buffer of the oldest job at a time */
+    job = (AgsPlayableStreamJob *) ags_playable_stream_job->data;
+    
+    if(!ags_playable_stream_read_chunk(job)){
+      ags_playable_stream_job = g_list_remove(ags_playable_stream_job,
+					      job);
+
+      pthread_mutex_unlock(&ags_playable_stream_mutex);
+
+      ags_playable_stream_job_free(job);
+    }else{
+      pthread_mutex_unlock(&ags_playable_stream_mutex);
+    }
+
+    sched_yield();
+    
+    pthread_mutex_lock(&ags_playable_stream_mutex);
+  }
+
+  pthread_exit(NULL);
+}
+
+gboolean
+ags_playable_stream_read_chunk(AgsPlayableStreamJob *job)
+{
+  GList *list;
+  
+  guint n_frames;
+  guint k;
+
+  GError *error;
+
+  if(job->position >= job->length){
+    return(FALSE);
+  }
+
+  if((job->position + 1) * job->buffer_size <= job->frames){
+    n_frames = job->buffer_size;
+  }else{
+    n_frames = job->frames % job->buffer_size;
+  }
+
+  list = job->audio_signal;
+  
+  for(k = 0; k < job->channels; k++){
+    if(job->current[k] != NULL){
+      /* not the wrapper, it would finish this job */
+      error = NULL;
+      AGS_PLAYABLE_GET_INTERFACE(job->playable)->read_chunk(job->playable,
+							    job->start_channel + k,
+							    job->current[k]->data, job->format,
+							    job->position * job->buffer_size, n_frames,
+							    &error);
+
+      if(error != NULL){
+	g_warning("%s\0", error->message);
+
+	g_error_free(error);
+      }
+
+      job->current[k] = job->current[k]->next;
+    }
+    
+    ags_audio_signal_set_stream_loaded(AGS_AUDIO_SIGNAL(list->data),
+				       job->position + 1);
+
+    list = list->next;
+  }
+
+  job->position++;
+
+  return((job->position < job->length) ? TRUE: FALSE);
+}
+
+void
+ags_playable_stream_job_free(AgsPlayableStreamJob *job)
+{
+  if(job->do_close){
+    AGS_PLAYABLE_GET_INTERFACE(job->playable)->close(job->playable);
+  }
+  
+  g_object_unref(job->playable);
+  
+  g_list_free_full(job->audio_signal,
+		   g_object_unref);
+  free(job->current);
+  
+  free(job);
+}
+
+void
+ags_playable_stream_finish(AgsPlayable *playable)
+{
+  AgsPlayableStreamJob *job;
+
+  GList *list;
+
+  pthread_mutex_lock(&ags_playable_stream_mutex);
+
+  job = NULL;
+  list = ags_playable_stream_job;
+
+  while(list != NULL){
+    if(((AgsPlayableStreamJob *) list->data)->playable == playable){
+      job = (AgsPlayableStreamJob *) list->data;
+
+      break;
+    }
+
+    list = list->next;
+  }
+
+  if(job == NULL){
+    pthread_mutex_unlock(&ags_playable_stream_mutex);
+
+    return;
+  }
+
+  /* read the remaining tail in the calling thread */
+  while(ags_playable_stream_read_chunk(job));
+
+  ags_playable_stream_job = g_list_remove(ags_playable_stream_job,
+					  job);
+
+  pthread_mutex_unlock(&ags_playable_stream_mutex);
+
+  ags_playable_stream_job_free(job);
+}
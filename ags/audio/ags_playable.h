@@ -34,6 +34,8 @@ typedef struct _AgsPlayableInterface AgsPlayableInterface;
 
 #define AGS_PLAYABLE_ERROR (ags_playable_error_quark())
 
+#define AGS_PLAYABLE_STREAM_HEAD_LENGTH (32)
+
 typedef enum{
   AGS_PLAYABLE_ERROR_NO_SUCH_LEVEL,
   AGS_PLAYABLE_ERROR_NO_SAMPLE,
@@ -78,6 +80,11 @@ struct _AgsPlayableInterface
   double* (*read)(AgsPlayable *playable,
 		  guint channel,
 		  GError **error);
+  guint (*read_chunk)(AgsPlayable *playable,
+		      guint channel,
+		      void *buffer, guint format,
+		      guint offset, guint n_frames,
+		      GError **error);
 
   /* write sample data */
   void (*write)(AgsPlayable *playable,
@@ -127,6 +134,11 @@ guint ags_playable_get_format(AgsPlayable *playable);
 double* ags_playable_read(AgsPlayable *playable,
 			  guint channel,
 			  GError **error);
+guint ags_playable_read_chunk(AgsPlayable *playable,
+			     guint channel,
+			     void *buffer, guint format,
+			     guint offset, guint n_frames,
+			     GError **error);
 
 void ags_playable_write(AgsPlayable *playable,
 			double *buffer, guint buffer_length);
@@ -124,6 +124,7 @@ void ags_recall_real_done(AgsRecall *recall);
 
 void ags_recall_real_cancel(AgsRecall *recall);
 void ags_recall_real_remove(AgsRecall *recall);
+void ags_recall_unpack_recursive(AgsRecall *recall);
 
 AgsRecall* ags_recall_real_duplicate(AgsRecall *reall,
 				     AgsRecallID *recall_id,
@@ -1055,10 +1056,13 @@ ags_recall_add_to_registry(AgsConnectable *connectable)
 
   if(server != NULL){
     entry = ags_registry_entry_alloc(server->registry);
-    g_value_set_object(&(entry->entry),
-		       (gpointer) recall);
-    ags_registry_add(server->registry,
-		     entry);
+
+    if(entry != NULL){
+      g_value_set_object(&(entry->entry),
+			 (gpointer) recall);
+      ags_registry_add(server->registry,
+		       entry);
+    }
   }
 }
 
@@ -2043,6 +2047,22 @@ ags_recall_cancel(AgsRecall *recall)
   g_object_unref(G_OBJECT(recall));
 }
 
+void
+ags_recall_unpack_recursive(AgsRecall *recall)
+{
+  GList *list;
+
+  ags_packable_unpack(AGS_PACKABLE(recall));
+
+  list = recall->children;
+
+  while(list != NULL){
+    ags_recall_unpack_recursive(AGS_RECALL(list->data));
+
+    list = list->next;
+  }
+}
+
 void
 ags_recall_real_remove(AgsRecall *recall)
 {
@@ -2081,6 +2101,11 @@ ags_recall_real_remove(AgsRecall *recall)
   /* dispose and unref */
   g_object_ref(recall);
 
+  /* the destroy worker doesn't lock the recall container, so unpack here */
+  if(destroy_worker != NULL){
+    ags_recall_unpack_recursive(recall);
+  }
+  
   if(recall->parent == NULL){
     if(destroy_worker != NULL){
       ags_destroy_worker_add(destroy_worker,
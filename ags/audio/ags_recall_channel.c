@@ -249,6 +249,7 @@ ags_recall_channel_class_init(AgsRecallChannelClass *recall_channel)
    case PROP_SOURCE:
      {
        AgsChannel *source;
+       AgsChannel *old_source;
 
        source = (AgsChannel *) g_value_get_object(value);
 
@@ -256,15 +257,23 @@ ags_recall_channel_class_init(AgsRecallChannelClass *recall_channel)
 	 return;
        }
 
-       if(recall_channel->source != NULL){
-	 g_object_unref(recall_channel->source);
-       }
-	
+       old_source = recall_channel->source;
+
        if(source != NULL){
 	 g_object_ref(source);
        }
        
        recall_channel->source = source;
+
+       if(AGS_RECALL(recall_channel)->container != NULL){
+	 ags_recall_container_reindex((AgsRecallContainer *) AGS_RECALL(recall_channel)->container,
+				      (AgsRecall *) recall_channel,
+				      (GObject *) old_source);
+       }
+
+       if(old_source != NULL){
+	 g_object_unref(old_source);
+       }
      }
      break;
    default:
@@ -384,14 +393,17 @@ ags_recall_channel_pack(AgsPackable *packable, GObject *container)
 	       NULL);
 
   /* set in AgsRecallChannelRun */
-  list = recall_container->recall_channel_run;
+  if(recall_channel->source != NULL){
+    list = ags_recall_container_lookup_recall_channel_run(recall_container,
+							  G_OBJECT(recall_channel->source));
 
-  while((list = ags_recall_find_provider(list, G_OBJECT(recall_channel->source))) != NULL){
-    g_object_set(G_OBJECT(list->data),
-		 "recall_channel\0", recall_channel,
-		 NULL);
+    while(list != NULL){
+      g_object_set(G_OBJECT(list->data),
+		   "recall_channel\0", recall_channel,
+		   NULL);
 
-    list = list->next;
+      list = list->next;
+    }
   }
 
   return(FALSE);
@@ -421,14 +433,17 @@ ags_recall_channel_unpack(AgsPackable *packable)
   g_object_ref(recall_container);
 
   /* unset in AgsRecallChannelRun */
-  list = recall_container->recall_channel_run;
+  if(AGS_RECALL_CHANNEL(packable)->source != NULL){
+    list = ags_recall_container_lookup_recall_channel_run(recall_container,
+							  G_OBJECT(AGS_RECALL_CHANNEL(packable)->source));
 
-  while((list = ags_recall_find_provider(list, G_OBJECT(AGS_RECALL_CHANNEL(packable)->source))) != NULL){
-    g_object_set(G_OBJECT(list->data),
-		 "recall_channel\0", NULL,
-		 NULL);
+    while(list != NULL){
+      g_object_set(G_OBJECT(list->data),
+		   "recall_channel\0", NULL,
+		   NULL);
 
-    list = list->next;
+      list = list->next;
+    }
   }
 
   /* call parent */
@@ -440,8 +455,8 @@ ags_recall_channel_unpack(AgsPackable *packable)
   }
 
   /* remove from list */
-  recall_container->recall_channel = g_list_remove(recall_container->recall_channel,
-						   recall);
+  ags_recall_container_remove_recall_channel(recall_container,
+					     recall);
 
   /* unref */
   g_object_unref(recall);
@@ -467,6 +467,12 @@ ags_recall_channel_run_set_property(GObject *gobject,
       if(source == recall_channel_run->destination){
 	g_warning("destination == recall_channel_run->source\0");
       }
+
+      if(AGS_RECALL(recall_channel_run)->container != NULL){
+	ags_recall_container_reindex((AgsRecallContainer *) AGS_RECALL(recall_channel_run)->container,
+				     (AgsRecall *) recall_channel_run,
+				     (GObject *) old_source);
+      }
       
       if(old_source != NULL){
 	g_object_unref(G_OBJECT(old_source));
@@ -536,8 +542,8 @@ ags_recall_channel_run_dispose(GObject *gobject)
 
     recall_container = AGS_RECALL(gobject)->container;
 
-    recall_container->recall_channel_run = g_list_remove(recall_container->recall_channel_run,
-							 gobject);
+    ags_recall_container_remove_recall_channel_run(recall_container,
+						   (AgsRecall *) gobject);
     g_object_unref(gobject);
     g_object_unref(AGS_RECALL(gobject)->container);
 
@@ -588,8 +594,8 @@ ags_recall_channel_run_finalize(GObject *gobject)
 
     recall_container = AGS_RECALL(gobject)->container;
 
-    recall_container->recall_channel_run = g_list_remove(recall_container->recall_channel_run,
-							 gobject);
+    ags_recall_container_remove_recall_channel_run(recall_container,
+						   (AgsRecall *) gobject);
     g_object_unref(AGS_RECALL(gobject)->container);
   }
 
@@ -734,10 +740,10 @@ ags_recall_channel_run_pack(AgsPackable *packable, GObject *container)
 
   /* set AgsRecallChannel */
   if(AGS_RECALL_CHANNEL_RUN(packable)->source != NULL){
-    list = recall_container->recall_channel;
+    list = ags_recall_container_lookup_recall_channel(recall_container,
+						      G_OBJECT(AGS_RECALL_CHANNEL_RUN(packable)->source));
 
-    if((list = ags_recall_find_provider(list,
-					G_OBJECT(AGS_RECALL_CHANNEL_RUN(packable)->source))) != NULL){
+    if(list != NULL){
       g_object_set(G_OBJECT(packable),
 		   "recall-channel\0", AGS_RECALL_CHANNEL(list->data),
 		   NULL);
@@ -794,8 +800,8 @@ ags_recall_channel_run_unpack(AgsPackable *packable)
   }
 
   /* remove from list */
-  recall_container->recall_channel_run = g_list_remove(recall_container->recall_channel_run,
-						       recall);
+  ags_recall_container_remove_recall_channel_run(recall_container,
+						 recall);
 
   /* unref */
   g_object_unref(recall);
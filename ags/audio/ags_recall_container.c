@@ -43,6 +43,13 @@ void ags_recall_container_connect(AgsConnectable *connectable);
 void ags_recall_container_disconnect(AgsConnectable *connectable);
 void ags_recall_container_finalize(GObject *recall);
 
+void ags_recall_container_index_insert(GHashTable *index,
+				       GObject *source,
+				       AgsRecall *recall);
+void ags_recall_container_index_remove(GHashTable *index,
+				       GObject *source,
+				       AgsRecall *recall);
+
 /**
  * SECTION:ags_recall_container
  * @short_description: Container to group recalls
@@ -51,6 +58,10 @@ void ags_recall_container_finalize(GObject *recall);
  * @include: ags/audio/ags_recall_container.h
  *
  * #AgsRecallContainer groups recalls of different context.
+ *
+ * The channel and channel run recalls are indexed by their source, so
+ * packing a recall of one channel doesn't scan the recalls of all the
+ * other channels.
  */
 
 enum{
@@ -265,7 +276,12 @@ ags_recall_container_init(AgsRecallContainer *recall_container)
   recall_container->recall_audio = NULL;
   recall_container->recall_audio_run = NULL;
   recall_container->recall_channel = NULL;
+  recall_container->recall_channel_index = g_hash_table_new(g_direct_hash,
+							    g_direct_equal);
+
   recall_container->recall_channel_run = NULL;
+  recall_container->recall_channel_run_index = g_hash_table_new(g_direct_hash,
+								g_direct_equal);
 }
 
 void
@@ -352,7 +368,9 @@ ags_recall_container_set_property(GObject *gobject,
       recall_channel = (AgsRecallChannel *) g_value_get_object(value);
 
       if(recall_channel == NULL ||
-	 g_list_find(recall_container->recall_channel, recall_channel) != NULL){
+	 g_list_find(ags_recall_container_lookup_recall_channel(recall_container,
+								(GObject *) recall_channel->source),
+		     recall_channel) != NULL){
 	return;
       }
 
@@ -360,6 +378,9 @@ ags_recall_container_set_property(GObject *gobject,
       
       recall_container->recall_channel = g_list_prepend(recall_container->recall_channel,
 							recall_channel);
+      ags_recall_container_index_insert(recall_container->recall_channel_index,
+					(GObject *) recall_channel->source,
+					(AgsRecall *) recall_channel);
     }
     break;
   case PROP_RECALL_CHANNEL_RUN_TYPE:
@@ -378,7 +399,9 @@ ags_recall_container_set_property(GObject *gobject,
       recall_channel_run = (AgsRecallChannelRun *) g_value_get_object(value);
 
       if(recall_channel_run == NULL ||
-	 g_list_find(recall_container->recall_channel_run, recall_channel_run) != NULL){
+	 g_list_find(ags_recall_container_lookup_recall_channel_run(recall_container,
+								    (GObject *) recall_channel_run->source),
+		     recall_channel_run) != NULL){
 	return;
       }
 
@@ -386,6 +409,9 @@ ags_recall_container_set_property(GObject *gobject,
 
       recall_container->recall_channel_run = g_list_prepend(recall_container->recall_channel_run,
 							    recall_channel_run);
+      ags_recall_container_index_insert(recall_container->recall_channel_run_index,
+					(GObject *) recall_channel_run->source,
+					(AgsRecall *) recall_channel_run);
     }
     break;
   default:
@@ -441,6 +467,9 @@ ags_recall_container_finalize(GObject *gobject)
   AgsRecallContainer *container;
   GList *list, *list_next;
 
+  GHashTableIter iter;
+  gpointer value;
+
   container = AGS_RECALL_CONTAINER(gobject);
 
   ags_packable_unpack(AGS_PACKABLE(container->recall_audio));
@@ -475,6 +504,25 @@ ags_recall_container_finalize(GObject *gobject)
     list = list_next;
   }
 
+  /* index */
+  g_hash_table_iter_init(&iter,
+			 container->recall_channel_index);
+
+  while(g_hash_table_iter_next(&iter, NULL, &value)){
+    g_list_free(value);
+  }
+
+  g_hash_table_destroy(container->recall_channel_index);
+
+  g_hash_table_iter_init(&iter,
+			 container->recall_channel_run_index);
+
+  while(g_hash_table_iter_next(&iter, NULL, &value)){
+    g_list_free(value);
+  }
+
+  g_hash_table_destroy(container->recall_channel_run_index);
+
   /* call parent */
   G_OBJECT_CLASS(ags_recall_container_parent_class)->finalize(gobject);
 }
@@ -543,6 +591,180 @@ ags_recall_container_get_recall_channel_run(AgsRecallContainer *container)
   return(container->recall_channel_run);
 }
 
+void
+ags_recall_container_index_insert(GHashTable *index,
+				  GObject *source,
+				  AgsRecall *recall)
+{
+  GList *list;
+
+  list = g_hash_table_lookup(index,
+			     source);
+  g_hash_table_insert(index,
+		      source,
+		      g_list_prepend(list,
+				     recall));
+}
+
+void
+ags_recall_container_index_remove(GHashTable *index,
+				  GObject *source,
+				  AgsRecall *recall)
+{
+  GList *list;
+
+  list = g_hash_table_lookup(index,
+			     source);
+  list = g_list_remove(list,
+		       recall);
+
+  if(list != NULL){
+    g_hash_table_insert(index,
+			source,
+			list);
+  }else{
+    g_hash_table_remove(index,
+			source);
+  }
+}
+
+/**
+ * ags_recall_container_lookup_recall_channel:
+ * @container: the #AgsRecallContainer
+ * @source: the #AgsChannel
+ *
+ * Retrieve the recall channels of container having @source.
+ *
+ * Returns: the #AgsRecallChannel as list, owned by @container
+ *
+ * Since: 0.7.136
+ */
+GList*
+ags_recall_container_lookup_recall_channel(AgsRecallContainer *container,
+					   GObject *source)
+{
+  return(g_hash_table_lookup(container->recall_channel_index,
+			     source));
+}
+
+/**
+ * ags_recall_container_lookup_recall_channel_run:
+ * @container: the #AgsRecallContainer
+ * @source: the #AgsChannel
+ *
+ * Retrieve the recall channel runs of container having @source.
+ *
+ * Returns: the #AgsRecallChannelRun as list, owned by @container
+ *
+ * Since: 0.7.136
+ */
+GList*
+ags_recall_container_lookup_recall_channel_run(AgsRecallContainer *container,
+					       GObject *source)
+{
+  return(g_hash_table_lookup(container->recall_channel_run_index,
+			     source));
+}
+
+/**
+ * ags_recall_container_remove_recall_channel:
+ * @container: the #AgsRecallContainer
+ * @recall_channel: the #AgsRecallChannel
+ *
+ * Remove @recall_channel from container and its index.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_recall_container_remove_recall_channel(AgsRecallContainer *container,
+					   AgsRecall *recall_channel)
+{
+  if(container == NULL ||
+     recall_channel == NULL){
+    return;
+  }
+
+  container->recall_channel = g_list_remove(container->recall_channel,
+					    recall_channel);
+  ags_recall_container_index_remove(container->recall_channel_index,
+				    (GObject *) AGS_RECALL_CHANNEL(recall_channel)->source,
+				    recall_channel);
+}
+
+/**
+ * ags_recall_container_remove_recall_channel_run:
+ * @container: the #AgsRecallContainer
+ * @recall_channel_run: the #AgsRecallChannelRun
+ *
+ * Remove @recall_channel_run from container and its index.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_recall_container_remove_recall_channel_run(AgsRecallContainer *container,
+					       AgsRecall *recall_channel_run)
+{
+  if(container == NULL ||
+     recall_channel_run == NULL){
+    return;
+  }
+
+  container->recall_channel_run = g_list_remove(container->recall_channel_run,
+						recall_channel_run);
+  ags_recall_container_index_remove(container->recall_channel_run_index,
+				    (GObject *) AGS_RECALL_CHANNEL_RUN(recall_channel_run)->source,
+				    recall_channel_run);
+}
+
+/**
+ * ags_recall_container_reindex:
+ * @container: the #AgsRecallContainer
+ * @recall: the #AgsRecallChannel or #AgsRecallChannelRun
+ * @old_source: the source @recall was indexed with
+ *
+ * Move @recall to the index of its current source, called as the source
+ * of a packed recall changes.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_recall_container_reindex(AgsRecallContainer *container,
+			     AgsRecall *recall,
+			     GObject *old_source)
+{
+  GHashTable *index;
+  GObject *source;
+
+  if(container == NULL ||
+     recall == NULL){
+    return;
+  }
+
+  if(AGS_IS_RECALL_CHANNEL(recall)){
+    index = container->recall_channel_index;
+    source = (GObject *) AGS_RECALL_CHANNEL(recall)->source;
+  }else if(AGS_IS_RECALL_CHANNEL_RUN(recall)){
+    index = container->recall_channel_run_index;
+    source = (GObject *) AGS_RECALL_CHANNEL_RUN(recall)->source;
+  }else{
+    return;
+  }
+
+  if(source == old_source ||
+     g_list_find(g_hash_table_lookup(index,
+				     old_source),
+		 recall) == NULL){
+    return;
+  }
+
+  ags_recall_container_index_remove(index,
+				    old_source,
+				    recall);
+  ags_recall_container_index_insert(index,
+				    source,
+				    recall);
+}
+
 /**
  * ags_recall_container_find:
  * @recall_container: the #AgsRecallContainer
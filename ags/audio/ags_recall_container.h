@@ -59,9 +59,11 @@ struct _AgsRecallContainer
 
   GType recall_channel_type;
   GList *recall_channel;
+  GHashTable *recall_channel_index;
 
   GType recall_channel_run_type;
   GList *recall_channel_run;
+  GHashTable *recall_channel_run_index;
 };
 
 struct _AgsRecallContainerClass
@@ -76,6 +78,20 @@ GList* ags_recall_container_get_recall_audio_run(AgsRecallContainer *container);
 GList* ags_recall_container_get_recall_channel(AgsRecallContainer *container);
 GList* ags_recall_container_get_recall_channel_run(AgsRecallContainer *container);
 
+GList* ags_recall_container_lookup_recall_channel(AgsRecallContainer *container,
+						  GObject *source);
+GList* ags_recall_container_lookup_recall_channel_run(AgsRecallContainer *container,
+						      GObject *source);
+
+void ags_recall_container_remove_recall_channel(AgsRecallContainer *container,
+						AgsRecall *recall_channel);
+void ags_recall_container_remove_recall_channel_run(AgsRecallContainer *container,
+						    AgsRecall *recall_channel_run);
+
+void ags_recall_container_reindex(AgsRecallContainer *container,
+				  AgsRecall *recall,
+				  GObject *old_source);
+
 GList* ags_recall_container_find(GList *recall_container,
 				 GType type,
 				 guint find_flags,
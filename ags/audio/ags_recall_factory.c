@@ -78,6 +78,8 @@
 #include <ags/audio/recall/ags_mute_channel_run.h>
 #include <ags/audio/recall/ags_volume_channel.h>
 #include <ags/audio/recall/ags_volume_channel_run.h>
+#include <ags/audio/recall/ags_oscillator_channel.h>
+#include <ags/audio/recall/ags_oscillator_channel_run.h>
 #include <ags/audio/recall/ags_record_midi_audio.h>
 #include <ags/audio/recall/ags_record_midi_audio_run.h>
 #include <ags/audio/recall/ags_route_dssi_audio.h>
@@ -91,6 +93,18 @@ void ags_recall_factory_class_init(AgsRecallFactoryClass *recall_factory_class);
 void ags_recall_factory_connectable_interface_init(AgsConnectableInterface *connectable);
 void ags_recall_factory_init(AgsRecallFactory *recall_factory);
 
+typedef GList* (*AgsRecallFactoryCreateFunc)(AgsAudio *audio,
+					     AgsRecallContainer *play_container, AgsRecallContainer *recall_container,
+					     gchar *plugin_name,
+					     guint start_audio_channel, guint stop_audio_channel,
+					     guint start_pad, guint stop_pad,
+					     guint create_flags, guint recall_flags);
+
+void ags_recall_factory_create_func_init();
+AgsRecallFactoryCreateFunc ags_recall_factory_lookup_create_func(gchar *plugin_name);
+void ags_recall_factory_connect_recall(GObject *recall,
+				       guint create_flags);
+
 GList* ags_recall_factory_create_play(AgsAudio *audio,
 				      AgsRecallContainer *play_container, AgsRecallContainer *recall_container,
 				      gchar *plugin_name,
@@ -193,6 +207,12 @@ GList* ags_recall_factory_create_volume(AgsAudio *audio,
 					guint start_audio_channel, guint stop_audio_channel,
 					guint start_pad, guint stop_pad,
 					guint create_flags, guint recall_flags);
+GList* ags_recall_factory_create_oscillator(AgsAudio *audio,
+					    AgsRecallContainer *play_container, AgsRecallContainer *recall_container,
+					    gchar *plugin_name,
+					    guint start_audio_channel, guint stop_audio_channel,
+					    guint start_pad, guint stop_pad,
+					    guint create_flags, guint recall_flags);
 GList* ags_recall_factory_create_ladspa(AgsAudio *audio,
 					AgsRecallContainer *play_container, AgsRecallContainer *recall_container,
 					gchar *plugin_name,
@@ -242,6 +262,9 @@ GList* ags_recall_factory_create_route_lv2(AgsAudio *audio,
 
 static gpointer ags_recall_factory_parent_class = NULL;
 
+static pthread_once_t ags_recall_factory_create_func_once = PTHREAD_ONCE_INIT;
+static GHashTable *ags_recall_factory_create_func = NULL;
+
 GType
 ags_recall_factory_get_type (void)
 {
@@ -299,6 +322,77 @@ ags_recall_factory_init(AgsRecallFactory *recall_factory)
 {
 }
 
+void
+ags_recall_factory_create_func_init()
+{
+  static const struct{
+    gchar *plugin_name;
+    AgsRecallFactoryCreateFunc create_func;
+  }create_func[] = {
+    {"ags-delay\0", ags_recall_factory_create_delay},
+    {"ags-count-beats\0", ags_recall_factory_create_count_beats},
+    {"ags-stream\0", ags_recall_factory_create_stream},
+    {"ags-loop\0", ags_recall_factory_create_loop},
+    {"ags-play-master\0", ags_recall_factory_create_play_master},
+    {"ags-prepare\0", ags_recall_factory_create_prepare},
+    {"ags-copy\0", ags_recall_factory_create_copy},
+    {"ags-buffer\0", ags_recall_factory_create_buffer},
+    {"ags-play\0", ags_recall_factory_create_play},
+    {"ags-copy-pattern\0", ags_recall_factory_create_copy_pattern},
+    {"ags-play-dssi\0", ags_recall_factory_create_play_dssi},
+    {"ags-play-lv2\0", ags_recall_factory_create_play_lv2},
+    {"ags-play-notation\0", ags_recall_factory_create_play_notation},
+    {"ags-peak\0", ags_recall_factory_create_peak},
+    {"ags-mute\0", ags_recall_factory_create_mute},
+    {"ags-volume\0", ags_recall_factory_create_volume},
+    {"ags-oscillator\0", ags_recall_factory_create_oscillator},
+    {"ags-ladspa\0", ags_recall_factory_create_ladspa},
+    {"ags-dssi\0", ags_recall_factory_create_dssi},
+    {"ags-lv2\0", ags_recall_factory_create_lv2},
+    {"ags-record-midi\0", ags_recall_factory_create_record_midi},
+    {"ags-route-dssi\0", ags_recall_factory_create_route_dssi},
+    {"ags-route-lv2\0", ags_recall_factory_create_route_lv2},
+  };
+
+  guint i;
+
+  /* resolved once, the table is read-only afterwards */
+  ags_recall_factory_create_func = g_hash_table_new(g_str_hash,
+						    g_str_equal);
+
+  for(i = 0; i < G_N_ELEMENTS(create_func); i++){
+    g_hash_table_insert(ags_recall_factory_create_func,
+			create_func[i].plugin_name,
+			create_func[i].create_func);
+  }
+}
+
+AgsRecallFactoryCreateFunc
+ags_recall_factory_lookup_create_func(gchar *plugin_name)
+{
+  if(plugin_name == NULL){
+    return(NULL);
+  }
+  
+  pthread_once(&ags_recall_factory_create_func_once,
+	       ags_recall_factory_create_func_init);
+
+  return((AgsRecallFactoryCreateFunc) g_hash_table_lookup(ags_recall_factory_create_func,
+							  plugin_name));
+}
+
+void
+ags_recall_factory_connect_recall(GObject *recall,
+				  guint create_flags)
+{
+  /* deferred recalls are connected by the batch or by their owner */
+  if((AGS_RECALL_FACTORY_DEFER_CONNECT & create_flags) != 0){
+    return;
+  }
+
+  ags_connectable_connect(AGS_CONNECTABLE(recall));
+}
+
 GList*
 ags_recall_factory_create_play(AgsAudio *audio,
 			       AgsRecallContainer *play_container, AgsRecallContainer *recall_container,
@@ -362,7 +456,8 @@ ags_recall_factory_create_play(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) play_channel, TRUE);
 	recall = g_list_prepend(recall,
 				play_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(play_channel));
+	ags_recall_factory_connect_recall((GObject *) play_channel,
+					  create_flags);
 	
 	/* AgsPlayChannelRun */
 	play_channel_run = (AgsPlayChannelRun *) g_object_new(AGS_TYPE_PLAY_CHANNEL_RUN,
@@ -377,7 +472,8 @@ ags_recall_factory_create_play(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) play_channel_run, TRUE);
 	recall = g_list_prepend(recall,
 				play_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(play_channel_run));
+	ags_recall_factory_connect_recall((GObject *) play_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -418,7 +514,8 @@ ags_recall_factory_create_play(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) play_channel, FALSE);
 	recall = g_list_prepend(recall,
 				play_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(play_channel));
+	ags_recall_factory_connect_recall((GObject *) play_channel,
+					  create_flags);
 
 	/* AgsPlayChannelRun */
 	play_channel_run = (AgsPlayChannelRun *) g_object_new(AGS_TYPE_PLAY_CHANNEL_RUN,
@@ -433,7 +530,8 @@ ags_recall_factory_create_play(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) play_channel_run, FALSE);
 	recall = g_list_prepend(recall,
 				play_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(play_channel_run));
+	ags_recall_factory_connect_recall((GObject *) play_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -547,7 +645,8 @@ ags_recall_factory_create_play_master(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) play_channel, TRUE);
 	recall = g_list_prepend(recall,
 				play_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(play_channel));
+	ags_recall_factory_connect_recall((GObject *) play_channel,
+					  create_flags);
       
 	/* AgsPlayChannelRun */
 	play_channel_run_master = (AgsPlayChannelRunMaster *) g_object_new(AGS_TYPE_PLAY_CHANNEL_RUN_MASTER,
@@ -564,7 +663,8 @@ ags_recall_factory_create_play_master(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) play_channel_run_master, TRUE);
 	recall = g_list_prepend(recall,
 				play_channel_run_master);
-	ags_connectable_connect(AGS_CONNECTABLE(play_channel_run_master));
+	ags_recall_factory_connect_recall((GObject *) play_channel_run_master,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -638,7 +738,8 @@ ags_recall_factory_create_play_master(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) play_channel, FALSE);
 	recall = g_list_prepend(recall,
 				play_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(play_channel));
+	ags_recall_factory_connect_recall((GObject *) play_channel,
+					  create_flags);
 	
 	/* AgsPlayChannelRun */
 	play_channel_run_master = (AgsPlayChannelRunMaster *) g_object_new(AGS_TYPE_PLAY_CHANNEL_RUN_MASTER,
@@ -655,7 +756,8 @@ ags_recall_factory_create_play_master(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) play_channel_run_master, FALSE);
 	recall = g_list_prepend(recall,
 				play_channel_run_master);
-	ags_connectable_connect(AGS_CONNECTABLE(play_channel_run_master));
+	ags_recall_factory_connect_recall((GObject *) play_channel_run_master,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -764,7 +866,8 @@ ags_recall_factory_create_prepare(AgsAudio *audio,
 	  channel->play = g_list_append(channel->play, prepare_channel);
 	  recall = g_list_prepend(recall,
 				  prepare_channel);
-	  ags_connectable_connect(AGS_CONNECTABLE(prepare_channel));
+	  ags_recall_factory_connect_recall((GObject *) prepare_channel,
+					    create_flags);
 
 	  /* AgsPrepareChannelRun */
 	  prepare_channel_run = (AgsPrepareChannelRun *) g_object_new(AGS_TYPE_PREPARE_CHANNEL_RUN,
@@ -783,7 +886,8 @@ ags_recall_factory_create_prepare(AgsAudio *audio,
 	  channel->play = g_list_append(channel->play, prepare_channel_run);
 	  recall = g_list_prepend(recall,
 				  prepare_channel_run);
-	  ags_connectable_connect(AGS_CONNECTABLE(prepare_channel_run));
+	  ags_recall_factory_connect_recall((GObject *) prepare_channel_run,
+					    create_flags);
 
 	  /* iterate */
 	  output = output->next_pad;
@@ -854,7 +958,8 @@ ags_recall_factory_create_prepare(AgsAudio *audio,
 	  channel->recall = g_list_append(channel->recall, prepare_channel);
 	  recall = g_list_prepend(recall,
 				  prepare_channel);
-	  ags_connectable_connect(AGS_CONNECTABLE(prepare_channel));
+	  ags_recall_factory_connect_recall((GObject *) prepare_channel,
+					    create_flags);
 
 	  /* AgsPrepareChannelRun */
 	  prepare_channel_run = (AgsPrepareChannelRun *) g_object_new(AGS_TYPE_PREPARE_CHANNEL_RUN,
@@ -873,7 +978,8 @@ ags_recall_factory_create_prepare(AgsAudio *audio,
 	  channel->recall = g_list_append(channel->recall, prepare_channel_run);
 	  recall = g_list_prepend(recall,
 				  prepare_channel_run);
-	  ags_connectable_connect(AGS_CONNECTABLE(prepare_channel_run));
+	  ags_recall_factory_connect_recall((GObject *) prepare_channel_run,
+					    create_flags);
 
 	  /* iterate */
 	  output = output->next_pad;
@@ -985,7 +1091,8 @@ ags_recall_factory_create_copy(AgsAudio *audio,
 	  channel->play = g_list_append(channel->play, copy_channel);
 	  recall = g_list_prepend(recall,
 				  copy_channel);
-	  ags_connectable_connect(AGS_CONNECTABLE(copy_channel));
+	  ags_recall_factory_connect_recall((GObject *) copy_channel,
+					    create_flags);
 
 	  /* AgsCopyChannelRun */
 	  copy_channel_run = (AgsCopyChannelRun *) g_object_new(AGS_TYPE_COPY_CHANNEL_RUN,
@@ -1004,7 +1111,8 @@ ags_recall_factory_create_copy(AgsAudio *audio,
 	  channel->play = g_list_append(channel->play, copy_channel_run);
 	  recall = g_list_prepend(recall,
 				  copy_channel_run);
-	  ags_connectable_connect(AGS_CONNECTABLE(copy_channel_run));
+	  ags_recall_factory_connect_recall((GObject *) copy_channel_run,
+					    create_flags);
 
 	  /* iterate */
 	  output = output->next_pad;
@@ -1075,7 +1183,8 @@ ags_recall_factory_create_copy(AgsAudio *audio,
 	  channel->recall = g_list_append(channel->recall, copy_channel);
 	  recall = g_list_prepend(recall,
 				  copy_channel);
-	  ags_connectable_connect(AGS_CONNECTABLE(copy_channel));
+	  ags_recall_factory_connect_recall((GObject *) copy_channel,
+					    create_flags);
 
 	  /* AgsCopyChannelRun */
 	  copy_channel_run = (AgsCopyChannelRun *) g_object_new(AGS_TYPE_COPY_CHANNEL_RUN,
@@ -1094,7 +1203,8 @@ ags_recall_factory_create_copy(AgsAudio *audio,
 	  channel->recall = g_list_append(channel->recall, copy_channel_run);
 	  recall = g_list_prepend(recall,
 				  copy_channel_run);
-	  ags_connectable_connect(AGS_CONNECTABLE(copy_channel_run));
+	  ags_recall_factory_connect_recall((GObject *) copy_channel_run,
+					    create_flags);
 
 	  /* iterate */
 	  output = output->next_pad;
@@ -1179,7 +1289,8 @@ ags_recall_factory_create_feed(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) feed_channel, TRUE);
 	recall = g_list_prepend(recall,
 				feed_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(feed_channel));
+	ags_recall_factory_connect_recall((GObject *) feed_channel,
+					  create_flags);
 
 	/* AgsFeedChannelRun */
 	feed_channel_run = (AgsFeedChannelRun *) g_object_new(AGS_TYPE_FEED_CHANNEL_RUN,
@@ -1196,7 +1307,8 @@ ags_recall_factory_create_feed(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) feed_channel_run, TRUE);
 	recall = g_list_prepend(recall,
 				feed_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(feed_channel_run));
+	ags_recall_factory_connect_recall((GObject *) feed_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -1239,7 +1351,8 @@ ags_recall_factory_create_feed(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) feed_channel, FALSE);
 	recall = g_list_prepend(recall,
 				feed_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(feed_channel));
+	ags_recall_factory_connect_recall((GObject *) feed_channel,
+					  create_flags);
 
 	/* AgsFeedChannelRun */
 	feed_channel_run = (AgsFeedChannelRun *) g_object_new(AGS_TYPE_FEED_CHANNEL_RUN,
@@ -1256,7 +1369,8 @@ ags_recall_factory_create_feed(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) feed_channel_run, FALSE);
 	recall = g_list_prepend(recall,
 				feed_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(feed_channel_run));
+	ags_recall_factory_connect_recall((GObject *) feed_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -1338,7 +1452,8 @@ ags_recall_factory_create_stream(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) stream_channel, TRUE);
 	recall = g_list_prepend(recall,
 				stream_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(stream_channel));
+	ags_recall_factory_connect_recall((GObject *) stream_channel,
+					  create_flags);
 
 	/* AgsStreamChannelRun */
 	stream_channel_run = (AgsStreamChannelRun *) g_object_new(AGS_TYPE_STREAM_CHANNEL_RUN,
@@ -1355,7 +1470,8 @@ ags_recall_factory_create_stream(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) stream_channel_run, TRUE);
 	recall = g_list_prepend(recall,
 				stream_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(stream_channel_run));
+	ags_recall_factory_connect_recall((GObject *) stream_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -1398,7 +1514,8 @@ ags_recall_factory_create_stream(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) stream_channel, FALSE);
 	recall = g_list_prepend(recall,
 				stream_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(stream_channel));
+	ags_recall_factory_connect_recall((GObject *) stream_channel,
+					  create_flags);
 
 	/* AgsStreamChannelRun */
 	stream_channel_run = (AgsStreamChannelRun *) g_object_new(AGS_TYPE_STREAM_CHANNEL_RUN,
@@ -1415,7 +1532,8 @@ ags_recall_factory_create_stream(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) stream_channel_run, FALSE);
 	recall = g_list_prepend(recall,
 				stream_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(stream_channel_run));
+	ags_recall_factory_connect_recall((GObject *) stream_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -1524,7 +1642,8 @@ ags_recall_factory_create_buffer(AgsAudio *audio,
 	  channel->play = g_list_append(channel->play, buffer_channel);
 	  recall = g_list_prepend(recall,
 				  buffer_channel);
-	  ags_connectable_connect(AGS_CONNECTABLE(buffer_channel));
+	  ags_recall_factory_connect_recall((GObject *) buffer_channel,
+					    create_flags);
 
 	  /* AgsBufferChannelRun */
 	  buffer_channel_run = (AgsBufferChannelRun *) g_object_new(AGS_TYPE_BUFFER_CHANNEL_RUN,
@@ -1543,7 +1662,8 @@ ags_recall_factory_create_buffer(AgsAudio *audio,
 	  channel->play = g_list_append(channel->play, buffer_channel_run);
 	  recall = g_list_prepend(recall,
 				  buffer_channel_run);
-	  ags_connectable_connect(AGS_CONNECTABLE(buffer_channel_run));
+	  ags_recall_factory_connect_recall((GObject *) buffer_channel_run,
+					    create_flags);
 
 	  /* iterate */
 	  output = output->next_pad;
@@ -1614,7 +1734,8 @@ ags_recall_factory_create_buffer(AgsAudio *audio,
 	  channel->recall = g_list_append(channel->recall, buffer_channel);
 	  recall = g_list_prepend(recall,
 				  buffer_channel);
-	  ags_connectable_connect(AGS_CONNECTABLE(buffer_channel));
+	  ags_recall_factory_connect_recall((GObject *) buffer_channel,
+					    create_flags);
 
 	  /* AgsBufferChannelRun */
 	  buffer_channel_run = (AgsBufferChannelRun *) g_object_new(AGS_TYPE_BUFFER_CHANNEL_RUN,
@@ -1633,7 +1754,8 @@ ags_recall_factory_create_buffer(AgsAudio *audio,
 	  channel->recall = g_list_append(channel->recall, buffer_channel_run);
 	  recall = g_list_prepend(recall,
 				  buffer_channel_run);
-	  ags_connectable_connect(AGS_CONNECTABLE(buffer_channel_run));
+	  ags_recall_factory_connect_recall((GObject *) buffer_channel_run,
+					    create_flags);
 
 	  /* iterate */
 	  output = output->next_pad;
@@ -1698,7 +1820,8 @@ ags_recall_factory_create_delay(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) delay_audio, TRUE);
     recall = g_list_prepend(recall,
 			    delay_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(delay_audio));
+    ags_recall_factory_connect_recall((GObject *) delay_audio,
+				      create_flags);
 
     delay_audio_run = (AgsDelayAudioRun *) g_object_new(AGS_TYPE_DELAY_AUDIO_RUN,
 							"soundcard\0", audio->soundcard,
@@ -1713,7 +1836,8 @@ ags_recall_factory_create_delay(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) delay_audio_run, TRUE);
     recall = g_list_prepend(recall,
 			    delay_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(delay_audio_run));
+    ags_recall_factory_connect_recall((GObject *) delay_audio_run,
+				      create_flags);
   }
 
   /* recall */
@@ -1737,7 +1861,8 @@ ags_recall_factory_create_delay(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) delay_audio, FALSE);
     recall = g_list_prepend(recall,
 			    delay_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(delay_audio));
+    ags_recall_factory_connect_recall((GObject *) delay_audio,
+				      create_flags);
 
     delay_audio_run = (AgsDelayAudioRun *) g_object_new(AGS_TYPE_DELAY_AUDIO_RUN,
 							"soundcard\0", audio->soundcard,
@@ -1753,7 +1878,8 @@ ags_recall_factory_create_delay(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) delay_audio_run, FALSE);
     recall = g_list_prepend(recall,
 			    delay_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(delay_audio_run));
+    ags_recall_factory_connect_recall((GObject *) delay_audio_run,
+				      create_flags);
   }
 
   /* return instantiated recall */
@@ -1807,7 +1933,8 @@ ags_recall_factory_create_count_beats(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) count_beats_audio, TRUE);
     recall = g_list_prepend(recall,
 			    count_beats_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(count_beats_audio));
+    ags_recall_factory_connect_recall((GObject *) count_beats_audio,
+				      create_flags);
 
     count_beats_audio_run = (AgsCountBeatsAudioRun *) g_object_new(AGS_TYPE_COUNT_BEATS_AUDIO_RUN,
 								   "soundcard\0", audio->soundcard,
@@ -1822,7 +1949,8 @@ ags_recall_factory_create_count_beats(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) count_beats_audio_run, TRUE);
     recall = g_list_prepend(recall,
 			    count_beats_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(count_beats_audio_run));
+    ags_recall_factory_connect_recall((GObject *) count_beats_audio_run,
+				      create_flags);
   }
 
   /* recall */
@@ -1846,7 +1974,8 @@ ags_recall_factory_create_count_beats(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) count_beats_audio, FALSE);
     recall = g_list_prepend(recall,
 			    count_beats_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(count_beats_audio));
+    ags_recall_factory_connect_recall((GObject *) count_beats_audio,
+				      create_flags);
 
     count_beats_audio_run = (AgsCountBeatsAudioRun *) g_object_new(AGS_TYPE_COUNT_BEATS_AUDIO_RUN,
 								   "soundcard\0", audio->soundcard,
@@ -1862,7 +1991,8 @@ ags_recall_factory_create_count_beats(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) count_beats_audio_run, FALSE);
     recall = g_list_prepend(recall,
 			    count_beats_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(count_beats_audio_run));
+    ags_recall_factory_connect_recall((GObject *) count_beats_audio_run,
+				      create_flags);
   }
 
   /* return instantiated recall */
@@ -1940,7 +2070,8 @@ ags_recall_factory_create_loop(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) loop_channel, TRUE);
 	recall = g_list_prepend(recall,
 				loop_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(loop_channel));
+	ags_recall_factory_connect_recall((GObject *) loop_channel,
+					  create_flags);
 
 	/* AgsLoopChannelRun */
 	loop_channel_run = (AgsLoopChannelRun *) g_object_new(AGS_TYPE_LOOP_CHANNEL_RUN,
@@ -1958,7 +2089,8 @@ ags_recall_factory_create_loop(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) loop_channel_run, TRUE);
 	recall = g_list_prepend(recall,
 				loop_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(loop_channel_run));
+	ags_recall_factory_connect_recall((GObject *) loop_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -2005,7 +2137,8 @@ ags_recall_factory_create_loop(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) loop_channel, FALSE);
 	recall = g_list_prepend(recall,
 				loop_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(loop_channel));
+	ags_recall_factory_connect_recall((GObject *) loop_channel,
+					  create_flags);
 
 	/* AgsLoopChannelRun */
 	loop_channel_run = (AgsLoopChannelRun *) g_object_new(AGS_TYPE_LOOP_CHANNEL_RUN,
@@ -2023,7 +2156,8 @@ ags_recall_factory_create_loop(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) loop_channel_run, FALSE);
 	recall = g_list_prepend(recall,
 				loop_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(loop_channel_run));
+	ags_recall_factory_connect_recall((GObject *) loop_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -2160,7 +2294,8 @@ ags_recall_factory_create_copy_pattern(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) copy_pattern_channel, TRUE);
 	recall = g_list_prepend(recall,
 				copy_pattern_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(copy_pattern_channel));
+	ags_recall_factory_connect_recall((GObject *) copy_pattern_channel,
+					  create_flags);
 
 	/* AgsCopyPatternChannelRun */
 	copy_pattern_channel_run = (AgsCopyPatternChannelRun *) g_object_new(AGS_TYPE_COPY_PATTERN_CHANNEL_RUN,
@@ -2177,7 +2312,8 @@ ags_recall_factory_create_copy_pattern(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) copy_pattern_channel_run, TRUE);   
 	recall = g_list_prepend(recall,
 				copy_pattern_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(copy_pattern_channel_run));
+	ags_recall_factory_connect_recall((GObject *) copy_pattern_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -2288,7 +2424,8 @@ ags_recall_factory_create_copy_pattern(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) copy_pattern_channel, FALSE);
 	recall = g_list_prepend(recall,
 				copy_pattern_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(copy_pattern_channel));
+	ags_recall_factory_connect_recall((GObject *) copy_pattern_channel,
+					  create_flags);
 
 	/* AgsCopyPatternChannelRun */
 	copy_pattern_channel_run = (AgsCopyPatternChannelRun *) g_object_new(AGS_TYPE_COPY_PATTERN_CHANNEL_RUN,
@@ -2305,7 +2442,8 @@ ags_recall_factory_create_copy_pattern(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) copy_pattern_channel_run, FALSE);   
 	recall = g_list_prepend(recall,
 				copy_pattern_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(copy_pattern_channel_run));
+	ags_recall_factory_connect_recall((GObject *) copy_pattern_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -2370,7 +2508,8 @@ ags_recall_factory_create_play_dssi(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) play_dssi_audio, TRUE);
     recall = g_list_prepend(recall,
 			    play_dssi_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(play_dssi_audio));
+    ags_recall_factory_connect_recall((GObject *) play_dssi_audio,
+				      create_flags);
 
     play_dssi_audio_run = (AgsPlayDssiAudioRun *) g_object_new(AGS_TYPE_PLAY_DSSI_AUDIO_RUN,
 							       "soundcard\0", audio->soundcard,
@@ -2383,7 +2522,8 @@ ags_recall_factory_create_play_dssi(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) play_dssi_audio_run, TRUE);
     recall = g_list_prepend(recall,
 			    play_dssi_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(play_dssi_audio_run));
+    ags_recall_factory_connect_recall((GObject *) play_dssi_audio_run,
+				      create_flags);
   }
 
   /* recall */
@@ -2410,7 +2550,8 @@ ags_recall_factory_create_play_dssi(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) play_dssi_audio, FALSE);
     recall = g_list_prepend(recall,
 			    play_dssi_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(play_dssi_audio));
+    ags_recall_factory_connect_recall((GObject *) play_dssi_audio,
+				      create_flags);
 
     play_dssi_audio_run = (AgsPlayDssiAudioRun *) g_object_new(AGS_TYPE_PLAY_DSSI_AUDIO_RUN,
 							       "soundcard\0", audio->soundcard,
@@ -2424,7 +2565,8 @@ ags_recall_factory_create_play_dssi(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) play_dssi_audio_run, FALSE);
     recall = g_list_prepend(recall,
 			    play_dssi_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(play_dssi_audio_run));
+    ags_recall_factory_connect_recall((GObject *) play_dssi_audio_run,
+				      create_flags);
   }
 
   /* return instantiated recall */
@@ -2476,7 +2618,8 @@ ags_recall_factory_create_play_lv2(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) play_lv2_audio, TRUE);
     recall = g_list_prepend(recall,
 			    play_lv2_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(play_lv2_audio));
+    ags_recall_factory_connect_recall((GObject *) play_lv2_audio,
+				      create_flags);
 
     play_lv2_audio_run = (AgsPlayLv2AudioRun *) g_object_new(AGS_TYPE_PLAY_LV2_AUDIO_RUN,
 							     "soundcard\0", audio->soundcard,
@@ -2495,7 +2638,8 @@ ags_recall_factory_create_play_lv2(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) play_lv2_audio_run, TRUE);
     recall = g_list_prepend(recall,
 			    play_lv2_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(play_lv2_audio_run));
+    ags_recall_factory_connect_recall((GObject *) play_lv2_audio_run,
+				      create_flags);
   }
 
   /* recall */
@@ -2523,7 +2667,8 @@ ags_recall_factory_create_play_lv2(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) play_lv2_audio, FALSE);
     recall = g_list_prepend(recall,
 			    play_lv2_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(play_lv2_audio));
+    ags_recall_factory_connect_recall((GObject *) play_lv2_audio,
+				      create_flags);
 
     play_lv2_audio_run = (AgsPlayLv2AudioRun *) g_object_new(AGS_TYPE_PLAY_LV2_AUDIO_RUN,
 							     "soundcard\0", audio->soundcard,
@@ -2537,7 +2682,8 @@ ags_recall_factory_create_play_lv2(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) play_lv2_audio_run, FALSE);
     recall = g_list_prepend(recall,
 			    play_lv2_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(play_lv2_audio_run));
+    ags_recall_factory_connect_recall((GObject *) play_lv2_audio_run,
+				      create_flags);
   }
 
   /* return instantiated recall */
@@ -2589,7 +2735,8 @@ ags_recall_factory_create_play_notation(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) play_notation_audio, TRUE);
     recall = g_list_prepend(recall,
 			    play_notation_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(play_notation_audio));
+    ags_recall_factory_connect_recall((GObject *) play_notation_audio,
+				      create_flags);
 
     play_notation_audio_run = (AgsPlayNotationAudioRun *) g_object_new(AGS_TYPE_PLAY_NOTATION_AUDIO_RUN,
 								       "soundcard\0", audio->soundcard,
@@ -2602,7 +2749,8 @@ ags_recall_factory_create_play_notation(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) play_notation_audio_run, TRUE);
     recall = g_list_prepend(recall,
 			    play_notation_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(play_notation_audio_run));
+    ags_recall_factory_connect_recall((GObject *) play_notation_audio_run,
+				      create_flags);
   }
 
   /* recall */
@@ -2624,7 +2772,8 @@ ags_recall_factory_create_play_notation(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) play_notation_audio, FALSE);
     recall = g_list_prepend(recall,
 			    play_notation_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(play_notation_audio));
+    ags_recall_factory_connect_recall((GObject *) play_notation_audio,
+				      create_flags);
 
     play_notation_audio_run = (AgsPlayNotationAudioRun *) g_object_new(AGS_TYPE_PLAY_NOTATION_AUDIO_RUN,
 								       "soundcard\0", audio->soundcard,
@@ -2638,7 +2787,8 @@ ags_recall_factory_create_play_notation(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) play_notation_audio_run, FALSE);
     recall = g_list_prepend(recall,
 			    play_notation_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(play_notation_audio_run));
+    ags_recall_factory_connect_recall((GObject *) play_notation_audio_run,
+				      create_flags);
   }
 
   /* return instantiated recall */
@@ -2712,7 +2862,8 @@ ags_recall_factory_create_peak(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) peak_channel, TRUE);
 	recall = g_list_prepend(recall,
 				peak_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(peak_channel));
+	ags_recall_factory_connect_recall((GObject *) peak_channel,
+					  create_flags);
 
 	/* AgsPeakChannelRun */
 	peak_channel_run = (AgsPeakChannelRun *) g_object_new(AGS_TYPE_PEAK_CHANNEL_RUN,
@@ -2729,7 +2880,8 @@ ags_recall_factory_create_peak(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) peak_channel_run, TRUE);
 	recall = g_list_prepend(recall,
 				peak_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(peak_channel_run));
+	ags_recall_factory_connect_recall((GObject *) peak_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -2772,7 +2924,8 @@ ags_recall_factory_create_peak(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) peak_channel, FALSE);
 	recall = g_list_prepend(recall,
 				peak_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(peak_channel));
+	ags_recall_factory_connect_recall((GObject *) peak_channel,
+					  create_flags);
 
 	/* AgsPeakChannelRun */
 	peak_channel_run = (AgsPeakChannelRun *) g_object_new(AGS_TYPE_PEAK_CHANNEL_RUN,
@@ -2789,7 +2942,8 @@ ags_recall_factory_create_peak(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) peak_channel_run, FALSE);
 	recall = g_list_prepend(recall,
 				peak_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(peak_channel_run));
+	ags_recall_factory_connect_recall((GObject *) peak_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -2954,7 +3108,8 @@ ags_recall_factory_create_mute(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) mute_channel, TRUE);
 	recall = g_list_prepend(recall,
 				mute_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(mute_channel));
+	ags_recall_factory_connect_recall((GObject *) mute_channel,
+					  create_flags);
 
 	/* AgsMuteChannelRun */
 	mute_channel_run = (AgsMuteChannelRun *) g_object_new(AGS_TYPE_MUTE_CHANNEL_RUN,
@@ -2971,7 +3126,8 @@ ags_recall_factory_create_mute(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) mute_channel_run, TRUE);
 	recall = g_list_prepend(recall,
 				mute_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(mute_channel_run));
+	ags_recall_factory_connect_recall((GObject *) mute_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -3083,7 +3239,8 @@ ags_recall_factory_create_mute(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) mute_channel, FALSE);
 	recall = g_list_prepend(recall,
 				mute_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(mute_channel));
+	ags_recall_factory_connect_recall((GObject *) mute_channel,
+					  create_flags);
 
 	/* AgsMuteChannelRun */
 	mute_channel_run = (AgsMuteChannelRun *) g_object_new(AGS_TYPE_MUTE_CHANNEL_RUN,
@@ -3100,7 +3257,8 @@ ags_recall_factory_create_mute(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) mute_channel_run, FALSE);
 	recall = g_list_prepend(recall,
 				mute_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(mute_channel_run));
+	ags_recall_factory_connect_recall((GObject *) mute_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -3182,7 +3340,8 @@ ags_recall_factory_create_volume(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) volume_channel, TRUE);
 	recall = g_list_prepend(recall,
 				volume_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(volume_channel));
+	ags_recall_factory_connect_recall((GObject *) volume_channel,
+					  create_flags);
 
 	/* AgsVolumeChannelRun */
 	volume_channel_run = (AgsVolumeChannelRun *) g_object_new(AGS_TYPE_VOLUME_CHANNEL_RUN,
@@ -3199,7 +3358,8 @@ ags_recall_factory_create_volume(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) volume_channel_run, TRUE);
 	recall = g_list_prepend(recall,
 				volume_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(volume_channel_run));
+	ags_recall_factory_connect_recall((GObject *) volume_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -3242,7 +3402,8 @@ ags_recall_factory_create_volume(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) volume_channel, FALSE);
 	recall = g_list_prepend(recall,
 				volume_channel);
-	ags_connectable_connect(AGS_CONNECTABLE(volume_channel));
+	ags_recall_factory_connect_recall((GObject *) volume_channel,
+					  create_flags);
 
 	/* AgsVolumeChannelRun */
 	volume_channel_run = (AgsVolumeChannelRun *) g_object_new(AGS_TYPE_VOLUME_CHANNEL_RUN,
@@ -3259,7 +3420,169 @@ ags_recall_factory_create_volume(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) volume_channel_run, FALSE);
 	recall = g_list_prepend(recall,
 				volume_channel_run);
-	ags_connectable_connect(AGS_CONNECTABLE(volume_channel_run));
+	ags_recall_factory_connect_recall((GObject *) volume_channel_run,
+					  create_flags);
+
+	/* iterate */
+	channel = channel->next;
+      }
+
+      channel = ags_channel_nth(channel,
+				audio->audio_channels - stop_audio_channel);
+    }
+  }
+
+  /* return instantiated recall */
+  recall = g_list_reverse(recall);
+
+  return(recall);
+}
+
+GList*
+ags_recall_factory_create_oscillator(AgsAudio *audio,
+				     AgsRecallContainer *play_container, AgsRecallContainer *recall_container,
+				     gchar *plugin_name,
+				     guint start_audio_channel, guint stop_audio_channel,
+				     guint start_pad, guint stop_pad,
+				     guint create_flags, guint recall_flags)
+{
+  AgsOscillatorChannel *oscillator_channel;
+  AgsOscillatorChannelRun *oscillator_channel_run;
+  AgsChannel *start, *channel;
+
+  GList *recall;
+
+  guint i, j;
+  
+  if(audio == NULL){
+    return(NULL);
+  }
+
+  if((AGS_RECALL_FACTORY_OUTPUT & (create_flags)) != 0){
+    start =
+      channel = ags_channel_nth(audio->output,
+				start_pad * audio->audio_channels);
+  }else{
+    start =
+      channel = ags_channel_nth(audio->input,
+				start_pad * audio->audio_channels);
+  }
+
+  recall = NULL;
+
+  /* play */
+  if((AGS_RECALL_FACTORY_PLAY & (create_flags)) != 0){
+    if(play_container == NULL){
+      play_container = ags_recall_container_new();
+    }
+
+    play_container->flags |= AGS_RECALL_CONTAINER_PLAY;
+    ags_audio_add_recall_container(audio, (GObject *) play_container);
+
+    for(i = 0; i < stop_pad - start_pad; i++){
+      channel = ags_channel_nth(channel,
+				start_audio_channel);
+      
+      for(j = 0; j < stop_audio_channel - start_audio_channel; j++){
+	ags_channel_add_recall_container(channel, (GObject *) play_container);
+
+	/* AgsOscillatorChannel */
+	oscillator_channel = (AgsOscillatorChannel *) g_object_new(AGS_TYPE_OSCILLATOR_CHANNEL,
+								   "soundcard\0", audio->soundcard,
+								   "source\0", channel,
+								   "recall_container\0", play_container,
+								   NULL);
+							      
+	ags_recall_set_flags(AGS_RECALL(oscillator_channel), (AGS_RECALL_TEMPLATE |
+							      (((AGS_RECALL_FACTORY_OUTPUT & create_flags) != 0) ? AGS_RECALL_OUTPUT_ORIENTATED: AGS_RECALL_INPUT_ORIENTATED) |
+							      AGS_RECALL_PLAYBACK |
+							      AGS_RECALL_SEQUENCER |
+							      AGS_RECALL_NOTATION));
+	ags_channel_add_recall(channel, (GObject *) oscillator_channel, TRUE);
+	recall = g_list_prepend(recall,
+				oscillator_channel);
+	ags_recall_factory_connect_recall((GObject *) oscillator_channel,
+					  create_flags);
+
+	/* AgsOscillatorChannelRun */
+	oscillator_channel_run = (AgsOscillatorChannelRun *) g_object_new(AGS_TYPE_OSCILLATOR_CHANNEL_RUN,
+									  "soundcard\0", audio->soundcard,
+									  "recall-channel\0", oscillator_channel,
+									  "source\0", channel,
+									  "recall_container\0", play_container,
+									  NULL);
+	ags_recall_set_flags(AGS_RECALL(oscillator_channel_run), (AGS_RECALL_TEMPLATE |
+								  (((AGS_RECALL_FACTORY_OUTPUT & create_flags) != 0) ? AGS_RECALL_OUTPUT_ORIENTATED: AGS_RECALL_INPUT_ORIENTATED) |
+								  AGS_RECALL_PLAYBACK |
+								  AGS_RECALL_SEQUENCER |
+								  AGS_RECALL_NOTATION));
+	ags_channel_add_recall(channel, (GObject *) oscillator_channel_run, TRUE);
+	recall = g_list_prepend(recall,
+				oscillator_channel_run);
+	ags_recall_factory_connect_recall((GObject *) oscillator_channel_run,
+					  create_flags);
+
+	/* iterate */
+	channel = channel->next;
+      }
+
+      channel = ags_channel_nth(channel,
+				audio->audio_channels - stop_audio_channel);
+    }
+  }
+
+  /* recall */
+  if((AGS_RECALL_FACTORY_RECALL & (create_flags)) != 0){
+    channel = start;
+
+    if(recall_container == NULL){
+      recall_container = ags_recall_container_new();
+    }
+
+    ags_audio_add_recall_container(audio, (GObject *) recall_container);
+
+    for(i = 0; i < stop_pad - start_pad; i++){
+      channel = ags_channel_nth(channel,
+				start_audio_channel);
+      
+      for(j = 0; j < stop_audio_channel - start_audio_channel; j++){
+	ags_channel_add_recall_container(channel, (GObject *) recall_container);
+
+	/* AgsOscillatorChannel */
+	oscillator_channel = (AgsOscillatorChannel *) g_object_new(AGS_TYPE_OSCILLATOR_CHANNEL,
+								   "soundcard\0", audio->soundcard,
+								   "source\0", channel,
+								   "recall_container\0", recall_container,
+								   NULL);
+							      
+	ags_recall_set_flags(AGS_RECALL(oscillator_channel), (AGS_RECALL_TEMPLATE |
+							      (((AGS_RECALL_FACTORY_OUTPUT & create_flags) != 0) ? AGS_RECALL_OUTPUT_ORIENTATED: AGS_RECALL_INPUT_ORIENTATED) |
+							      AGS_RECALL_PLAYBACK |
+							      AGS_RECALL_SEQUENCER |
+							      AGS_RECALL_NOTATION));
+	ags_channel_add_recall(channel, (GObject *) oscillator_channel, FALSE);
+	recall = g_list_prepend(recall,
+				oscillator_channel);
+	ags_recall_factory_connect_recall((GObject *) oscillator_channel,
+					  create_flags);
+
+	/* AgsOscillatorChannelRun */
+	oscillator_channel_run = (AgsOscillatorChannelRun *) g_object_new(AGS_TYPE_OSCILLATOR_CHANNEL_RUN,
+									  "soundcard\0", audio->soundcard,
+									  "recall_channel\0", oscillator_channel,
+									  "source\0", channel,
+									  "recall_container\0", recall_container,
+									  NULL);
+	ags_recall_set_flags(AGS_RECALL(oscillator_channel_run), (AGS_RECALL_TEMPLATE |
+								  (((AGS_RECALL_FACTORY_OUTPUT & create_flags) != 0) ? AGS_RECALL_OUTPUT_ORIENTATED: AGS_RECALL_INPUT_ORIENTATED) |
+								  AGS_RECALL_PLAYBACK |
+								  AGS_RECALL_SEQUENCER |
+								  AGS_RECALL_NOTATION));
+	ags_channel_add_recall(channel, (GObject *) oscillator_channel_run, FALSE);
+	recall = g_list_prepend(recall,
+				oscillator_channel_run);
+	ags_recall_factory_connect_recall((GObject *) oscillator_channel_run,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -3341,7 +3664,8 @@ ags_recall_factory_create_ladspa(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) recall_ladspa, TRUE);
 	recall = g_list_prepend(recall,
 				recall_ladspa);
-	ags_connectable_connect(AGS_CONNECTABLE(recall_ladspa));
+	ags_recall_factory_connect_recall((GObject *) recall_ladspa,
+					  create_flags);
 
 	/* AgsRecallChannelRunDummy */
 	recall_channel_run_dummy = ags_recall_channel_run_dummy_new(channel,
@@ -3362,7 +3686,8 @@ ags_recall_factory_create_ladspa(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) recall_channel_run_dummy, TRUE);
 	recall = g_list_prepend(recall,
 				recall_channel_run_dummy);
-	ags_connectable_connect(AGS_CONNECTABLE(recall_channel_run_dummy));
+	ags_recall_factory_connect_recall((GObject *) recall_channel_run_dummy,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -3405,7 +3730,8 @@ ags_recall_factory_create_ladspa(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) recall_ladspa, FALSE);
 	recall = g_list_prepend(recall,
 				recall_ladspa);
-	ags_connectable_connect(AGS_CONNECTABLE(recall_ladspa));
+	ags_recall_factory_connect_recall((GObject *) recall_ladspa,
+					  create_flags);
 
 	/* AgsRecallChannelRunDummy */
 	recall_channel_run_dummy = ags_recall_channel_run_dummy_new(channel,
@@ -3425,7 +3751,8 @@ ags_recall_factory_create_ladspa(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) recall_channel_run_dummy, FALSE);
 	recall = g_list_prepend(recall,
 				recall_channel_run_dummy);
-	ags_connectable_connect(AGS_CONNECTABLE(recall_channel_run_dummy));
+	ags_recall_factory_connect_recall((GObject *) recall_channel_run_dummy,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -3507,7 +3834,8 @@ ags_recall_factory_create_lv2(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) recall_lv2, TRUE);
 	recall = g_list_prepend(recall,
 				recall_lv2);
-	ags_connectable_connect(AGS_CONNECTABLE(recall_lv2));
+	ags_recall_factory_connect_recall((GObject *) recall_lv2,
+					  create_flags);
 
 	/* AgsRecallChannelRunDummy */
 	recall_channel_run_dummy = ags_recall_channel_run_dummy_new(channel,
@@ -3528,7 +3856,8 @@ ags_recall_factory_create_lv2(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) recall_channel_run_dummy, TRUE);
 	recall = g_list_prepend(recall,
 				recall_channel_run_dummy);
-	ags_connectable_connect(AGS_CONNECTABLE(recall_channel_run_dummy));
+	ags_recall_factory_connect_recall((GObject *) recall_channel_run_dummy,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -3571,7 +3900,8 @@ ags_recall_factory_create_lv2(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) recall_lv2, FALSE);
 	recall = g_list_prepend(recall,
 				recall_lv2);
-	ags_connectable_connect(AGS_CONNECTABLE(recall_lv2));
+	ags_recall_factory_connect_recall((GObject *) recall_lv2,
+					  create_flags);
 
 	/* AgsRecallChannelRunDummy */
 	recall_channel_run_dummy = ags_recall_channel_run_dummy_new(channel,
@@ -3591,7 +3921,8 @@ ags_recall_factory_create_lv2(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) recall_channel_run_dummy, FALSE);
 	recall = g_list_prepend(recall,
 				recall_channel_run_dummy);
-	ags_connectable_connect(AGS_CONNECTABLE(recall_channel_run_dummy));
+	ags_recall_factory_connect_recall((GObject *) recall_channel_run_dummy,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -3673,7 +4004,8 @@ ags_recall_factory_create_dssi(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) recall_dssi, TRUE);
 	recall = g_list_prepend(recall,
 				recall_dssi);
-	ags_connectable_connect(AGS_CONNECTABLE(recall_dssi));
+	ags_recall_factory_connect_recall((GObject *) recall_dssi,
+					  create_flags);
 
 	/* AgsRecallChannelRunDummy */
 	recall_channel_run_dummy = ags_recall_channel_run_dummy_new(channel,
@@ -3694,7 +4026,8 @@ ags_recall_factory_create_dssi(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) recall_channel_run_dummy, TRUE);
 	recall = g_list_prepend(recall,
 				recall_channel_run_dummy);
-	ags_connectable_connect(AGS_CONNECTABLE(recall_channel_run_dummy));
+	ags_recall_factory_connect_recall((GObject *) recall_channel_run_dummy,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -3737,7 +4070,8 @@ ags_recall_factory_create_dssi(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) recall_dssi, FALSE);
 	recall = g_list_prepend(recall,
 				recall_dssi);
-	ags_connectable_connect(AGS_CONNECTABLE(recall_dssi));
+	ags_recall_factory_connect_recall((GObject *) recall_dssi,
+					  create_flags);
 
 	/* AgsRecallChannelRunDummy */
 	recall_channel_run_dummy = ags_recall_channel_run_dummy_new(channel,
@@ -3757,7 +4091,8 @@ ags_recall_factory_create_dssi(AgsAudio *audio,
 	ags_channel_add_recall(channel, (GObject *) recall_channel_run_dummy, FALSE);
 	recall = g_list_prepend(recall,
 				recall_channel_run_dummy);
-	ags_connectable_connect(AGS_CONNECTABLE(recall_channel_run_dummy));
+	ags_recall_factory_connect_recall((GObject *) recall_channel_run_dummy,
+					  create_flags);
 
 	/* iterate */
 	channel = channel->next;
@@ -3817,7 +4152,8 @@ ags_recall_factory_create_record_midi(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) record_midi_audio, TRUE);
     recall = g_list_prepend(recall,
 			    record_midi_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(record_midi_audio));
+    ags_recall_factory_connect_recall((GObject *) record_midi_audio,
+				      create_flags);
 
     record_midi_audio_run = (AgsRouteDssiAudioRun *) g_object_new(AGS_TYPE_RECORD_MIDI_AUDIO_RUN,
 								  "soundcard\0", audio->soundcard,
@@ -3830,7 +4166,8 @@ ags_recall_factory_create_record_midi(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) record_midi_audio_run, TRUE);
     recall = g_list_prepend(recall,
 			    record_midi_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(record_midi_audio_run));
+    ags_recall_factory_connect_recall((GObject *) record_midi_audio_run,
+				      create_flags);
   }
 
   /* recall */
@@ -3852,7 +4189,8 @@ ags_recall_factory_create_record_midi(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) record_midi_audio, FALSE);
     recall = g_list_prepend(recall,
 			    record_midi_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(record_midi_audio));
+    ags_recall_factory_connect_recall((GObject *) record_midi_audio,
+				      create_flags);
 
     record_midi_audio_run = (AgsRouteDssiAudioRun *) g_object_new(AGS_TYPE_RECORD_MIDI_AUDIO_RUN,
 								  "soundcard\0", audio->soundcard,
@@ -3866,7 +4204,8 @@ ags_recall_factory_create_record_midi(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) record_midi_audio_run, FALSE);
     recall = g_list_prepend(recall,
 			    record_midi_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(record_midi_audio_run));
+    ags_recall_factory_connect_recall((GObject *) record_midi_audio_run,
+				      create_flags);
   }
 
   /* return instantiated recall */
@@ -3918,7 +4257,8 @@ ags_recall_factory_create_route_dssi(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) route_dssi_audio, TRUE);
     recall = g_list_prepend(recall,
 			    route_dssi_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(route_dssi_audio));
+    ags_recall_factory_connect_recall((GObject *) route_dssi_audio,
+				      create_flags);
 
     route_dssi_audio_run = (AgsRouteDssiAudioRun *) g_object_new(AGS_TYPE_ROUTE_DSSI_AUDIO_RUN,
 								 "soundcard\0", audio->soundcard,
@@ -3931,7 +4271,8 @@ ags_recall_factory_create_route_dssi(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) route_dssi_audio_run, TRUE);
     recall = g_list_prepend(recall,
 			    route_dssi_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(route_dssi_audio_run));
+    ags_recall_factory_connect_recall((GObject *) route_dssi_audio_run,
+				      create_flags);
   }
 
   /* recall */
@@ -3953,7 +4294,8 @@ ags_recall_factory_create_route_dssi(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) route_dssi_audio, FALSE);
     recall = g_list_prepend(recall,
 			    route_dssi_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(route_dssi_audio));
+    ags_recall_factory_connect_recall((GObject *) route_dssi_audio,
+				      create_flags);
 
     route_dssi_audio_run = (AgsRouteDssiAudioRun *) g_object_new(AGS_TYPE_ROUTE_DSSI_AUDIO_RUN,
 								 "soundcard\0", audio->soundcard,
@@ -3967,7 +4309,8 @@ ags_recall_factory_create_route_dssi(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) route_dssi_audio_run, FALSE);
     recall = g_list_prepend(recall,
 			    route_dssi_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(route_dssi_audio_run));
+    ags_recall_factory_connect_recall((GObject *) route_dssi_audio_run,
+				      create_flags);
   }
 
   /* return instantiated recall */
@@ -4020,7 +4363,8 @@ ags_recall_factory_create_route_lv2(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) route_lv2_audio, TRUE);
     recall = g_list_prepend(recall,
 			    route_lv2_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(route_lv2_audio));
+    ags_recall_factory_connect_recall((GObject *) route_lv2_audio,
+				      create_flags);
 
     route_lv2_audio_run = (AgsRouteLv2AudioRun *) g_object_new(AGS_TYPE_ROUTE_LV2_AUDIO_RUN,
 							       "soundcard\0", audio->soundcard,
@@ -4035,7 +4379,8 @@ ags_recall_factory_create_route_lv2(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) route_lv2_audio_run, TRUE);
     recall = g_list_prepend(recall,
 			    route_lv2_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(route_lv2_audio_run));
+    ags_recall_factory_connect_recall((GObject *) route_lv2_audio_run,
+				      create_flags);
   }
 
   /* recall */
@@ -4059,7 +4404,8 @@ ags_recall_factory_create_route_lv2(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) route_lv2_audio, FALSE);
     recall = g_list_prepend(recall,
 			    route_lv2_audio);
-    ags_connectable_connect(AGS_CONNECTABLE(route_lv2_audio));
+    ags_recall_factory_connect_recall((GObject *) route_lv2_audio,
+				      create_flags);
 
     route_lv2_audio_run = (AgsRouteLv2AudioRun *) g_object_new(AGS_TYPE_ROUTE_LV2_AUDIO_RUN,
 							       "soundcard\0", audio->soundcard,
@@ -4075,7 +4421,8 @@ ags_recall_factory_create_route_lv2(AgsAudio *audio,
     ags_audio_add_recall(audio, (GObject *) route_lv2_audio_run, FALSE);
     recall = g_list_prepend(recall,
 			    route_lv2_audio_run);
-    ags_connectable_connect(AGS_CONNECTABLE(route_lv2_audio_run));
+    ags_recall_factory_connect_recall((GObject *) route_lv2_audio_run,
+				      create_flags);
   }
 
   /* return instantiated recall */
@@ -4097,7 +4444,10 @@ ags_recall_factory_create_route_lv2(AgsAudio *audio,
  * @create_flags: modify the behaviour of this function
  * @recall_flags: flags to be set for #AgsRecall
  *
- * Instantiate #AgsRecall by this factory.
+ * Instantiate #AgsRecall by this factory. The plugin is resolved through a
+ * table built once. With %AGS_RECALL_FACTORY_DEFER_CONNECT the recalls are
+ * left unconnected for the caller or the owning #AgsAudio and #AgsChannel
+ * to connect.
  *
  * Returns: The available AgsPort objects of the plugin to modify.
  * 
@@ -4113,6 +4463,8 @@ ags_recall_factory_create(AgsAudio *audio,
 {
   AgsMutexManager *mutex_manager;
 
+  AgsRecallFactoryCreateFunc create_func;
+  
   GList *recall;
 
   pthread_mutex_t *application_mutex;
@@ -4136,204 +4488,15 @@ ags_recall_factory_create(AgsAudio *audio,
   g_message("AgsRecallFactory creating: %s[%d,%d]\0", plugin_name, stop_pad, stop_audio_channel);
 #endif
 
-  if(!strncmp(plugin_name,
-	      "ags-delay\0",
-	      10)){
-    recall = ags_recall_factory_create_delay(audio,
-					     play_container, recall_container,
-					     plugin_name,
-					     start_audio_channel, stop_audio_channel,
-					     start_pad, stop_pad,
-					     create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-count-beats\0",
-		    16)){
-    recall = ags_recall_factory_create_count_beats(audio,
-						   play_container, recall_container,
-						   plugin_name,
-						   start_audio_channel, stop_audio_channel,
-						   start_pad, stop_pad,
-						   create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-stream\0",
-		    11)){
-    recall = ags_recall_factory_create_stream(audio,
-					      play_container, recall_container,
-					      plugin_name,
-					      start_audio_channel, stop_audio_channel,
-					      start_pad, stop_pad,
-					      create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-loop\0",
-		    9)){
-    recall = ags_recall_factory_create_loop(audio,
-					    play_container, recall_container,
-					    plugin_name,
-					    start_audio_channel, stop_audio_channel,
-					    start_pad, stop_pad,
-					    create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-play-master\0",
-		    16)){
-    recall = ags_recall_factory_create_play_master(audio,
-						   play_container, recall_container,
-						   plugin_name,
-						   start_audio_channel, stop_audio_channel,
-						   start_pad, stop_pad,
-						   create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-prepare\0",
-		    12)){
-    recall = ags_recall_factory_create_prepare(audio,
-					       play_container, recall_container,
-					       plugin_name,
-					       start_audio_channel, stop_audio_channel,
-					       start_pad, stop_pad,
-					       create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-copy\0",
-		    9)){
-    recall = ags_recall_factory_create_copy(audio,
-					    play_container, recall_container,
-					    plugin_name,
-					    start_audio_channel, stop_audio_channel,
-					    start_pad, stop_pad,
-					    create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-buffer\0",
-		    11)){
-    recall = ags_recall_factory_create_buffer(audio,
-					      play_container, recall_container,
-					      plugin_name,
-					      start_audio_channel, stop_audio_channel,
-					      start_pad, stop_pad,
-					      create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-play\0",
-		    9)){
-    recall = ags_recall_factory_create_play(audio,
-					    play_container, recall_container,
-					    plugin_name,
-					    start_audio_channel, stop_audio_channel,
-					    start_pad, stop_pad,
-					    create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-copy-pattern\0",
-		    17)){
-    recall = ags_recall_factory_create_copy_pattern(audio,
-						    play_container, recall_container,
-						    plugin_name,
-						    start_audio_channel, stop_audio_channel,
-						    start_pad, stop_pad,
-						    create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-play-dssi\0",
-		    14)){
-    recall = ags_recall_factory_create_play_dssi(audio,
-						 play_container, recall_container,
-						 plugin_name,
-						 start_audio_channel, stop_audio_channel,
-						 start_pad, stop_pad,
-						 create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-play-lv2\0",
-		    13)){
-    recall = ags_recall_factory_create_play_lv2(audio,
-						play_container, recall_container,
-						plugin_name,
-						start_audio_channel, stop_audio_channel,
-						start_pad, stop_pad,
-						create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-play-notation\0",
-		    18)){
-    recall = ags_recall_factory_create_play_notation(audio,
-						     play_container, recall_container,
-						     plugin_name,
-						     start_audio_channel, stop_audio_channel,
-						     start_pad, stop_pad,
-						     create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-peak\0",
-		    9)){
-    recall = ags_recall_factory_create_peak(audio,
-					    play_container, recall_container,
-					    plugin_name,
-					    start_audio_channel, stop_audio_channel,
-					    start_pad, stop_pad,
-					    create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-mute\0",
-		    9)){
-    recall = ags_recall_factory_create_mute(audio,
-					    play_container, recall_container,
-					    plugin_name,
-					    start_audio_channel, stop_audio_channel,
-					    start_pad, stop_pad,
-					    create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-volume\0",
-		    11)){
-    recall = ags_recall_factory_create_volume(audio,
-					      play_container, recall_container,
-					      plugin_name,
-					      start_audio_channel, stop_audio_channel,
-					      start_pad, stop_pad,
-					      create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-ladspa\0",
-		    11)){
-    recall = ags_recall_factory_create_ladspa(audio,
-					      play_container, recall_container,
-					      plugin_name,
-					      start_audio_channel, stop_audio_channel,
-					      start_pad, stop_pad,
-					      create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-dssi\0",
-		    9)){
-    recall = ags_recall_factory_create_dssi(audio,
-					    play_container, recall_container,
-					    plugin_name,
-					    start_audio_channel, stop_audio_channel,
-					    start_pad, stop_pad,
-					    create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-lv2\0",
-		    8)){
-    recall = ags_recall_factory_create_lv2(audio,
-					   play_container, recall_container,
-					   plugin_name,
-					   start_audio_channel, stop_audio_channel,
-					   start_pad, stop_pad,
-					   create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-record-midi\0",
-		    16)){
-    recall = ags_recall_factory_create_record_midi(audio,
-						   play_container, recall_container,
-						   plugin_name,
-						   start_audio_channel, stop_audio_channel,
-						   start_pad, stop_pad,
-						   create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-route-dssi\0",
-		    15)){
-    recall = ags_recall_factory_create_route_dssi(audio,
-						  play_container, recall_container,
-						  plugin_name,
-						  start_audio_channel, stop_audio_channel,
-						  start_pad, stop_pad,
-						  create_flags, recall_flags);
-  }else if(!strncmp(plugin_name,
-		    "ags-route-lv2\0",
-		    14)){
-    recall = ags_recall_factory_create_route_lv2(audio,
-						 play_container, recall_container,
-						 plugin_name,
-						 start_audio_channel, stop_audio_channel,
-						 start_pad, stop_pad,
-						 create_flags, recall_flags);
+  create_func = ags_recall_factory_lookup_create_func(plugin_name);
+
+  if(create_func != NULL){
+    recall = create_func(audio,
+			 play_container, recall_container,
+			 plugin_name,
+			 start_audio_channel, stop_audio_channel,
+			 start_pad, stop_pad,
+			 create_flags, recall_flags);
   }
 
   pthread_mutex_unlock(audio_mutex);
@@ -4341,6 +4504,97 @@ ags_recall_factory_create(AgsAudio *audio,
   return(recall);
 }
 
+/**
+ * ags_recall_factory_create_batch:
+ * @audio: an #AgsAudio that should keep the recalls
+ * @plugin_name: a %NULL terminated array of plugin identifiers to instantiate
+ * @start_audio_channel: the first audio channel to apply
+ * @stop_audio_channel: the last audio channel to apply
+ * @start_pad: the first pad to apply
+ * @stop_pad: the last pad to apply
+ * @create_flags: modify the behaviour of this function
+ * @recall_flags: flags to be set for #AgsRecall
+ *
+ * Instantiate the recalls of all @plugin_name for the same range. The audio
+ * mutex is taken once and the recalls are connected after all of them were
+ * added, unless @create_flags contains %AGS_RECALL_FACTORY_DEFER_CONNECT.
+ * Each plugin gets recall containers of its own.
+ *
+ * Returns: The instantiated recalls of all plugins in the order of @plugin_name.
+ * 
+ * Since: 0.7.136
+ */
+GList*
+ags_recall_factory_create_batch(AgsAudio *audio,
+				gchar **plugin_name,
+				guint start_audio_channel, guint stop_audio_channel,
+				guint start_pad, guint stop_pad,
+				guint create_flags, guint recall_flags)
+{
+  AgsMutexManager *mutex_manager;
+
+  AgsRecallFactoryCreateFunc create_func;
+  
+  GList *recall, *current;
+  GList *list;
+
+  guint i;
+  
+  pthread_mutex_t *application_mutex;
+  pthread_mutex_t *audio_mutex;
+
+  if(audio == NULL ||
+     plugin_name == NULL){
+    return(NULL);
+  }
+  
+  mutex_manager = ags_mutex_manager_get_instance();
+  application_mutex = ags_mutex_manager_get_application_mutex(mutex_manager);
+  
+  pthread_mutex_lock(application_mutex);
+
+  audio_mutex = ags_mutex_manager_lookup(mutex_manager,
+					 (GObject *) audio);
+  
+  pthread_mutex_unlock(application_mutex);
+
+  pthread_mutex_lock(audio_mutex);
+
+  recall = NULL;
+  
+  for(i = 0; plugin_name[i] != NULL; i++){
+    create_func = ags_recall_factory_lookup_create_func(plugin_name[i]);
+
+    if(create_func == NULL){
+      continue;
+    }
+
+    current = create_func(audio,
+			  NULL, NULL,
+			  plugin_name[i],
+			  start_audio_channel, stop_audio_channel,
+			  start_pad, stop_pad,
+			  (create_flags | AGS_RECALL_FACTORY_DEFER_CONNECT), recall_flags);
+    recall = g_list_concat(recall,
+			   current);
+  }
+
+  /* connect */
+  if((AGS_RECALL_FACTORY_DEFER_CONNECT & create_flags) == 0){
+    list = recall;
+
+    while(list != NULL){
+      ags_connectable_connect(AGS_CONNECTABLE(list->data));
+
+      list = list->next;
+    }
+  }
+  
+  pthread_mutex_unlock(audio_mutex);
+
+  return(recall);
+}
+
 void
 ags_recall_factory_remove(AgsAudio *audio,
 			  AgsRecallContainer *recall_container)
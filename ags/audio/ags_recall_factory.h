@@ -44,6 +44,7 @@ typedef enum{
   AGS_RECALL_FACTORY_PLAY      = 1 << 4,
   AGS_RECALL_FACTORY_RECALL    = 1 << 5,
   AGS_RECALL_FACTORY_BULK      = 1 << 6,
+  AGS_RECALL_FACTORY_DEFER_CONNECT = 1 << 7,
 }AgsRecallFactoryCreateFlags;
 
 struct _AgsRecallFactory
@@ -64,6 +65,11 @@ GList* ags_recall_factory_create(AgsAudio *audio,
 				 guint start_audio_channel, guint stop_audio_channel,
 				 guint start_pad, guint stop_pad,
 				 guint create_flags, guint recall_flags);
+GList* ags_recall_factory_create_batch(AgsAudio *audio,
+				       gchar **plugin_name,
+				       guint start_audio_channel, guint stop_audio_channel,
+				       guint start_pad, guint stop_pad,
+				       guint create_flags, guint recall_flags);
 
 void ags_recall_factory_remove(AgsAudio *audio,
 			       AgsRecallContainer *recall_container);
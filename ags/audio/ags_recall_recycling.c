@@ -842,11 +842,10 @@ ags_recall_recycling_source_remove_audio_signal_callback(AgsRecycling *source,
   AgsMutexManager *mutex_manager;
 
   AgsConfig *config;
+  AgsConfigSnapshot *snapshot;
   
   GList *list, *list_start;
 
-  gchar *str;
-  
   gboolean performance_mode;
   
   pthread_mutex_t *application_mutex;
@@ -925,18 +924,12 @@ ags_recall_recycling_source_remove_audio_signal_callback(AgsRecycling *source,
 
   config = ags_config_get_instance();
 
-  str = ags_config_get_value(config,
-			     AGS_CONFIG_GENERIC,
-			     "engine-mode\0");
-
-  if(str != NULL &&
-     !g_ascii_strncasecmp(str,
-			  "performance\0",
-			  12)){
-    performance_mode = TRUE;
-  }else{
-    performance_mode = FALSE;
-  }
+  snapshot = ags_config_get_snapshot(config);
+  
+  performance_mode = ((AGS_CONFIG_SNAPSHOT_PERFORMANCE_MODE & (snapshot->flags)) != 0) ? TRUE: FALSE;
+
+  ags_config_release_snapshot(config,
+			      snapshot);
   
   list_start = 
     list = ags_recall_get_children(recall);
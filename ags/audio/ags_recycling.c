@@ -24,12 +24,20 @@
 #include <ags/object/ags_concurrent_tree.h>
 #include <ags/object/ags_soundcard.h>
 
+#include <ags/util/ags_list_util.h>
+
+#include <ags/object/ags_application_context.h>
+
 #include <ags/thread/ags_mutex_manager.h>
+#include <ags/thread/ags_concurrency_provider.h>
+#include <ags/thread/ags_destroy_worker.h>
 
 #include <ags/audio/ags_audio.h>
 #include <ags/audio/ags_audio_buffer_util.h>
 #include <ags/audio/ags_channel.h>
+#include <ags/audio/ags_recall_id.h>
 
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
@@ -58,6 +66,25 @@ void ags_recycling_real_add_audio_signal(AgsRecycling *recycling,
 void ags_recycling_real_remove_audio_signal(AgsRecycling *recycling,
 					    AgsAudioSignal *audio_signal);
 
+void ags_recycling_index_insert(AgsRecycling *recycling,
+				AgsAudioSignal *audio_signal);
+void ags_recycling_index_remove(AgsRecycling *recycling,
+				AgsAudioSignal *audio_signal);
+gboolean ags_recycling_index_is_active(AgsRecycling *recycling,
+				       GObject *recall_id);
+
+typedef struct _AgsRecyclingAudioSignalLink AgsRecyclingAudioSignalLink;
+
+struct _AgsRecyclingAudioSignalLink
+{
+  GList *link;
+
+  GObject *recall_id;
+  GList *bucket;
+};
+
+void ags_recycling_audio_signal_link_free(AgsRecyclingAudioSignalLink *audio_signal_link);
+
 /**
  * SECTION:ags_recycling
  * @short_description: A container of audio signals
@@ -67,6 +94,9 @@ void ags_recycling_real_remove_audio_signal(AgsRecycling *recycling,
  *
  * #AgsRecycling forms the nested tree of AgsChannel. Ever channel
  * having own audio signal contains therefor an #AgsRecycling
+ *
+ * The audio signals are indexed by their #AgsRecallID and the template
+ * is kept aside, so looking them up doesn't walk the whole list.
  */
 
 enum{
@@ -344,6 +374,14 @@ ags_recycling_init(AgsRecycling *recycling)
   recycling->prev = NULL;
 
   recycling->audio_signal = NULL;
+
+  recycling->template = NULL;
+  recycling->audio_signal_link = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+						       NULL,
+						       (GDestroyNotify) ags_recycling_audio_signal_link_free);
+  recycling->audio_signal_index = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+							NULL,
+							(GDestroyNotify) g_list_free);
 }
 
 void
@@ -457,7 +495,8 @@ ags_recycling_set_property(GObject *gobject,
       audio_signal = g_value_get_object(value);
 
       if(audio_signal == NULL ||
-	 g_list_find(recycling->audio_signal, audio_signal) != NULL){
+	 g_hash_table_lookup(recycling->audio_signal_link,
+			     audio_signal) != NULL){
 	return;
       }
 
@@ -673,6 +712,10 @@ ags_recycling_dispose(GObject *gobject)
 		   g_object_unref);
 
   recycling->audio_signal = NULL;
+
+  recycling->template = NULL;
+  g_hash_table_remove_all(recycling->audio_signal_link);
+  g_hash_table_remove_all(recycling->audio_signal_index);
 }
 
 void
@@ -726,6 +769,9 @@ ags_recycling_finalize(GObject *gobject)
   g_list_free_full(recycling->audio_signal,
 		   g_object_unref);
 
+  g_hash_table_destroy(recycling->audio_signal_link);
+  g_hash_table_destroy(recycling->audio_signal_index);
+
   /* call parent */
   G_OBJECT_CLASS(ags_recycling_parent_class)->finalize(gobject);
 }
@@ -820,20 +866,21 @@ void
 ags_recycling_real_add_audio_signal(AgsRecycling *recycling,
 				    AgsAudioSignal *audio_signal)
 {
-  if(g_list_find(recycling->audio_signal,
-		 audio_signal) == NULL){
+  if(g_hash_table_lookup(recycling->audio_signal_link,
+			 audio_signal) == NULL){
     if((AGS_AUDIO_SIGNAL_TEMPLATE & (audio_signal->flags)) != 0){
       AgsAudioSignal *old_template;
 
       /* old template */
-      old_template = ags_audio_signal_get_template(recycling->audio_signal);
+      old_template = ags_recycling_get_template(recycling);
     
       /* remove old template */
       ags_recycling_remove_audio_signal(recycling,
 					old_template);
     }
 
-    recycling->audio_signal = g_list_prepend(recycling->audio_signal, (gpointer) audio_signal);
+    ags_recycling_index_insert(recycling,
+			       audio_signal);
     g_object_ref(audio_signal);
   }
   
@@ -857,7 +904,12 @@ ags_recycling_remove_audio_signal(AgsRecycling *recycling,
 				  AgsAudioSignal *audio_signal)
 {
   AgsMutexManager *mutex_manager;
+  AgsDestroyWorker *destroy_worker;
+  
+  AgsApplicationContext *application_context;
 
+  GList *worker;
+  
   pthread_mutex_t *application_mutex;
   pthread_mutex_t *recycling_mutex;
 
@@ -874,6 +926,24 @@ ags_recycling_remove_audio_signal(AgsRecycling *recycling,
   recycling_mutex = ags_mutex_manager_lookup(mutex_manager,
 					     (GObject *) recycling);
 
+  /* get destroy worker */
+  application_context = ags_application_context_get_instance();
+
+  worker = NULL;
+  
+  if(application_context != NULL){
+    worker = ags_concurrency_provider_get_worker(AGS_CONCURRENCY_PROVIDER(application_context));
+  }
+  
+  worker = ags_list_util_find_type(worker,
+				   AGS_TYPE_DESTROY_WORKER);
+
+  if(worker != NULL){
+    destroy_worker = worker->data;
+  }else{
+    destroy_worker = NULL;
+  }
+
   pthread_mutex_unlock(application_mutex);
   
   pthread_mutex_lock(recycling_mutex);
@@ -896,30 +966,291 @@ ags_recycling_remove_audio_signal(AgsRecycling *recycling,
   g_signal_emit(G_OBJECT(recycling),
 		recycling_signals[REMOVE_AUDIO_SIGNAL], 0,
 		audio_signal);
-  g_object_unref((GObject *) audio_signal);
   g_object_unref((GObject *) recycling);
 
   /* release lock */
   pthread_mutex_unlock(recycling_mutex);
+
+  /* the last reference is dropped of the destroy worker */
+  if(destroy_worker != NULL){
+    ags_destroy_worker_add(destroy_worker,
+			   audio_signal, g_object_unref);
+  }else{
+    g_object_unref((GObject *) audio_signal);
+  }
 }
 
 void
 ags_recycling_real_remove_audio_signal(AgsRecycling *recycling,
 				       AgsAudioSignal *audio_signal)
 {
-
-  if(g_list_find(recycling->audio_signal,
-		 (gpointer) audio_signal) == NULL){
+  if(g_hash_table_lookup(recycling->audio_signal_link,
+			  audio_signal) == NULL){
     return;
   }
   
-  recycling->audio_signal = g_list_remove(recycling->audio_signal,
-					  (gpointer) audio_signal);
+  ags_recycling_index_remove(recycling,
+			     audio_signal);
   audio_signal->recycling = NULL;
   g_object_unref(audio_signal);
   g_object_unref(recycling);
 }
 
+void
+ags_recycling_index_insert(AgsRecycling *recycling,
+			   AgsAudioSignal *audio_signal)
+{
+  AgsRecyclingAudioSignalLink *audio_signal_link;
+
+  GList *bucket;
+  
+  recycling->audio_signal = g_list_prepend(recycling->audio_signal,
+					   (gpointer) audio_signal);
+
+  audio_signal_link = (AgsRecyclingAudioSignalLink *) malloc(sizeof(AgsRecyclingAudioSignalLink));
+  audio_signal_link->link = recycling->audio_signal;
+  audio_signal_link->recall_id = NULL;
+  audio_signal_link->bucket = NULL;
+  
+  g_hash_table_insert(recycling->audio_signal_link,
+		      audio_signal,
+		      audio_signal_link);
+  
+  /* the template is kept aside */
+  if((AGS_AUDIO_SIGNAL_TEMPLATE & (audio_signal->flags)) != 0){
+    recycling->template = audio_signal;
+
+    return;
+  }
+
+  /* prepend to the bucket of its recall id */
+  bucket = g_hash_table_lookup(recycling->audio_signal_index,
+			       audio_signal->recall_id);
+
+  if(bucket != NULL){
+    g_hash_table_steal(recycling->audio_signal_index,
+		       audio_signal->recall_id);
+  }
+  
+  bucket = g_list_prepend(bucket,
+			  audio_signal);
+  g_hash_table_insert(recycling->audio_signal_index,
+		      audio_signal->recall_id,
+		      bucket);
+
+  /* keeps the key alive */
+  if(audio_signal->recall_id != NULL){
+    g_object_ref(audio_signal->recall_id);
+  }
+  
+  audio_signal_link->recall_id = audio_signal->recall_id;
+  audio_signal_link->bucket = bucket;
+}
+
+void
+ags_recycling_index_remove(AgsRecycling *recycling,
+			   AgsAudioSignal *audio_signal)
+{
+  AgsRecyclingAudioSignalLink *audio_signal_link;
+
+  GList *bucket;
+  
+  audio_signal_link = g_hash_table_lookup(recycling->audio_signal_link,
+					  audio_signal);
+
+  if(audio_signal_link == NULL){
+    return;
+  }
+
+  recycling->audio_signal = g_list_delete_link(recycling->audio_signal,
+					       audio_signal_link->link);
+  
+  if(recycling->template == audio_signal){
+    recycling->template = NULL;
+  }
+
+  /* unlink from bucket */
+  if(audio_signal_link->bucket != NULL){
+    bucket = g_hash_table_lookup(recycling->audio_signal_index,
+				 audio_signal_link->recall_id);
+    g_hash_table_steal(recycling->audio_signal_index,
+		       audio_signal_link->recall_id);
+
+    bucket = g_list_delete_link(bucket,
+				audio_signal_link->bucket);
+
+    if(bucket != NULL){
+      g_hash_table_insert(recycling->audio_signal_index,
+			  audio_signal_link->recall_id,
+			  bucket);
+    }
+  }
+  
+  g_hash_table_remove(recycling->audio_signal_link,
+		      audio_signal);
+}
+
+void
+ags_recycling_audio_signal_link_free(AgsRecyclingAudioSignalLink *audio_signal_link)
+{
+  if(audio_signal_link->recall_id != NULL){
+    g_object_unref(audio_signal_link->recall_id);
+  }
+
+  free(audio_signal_link);
+}
+
+gboolean
+ags_recycling_index_is_active(AgsRecycling *recycling,
+			      GObject *recall_id)
+{
+  AgsRecyclingContext *recycling_context;
+  
+  GHashTableIter iter;
+  gpointer key;
+
+  recycling_context = AGS_RECALL_ID(recall_id)->recycling_context;
+  
+  /* distinct recall ids instead of every audio signal */
+  g_hash_table_iter_init(&iter,
+			 recycling->audio_signal_index);
+
+  while(g_hash_table_iter_next(&iter,
+			       &key, NULL)){
+    if(key != NULL &&
+       AGS_RECALL_ID(key)->recycling_context == recycling_context){
+      return(TRUE);
+    }
+  }
+
+  return(FALSE);
+}
+
+/**
+ * ags_recycling_get_template:
+ * @recycling: the #AgsRecycling
+ *
+ * Get the template of @recycling without walking its audio signals.
+ *
+ * Returns: the template #AgsAudioSignal or %NULL
+ *
+ * Since: 0.7.136
+ */
+AgsAudioSignal*
+ags_recycling_get_template(AgsRecycling *recycling)
+{
+  if(recycling == NULL){
+    return(NULL);
+  }
+
+  if(recycling->template == NULL ||
+     (AGS_AUDIO_SIGNAL_TEMPLATE & (recycling->template->flags)) == 0){
+    /* flags modified after adding */
+    recycling->template = ags_audio_signal_get_template(recycling->audio_signal);
+  }
+  
+  return(recycling->template);
+}
+
+/**
+ * ags_recycling_get_audio_signal_by_recall_id:
+ * @recycling: the #AgsRecycling
+ * @recall_id: the #AgsRecallID
+ *
+ * Get the audio signals of @recycling refering to @recall_id, the template
+ * excluded. The list is owned by @recycling and is valid until it is
+ * modified.
+ *
+ * Returns: the #GList-struct containing #AgsAudioSignal, newest first
+ *
+ * Since: 0.7.136
+ */
+GList*
+ags_recycling_get_audio_signal_by_recall_id(AgsRecycling *recycling,
+					    GObject *recall_id)
+{
+  if(recycling == NULL){
+    return(NULL);
+  }
+
+  return(g_hash_table_lookup(recycling->audio_signal_index,
+			     recall_id));
+}
+
+/**
+ * ags_recycling_reindex_audio_signal:
+ * @recycling: the #AgsRecycling
+ * @audio_signal: the #AgsAudioSignal
+ *
+ * Move @audio_signal to the bucket of its current recall id. Called as
+ * #AgsAudioSignal:recall-id changes.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_recycling_reindex_audio_signal(AgsRecycling *recycling,
+				   AgsAudioSignal *audio_signal)
+{
+  AgsRecyclingAudioSignalLink *audio_signal_link;
+
+  GList *link, *bucket;
+  
+  if(recycling == NULL ||
+     audio_signal == NULL){
+    return;
+  }
+
+  audio_signal_link = g_hash_table_lookup(recycling->audio_signal_link,
+					  audio_signal);
+
+  if(audio_signal_link == NULL ||
+     audio_signal_link->bucket == NULL ||
+     audio_signal_link->recall_id == audio_signal->recall_id){
+    return;
+  }
+
+  /* unlink from old bucket */
+  bucket = g_hash_table_lookup(recycling->audio_signal_index,
+			       audio_signal_link->recall_id);
+  g_hash_table_steal(recycling->audio_signal_index,
+		     audio_signal_link->recall_id);
+
+  link = audio_signal_link->bucket;
+  bucket = g_list_remove_link(bucket,
+			      link);
+
+  if(bucket != NULL){
+    g_hash_table_insert(recycling->audio_signal_index,
+			audio_signal_link->recall_id,
+			bucket);
+  }
+
+  /* prepend to new bucket */
+  bucket = g_hash_table_lookup(recycling->audio_signal_index,
+			       audio_signal->recall_id);
+
+  if(bucket != NULL){
+    g_hash_table_steal(recycling->audio_signal_index,
+		       audio_signal->recall_id);
+  }
+
+  bucket = g_list_concat(link,
+			 bucket);
+  g_hash_table_insert(recycling->audio_signal_index,
+		      audio_signal->recall_id,
+		      bucket);
+
+  if(audio_signal->recall_id != NULL){
+    g_object_ref(audio_signal->recall_id);
+  }
+
+  if(audio_signal_link->recall_id != NULL){
+    g_object_unref(audio_signal_link->recall_id);
+  }
+  
+  audio_signal_link->recall_id = audio_signal->recall_id;
+}
+
 /**
  * ags_recycling_create_audio_signal_with_defaults:
  * @recycling: an #AgsRecycling
@@ -927,7 +1258,9 @@ ags_recycling_real_remove_audio_signal(AgsRecycling *recycling,
  * @delay: the delay
  * @attack: the attack
  *
- * Create audio signal with defaults.
+ * Create audio signal with defaults. An @attack of a buffer size or more is
+ * split, the whole buffers delay the copied stream and the remainder is
+ * stored as the audio signal's attack.
  *
  * Since: 0.4
  */
@@ -940,6 +1273,8 @@ ags_recycling_create_audio_signal_with_defaults(AgsRecycling *recycling,
 
   AgsMutexManager *mutex_manager;
 
+  guint n_delay_buffers;
+
   pthread_mutex_t *application_mutex;
   pthread_mutex_t *recycling_mutex;
 
@@ -969,10 +1304,17 @@ ags_recycling_create_audio_signal_with_defaults(AgsRecycling *recycling,
   }
 
   /* create audio signal */
-  template = ags_audio_signal_get_template(recycling->audio_signal);
+  template = ags_recycling_get_template(recycling);
 
-  audio_signal->delay = delay;
-  audio_signal->attack = attack;
+  n_delay_buffers = 0;
+  
+  if(template != NULL &&
+     attack >= template->buffer_size){
+    n_delay_buffers = attack / template->buffer_size;
+  }
+  
+  audio_signal->delay = delay + (gdouble) n_delay_buffers;
+  audio_signal->attack = (template != NULL) ? (attack % template->buffer_size): attack;
 
   if(template == NULL){
     ags_audio_signal_stream_resize(audio_signal,
@@ -1008,11 +1350,18 @@ ags_recycling_create_audio_signal_with_defaults(AgsRecycling *recycling,
 			     template->loop_end) %
 			    template->buffer_size);
 
-  ags_audio_signal_stream_resize(audio_signal,
-				 template->length);
+  /* the recalls shift by less than a buffer, whole buffers are silent in the stream */
+  if(n_delay_buffers == 0){
+    ags_audio_signal_stream_resize(audio_signal,
+				   template->length);
 
-  ags_audio_signal_duplicate_stream(audio_signal,
-				    template);
+    ags_audio_signal_duplicate_stream(audio_signal,
+				      template);
+  }else{
+    ags_audio_signal_duplicate_stream_with_offset(audio_signal,
+						  template,
+						  n_delay_buffers * template->buffer_size);
+  }
 
   /* release lock */
   pthread_mutex_unlock(recycling_mutex);
@@ -1026,7 +1375,8 @@ ags_recycling_create_audio_signal_with_defaults(AgsRecycling *recycling,
  * @delay: the delay
  * @attack: the attack
  *
- * Create audio signal with frame count.
+ * Create audio signal with frame count. The template isn't copied, see
+ * ags_audio_signal_open_cursor().
  *
  * Since: 0.4
  */
@@ -1040,16 +1390,6 @@ ags_recycling_create_audio_signal_with_frame_count(AgsRecycling *recycling,
 
   AgsMutexManager *mutex_manager;
 
-  GList *stream, *template_stream, *template_loop;
-
-  guint loop_length;
-  guint loop_frame_count;
-  guint n_frames;
-  guint copy_n_frames;
-  guint nth_loop;
-  guint i, j, k;
-  guint copy_mode;
-  
   pthread_mutex_t *application_mutex;
   pthread_mutex_t *recycling_mutex;
 
@@ -1079,129 +1419,34 @@ ags_recycling_create_audio_signal_with_frame_count(AgsRecycling *recycling,
   }
 
   /* create audio signal */
-  template = ags_audio_signal_get_template(recycling->audio_signal);
-
-  audio_signal->soundcard = template->soundcard;
+  template = ags_recycling_get_template(recycling);
 
-  audio_signal->recycling = (GObject *) recycling;
-
-  audio_signal->samplerate = template->samplerate;
-  audio_signal->buffer_size = template->buffer_size;
-  audio_signal->format = template->format;
-  audio_signal->word_size = template->word_size;
-
-  audio_signal->last_frame = (((guint)(delay *
-				       template->buffer_size) +
-			       attack +
-			       template->last_frame) %
-			      template->buffer_size);
-  audio_signal->loop_start = ((guint) (delay *
-				       template->buffer_size) +
-			      attack +
-			      template->loop_start);
-  audio_signal->loop_end = ((guint)(delay *
-				    template->buffer_size) +
-			    attack +
-			    template->loop_end);
-
-  /* resize */
-  if(template->loop_end > template->loop_start){
-    loop_length = template->loop_end - template->loop_start;
-    loop_frame_count = ((frame_count - template->loop_start) / loop_length) * template->buffer_size;
-
-    ags_audio_signal_stream_resize(audio_signal,
-				   (guint) ceil(frame_count / audio_signal->buffer_size) + 1);
-    
-  }else{
-    ags_audio_signal_duplicate_stream(audio_signal,
-				      template);
+  if(template == NULL){
     ags_audio_signal_stream_resize(audio_signal,
-				   (guint) ceil(frame_count / audio_signal->buffer_size) + 1);
-
-    pthread_mutex_unlock(recycling_mutex);
-
-    return;
-  }
-
-  audio_signal->last_frame = ((guint) (delay * audio_signal->buffer_size) + frame_count + attack) % audio_signal->buffer_size;
+				   0);
 
-  if(template->length == 0){
     /* release lock */
     pthread_mutex_unlock(recycling_mutex);
 
     return;
   }
 
-  /* generic copying */
-  stream = g_list_nth(audio_signal->stream_beginning,
-		      (guint) ((delay * audio_signal->buffer_size) + attack) / audio_signal->buffer_size);
-  template_stream = template->stream_beginning;
-
-  /* loop related copying */
-  copy_mode = ags_audio_buffer_util_get_copy_mode(ags_audio_buffer_util_format_from_soundcard(audio_signal->format),
-						  ags_audio_buffer_util_format_from_soundcard(template->format));
-  
-  for(i = 0, j = 0, k = attack, nth_loop = 0; i < frame_count;){    
-    /* compute count of frames to copy */
-    copy_n_frames = audio_signal->buffer_size;
-
-    /* limit nth loop */
-    if(i > template->loop_start &&
-       i + copy_n_frames > template->loop_start + loop_length &&
-       i + copy_n_frames < template->loop_start + loop_frame_count &&
-       i + copy_n_frames >= template->loop_start + (nth_loop + 1) * loop_length){
-      copy_n_frames = (template->loop_start + (nth_loop + 1) * loop_length) - i;
-    }
-
-    /* check boundaries */
-    if((k % audio_signal->buffer_size) + copy_n_frames > audio_signal->buffer_size){
-      copy_n_frames = audio_signal->buffer_size - (k % audio_signal->buffer_size);
-    }
+  audio_signal->soundcard = template->soundcard;
 
-    if(j + copy_n_frames > audio_signal->buffer_size){
-      copy_n_frames = audio_signal->buffer_size - j;
-    }
+  audio_signal->recycling = (GObject *) recycling;
 
-    if(stream == NULL ||
-       template_stream == NULL){
-      break;
-    }
-    
-    /* copy */
-    ags_audio_buffer_util_copy_buffer_to_buffer(stream->data, 1, k % audio_signal->buffer_size,
-						template_stream->data, 1, j,
-						copy_n_frames, copy_mode);
-
-    /* increment and iterate */
-    if((i + copy_n_frames) % audio_signal->buffer_size == 0){
-      stream = stream->next;
-    }
+  audio_signal->samplerate = template->samplerate;
+  audio_signal->buffer_size = template->buffer_size;
+  audio_signal->format = template->format;
+  audio_signal->word_size = template->word_size;
 
-    if(j + copy_n_frames == template->buffer_size){
-      template_stream = template_stream->next;
-    }
-    
-    if(template_stream == NULL ||
-       (i > template->loop_start &&
-	i + copy_n_frames > template->loop_start + loop_length &&
-	i + copy_n_frames < template->loop_start + loop_frame_count &&
-	i + copy_n_frames >= template->loop_start + (nth_loop + 1) * loop_length)){
-      j = template->loop_start % template->buffer_size;
-      template_stream = g_list_nth(template->stream_beginning,
-				   floor(template->loop_start / template->buffer_size));
-
-      nth_loop++;
-    }else{
-      j += copy_n_frames;
-    }
-    
-    i += copy_n_frames;
-    k += copy_n_frames;
+  audio_signal->last_frame = ((guint) (delay * audio_signal->buffer_size) + frame_count + attack) % audio_signal->buffer_size;
 
-    if(j == template->buffer_size){
-      j = 0;
-    }
-  }
+  /* reference the template, the stream is pulled a buffer at a time while playing */
+  ags_audio_signal_open_cursor(audio_signal,
+			       template,
+			       (guint) (delay * template->buffer_size) + attack,
+			       frame_count);
 
   /* release lock */
   pthread_mutex_unlock(recycling_mutex);
@@ -1393,8 +1638,8 @@ ags_recycling_is_active(AgsRecycling *start_region, AgsRecycling *end_region,
     /* is active */
     pthread_mutex_lock(current_mutex);
 
-    if(ags_audio_signal_is_active(current->audio_signal,
-				  recall_id)){
+    if(ags_recycling_index_is_active(current,
+				     recall_id)){
       pthread_mutex_unlock(current_mutex);
       
       return(TRUE);
@@ -1436,8 +1681,8 @@ ags_recycling_new(GObject *soundcard)
 
   ags_connectable_connect(AGS_CONNECTABLE(audio_signal));
 
-  recycling->audio_signal = g_list_alloc();
-  recycling->audio_signal->data = (gpointer) audio_signal;
+  ags_recycling_index_insert(recycling,
+			     audio_signal);
 
   return(recycling);
 }
@@ -56,6 +56,10 @@ struct _AgsRecycling
   AgsRecycling *prev;
 
   GList *audio_signal;
+
+  AgsAudioSignal *template;
+  GHashTable *audio_signal_link;
+  GHashTable *audio_signal_index;
 };
 
 struct _AgsRecyclingClass
@@ -77,6 +81,12 @@ void ags_recycling_add_audio_signal(AgsRecycling *recycling,
 void ags_recycling_remove_audio_signal(AgsRecycling *recycling,
 				       AgsAudioSignal *audio_signal);
 
+AgsAudioSignal* ags_recycling_get_template(AgsRecycling *recycling);
+GList* ags_recycling_get_audio_signal_by_recall_id(AgsRecycling *recycling,
+						   GObject *recall_id);
+void ags_recycling_reindex_audio_signal(AgsRecycling *recycling,
+					AgsAudioSignal *audio_signal);
+
 void ags_recycling_create_audio_signal_with_defaults(AgsRecycling *recycling,
 						     AgsAudioSignal *audio_signal,
 						     gdouble delay, guint attack);
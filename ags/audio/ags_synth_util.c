@@ -20,9 +20,27 @@
 #include <ags/audio/ags_synth_util.h>
 
 #include <ags/audio/ags_audio_buffer_util.h>
+#include <ags/audio/ags_synth_generator.h>
+
+#include <pthread.h>
 
 #include <math.h>
 
+#define AGS_SYNTH_UTIL_SIN_TABLE_SIZE (4096)
+
+#define AGS_SYNTH_UTIL_OSCILLATOR_LANES (8)
+#define AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE (256)
+
+void ags_synth_util_sin_table_init();
+gdouble ags_synth_util_poly_blep(gdouble t, gdouble increment, gdouble inv_increment);
+gdouble ags_synth_util_oscillator_block(gdouble *block,
+					guint oscillator,
+					gdouble increment, gdouble phase,
+					guint n_frames);
+
+static pthread_once_t ags_synth_util_sin_table_once = PTHREAD_ONCE_INIT;
+static gdouble ags_synth_util_sin_table[AGS_SYNTH_UTIL_SIN_TABLE_SIZE + 1];
+
 /**
  * ags_synth_util_sin_s8:
  * @buffer: the audio buffer
@@ -1229,3 +1247,576 @@ ags_synth_util_square(void *buffer,
     }
   }
 }
+
+void
+ags_synth_util_sin_table_init()
+{
+  guint i;
+
+  for(i = 0; i <= AGS_SYNTH_UTIL_SIN_TABLE_SIZE; i++){
+    ags_synth_util_sin_table[i] = sin((gdouble) i * 2.0 * M_PI / (gdouble) AGS_SYNTH_UTIL_SIN_TABLE_SIZE);
+  }
+}
+
+gdouble
+ags_synth_util_poly_blep(gdouble t, gdouble increment, gdouble inv_increment)
+{
+  /* polynomial band-limited step, smoothes the discontinuity at phase 0.0 */
+  if(t < increment){
+    t *= inv_increment;
+
+    return(t + t - t * t - 1.0);
+  }else if(t > 1.0 - increment){
+    t = (t - 1.0) * inv_increment;
+
+    return(t * t + t + t + 1.0);
+  }
+
+  return(0.0);
+}
+
+gdouble
+ags_synth_util_oscillator_block(gdouble *block,
+				guint oscillator,
+				gdouble increment, gdouble phase,
+				guint n_frames)
+{
+  gdouble lane[AGS_SYNTH_UTIL_OSCILLATOR_LANES];
+  gdouble position;
+  gdouble inv_increment;
+  guint index;
+  guint i, k;
+
+  pthread_once(&ags_synth_util_sin_table_once,
+	       ags_synth_util_sin_table_init);
+
+  if(increment > 0.0){
+    inv_increment = 1.0 / increment;
+  }else{
+    inv_increment = 0.0;
+  }
+
+  /* the lanes are computed from the start phase so no error accumulates,
+   * @block must hold n_frames rounded up to a multiple of the lanes
+   */
+  for(i = 0; i < n_frames; i += AGS_SYNTH_UTIL_OSCILLATOR_LANES){
+    for(k = 0; k < AGS_SYNTH_UTIL_OSCILLATOR_LANES; k++){
+      lane[k] = phase + (gdouble) (i + k) * increment;
+      lane[k] -= floor(lane[k]);
+    }
+
+    switch(oscillator){
+    case AGS_SYNTH_GENERATOR_OSCILLATOR_SIN:
+      {
+	for(k = 0; k < AGS_SYNTH_UTIL_OSCILLATOR_LANES; k++){
+	  position = lane[k] * (gdouble) AGS_SYNTH_UTIL_SIN_TABLE_SIZE;
+	  index = (guint) position;
+
+	  block[i + k] = ags_synth_util_sin_table[index] + (position - (gdouble) index) * (ags_synth_util_sin_table[index + 1] - ags_synth_util_sin_table[index]);
+	}
+      }
+      break;
+    case AGS_SYNTH_GENERATOR_OSCILLATOR_SAWTOOTH:
+      {
+	for(k = 0; k < AGS_SYNTH_UTIL_OSCILLATOR_LANES; k++){
+	  block[i + k] = (2.0 * lane[k]) - 1.0 - ags_synth_util_poly_blep(lane[k], increment, inv_increment);
+	}
+      }
+      break;
+    case AGS_SYNTH_GENERATOR_OSCILLATOR_TRIANGLE:
+      {
+	/* harmonics fall off with 12 dB per octave, no correction needed */
+	for(k = 0; k < AGS_SYNTH_UTIL_OSCILLATOR_LANES; k++){
+	  block[i + k] = 1.0 - 4.0 * fabs(lane[k] - 0.5);
+	}
+      }
+      break;
+    case AGS_SYNTH_GENERATOR_OSCILLATOR_SQUARE:
+      {
+	for(k = 0; k < AGS_SYNTH_UTIL_OSCILLATOR_LANES; k++){
+	  position = lane[k] + 0.5;
+	  position -= floor(position);
+
+	  block[i + k] = ((lane[k] < 0.5) ? 1.0: -1.0) + ags_synth_util_poly_blep(lane[k], increment, inv_increment) - ags_synth_util_poly_blep(position, increment, inv_increment);
+	}
+      }
+      break;
+    default:
+      {
+	for(k = 0; k < AGS_SYNTH_UTIL_OSCILLATOR_LANES; k++){
+	  block[i + k] = 0.0;
+	}
+      }
+    }
+  }
+
+  phase += (gdouble) n_frames * increment;
+
+  return(phase - floor(phase));
+}
+
+/**
+ * ags_synth_util_oscillator_s8:
+ * @buffer: the audio buffer
+ * @oscillator: the #AgsSynthGeneratorOscillator
+ * @freq: the frequency of the wave
+ * @phase: the normalized phase to start with, 0.0 up to 1.0
+ * @volume: the volume of the wave
+ * @samplerate: the samplerate
+ * @offset: start frame
+ * @n_frames: generate n frames
+ *
+ * Add @n_frames of the wave of @oscillator to @buffer using a phase accumulator.
+ *
+ * Returns: the phase to continue with
+ *
+ * Since: 0.7.136
+ */
+gdouble
+ags_synth_util_oscillator_s8(signed char *buffer,
+			     guint oscillator,
+			     gdouble freq, gdouble phase, gdouble volume,
+			     guint samplerate,
+			     guint offset, guint n_frames)
+{
+  static const gdouble scale = 127.0;
+  gdouble block[AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE];
+  gdouble increment;
+  guint count;
+  guint i, j;
+
+  increment = freq / (gdouble) samplerate;
+
+  for(i = offset; i < offset + n_frames; i += count){
+    count = offset + n_frames - i;
+
+    if(count > AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE){
+      count = AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE;
+    }
+
+    phase = ags_synth_util_oscillator_block(block,
+					    oscillator,
+					    increment, phase,
+					    count);
+
+    for(j = 0; j < count; j++){
+      buffer[i + j] = (signed char) (0xff & ((signed short) buffer[i + j] + (signed short) (block[j] * scale * volume)));
+    }
+  }
+
+  return(phase);
+}
+
+/**
+ * ags_synth_util_oscillator_s16:
+ * @buffer: the audio buffer
+ * @oscillator: the #AgsSynthGeneratorOscillator
+ * @freq: the frequency of the wave
+ * @phase: the normalized phase to start with, 0.0 up to 1.0
+ * @volume: the volume of the wave
+ * @samplerate: the samplerate
+ * @offset: start frame
+ * @n_frames: generate n frames
+ *
+ * Add @n_frames of the wave of @oscillator to @buffer using a phase accumulator.
+ *
+ * Returns: the phase to continue with
+ *
+ * Since: 0.7.136
+ */
+gdouble
+ags_synth_util_oscillator_s16(signed short *buffer,
+			      guint oscillator,
+			      gdouble freq, gdouble phase, gdouble volume,
+			      guint samplerate,
+			      guint offset, guint n_frames)
+{
+  static const gdouble scale = 32767.0;
+  gdouble block[AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE];
+  gdouble increment;
+  guint count;
+  guint i, j;
+
+  increment = freq / (gdouble) samplerate;
+
+  for(i = offset; i < offset + n_frames; i += count){
+    count = offset + n_frames - i;
+
+    if(count > AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE){
+      count = AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE;
+    }
+
+    phase = ags_synth_util_oscillator_block(block,
+					    oscillator,
+					    increment, phase,
+					    count);
+
+    for(j = 0; j < count; j++){
+      buffer[i + j] = (signed short) (0xffff & ((signed long) buffer[i + j] + (signed long) (block[j] * scale * volume)));
+    }
+  }
+
+  return(phase);
+}
+
+/**
+ * ags_synth_util_oscillator_s24:
+ * @buffer: the audio buffer
+ * @oscillator: the #AgsSynthGeneratorOscillator
+ * @freq: the frequency of the wave
+ * @phase: the normalized phase to start with, 0.0 up to 1.0
+ * @volume: the volume of the wave
+ * @samplerate: the samplerate
+ * @offset: start frame
+ * @n_frames: generate n frames
+ *
+ * Add @n_frames of the wave of @oscillator to @buffer using a phase accumulator.
+ *
+ * Returns: the phase to continue with
+ *
+ * Since: 0.7.136
+ */
+gdouble
+ags_synth_util_oscillator_s24(signed long *buffer,
+			      guint oscillator,
+			      gdouble freq, gdouble phase, gdouble volume,
+			      guint samplerate,
+			      guint offset, guint n_frames)
+{
+  static const gdouble scale = 8388607.0;
+  gdouble block[AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE];
+  gdouble increment;
+  guint count;
+  guint i, j;
+
+  increment = freq / (gdouble) samplerate;
+
+  for(i = offset; i < offset + n_frames; i += count){
+    count = offset + n_frames - i;
+
+    if(count > AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE){
+      count = AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE;
+    }
+
+    phase = ags_synth_util_oscillator_block(block,
+					    oscillator,
+					    increment, phase,
+					    count);
+
+    for(j = 0; j < count; j++){
+      buffer[i + j] = (signed long) (0xffffff & ((signed long) buffer[i + j] + (signed long) (block[j] * scale * volume)));
+    }
+  }
+
+  return(phase);
+}
+
+/**
+ * ags_synth_util_oscillator_s32:
+ * @buffer: the audio buffer
+ * @oscillator: the #AgsSynthGeneratorOscillator
+ * @freq: the frequency of the wave
+ * @phase: the normalized phase to start with, 0.0 up to 1.0
+ * @volume: the volume of the wave
+ * @samplerate: the samplerate
+ * @offset: start frame
+ * @n_frames: generate n frames
+ *
+ * Add @n_frames of the wave of @oscillator to @buffer using a phase accumulator.
+ *
+ * Returns: the phase to continue with
+ *
+ * Since: 0.7.136
+ */
+gdouble
+ags_synth_util_oscillator_s32(signed long *buffer,
+			      guint oscillator,
+			      gdouble freq, gdouble phase, gdouble volume,
+			      guint samplerate,
+			      guint offset, guint n_frames)
+{
+  static const gdouble scale = 214748363.0;
+  gdouble block[AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE];
+  gdouble increment;
+  guint count;
+  guint i, j;
+
+  increment = freq / (gdouble) samplerate;
+
+  for(i = offset; i < offset + n_frames; i += count){
+    count = offset + n_frames - i;
+
+    if(count > AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE){
+      count = AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE;
+    }
+
+    phase = ags_synth_util_oscillator_block(block,
+					    oscillator,
+					    increment, phase,
+					    count);
+
+    for(j = 0; j < count; j++){
+      buffer[i + j] = (signed long) (0xffffffff & ((signed long long) buffer[i + j] + (signed long long) (block[j] * scale * volume)));
+    }
+  }
+
+  return(phase);
+}
+
+/**
+ * ags_synth_util_oscillator_s64:
+ * @buffer: the audio buffer
+ * @oscillator: the #AgsSynthGeneratorOscillator
+ * @freq: the frequency of the wave
+ * @phase: the normalized phase to start with, 0.0 up to 1.0
+ * @volume: the volume of the wave
+ * @samplerate: the samplerate
+ * @offset: start frame
+ * @n_frames: generate n frames
+ *
+ * Add @n_frames of the wave of @oscillator to @buffer using a phase accumulator.
+ *
+ * Returns: the phase to continue with
+ *
+ * Since: 0.7.136
+ */
+gdouble
+ags_synth_util_oscillator_s64(signed long long *buffer,
+			      guint oscillator,
+			      gdouble freq, gdouble phase, gdouble volume,
+			      guint samplerate,
+			      guint offset, guint n_frames)
+{
+  static const gdouble scale = 9223372036854775807.0;
+  gdouble block[AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE];
+  gdouble increment;
+  guint count;
+  guint i, j;
+
+  increment = freq / (gdouble) samplerate;
+
+  for(i = offset; i < offset + n_frames; i += count){
+    count = offset + n_frames - i;
+
+    if(count > AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE){
+      count = AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE;
+    }
+
+    phase = ags_synth_util_oscillator_block(block,
+					    oscillator,
+					    increment, phase,
+					    count);
+
+    for(j = 0; j < count; j++){
+      buffer[i + j] = (signed long long) ((signed long long) buffer[i + j] + (signed long long) (block[j] * scale * volume));
+    }
+  }
+
+  return(phase);
+}
+
+/**
+ * ags_synth_util_oscillator_float:
+ * @buffer: the audio buffer
+ * @oscillator: the #AgsSynthGeneratorOscillator
+ * @freq: the frequency of the wave
+ * @phase: the normalized phase to start with, 0.0 up to 1.0
+ * @volume: the volume of the wave
+ * @samplerate: the samplerate
+ * @offset: start frame
+ * @n_frames: generate n frames
+ *
+ * Add @n_frames of the wave of @oscillator to @buffer using a phase accumulator.
+ *
+ * Returns: the phase to continue with
+ *
+ * Since: 0.7.136
+ */
+gdouble
+ags_synth_util_oscillator_float(float *buffer,
+				guint oscillator,
+				gdouble freq, gdouble phase, gdouble volume,
+				guint samplerate,
+				guint offset, guint n_frames)
+{
+  gdouble block[AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE];
+  gdouble increment;
+  guint count;
+  guint i, j;
+
+  increment = freq / (gdouble) samplerate;
+
+  for(i = offset; i < offset + n_frames; i += count){
+    count = offset + n_frames - i;
+
+    if(count > AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE){
+      count = AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE;
+    }
+
+    phase = ags_synth_util_oscillator_block(block,
+					    oscillator,
+					    increment, phase,
+					    count);
+
+    for(j = 0; j < count; j++){
+      buffer[i + j] = (float) ((gdouble) buffer[i + j] + block[j] * volume);
+    }
+  }
+
+  return(phase);
+}
+
+/**
+ * ags_synth_util_oscillator_double:
+ * @buffer: the audio buffer
+ * @oscillator: the #AgsSynthGeneratorOscillator
+ * @freq: the frequency of the wave
+ * @phase: the normalized phase to start with, 0.0 up to 1.0
+ * @volume: the volume of the wave
+ * @samplerate: the samplerate
+ * @offset: start frame
+ * @n_frames: generate n frames
+ *
+ * Add @n_frames of the wave of @oscillator to @buffer using a phase accumulator.
+ *
+ * Returns: the phase to continue with
+ *
+ * Since: 0.7.136
+ */
+gdouble
+ags_synth_util_oscillator_double(double *buffer,
+				 guint oscillator,
+				 gdouble freq, gdouble phase, gdouble volume,
+				 guint samplerate,
+				 guint offset, guint n_frames)
+{
+  gdouble block[AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE];
+  gdouble increment;
+  guint count;
+  guint i, j;
+
+  increment = freq / (gdouble) samplerate;
+
+  for(i = offset; i < offset + n_frames; i += count){
+    count = offset + n_frames - i;
+
+    if(count > AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE){
+      count = AGS_SYNTH_UTIL_OSCILLATOR_BLOCK_SIZE;
+    }
+
+    phase = ags_synth_util_oscillator_block(block,
+					    oscillator,
+					    increment, phase,
+					    count);
+
+    for(j = 0; j < count; j++){
+      buffer[i + j] = (double) ((gdouble) buffer[i + j] + block[j] * volume);
+    }
+  }
+
+  return(phase);
+}
+
+/**
+ * ags_synth_util_oscillator:
+ * @buffer: the audio buffer
+ * @oscillator: the #AgsSynthGeneratorOscillator
+ * @freq: the frequency of the wave
+ * @phase: the normalized phase to start with, 0.0 up to 1.0
+ * @volume: the volume of the wave
+ * @samplerate: the samplerate
+ * @audio_buffer_util_format: the audio data format
+ * @offset: start frame
+ * @n_frames: generate n frames
+ *
+ * Add @n_frames of the wave of @oscillator to @buffer. Pass the returned
+ * phase to the next call to continue the wave seamlessly, so the frequency
+ * may change between two calls.
+ *
+ * The sawtooth and square waves are band-limited using polyBLEP. All formats
+ * are derived of the same double precision kernel that computes
+ * %AGS_SYNTH_UTIL_OSCILLATOR_LANES frames per iteration.
+ *
+ * Returns: the phase to continue with
+ *
+ * Since: 0.7.136
+ */
+gdouble
+ags_synth_util_oscillator(void *buffer,
+			  guint oscillator,
+			  gdouble freq, gdouble phase, gdouble volume,
+			  guint samplerate, guint audio_buffer_util_format,
+			  guint offset, guint n_frames)
+{
+  switch(audio_buffer_util_format){
+  case AGS_AUDIO_BUFFER_UTIL_S8:
+    {
+      phase = ags_synth_util_oscillator_s8((signed char *) buffer,
+					   oscillator,
+					   freq, phase, volume,
+					   samplerate,
+					   offset, n_frames);
+    }
+    break;
+  case AGS_AUDIO_BUFFER_UTIL_S16:
+    {
+      phase = ags_synth_util_oscillator_s16((signed short *) buffer,
+					    oscillator,
+					    freq, phase, volume,
+					    samplerate,
+					    offset, n_frames);
+    }
+    break;
+  case AGS_AUDIO_BUFFER_UTIL_S24:
+    {
+      phase = ags_synth_util_oscillator_s24((signed long *) buffer,
+					    oscillator,
+					    freq, phase, volume,
+					    samplerate,
+					    offset, n_frames);
+    }
+    break;
+  case AGS_AUDIO_BUFFER_UTIL_S32:
+    {
+      phase = ags_synth_util_oscillator_s32((signed long *) buffer,
+					    oscillator,
+					    freq, phase, volume,
+					    samplerate,
+					    offset, n_frames);
+    }
+    break;
+  case AGS_AUDIO_BUFFER_UTIL_S64:
+    {
+      phase = ags_synth_util_oscillator_s64((signed long long *) buffer,
+					    oscillator,
+					    freq, phase, volume,
+					    samplerate,
+					    offset, n_frames);
+    }
+    break;
+  case AGS_AUDIO_BUFFER_UTIL_FLOAT:
+    {
+      phase = ags_synth_util_oscillator_float((float *) buffer,
+					      oscillator,
+					      freq, phase, volume,
+					      samplerate,
+					      offset, n_frames);
+    }
+    break;
+  case AGS_AUDIO_BUFFER_UTIL_DOUBLE:
+    {
+      phase = ags_synth_util_oscillator_double((double *) buffer,
+					       oscillator,
+					       freq, phase, volume,
+					       samplerate,
+					       offset, n_frames);
+    }
+    break;
+  default:
+    {
+      g_warning("ags_synth_util_oscillator() - unsupported format\0");
+    }
+  }
+
+  return(phase);
+}
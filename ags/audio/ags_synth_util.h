@@ -164,4 +164,46 @@ void ags_synth_util_square(void *buffer,
 			   guint samplerate, guint audio_buffer_util_format,
 			   guint offset, guint n_frames);
 
+/* phase accumulating oscillator */
+gdouble ags_synth_util_oscillator_s8(signed char *buffer,
+				     guint oscillator,
+				     gdouble freq, gdouble phase, gdouble volume,
+				     guint samplerate,
+				     guint offset, guint n_frames);
+gdouble ags_synth_util_oscillator_s16(signed short *buffer,
+				      guint oscillator,
+				      gdouble freq, gdouble phase, gdouble volume,
+				      guint samplerate,
+				      guint offset, guint n_frames);
+gdouble ags_synth_util_oscillator_s24(signed long *buffer,
+				      guint oscillator,
+				      gdouble freq, gdouble phase, gdouble volume,
+				      guint samplerate,
+				      guint offset, guint n_frames);
+gdouble ags_synth_util_oscillator_s32(signed long *buffer,
+				      guint oscillator,
+				      gdouble freq, gdouble phase, gdouble volume,
+				      guint samplerate,
+				      guint offset, guint n_frames);
+gdouble ags_synth_util_oscillator_s64(signed long long *buffer,
+				      guint oscillator,
+				      gdouble freq, gdouble phase, gdouble volume,
+				      guint samplerate,
+				      guint offset, guint n_frames);
+gdouble ags_synth_util_oscillator_float(float *buffer,
+					guint oscillator,
+					gdouble freq, gdouble phase, gdouble volume,
+					guint samplerate,
+					guint offset, guint n_frames);
+gdouble ags_synth_util_oscillator_double(double *buffer,
+					 guint oscillator,
+					 gdouble freq, gdouble phase, gdouble volume,
+					 guint samplerate,
+					 guint offset, guint n_frames);
+gdouble ags_synth_util_oscillator(void *buffer,
+				  guint oscillator,
+				  gdouble freq, gdouble phase, gdouble volume,
+				  guint samplerate, guint audio_buffer_util_format,
+				  guint offset, guint n_frames);
+
 #endif /*__AGS_SYNTH_UTIL_H__*/
@@ -20,10 +20,64 @@
 #include <ags/audio/client/ags_remote_channel.h>
 
 #include <ags/object/ags_connectable.h>
+#include <ags/object/ags_soundcard.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+
+#include <sys/ioctl.h>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
 
 void ags_remote_channel_class_init(AgsRemoteChannelClass *remote_channel_class);
 void ags_remote_channel_connectable_interface_init(AgsConnectableInterface *connectable);
 void ags_remote_channel_init(AgsRemoteChannel *remote_channel);
+void ags_remote_channel_finalize(GObject *gobject);
+
+gboolean ags_remote_channel_parse_uri(AgsRemoteChannel *remote_channel,
+				      gchar **host, gchar **port);
+gboolean ags_remote_channel_wait(AgsRemoteChannel *remote_channel,
+				 int fd,
+				 GError **error);
+gboolean ags_remote_channel_read_exactly(AgsRemoteChannel *remote_channel,
+					 guchar *buffer, guint length,
+					 GError **error);
+AgsRemoteChannelFrame* ags_remote_channel_read_frame(AgsRemoteChannel *remote_channel,
+						     GError **error);
+void ags_remote_channel_queue_frame(AgsRemoteChannel *remote_channel,
+				    AgsRemoteChannelFrame *frame);
+AgsRemoteChannelFrame* ags_remote_channel_next_frame(AgsRemoteChannel *remote_channel);
+
+GObject* ags_remote_channel_real_connect(AgsRemoteChannel *remote_channel);
+guint ags_remote_channel_real_transfer_data(AgsRemoteChannel *remote_channel, gchar *uuid,
+					    char *data, guint buffer_length,
+					    GError **error);
+guint ags_remote_channel_real_recieve_data(AgsRemoteChannel *remote_channel, gchar *uuid,
+					   char *data, guint buffer_length,
+					   GError **error);
+void ags_remote_channel_real_add_audio_signal(AgsRemoteChannel *remote_channel,
+					      AgsAudioSignal *audio_signal);
+void ags_remote_channel_real_remove_audio_signal(AgsRemoteChannel *remote_channel,
+						 AgsAudioSignal *audio_signal);
+
+/**
+ * SECTION:ags_remote_channel
+ * @short_description: stream audio between processes
+ * @title: AgsRemoteChannel
+ * @section_id:
+ * @include: ags/audio/client/ags_remote_channel.h
+ *
+ * The #AgsRemoteChannel streams period buffers to a peer process. Every
+ * buffer is sent as frame with a fixed binary header carrying a sequence
+ * number, the receiving side reorders them in a small jitter buffer.
+ */
+
+static gpointer ags_remote_channel_parent_class = NULL;
 
 GType
 ags_remote_channel_get_type(void)
@@ -61,9 +115,38 @@ ags_remote_channel_get_type(void)
   return(ags_type_remote_channel);
 }
 
+GQuark
+ags_remote_channel_error_quark()
+{
+  return(g_quark_from_static_string("ags-remote-channel-error-quark\0"));
+}
+
 void
 ags_remote_channel_class_init(AgsRemoteChannelClass *remote_channel_class)
 {
+  GObjectClass *gobject;
+
+  ags_remote_channel_parent_class = g_type_class_peek_parent(remote_channel_class);
+
+  /* GObjectClass */
+  gobject = (GObjectClass *) remote_channel_class;
+
+  gobject->finalize = ags_remote_channel_finalize;
+
+  /* AgsRemoteChannelClass */
+  remote_channel_class->connect = ags_remote_channel_real_connect;
+
+  remote_channel_class->transfer_data = ags_remote_channel_real_transfer_data;
+  remote_channel_class->recieve_data = ags_remote_channel_real_recieve_data;
+
+  remote_channel_class->put_package = NULL;
+  remote_channel_class->get_package = NULL;
+
+  remote_channel_class->delete_package = NULL;
+  remote_channel_class->post_package = NULL;
+
+  remote_channel_class->add_audio_signal = ags_remote_channel_real_add_audio_signal;
+  remote_channel_class->remove_audio_signal = ags_remote_channel_real_remove_audio_signal;
 }
 
 void
@@ -74,4 +157,1058 @@ ags_remote_channel_connectable_interface_init(AgsConnectableInterface *connectab
 void
 ags_remote_channel_init(AgsRemoteChannel *remote_channel)
 {
+  remote_channel->flags = 0;
+  remote_channel->protocol_flags = AGS_REMOTE_CHANNEL_STREAM_TCP;
+
+  remote_channel->data_encoding = NULL;
+  remote_channel->data_compression = NULL;
+
+  remote_channel->character_encoding = NULL;
+
+  remote_channel->uuid = NULL;
+  remote_channel->uri = NULL;
+
+  remote_channel->server = NULL;
+  remote_channel->credentials = NULL;
+
+  remote_channel->client = NULL;
+  remote_channel->data_package = NULL;
+
+  remote_channel->audio_signal = NULL;
+
+  /* transport */
+  remote_channel->fd = -1;
+
+  memset(&(remote_channel->peer_address), 0, sizeof(struct sockaddr_storage));
+  remote_channel->peer_address_length = 0;
+
+  remote_channel->timeout = AGS_REMOTE_CHANNEL_DEFAULT_TIMEOUT;
+
+  remote_channel->samplerate = AGS_SOUNDCARD_DEFAULT_SAMPLERATE;
+  remote_channel->buffer_size = AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE;
+  remote_channel->format = AGS_SOUNDCARD_DEFAULT_FORMAT;
+
+  remote_channel->send_sequence = 0;
+  remote_channel->recieve_sequence = 0;
+
+  /* jitter buffer */
+  remote_channel->jitter_buffer_size = AGS_REMOTE_CHANNEL_DEFAULT_JITTER_BUFFER_SIZE;
+  remote_channel->jitter_buffer_depth = AGS_REMOTE_CHANNEL_DEFAULT_JITTER_BUFFER_DEPTH;
+  remote_channel->jitter_buffer_count = 0;
+  remote_channel->jitter_buffer = (AgsRemoteChannelFrame **) malloc(remote_channel->jitter_buffer_size * sizeof(AgsRemoteChannelFrame *));
+  memset(remote_channel->jitter_buffer, 0, remote_channel->jitter_buffer_size * sizeof(AgsRemoteChannelFrame *));
+
+  remote_channel->frame_buffer = NULL;
+
+  remote_channel->late_frames = 0;
+  remote_channel->lost_frames = 0;
+}
+
+void
+ags_remote_channel_finalize(GObject *gobject)
+{
+  AgsRemoteChannel *remote_channel;
+
+  guint i;
+  
+  remote_channel = AGS_REMOTE_CHANNEL(gobject);
+
+  ags_remote_channel_close(remote_channel);
+
+  for(i = 0; i < remote_channel->jitter_buffer_size; i++){
+    if(remote_channel->jitter_buffer[i] != NULL){
+      ags_remote_channel_frame_free(remote_channel->jitter_buffer[i]);
+    }
+  }
+  
+  free(remote_channel->jitter_buffer);
+  free(remote_channel->frame_buffer);
+
+  g_list_free_full(remote_channel->audio_signal,
+		   g_object_unref);
+  
+  g_free(remote_channel->uri);
+  g_free(remote_channel->uuid);
+  
+  /* call parent */
+  G_OBJECT_CLASS(ags_remote_channel_parent_class)->finalize(gobject);
+}
+
+/**
+ * ags_remote_channel_frame_alloc:
+ * @payload_length: the payload length in bytes
+ *
+ * Allocate #AgsRemoteChannelFrame.
+ *
+ * Returns: the new #AgsRemoteChannelFrame
+ *
+ * Since: 0.7.136
+ */
+AgsRemoteChannelFrame*
+ags_remote_channel_frame_alloc(guint payload_length)
+{
+  AgsRemoteChannelFrame *frame;
+
+  frame = (AgsRemoteChannelFrame *) malloc(sizeof(AgsRemoteChannelFrame));
+
+  frame->sequence = 0;
+  frame->stream_id = 0;
+
+  frame->format = 0;
+  frame->buffer_size = 0;
+
+  frame->payload_length = payload_length;
+
+  if(payload_length > 0){
+    frame->payload = (guchar *) malloc(payload_length * sizeof(guchar));
+  }else{
+    frame->payload = NULL;
+  }
+  
+  return(frame);
+}
+
+/**
+ * ags_remote_channel_frame_free:
+ * @frame: the #AgsRemoteChannelFrame
+ *
+ * Free @frame and its payload.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_remote_channel_frame_free(AgsRemoteChannelFrame *frame)
+{
+  if(frame == NULL){
+    return;
+  }
+
+  free(frame->payload);
+  free(frame);
+}
+
+/**
+ * ags_remote_channel_pack_frame_header:
+ * @frame: the #AgsRemoteChannelFrame
+ * @buffer: at least %AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE bytes
+ *
+ * Write the header of @frame to @buffer in network byte order.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_remote_channel_pack_frame_header(AgsRemoteChannelFrame *frame,
+				     guchar *buffer)
+{
+  guint32 value32;
+  guint16 value16;
+
+  value32 = g_htonl(AGS_REMOTE_CHANNEL_FRAME_MAGIC);
+  memcpy(buffer, &value32, 4);
+
+  value16 = g_htons(AGS_REMOTE_CHANNEL_FRAME_VERSION);
+  memcpy(buffer + 4, &value16, 2);
+
+  value16 = g_htons(frame->format);
+  memcpy(buffer + 6, &value16, 2);
+
+  value32 = g_htonl(frame->sequence);
+  memcpy(buffer + 8, &value32, 4);
+
+  value32 = g_htonl(frame->stream_id);
+  memcpy(buffer + 12, &value32, 4);
+
+  value32 = g_htonl(frame->buffer_size);
+  memcpy(buffer + 16, &value32, 4);
+
+  value32 = g_htonl(frame->payload_length);
+  memcpy(buffer + 20, &value32, 4);
+}
+
+/**
+ * ags_remote_channel_unpack_frame_header:
+ * @frame: the #AgsRemoteChannelFrame
+ * @buffer: %AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE bytes as received
+ *
+ * Read the header in @buffer into @frame. The payload isn't touched.
+ *
+ * Returns: %TRUE if @buffer contains a valid header, else %FALSE
+ *
+ * Since: 0.7.136
+ */
+gboolean
+ags_remote_channel_unpack_frame_header(AgsRemoteChannelFrame *frame,
+				       guchar *buffer)
+{
+  guint32 value32;
+  guint16 value16;
+
+  memcpy(&value32, buffer, 4);
+
+  if(g_ntohl(value32) != AGS_REMOTE_CHANNEL_FRAME_MAGIC){
+    return(FALSE);
+  }
+  
+  memcpy(&value16, buffer + 4, 2);
+
+  if(g_ntohs(value16) != AGS_REMOTE_CHANNEL_FRAME_VERSION){
+    return(FALSE);
+  }
+  
+  memcpy(&value16, buffer + 6, 2);
+  frame->format = g_ntohs(value16);
+
+  memcpy(&value32, buffer + 8, 4);
+  frame->sequence = g_ntohl(value32);
+
+  memcpy(&value32, buffer + 12, 4);
+  frame->stream_id = g_ntohl(value32);
+
+  memcpy(&value32, buffer + 16, 4);
+  frame->buffer_size = g_ntohl(value32);
+
+  memcpy(&value32, buffer + 20, 4);
+  frame->payload_length = g_ntohl(value32);
+
+  if(frame->payload_length > AGS_REMOTE_CHANNEL_FRAME_MAX_PAYLOAD_SIZE){
+    return(FALSE);
+  }
+  
+  return(TRUE);
+}
+
+gboolean
+ags_remote_channel_parse_uri(AgsRemoteChannel *remote_channel,
+			     gchar **host, gchar **port)
+{
+  gchar *str, *offset;
+
+  *host = NULL;
+  *port = NULL;
+
+  /* defaults */
+  if(remote_channel->uri == NULL){
+    *host = g_strdup(AGS_REMOTE_CHANNEL_DEFAULT_HOST);
+    *port = g_strdup_printf("%d\0", AGS_REMOTE_CHANNEL_DEFAULT_PORT);
+    
+    return(TRUE);
+  }
+
+  /* scheme - tcp://host:port or udp://host:port */
+  str = remote_channel->uri;
+  
+  if(!g_ascii_strncasecmp(str, "tcp://\0", 6)){
+    remote_channel->protocol_flags &= (~AGS_REMOTE_CHANNEL_STREAM_UDP);
+    remote_channel->protocol_flags |= AGS_REMOTE_CHANNEL_STREAM_TCP;
+
+    str += 6;
+  }else if(!g_ascii_strncasecmp(str, "udp://\0", 6)){
+    remote_channel->protocol_flags &= (~AGS_REMOTE_CHANNEL_STREAM_TCP);
+    remote_channel->protocol_flags |= AGS_REMOTE_CHANNEL_STREAM_UDP;
+
+    str += 6;
+  }
+
+  offset = strrchr(str, ':');
+
+  if(offset == NULL){
+    *host = g_strdup(str);
+    *port = g_strdup_printf("%d\0", AGS_REMOTE_CHANNEL_DEFAULT_PORT);
+  }else{
+    *host = g_strndup(str, offset - str);
+    *port = g_strdup(offset + 1);
+  }
+
+  return(**host != '\0' && **port != '\0');
+}
+
+/**
+ * ags_remote_channel_connect:
+ * @remote_channel: the #AgsRemoteChannel
+ *
+ * Open the transport described by #AgsRemoteChannel:uri. With
+ * %AGS_REMOTE_CHANNEL_LISTEN set it binds the address and, for TCP, waits
+ * for the peer to connect.
+ *
+ * Returns: @remote_channel as #GObject on success, otherwise %NULL
+ *
+ * Since: 0.7.136
+ */
+GObject*
+ags_remote_channel_connect(AgsRemoteChannel *remote_channel)
+{
+  GObject *retval;
+
+  g_return_val_if_fail(AGS_IS_REMOTE_CHANNEL(remote_channel), NULL);
+
+  g_object_ref(G_OBJECT(remote_channel));
+  retval = AGS_REMOTE_CHANNEL_GET_CLASS(remote_channel)->connect(remote_channel);
+  g_object_unref(G_OBJECT(remote_channel));
+
+  return(retval);
+}
+
+GObject*
+ags_remote_channel_real_connect(AgsRemoteChannel *remote_channel)
+{
+  struct addrinfo hints, *address_info, *current;
+
+  gchar *host, *port;
+  
+  int fd;
+  int option;
+  gboolean is_tcp;
+  gboolean success;
+  
+  if((AGS_REMOTE_CHANNEL_CONNECTED & (remote_channel->flags)) != 0){
+    return((GObject *) remote_channel);
+  }
+  
+  if(!ags_remote_channel_parse_uri(remote_channel,
+				   &host, &port)){
+    g_warning("ags_remote_channel.c - invalid uri %s\0", remote_channel->uri);
+
+    g_free(host);
+    g_free(port);
+    
+    return(NULL);
+  }
+
+  is_tcp = ((AGS_REMOTE_CHANNEL_STREAM_UDP & (remote_channel->protocol_flags)) == 0) ? TRUE: FALSE;
+
+  /* resolve */
+  memset(&hints, 0, sizeof(struct addrinfo));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = (is_tcp) ? SOCK_STREAM: SOCK_DGRAM;
+
+  if((AGS_REMOTE_CHANNEL_LISTEN & (remote_channel->flags)) != 0){
+    hints.ai_flags = AI_PASSIVE;
+  }
+  
+  if(getaddrinfo(host, port,
+		 &hints,
+		 &address_info) != 0){
+    g_warning("ags_remote_channel.c - can't resolve %s:%s\0", host, port);
+
+    g_free(host);
+    g_free(port);
+
+    return(NULL);
+  }
+
+  g_free(host);
+  g_free(port);
+
+  fd = -1;
+  success = FALSE;
+  
+  for(current = address_info; current != NULL && !success; current = current->ai_next){
+    fd = socket(current->ai_family, current->ai_socktype, current->ai_protocol);
+
+    if(fd == -1){
+      continue;
+    }
+    
+    if((AGS_REMOTE_CHANNEL_LISTEN & (remote_channel->flags)) != 0){
+      option = 1;
+      setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &option, sizeof(int));
+
+      success = (bind(fd, current->ai_addr, current->ai_addrlen) == 0 &&
+		 (!is_tcp || listen(fd, 1) == 0)) ? TRUE: FALSE;
+    }else{
+      success = (connect(fd, current->ai_addr, current->ai_addrlen) == 0) ? TRUE: FALSE;
+
+      if(success){
+	memcpy(&(remote_channel->peer_address), current->ai_addr, current->ai_addrlen);
+	remote_channel->peer_address_length = current->ai_addrlen;
+      }
+    }
+
+    if(!success){
+      close(fd);
+      fd = -1;
+    }
+  }
+
+  freeaddrinfo(address_info);
+
+  if(fd == -1){
+    return(NULL);
+  }
+  
+  /* the listening side of TCP waits for its peer */
+  if(is_tcp &&
+     (AGS_REMOTE_CHANNEL_LISTEN & (remote_channel->flags)) != 0){
+    int listen_fd;
+
+    listen_fd = fd;
+
+    remote_channel->peer_address_length = sizeof(struct sockaddr_storage);
+    fd = accept(listen_fd, (struct sockaddr *) &(remote_channel->peer_address), &(remote_channel->peer_address_length));
+    close(listen_fd);
+
+    if(fd == -1){
+      return(NULL);
+    }
+  }
+
+  /* don't let small period buffers wait for each other */
+  if(is_tcp){
+    option = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &option, sizeof(int));
+  }
+  
+  remote_channel->fd = fd;
+
+  if(remote_channel->frame_buffer == NULL){
+    remote_channel->frame_buffer = (guchar *) malloc((AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE + AGS_REMOTE_CHANNEL_FRAME_MAX_PAYLOAD_SIZE) * sizeof(guchar));
+  }
+  
+  remote_channel->send_sequence = 0;
+  remote_channel->flags &= (~(AGS_REMOTE_CHANNEL_SYNCED |
+			      AGS_REMOTE_CHANNEL_PRIMED));
+  remote_channel->flags |= AGS_REMOTE_CHANNEL_CONNECTED;
+  
+  return((GObject *) remote_channel);
+}
+
+/**
+ * ags_remote_channel_close:
+ * @remote_channel: the #AgsRemoteChannel
+ *
+ * Close the transport and drop all buffered frames.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_remote_channel_close(AgsRemoteChannel *remote_channel)
+{
+  guint i;
+
+  g_return_if_fail(AGS_IS_REMOTE_CHANNEL(remote_channel));
+
+  if(remote_channel->fd != -1){
+    close(remote_channel->fd);
+    remote_channel->fd = -1;
+  }
+
+  for(i = 0; i < remote_channel->jitter_buffer_size; i++){
+    if(remote_channel->jitter_buffer[i] != NULL){
+      ags_remote_channel_frame_free(remote_channel->jitter_buffer[i]);
+      remote_channel->jitter_buffer[i] = NULL;
+    }
+  }
+
+  remote_channel->jitter_buffer_count = 0;
+  
+  remote_channel->flags &= (~(AGS_REMOTE_CHANNEL_CONNECTED |
+			      AGS_REMOTE_CHANNEL_SYNCED |
+			      AGS_REMOTE_CHANNEL_PRIMED));
+}
+
+/**
+ * ags_remote_channel_transfer_data:
+ * @remote_channel: the #AgsRemoteChannel
+ * @uuid: the stream's id or %NULL
+ * @data: the period buffer
+ * @buffer_length: length of @data in bytes
+ * @error: return location of #GError
+ *
+ * Send one period buffer as frame to the peer. A buffer exceeding
+ * %AGS_REMOTE_CHANNEL_FRAME_MAX_PAYLOAD_SIZE is refused with
+ * %AGS_REMOTE_CHANNEL_PAYLOAD_TOO_LARGE.
+ *
+ * Returns: the count of bytes sent
+ *
+ * Since: 0.7.136
+ */
+guint
+ags_remote_channel_transfer_data(AgsRemoteChannel *remote_channel, gchar *uuid,
+				 char *data, guint buffer_length,
+				 GError **error)
+{
+  guint retval;
+
+  g_return_val_if_fail(AGS_IS_REMOTE_CHANNEL(remote_channel), 0);
+
+  g_object_ref(G_OBJECT(remote_channel));
+  retval = AGS_REMOTE_CHANNEL_GET_CLASS(remote_channel)->transfer_data(remote_channel, uuid,
+								       data, buffer_length,
+								       error);
+  g_object_unref(G_OBJECT(remote_channel));
+
+  return(retval);
+}
+
+guint
+ags_remote_channel_real_transfer_data(AgsRemoteChannel *remote_channel, gchar *uuid,
+				      char *data, guint buffer_length,
+				      GError **error)
+{
+  AgsRemoteChannelFrame frame;
+
+  guint length, offset;
+  ssize_t count;
+  
+  if((AGS_REMOTE_CHANNEL_CONNECTED & (remote_channel->flags)) == 0){
+    g_set_error(error,
+		AGS_REMOTE_CHANNEL_ERROR,
+		AGS_REMOTE_CHANNEL_NOT_CONNECTED,
+		"remote channel not connected\0");
+    
+    return(0);
+  }
+
+  /* a period is one frame, the peer can't reassemble a split one */
+  if(buffer_length > AGS_REMOTE_CHANNEL_FRAME_MAX_PAYLOAD_SIZE){
+    g_set_error(error,
+		AGS_REMOTE_CHANNEL_ERROR,
+		AGS_REMOTE_CHANNEL_PAYLOAD_TOO_LARGE,
+		"remote channel period of %u bytes exceeds frame payload of %u bytes\0",
+		buffer_length,
+		AGS_REMOTE_CHANNEL_FRAME_MAX_PAYLOAD_SIZE);
+    
+    return(0);
+  }
+  
+  /* header and payload go out as one write resp. datagram */
+  frame.sequence = remote_channel->send_sequence;
+  frame.stream_id = ((uuid != NULL) ? g_str_hash(uuid): 0);
+  frame.format = remote_channel->format;
+  frame.buffer_size = remote_channel->buffer_size;
+  frame.payload_length = buffer_length;
+
+  ags_remote_channel_pack_frame_header(&frame,
+				       remote_channel->frame_buffer);
+  memcpy(remote_channel->frame_buffer + AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE,
+	 data,
+	 buffer_length);
+
+  length = AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE + buffer_length;
+  offset = 0;
+
+  while(offset < length){
+    count = send(remote_channel->fd,
+		 remote_channel->frame_buffer + offset,
+		 length - offset,
+		 MSG_NOSIGNAL);
+
+    if(count == -1){
+      if(errno == EINTR){
+	continue;
+      }
+
+      g_set_error(error,
+		  AGS_REMOTE_CHANNEL_ERROR,
+		  AGS_REMOTE_CHANNEL_SERVER_DIED,
+		  "remote channel failed to send: %s\0",
+		  strerror(errno));
+      
+      return(0);
+    }
+
+    offset += count;
+  }
+  
+  remote_channel->send_sequence += 1;
+  
+  return(buffer_length);
+}
+
+gboolean
+ags_remote_channel_wait(AgsRemoteChannel *remote_channel,
+			int fd,
+			GError **error)
+{
+  struct pollfd poll_fd;
+
+  int retval;
+  
+  poll_fd.fd = fd;
+  poll_fd.events = POLLIN;
+  poll_fd.revents = 0;
+
+  do{
+    retval = poll(&poll_fd, 1, remote_channel->timeout);
+  }while(retval == -1 && errno == EINTR);
+  
+  if(retval <= 0){
+    g_set_error(error,
+		AGS_REMOTE_CHANNEL_ERROR,
+		AGS_REMOTE_CHANNEL_SERVER_TIMEOUT,
+		"remote channel timed out\0");
+
+    return(FALSE);
+  }
+
+  return(TRUE);
+}
+
+gboolean
+ags_remote_channel_read_exactly(AgsRemoteChannel *remote_channel,
+				guchar *buffer, guint length,
+				GError **error)
+{
+  guint offset;
+  ssize_t count;
+  
+  offset = 0;
+
+  while(offset < length){
+    if(!ags_remote_channel_wait(remote_channel,
+				remote_channel->fd,
+				error)){
+      return(FALSE);
+    }
+    
+    count = recv(remote_channel->fd,
+		 buffer + offset,
+		 length - offset,
+		 0);
+
+    if(count == -1 && errno == EINTR){
+      continue;
+    }
+    
+    if(count <= 0){
+      g_set_error(error,
+		  AGS_REMOTE_CHANNEL_ERROR,
+		  AGS_REMOTE_CHANNEL_SERVER_DIED,
+		  "remote channel peer closed connection\0");
+      
+      return(FALSE);
+    }
+
+    offset += count;
+  }
+
+  return(TRUE);
+}
+
+AgsRemoteChannelFrame*
+ags_remote_channel_read_frame(AgsRemoteChannel *remote_channel,
+			      GError **error)
+{
+  AgsRemoteChannelFrame *frame;
+  AgsRemoteChannelFrame header;
+
+  ssize_t count;
+  int available;
+  
+  if((AGS_REMOTE_CHANNEL_STREAM_UDP & (remote_channel->protocol_flags)) != 0){
+    /* one frame per datagram */
+    remote_channel->peer_address_length = sizeof(struct sockaddr_storage);
+
+    do{
+      count = recvfrom(remote_channel->fd,
+		       remote_channel->frame_buffer,
+		       AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE + AGS_REMOTE_CHANNEL_FRAME_MAX_PAYLOAD_SIZE,
+		       MSG_DONTWAIT,
+		       (struct sockaddr *) &(remote_channel->peer_address), &(remote_channel->peer_address_length));
+    }while(count == -1 && errno == EINTR);
+
+    if(count == -1){
+      if(errno == EAGAIN ||
+	 errno == EWOULDBLOCK){
+	/* nothing pending */
+	return(NULL);
+      }
+
+      g_set_error(error,
+		  AGS_REMOTE_CHANNEL_ERROR,
+		  AGS_REMOTE_CHANNEL_SERVER_DIED,
+		  "remote channel failed to receive: %s\0",
+		  strerror(errno));
+
+      return(NULL);
+    }
+    
+    if(count < AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE ||
+       !ags_remote_channel_unpack_frame_header(&header,
+					       remote_channel->frame_buffer) ||
+       count != AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE + header.payload_length){
+      g_set_error(error,
+		  AGS_REMOTE_CHANNEL_ERROR,
+		  AGS_REMOTE_CHANNEL_MALFORMED_FRAME,
+		  "remote channel received malformed datagram\0");
+
+      return(NULL);
+    }
+
+    frame = ags_remote_channel_frame_alloc(header.payload_length);
+    memcpy(frame->payload,
+	   remote_channel->frame_buffer + AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE,
+	   header.payload_length);
+  }else{
+    /* peek the header, the frame stays queued until it arrived completely */
+    do{
+      count = recv(remote_channel->fd,
+		   remote_channel->frame_buffer,
+		   AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE,
+		   MSG_PEEK | MSG_DONTWAIT);
+    }while(count == -1 && errno == EINTR);
+
+    if(count == -1 &&
+       (errno == EAGAIN ||
+	errno == EWOULDBLOCK)){
+      return(NULL);
+    }
+
+    if(count <= 0){
+      g_set_error(error,
+		  AGS_REMOTE_CHANNEL_ERROR,
+		  AGS_REMOTE_CHANNEL_SERVER_DIED,
+		  "remote channel peer closed connection\0");
+      
+      return(NULL);
+    }
+
+    if(count < AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE){
+      return(NULL);
+    }
+    
+    if(!ags_remote_channel_unpack_frame_header(&header,
+					       remote_channel->frame_buffer)){
+      /* skip it, the peer resyncs at its next frame */
+      ags_remote_channel_read_exactly(remote_channel,
+				      remote_channel->frame_buffer, AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE,
+				      NULL);
+      
+      g_set_error(error,
+		  AGS_REMOTE_CHANNEL_ERROR,
+		  AGS_REMOTE_CHANNEL_MALFORMED_FRAME,
+		  "remote channel received malformed frame header\0");
+
+      return(NULL);
+    }
+
+    if(ioctl(remote_channel->fd, FIONREAD, &available) == -1 ||
+       available < AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE + header.payload_length){
+      return(NULL);
+    }
+
+    /* all present, doesn't block */
+    frame = ags_remote_channel_frame_alloc(header.payload_length);
+
+    if(!ags_remote_channel_read_exactly(remote_channel,
+					remote_channel->frame_buffer, AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE,
+					error) ||
+       !ags_remote_channel_read_exactly(remote_channel,
+					frame->payload, header.payload_length,
+					error)){
+      ags_remote_channel_frame_free(frame);
+      
+      return(NULL);
+    }
+  }
+
+  frame->sequence = header.sequence;
+  frame->stream_id = header.stream_id;
+  frame->format = header.format;
+  frame->buffer_size = header.buffer_size;
+
+  return(frame);
+}
+
+void
+ags_remote_channel_queue_frame(AgsRemoteChannel *remote_channel,
+				AgsRemoteChannelFrame *frame)
+{
+  guint nth;
+  gint32 distance;
+  
+  if((AGS_REMOTE_CHANNEL_SYNCED & (remote_channel->flags)) == 0){
+    remote_channel->recieve_sequence = frame->sequence;
+    remote_channel->flags |= AGS_REMOTE_CHANNEL_SYNCED;
+  }
+
+  distance = (gint32) (frame->sequence - remote_channel->recieve_sequence);
+
+  /* reordered before playback started, begin earlier */
+  if(distance < 0 &&
+     (AGS_REMOTE_CHANNEL_PRIMED & (remote_channel->flags)) == 0 &&
+     -distance < (gint32) (remote_channel->jitter_buffer_size - remote_channel->jitter_buffer_depth)){
+    remote_channel->recieve_sequence = frame->sequence;
+    distance = 0;
+  }
+  
+  /* already played */
+  if(distance < 0){
+    remote_channel->late_frames += 1;
+    ags_remote_channel_frame_free(frame);
+
+    return;
+  }
+
+  /* peer is too far ahead, give up the oldest slots */
+  while(distance >= (gint32) remote_channel->jitter_buffer_size){
+    nth = remote_channel->recieve_sequence % remote_channel->jitter_buffer_size;
+
+    if(remote_channel->jitter_buffer[nth] != NULL){
+      ags_remote_channel_frame_free(remote_channel->jitter_buffer[nth]);
+      remote_channel->jitter_buffer[nth] = NULL;
+
+      remote_channel->jitter_buffer_count -= 1;
+    }
+
+    remote_channel->lost_frames += 1;
+    remote_channel->recieve_sequence += 1;
+    distance--;
+  }
+
+  nth = frame->sequence % remote_channel->jitter_buffer_size;
+
+  /* duplicate */
+  if(remote_channel->jitter_buffer[nth] != NULL){
+    ags_remote_channel_frame_free(frame);
+
+    return;
+  }
+
+  remote_channel->jitter_buffer[nth] = frame;
+  remote_channel->jitter_buffer_count += 1;
+}
+
+AgsRemoteChannelFrame*
+ags_remote_channel_next_frame(AgsRemoteChannel *remote_channel)
+{
+  AgsRemoteChannelFrame *frame;
+
+  frame = remote_channel->jitter_buffer[remote_channel->recieve_sequence % remote_channel->jitter_buffer_size];
+
+  /* a later frame wrapped into the slot isn't due yet */
+  if(frame != NULL &&
+     frame->sequence != remote_channel->recieve_sequence){
+    return(NULL);
+  }
+  
+  return(frame);
+}
+
+/**
+ * ags_remote_channel_recieve_data:
+ * @remote_channel: the #AgsRemoteChannel
+ * @uuid: the stream's id or %NULL
+ * @data: the period buffer to fill
+ * @buffer_length: length of @data in bytes
+ * @error: return location of #GError
+ *
+ * Fill @data with the next period buffer in sequence of the stream @uuid,
+ * frames of other streams are dropped. The call doesn't block, it takes
+ * what is pending on the transport. Until the jitter buffer is primed and
+ * for a frame that didn't arrive in time silence is played.
+ *
+ * Returns: the count of bytes filled
+ *
+ * Since: 0.7.136
+ */
+guint
+ags_remote_channel_recieve_data(AgsRemoteChannel *remote_channel, gchar *uuid,
+				char *data, guint buffer_length,
+				GError **error)
+{
+  guint retval;
+
+  g_return_val_if_fail(AGS_IS_REMOTE_CHANNEL(remote_channel), 0);
+
+  g_object_ref(G_OBJECT(remote_channel));
+  retval = AGS_REMOTE_CHANNEL_GET_CLASS(remote_channel)->recieve_data(remote_channel, uuid,
+								      data, buffer_length,
+								      error);
+  g_object_unref(G_OBJECT(remote_channel));
+
+  return(retval);
+}
+
+guint
+ags_remote_channel_real_recieve_data(AgsRemoteChannel *remote_channel, gchar *uuid,
+				     char *data, guint buffer_length,
+				     GError **error)
+{
+  AgsRemoteChannelFrame *frame;
+
+  GError *read_error;
+  
+  guint32 stream_id;
+  guint nth;
+  guint length;
+  guint i;
+  
+  if((AGS_REMOTE_CHANNEL_CONNECTED & (remote_channel->flags)) == 0){
+    g_set_error(error,
+		AGS_REMOTE_CHANNEL_ERROR,
+		AGS_REMOTE_CHANNEL_NOT_CONNECTED,
+		"remote channel not connected\0");
+    
+    return(0);
+  }
+
+  stream_id = ((uuid != NULL) ? g_str_hash(uuid): 0);
+  
+  /* move pending frames to the jitter buffer, at most one round of it */
+  for(i = 0; i < remote_channel->jitter_buffer_size; i++){
+    read_error = NULL;
+    frame = ags_remote_channel_read_frame(remote_channel,
+					  &read_error);
+
+    if(frame == NULL){
+      if(read_error == NULL){
+	/* nothing pending */
+	break;
+      }
+      
+      if(read_error->code == AGS_REMOTE_CHANNEL_MALFORMED_FRAME){
+	g_error_free(read_error);
+
+	continue;
+      }
+
+      if(remote_channel->jitter_buffer_count > 0){
+	/* drain what we have */
+	g_error_free(read_error);
+
+	break;
+      }
+      
+      g_propagate_error(error,
+			read_error);
+      
+      return(0);
+    }
+
+    if(frame->stream_id != stream_id){
+      ags_remote_channel_frame_free(frame);
+
+      continue;
+    }
+    
+    ags_remote_channel_queue_frame(remote_channel,
+				   frame);
+
+    if(remote_channel->jitter_buffer_count >= remote_channel->jitter_buffer_depth){
+      remote_channel->flags |= AGS_REMOTE_CHANNEL_PRIMED;
+    }
+  }
+
+  /* not yet primed */
+  if((AGS_REMOTE_CHANNEL_PRIMED & (remote_channel->flags)) == 0){
+    memset(data, 0, buffer_length);
+
+    return(buffer_length);
+  }
+  
+  /* play next */
+  nth = remote_channel->recieve_sequence % remote_channel->jitter_buffer_size;
+  frame = ags_remote_channel_next_frame(remote_channel);
+
+  if(frame != NULL){
+    length = MIN(frame->payload_length, buffer_length);
+    memcpy(data, frame->payload, length);
+
+    if(length < buffer_length){
+      memset(data + length, 0, buffer_length - length);
+    }
+
+    ags_remote_channel_frame_free(frame);
+    remote_channel->jitter_buffer[nth] = NULL;
+
+    remote_channel->jitter_buffer_count -= 1;
+  }else{
+    memset(data, 0, buffer_length);
+
+    remote_channel->lost_frames += 1;
+  }
+
+  remote_channel->recieve_sequence += 1;
+  
+  return(buffer_length);
+}
+
+/**
+ * ags_remote_channel_add_audio_signal:
+ * @remote_channel: the #AgsRemoteChannel
+ * @audio_signal: the #AgsAudioSignal
+ *
+ * Add @audio_signal to the streamed signals.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_remote_channel_add_audio_signal(AgsRemoteChannel *remote_channel,
+				    AgsAudioSignal *audio_signal)
+{
+  g_return_if_fail(AGS_IS_REMOTE_CHANNEL(remote_channel));
+
+  g_object_ref(G_OBJECT(remote_channel));
+  AGS_REMOTE_CHANNEL_GET_CLASS(remote_channel)->add_audio_signal(remote_channel,
+								 audio_signal);
+  g_object_unref(G_OBJECT(remote_channel));
+}
+
+void
+ags_remote_channel_real_add_audio_signal(AgsRemoteChannel *remote_channel,
+					 AgsAudioSignal *audio_signal)
+{
+  if(g_list_find(remote_channel->audio_signal, audio_signal) != NULL){
+    return;
+  }
+
+  g_object_ref(audio_signal);
+  remote_channel->audio_signal = g_list_append(remote_channel->audio_signal,
+					       audio_signal);
+}
+
+/**
+ * ags_remote_channel_remove_audio_signal:
+ * @remote_channel: the #AgsRemoteChannel
+ * @audio_signal: the #AgsAudioSignal
+ *
+ * Remove @audio_signal from the streamed signals.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_remote_channel_remove_audio_signal(AgsRemoteChannel *remote_channel,
+				       AgsAudioSignal *audio_signal)
+{
+  g_return_if_fail(AGS_IS_REMOTE_CHANNEL(remote_channel));
+
+  g_object_ref(G_OBJECT(remote_channel));
+  AGS_REMOTE_CHANNEL_GET_CLASS(remote_channel)->remove_audio_signal(remote_channel,
+								    audio_signal);
+  g_object_unref(G_OBJECT(remote_channel));
+}
+
+void
+ags_remote_channel_real_remove_audio_signal(AgsRemoteChannel *remote_channel,
+					    AgsAudioSignal *audio_signal)
+{
+  if(g_list_find(remote_channel->audio_signal, audio_signal) == NULL){
+    return;
+  }
+
+  remote_channel->audio_signal = g_list_remove(remote_channel->audio_signal,
+					       audio_signal);
+  g_object_unref(audio_signal);
+}
+
+/**
+ * ags_remote_channel_new:
+ * @application_context: the #AgsApplicationContext
+ *
+ * Creates an #AgsRemoteChannel
+ *
+ * Returns: a new #AgsRemoteChannel
+ *
+ * Since: 0.7.136
+ */
+AgsRemoteChannel*
+ags_remote_channel_new(GObject *application_context)
+{
+  AgsRemoteChannel *remote_channel;
+
+  remote_channel = (AgsRemoteChannel *) g_object_new(AGS_TYPE_REMOTE_CHANNEL,
+						     NULL);
+
+  return(remote_channel);
 }
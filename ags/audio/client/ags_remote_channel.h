@@ -23,6 +23,9 @@
 #include <glib.h>
 #include <glib-object.h>
 
+#include <sys/types.h>
+#include <sys/socket.h>
+
 #include <ags/audio/ags_audio_signal.h>
 
 #define AGS_TYPE_REMOTE_CHANNEL                (ags_remote_channel_get_type())
@@ -32,22 +35,45 @@
 #define AGS_IS_REMOTE_CHANNEL_CLASS(class)     (G_TYPE_CHECK_CLASS_TYPE ((class), AGS_TYPE_REMOTE_CHANNEL))
 #define AGS_REMOTE_CHANNEL_GET_CLASS(obj)      (G_TYPE_INSTANCE_GET_CLASS(obj, AGS_TYPE_REMOTE_CHANNEL, AgsRemoteChannelClass))
 
+#define AGS_REMOTE_CHANNEL_ERROR (ags_remote_channel_error_quark())
+
+#define AGS_REMOTE_CHANNEL_FRAME_MAGIC (0x41475346)
+#define AGS_REMOTE_CHANNEL_FRAME_VERSION (1)
+#define AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE (24)
+#define AGS_REMOTE_CHANNEL_FRAME_MAX_PAYLOAD_SIZE (65507 - AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE)
+
+#define AGS_REMOTE_CHANNEL_DEFAULT_HOST "127.0.0.1\0"
+#define AGS_REMOTE_CHANNEL_DEFAULT_PORT (8081)
+#define AGS_REMOTE_CHANNEL_DEFAULT_TIMEOUT (1000)
+#define AGS_REMOTE_CHANNEL_DEFAULT_JITTER_BUFFER_SIZE (16)
+#define AGS_REMOTE_CHANNEL_DEFAULT_JITTER_BUFFER_DEPTH (2)
+
 typedef struct _AgsRemoteChannel AgsRemoteChannel;
 typedef struct _AgsRemoteChannelClass AgsRemoteChannelClass;
+typedef struct _AgsRemoteChannelFrame AgsRemoteChannelFrame;
 
 typedef enum{
   AGS_REMOTE_CHANNEL_KEEP_ALIVE         =  1,
+  AGS_REMOTE_CHANNEL_LISTEN             =  1 <<  1,
+  AGS_REMOTE_CHANNEL_CONNECTED          =  1 <<  2,
+  AGS_REMOTE_CHANNEL_SYNCED             =  1 <<  3,
+  AGS_REMOTE_CHANNEL_PRIMED             =  1 <<  4,
 }AgsRemoteChannelFlags;
 
 typedef enum{
   AGS_REMOTE_CHANNEL_RPC                =  1,
   AGS_REMOTE_CHANNEL_XMLRPC             =  1 <<  1,
   AGS_REMOTE_CHANNEL_REST_HTTP          =  1 <<  2,
+  AGS_REMOTE_CHANNEL_STREAM_TCP         =  1 <<  3,
+  AGS_REMOTE_CHANNEL_STREAM_UDP         =  1 <<  4,
 }AgsRemoteChannelProtocolFlags;
 
 typedef enum{
   AGS_REMOTE_CHANNEL_SERVER_TIMEOUT,
   AGS_REMOTE_CHANNEL_SERVER_DIED,
+  AGS_REMOTE_CHANNEL_NOT_CONNECTED,
+  AGS_REMOTE_CHANNEL_MALFORMED_FRAME,
+  AGS_REMOTE_CHANNEL_PAYLOAD_TOO_LARGE,
 }AgsRemoteChannelError;
 
 struct _AgsRemoteChannel
@@ -72,6 +98,30 @@ struct _AgsRemoteChannel
   GList *data_package;
 
   GList *audio_signal;
+
+  int fd;
+
+  struct sockaddr_storage peer_address;
+  socklen_t peer_address_length;
+  
+  guint timeout;
+
+  guint samplerate;
+  guint buffer_size;
+  guint format;
+  
+  guint32 send_sequence;
+  guint32 recieve_sequence;
+
+  guint jitter_buffer_size;
+  guint jitter_buffer_depth;
+  guint jitter_buffer_count;
+  AgsRemoteChannelFrame **jitter_buffer;
+
+  guchar *frame_buffer;
+  
+  guint late_frames;
+  guint lost_frames;
 };
 
 struct _AgsRemoteChannelClass
@@ -82,10 +132,10 @@ struct _AgsRemoteChannelClass
 
   guint (*transfer_data)(AgsRemoteChannel *remote_channel, gchar *uuid,
 			 char *data, guint buffer_length,
-			 GError *error);
+			 GError **error);
   guint (*recieve_data)(AgsRemoteChannel *remote_channel, gchar *uuid,
 			char *data, guint buffer_length,
-			GError *error);
+			GError **error);
   
   void (*put_package)(AgsRemoteChannel *remote_channel,
 		      GObject *data_package);
@@ -103,10 +153,45 @@ struct _AgsRemoteChannelClass
 			      AgsAudioSignal *audio_signal);
 };
 
+struct _AgsRemoteChannelFrame
+{
+  guint32 sequence;
+  guint32 stream_id;
+
+  guint16 format;
+  guint32 buffer_size;
+  
+  guint32 payload_length;
+  guchar *payload;
+};
+
 GType ags_remote_channel_get_type();
 
 GQuark ags_remote_channel_error_quark();
 
+AgsRemoteChannelFrame* ags_remote_channel_frame_alloc(guint payload_length);
+void ags_remote_channel_frame_free(AgsRemoteChannelFrame *frame);
+
+void ags_remote_channel_pack_frame_header(AgsRemoteChannelFrame *frame,
+					  guchar *buffer);
+gboolean ags_remote_channel_unpack_frame_header(AgsRemoteChannelFrame *frame,
+						guchar *buffer);
+
+GObject* ags_remote_channel_connect(AgsRemoteChannel *remote_channel);
+void ags_remote_channel_close(AgsRemoteChannel *remote_channel);
+
+guint ags_remote_channel_transfer_data(AgsRemoteChannel *remote_channel, gchar *uuid,
+				       char *data, guint buffer_length,
+				       GError **error);
+guint ags_remote_channel_recieve_data(AgsRemoteChannel *remote_channel, gchar *uuid,
+				      char *data, guint buffer_length,
+				      GError **error);
+
+void ags_remote_channel_add_audio_signal(AgsRemoteChannel *remote_channel,
+					 AgsAudioSignal *audio_signal);
+void ags_remote_channel_remove_audio_signal(AgsRemoteChannel *remote_channel,
+					    AgsAudioSignal *audio_signal);
+
 AgsRemoteChannel* ags_remote_channel_new(GObject *application_context);
 
 #endif /*__AGS_REMOTE_CHANNEL_H__*/
@@ -74,4 +74,67 @@ ags_remote_input_connectable_interface_init(AgsConnectableInterface *connectable
 void
 ags_remote_input_init(AgsRemoteInput *remote_input)
 {
+  /* the receiving side binds the address */
+  AGS_REMOTE_CHANNEL(remote_input)->flags |= AGS_REMOTE_CHANNEL_LISTEN;
+}
+
+/**
+ * ags_remote_input_recieve:
+ * @remote_input: the #AgsRemoteInput
+ * @audio_signal: the #AgsAudioSignal
+ * @stream: the current #GList-struct of @audio_signal's stream
+ * @error: return location of #GError
+ *
+ * Fill the current period of @stream belonging to @audio_signal with the next buffer
+ * received from the peer.
+ *
+ * Returns: the count of bytes transferred
+ *
+ * Since: 0.7.136
+ */
+guint
+ags_remote_input_recieve(AgsRemoteInput *remote_input,
+			 AgsAudioSignal *audio_signal, GList *stream,
+			 GError **error)
+{
+  AgsRemoteChannel *remote_channel;
+
+  guint length;
+  guint retval;
+  
+  if(!AGS_IS_REMOTE_INPUT(remote_input) ||
+     !AGS_IS_AUDIO_SIGNAL(audio_signal) ||
+     stream == NULL){
+    return(0);
+  }
+
+  remote_channel = AGS_REMOTE_CHANNEL(remote_input);
+  length = audio_signal->buffer_size * audio_signal->word_size;
+
+  retval = ags_remote_channel_recieve_data(remote_channel, NULL,
+					   stream->data, length,
+					   error);
+
+  return(retval);
+}
+
+/**
+ * ags_remote_input_new:
+ * @application_context: the #AgsApplicationContext
+ *
+ * Creates an #AgsRemoteInput
+ *
+ * Returns: a new #AgsRemoteInput
+ *
+ * Since: 0.7.136
+ */
+AgsRemoteInput*
+ags_remote_input_new(GObject *application_context)
+{
+  AgsRemoteInput *remote_input;
+
+  remote_input = (AgsRemoteInput *) g_object_new(AGS_TYPE_REMOTE_INPUT,
+						 NULL);
+
+  return(remote_input);
 }
@@ -47,6 +47,10 @@ struct _AgsRemoteInputClass
 
 GType ags_remote_input_get_type();
 
+guint ags_remote_input_recieve(AgsRemoteInput *remote_input,
+			       AgsAudioSignal *audio_signal, GList *stream,
+			       GError **error);
+
 AgsRemoteInput* ags_remote_input_new(GObject *application_context);
 
 #endif /*__AGS_REMOTE_INPUT_H__*/
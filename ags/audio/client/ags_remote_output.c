@@ -74,4 +74,70 @@ ags_remote_output_connectable_interface_init(AgsConnectableInterface *connectabl
 void
 ags_remote_output_init(AgsRemoteOutput *remote_output)
 {
+  /* the sending side connects to the peer */
+  AGS_REMOTE_CHANNEL(remote_output)->flags &= (~AGS_REMOTE_CHANNEL_LISTEN);
+}
+
+/**
+ * ags_remote_output_send:
+ * @remote_output: the #AgsRemoteOutput
+ * @audio_signal: the #AgsAudioSignal
+ * @stream: the current #GList-struct of @audio_signal's stream
+ * @error: return location of #GError
+ *
+ * Send the current period of @stream belonging to @audio_signal to the peer.
+ *
+ * Returns: the count of bytes transferred
+ *
+ * Since: 0.7.136
+ */
+guint
+ags_remote_output_send(AgsRemoteOutput *remote_output,
+		       AgsAudioSignal *audio_signal, GList *stream,
+		       GError **error)
+{
+  AgsRemoteChannel *remote_channel;
+
+  guint length;
+  guint retval;
+  
+  if(!AGS_IS_REMOTE_OUTPUT(remote_output) ||
+     !AGS_IS_AUDIO_SIGNAL(audio_signal) ||
+     stream == NULL){
+    return(0);
+  }
+
+  remote_channel = AGS_REMOTE_CHANNEL(remote_output);
+  length = audio_signal->buffer_size * audio_signal->word_size;
+
+  remote_channel->samplerate = audio_signal->samplerate;
+  remote_channel->buffer_size = audio_signal->buffer_size;
+  remote_channel->format = audio_signal->format;
+  
+  retval = ags_remote_channel_transfer_data(remote_channel, NULL,
+					    stream->data, length,
+					    error);
+
+  return(retval);
+}
+
+/**
+ * ags_remote_output_new:
+ * @application_context: the #AgsApplicationContext
+ *
+ * Creates an #AgsRemoteOutput
+ *
+ * Returns: a new #AgsRemoteOutput
+ *
+ * Since: 0.7.136
+ */
+AgsRemoteOutput*
+ags_remote_output_new(GObject *application_context)
+{
+  AgsRemoteOutput *remote_output;
+
+  remote_output = (AgsRemoteOutput *) g_object_new(AGS_TYPE_REMOTE_OUTPUT,
+						   NULL);
+
+  return(remote_output);
 }
@@ -47,6 +47,10 @@ struct _AgsRemoteOutputClass
 
 GType ags_remote_output_get_type();
 
+guint ags_remote_output_send(AgsRemoteOutput *remote_output,
+			     AgsAudioSignal *audio_signal, GList *stream,
+			     GError **error);
+
 AgsRemoteOutput* ags_remote_output_new(GObject *application_context);
 
 #endif /*__AGS_REMOTE_OUTPUT_H__*/
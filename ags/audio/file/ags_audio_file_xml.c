@@ -2109,7 +2109,7 @@ ags_file_read_recall_container(AgsFile *file, xmlNode *node, AgsRecallContainer
 	    if(!xmlStrncmp(value_node->name,
 			   (xmlChar *) "ags-value\0",
 			   10)){
-	      list = ags_file_lookup_find_by_node(file->lookup,
+	      list = ags_file_find_lookup_by_node(file,
 						  value_node);
 	  
 	      if(list != NULL){
@@ -2844,7 +2844,7 @@ ags_file_read_port(AgsFile *file, xmlNode *node, AgsPort **port)
 
 	if(gobject->port_value_type == G_TYPE_POINTER ||
 	   gobject->port_value_type == G_TYPE_OBJECT){
-	  list = ags_file_lookup_find_by_node(file->lookup,
+	  list = ags_file_find_lookup_by_node(file,
 					      child);
 	  
 	  if(list != NULL){
@@ -4387,6 +4387,8 @@ ags_file_read_notation(AgsFile *file, xmlNode *node, AgsNotation **notation)
 	ags_file_read_note_list(file,
 				child,
 				&gobject->notes);
+
+	gobject->flags &= (~AGS_NOTATION_INDEXED);
       }
     }
 
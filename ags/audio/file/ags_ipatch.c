@@ -26,6 +26,8 @@
 
 #include <ags/audio/file/ags_ipatch_sf2_reader.h>
 
+#include <stdlib.h>
+
 void ags_ipatch_class_init(AgsIpatchClass *ipatch);
 void ags_ipatch_connectable_interface_init(AgsConnectableInterface *connectable);
 void ags_ipatch_playable_interface_init(AgsPlayableInterface *playable);
@@ -58,8 +60,14 @@ void ags_ipatch_info(AgsPlayable *playable,
 		     GError **error);
 guint ags_ipatch_get_samplerate(AgsPlayable *playable);
 guint ags_ipatch_get_format(AgsPlayable *playable);
+IpatchSample* ags_ipatch_find_sample(AgsIpatch *ipatch);
 double* ags_ipatch_read(AgsPlayable *playable, guint channel,
 			GError **error);
+guint ags_ipatch_read_chunk(AgsPlayable *playable,
+			    guint channel,
+			    void *buffer, guint format,
+			    guint offset, guint n_frames,
+			    GError **error);
 void ags_ipatch_close(AgsPlayable *playable);
 
 /**
@@ -224,6 +232,7 @@ ags_ipatch_playable_interface_init(AgsPlayableInterface *playable)
   playable->get_format = ags_ipatch_get_format;
 
   playable->read = ags_ipatch_read;
+  playable->read_chunk = ags_ipatch_read_chunk;
 
   playable->close = ags_ipatch_close;
 }
@@ -251,6 +260,9 @@ ags_ipatch_init(AgsIpatch *ipatch)
   ipatch->iter = NULL;
 
   ipatch->nth_level = 0;
+
+  ipatch->chunk = NULL;
+  ipatch->chunk_size = 0;
 }
 
 void
@@ -978,6 +990,40 @@ ags_ipatch_get_format(AgsPlayable *playable)
   }
 }
 
+IpatchSample*
+ags_ipatch_find_sample(AgsIpatch *ipatch)
+{
+  IpatchSample *sample;
+
+  sample = NULL;
+
+  if(ipatch->nth_level == 3){
+    if(AGS_IPATCH_SF2_READER(ipatch->reader)->sample != NULL){
+      sample = AGS_IPATCH_SF2_READER(ipatch->reader)->sample;
+    }else{
+      if(ipatch->iter != NULL){
+	sample = IPATCH_SAMPLE(ipatch->iter->data);
+      }
+    }
+  }else{
+    if((AGS_IPATCH_DLS2 & (ipatch->flags)) != 0){
+      //TODO:JK: implement me
+    }else if((AGS_IPATCH_SF2 & (ipatch->flags)) != 0){
+      AgsIpatchSF2Reader *reader;
+
+      reader = AGS_IPATCH_SF2_READER(ipatch->reader);
+
+      sample = (IpatchSample *) ipatch_sf2_find_sample(reader->sf2,
+						       reader->selected[3],
+						       NULL);
+    }else if((AGS_IPATCH_GIG & (ipatch->flags)) != 0){
+      //TODO:JK: implement me
+    }
+  }
+
+  return(sample);
+}
+
 double*
 ags_ipatch_read(AgsPlayable *playable, guint channel,
 		GError **error)
@@ -1007,34 +1053,7 @@ ags_ipatch_read(AgsPlayable *playable, guint channel,
 
   buffer = (double *) malloc(channels * frames * sizeof(double));
   
-  if(ipatch->nth_level == 3){
-    if(AGS_IPATCH_SF2_READER(ipatch->reader)->sample != NULL){
-      sample = AGS_IPATCH_SF2_READER(ipatch->reader)->sample;
-    }else{
-      if(ipatch->iter != NULL){
-	sample = IPATCH_SAMPLE(ipatch->iter->data);
-      }else{
-	sample = NULL;
-      }
-    }
-  }else{
-    sample = NULL;
-
-    if((AGS_IPATCH_DLS2 & (ipatch->flags)) != 0){
-      //TODO:JK: implement me
-    }else if((AGS_IPATCH_SF2 & (ipatch->flags)) != 0){
-      AgsIpatchSF2Reader *reader;
-
-      reader = AGS_IPATCH_SF2_READER(ipatch->reader);
-
-      this_error = NULL;
-      sample = (IpatchSample *) ipatch_sf2_find_sample(reader->sf2,
-						       reader->selected[3],
-						       NULL);
-    }else if((AGS_IPATCH_GIG & (ipatch->flags)) != 0){
-      //TODO:JK: implement me
-    }
-  }
+  sample = ags_ipatch_find_sample(ipatch);
 
   this_error = NULL;
   ipatch_sample_read_transform(sample,
@@ -1052,6 +1071,97 @@ ags_ipatch_read(AgsPlayable *playable, guint channel,
   return(buffer);
 }
 
+guint
+ags_ipatch_read_chunk(AgsPlayable *playable,
+		      guint channel,
+		      void *buffer, guint format,
+		      guint offset, guint n_frames,
+		      GError **error)
+{
+  AgsIpatch *ipatch;
+
+  IpatchSample *sample;
+
+  guint channels, frames;
+  guint loop_start, loop_end;
+  guint chunk_format;
+  int ipatch_format;
+  guint copy_mode;
+  
+  GError *this_error;
+
+  ipatch = AGS_IPATCH(playable);
+
+  sample = ags_ipatch_find_sample(ipatch);
+
+  if(sample == NULL){
+    return(0);
+  }
+
+  this_error = NULL;
+  ags_playable_info(playable,
+		    &channels, &frames,
+		    &loop_start, &loop_end,
+		    &this_error);
+
+  if(this_error != NULL){
+    g_warning("%s\0", this_error->message);
+
+    g_error_free(this_error);
+  }
+
+  if(offset >= frames){
+    return(0);
+  }
+
+  if(offset + n_frames > frames){
+    n_frames = frames - offset;
+  }
+  
+  /* up to 16 bit read as short without conversion, above as double */
+  if(format == AGS_SOUNDCARD_SIGNED_8_BIT ||
+     format == AGS_SOUNDCARD_SIGNED_16_BIT){
+    chunk_format = AGS_AUDIO_BUFFER_UTIL_S16;
+    ipatch_format = (IPATCH_SAMPLE_16BIT | IPATCH_SAMPLE_SIGNED | IPATCH_SAMPLE_ENDIAN_HOST | IPATCH_SAMPLE_MONO);
+  }else{
+    chunk_format = AGS_AUDIO_BUFFER_UTIL_DOUBLE;
+    ipatch_format = (IPATCH_SAMPLE_DOUBLE | IPATCH_SAMPLE_MONO);
+  }
+
+  if(ipatch->chunk_size < n_frames){
+    free(ipatch->chunk);
+
+    ipatch->chunk = malloc(n_frames * sizeof(double));
+    ipatch->chunk_size = n_frames;
+  }
+
+  /* read only the requested part of the sample */
+  this_error = NULL;
+  ipatch_sample_read_transform(sample,
+			       offset,
+			       n_frames,
+			       ipatch->chunk,
+			       ipatch_format,
+			       IPATCH_SAMPLE_UNITY_CHANNEL_MAP,
+			       &this_error);
+  
+  if(this_error != NULL){
+    g_propagate_error(error,
+		      this_error);
+
+    return(0);
+  }
+
+  copy_mode = ags_audio_buffer_util_get_copy_mode(ags_audio_buffer_util_format_from_soundcard(format),
+						  chunk_format);
+  
+  ags_audio_buffer_util_copy_buffer_to_buffer(buffer, 1, 0,
+					      ipatch->chunk, 1, 0,
+					      n_frames, copy_mode);
+
+  return(n_frames);
+}
+
 void
 ags_ipatch_close(AgsPlayable *playable)
 {
@@ -1061,9 +1171,14 @@ ags_ipatch_close(AgsPlayable *playable)
 void
 ags_ipatch_finalize(GObject *gobject)
 {
-  G_OBJECT_CLASS(ags_ipatch_parent_class)->finalize(gobject);
+  AgsIpatch *ipatch;
 
-  /* empty */
+  ipatch = AGS_IPATCH(gobject);
+
+  free(ipatch->chunk);
+
+  /* call parent */
+  G_OBJECT_CLASS(ags_ipatch_parent_class)->finalize(gobject);
 }
 
 /**
@@ -71,6 +71,9 @@ struct _AgsIpatch
   GList *iter;
 
   guint nth_level;
+
+  gpointer chunk;
+  guint chunk_size;
 };
 
 struct _AgsIpatchClass
@@ -25,6 +25,7 @@
 #include <ags/audio/ags_playable.h>
 #include <ags/audio/ags_audio_buffer_util.h>
 
+#include <stdlib.h>
 #include <string.h>
 
 void ags_sndfile_class_init(AgsSndfileClass *sndfile);
@@ -53,6 +54,11 @@ void ags_sndfile_info(AgsPlayable *playable,
 guint ags_sndfile_get_samplerate(AgsPlayable *playable);
 guint ags_sndfile_get_format(AgsPlayable *playable);
 double* ags_sndfile_read(AgsPlayable *playable, guint channel, GError **error);
+guint ags_sndfile_read_chunk(AgsPlayable *playable,
+			     guint channel,
+			     void *buffer, guint format,
+			     guint offset, guint n_frames,
+			     GError **error);
 void ags_sndfile_write(AgsPlayable *playable, double *buffer, guint buffer_length);
 void ags_sndfile_flush(AgsPlayable *playable);
 void ags_sndfile_seek(AgsPlayable *playable, guint frames, gint whence);
@@ -179,6 +185,7 @@ ags_sndfile_playable_interface_init(AgsPlayableInterface *playable)
   playable->get_format = ags_sndfile_get_format;
 
   playable->read = ags_sndfile_read;
+  playable->read_chunk = ags_sndfile_read_chunk;
 
   playable->write = ags_sndfile_write;
   playable->flush = ags_sndfile_flush;
@@ -201,6 +208,13 @@ ags_sndfile_init(AgsSndfile *sndfile)
   sndfile->length = 0;
 
   sndfile->buffer = NULL;
+
+  sndfile->chunk = NULL;
+  sndfile->chunk_format = AGS_AUDIO_BUFFER_UTIL_S16;
+  sndfile->chunk_offset = 0;
+  sndfile->chunk_length = 0;
+  sndfile->chunk_frames = 0;
+  sndfile->chunk_size = 0;
 }
 
 void
@@ -443,6 +457,82 @@ ags_sndfile_read(AgsPlayable *playable, guint channel, GError **error)
   return(buffer);
 }
 
+guint
+ags_sndfile_read_chunk(AgsPlayable *playable,
+		       guint channel,
+		       void *buffer, guint format,
+		       guint offset, guint n_frames,
+		       GError **error)
+{
+  AgsSndfile *sndfile;
+
+  sf_count_t position;
+  guint channels;
+  guint chunk_format;
+  guint copy_mode;
+
+  sndfile = AGS_SNDFILE(playable);
+
+  if(sndfile->file == NULL ||
+     sndfile->info == NULL){
+    return(0);
+  }
+
+  channels = sndfile->info->channels;
+
+  if(channel >= channels ||
+     n_frames == 0){
+    return(0);
+  }
+  
+  /* up to 16 bit read as short without conversion, above as double */
+  if(format == AGS_SOUNDCARD_SIGNED_8_BIT ||
+     format == AGS_SOUNDCARD_SIGNED_16_BIT){
+    chunk_format = AGS_AUDIO_BUFFER_UTIL_S16;
+  }else{
+    chunk_format = AGS_AUDIO_BUFFER_UTIL_DOUBLE;
+  }
+
+  /* read interleaved chunk once for all channels */
+  if(sndfile->chunk == NULL ||
+     sndfile->chunk_format != chunk_format ||
+     sndfile->chunk_offset != offset ||
+     sndfile->chunk_length != n_frames){
+    if(sndfile->chunk_size < n_frames){
+      free(sndfile->chunk);
+
+      sndfile->chunk = malloc((size_t) channels * n_frames * sizeof(double));
+      sndfile->chunk_size = n_frames;
+    }
+
+    position = sf_seek(sndfile->file, 0, SEEK_CUR);
+
+    if(position != offset){
+      sf_seek(sndfile->file, offset, SEEK_SET);
+    }
+    
+    if(chunk_format == AGS_AUDIO_BUFFER_UTIL_S16){
+      sndfile->chunk_frames = sf_readf_short(sndfile->file, (short *) sndfile->chunk, n_frames);
+    }else{
+      sndfile->chunk_frames = sf_readf_double(sndfile->file, (double *) sndfile->chunk, n_frames);
+    }
+
+    sndfile->chunk_format = chunk_format;
+    sndfile->chunk_offset = offset;
+    sndfile->chunk_length = n_frames;
+  }
+
+  /* de-interleave */
+  copy_mode = ags_audio_buffer_util_get_copy_mode(ags_audio_buffer_util_format_from_soundcard(format),
+						  chunk_format);
+  
+  ags_audio_buffer_util_copy_buffer_to_buffer(buffer, 1, 0,
+					      sndfile->chunk, channels, channel,
+					      sndfile->chunk_frames, copy_mode);
+
+  return(sndfile->chunk_frames);
+}
+
 void
 ags_sndfile_write(AgsPlayable *playable, double *buffer, guint buffer_length)
 {
@@ -495,9 +585,14 @@ ags_sndfile_close(AgsPlayable *playable)
 void
 ags_sndfile_finalize(GObject *gobject)
 {
-  G_OBJECT_CLASS(ags_sndfile_parent_class)->finalize(gobject);
+  AgsSndfile *sndfile;
 
-  /* empty */
+  sndfile = AGS_SNDFILE(gobject);
+
+  free(sndfile->chunk);
+
+  /* call parent */
+  G_OBJECT_CLASS(ags_sndfile_parent_class)->finalize(gobject);
 }
 
 sf_count_t
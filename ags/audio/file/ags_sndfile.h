@@ -53,6 +53,13 @@ struct _AgsSndfile
   gsize length;
 
   gpointer buffer;
+
+  gpointer chunk;
+  guint chunk_format;
+  guint chunk_offset;
+  guint chunk_length;
+  guint chunk_frames;
+  guint chunk_size;
 };
 
 struct _AgsSndfileClass
@@ -0,0 +1,452 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/audio/midi/ags_midi_event_ring.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+guint ags_midi_event_ring_message_length(unsigned char status);
+guint ags_midi_event_ring_terminate_sysex(AgsMidiEventRing *midi_event_ring);
+
+/**
+ * SECTION:ags_midi_event_ring
+ * @short_description: timestamped MIDI event ring
+ * @title: AgsMidiEventRing
+ * @section_id:
+ * @include: ags/audio/midi/ags_midi_event_ring.h
+ *
+ * #AgsMidiEventRing is a preallocated single producer, single consumer
+ * ring of #AgsMidiEvent. The producer splits raw MIDI bytes into messages
+ * and stamps them with a frame, the consumer takes them out without
+ * any lock held.
+ */
+
+/**
+ * ags_midi_event_ring_alloc:
+ * @size: the count of events, rounded up to a power of 2
+ *
+ * Allocate #AgsMidiEventRing.
+ *
+ * Returns: the new #AgsMidiEventRing
+ *
+ * Since: 0.7.136
+ */
+AgsMidiEventRing*
+ags_midi_event_ring_alloc(guint size)
+{
+  AgsMidiEventRing *midi_event_ring;
+
+  guint ring_size;
+
+  ring_size = 1;
+
+  while(ring_size < size){
+    ring_size <<= 1;
+  }
+
+  midi_event_ring = (AgsMidiEventRing *) malloc(sizeof(AgsMidiEventRing));
+
+  midi_event_ring->event = (AgsMidiEvent *) malloc(ring_size * sizeof(AgsMidiEvent));
+
+  midi_event_ring->size = ring_size;
+  midi_event_ring->mask = ring_size - 1;
+
+  ags_midi_event_ring_reset(midi_event_ring);
+
+  return(midi_event_ring);
+}
+
+/**
+ * ags_midi_event_ring_free:
+ * @midi_event_ring: the #AgsMidiEventRing
+ *
+ * Free @midi_event_ring.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_midi_event_ring_free(AgsMidiEventRing *midi_event_ring)
+{
+  if(midi_event_ring == NULL){
+    return;
+  }
+
+  free(midi_event_ring->event);
+  free(midi_event_ring);
+}
+
+/**
+ * ags_midi_event_ring_reset:
+ * @midi_event_ring: the #AgsMidiEventRing
+ *
+ * Discard all events and the parser state of @midi_event_ring. Neither
+ * producer nor consumer may run meanwhile.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_midi_event_ring_reset(AgsMidiEventRing *midi_event_ring)
+{
+  if(midi_event_ring == NULL){
+    return;
+  }
+
+  g_atomic_int_set(&(midi_event_ring->head),
+		   0);
+  g_atomic_int_set(&(midi_event_ring->tail),
+		   0);
+
+  g_atomic_int_set(&(midi_event_ring->dropped),
+		   0);
+
+  memset(&(midi_event_ring->message),
+	 0,
+	 sizeof(AgsMidiEvent));
+
+  midi_event_ring->expected = 0;
+  midi_event_ring->running_status = 0;
+  midi_event_ring->sysex = FALSE;
+}
+
+/**
+ * ags_midi_event_ring_push:
+ * @midi_event_ring: the #AgsMidiEventRing
+ * @midi_event: the #AgsMidiEvent to copy
+ *
+ * Copy @midi_event into @midi_event_ring. Called by the producer only.
+ * If the ring is full the event is counted as dropped.
+ *
+ * Returns: %TRUE on success, otherwise %FALSE
+ *
+ * Since: 0.7.136
+ */
+gboolean
+ags_midi_event_ring_push(AgsMidiEventRing *midi_event_ring,
+			 AgsMidiEvent *midi_event)
+{
+  guint head, tail;
+
+  if(midi_event_ring == NULL ||
+     midi_event == NULL){
+    return(FALSE);
+  }
+
+  head = g_atomic_int_get(&(midi_event_ring->head));
+  tail = g_atomic_int_get(&(midi_event_ring->tail));
+
+  if(head - tail >= midi_event_ring->size){
+    g_atomic_int_inc(&(midi_event_ring->dropped));
+
+    return(FALSE);
+  }
+
+  memcpy(&(midi_event_ring->event[head & (midi_event_ring->mask)]),
+	 midi_event,
+	 sizeof(AgsMidiEvent));
+
+  /* publish */
+  g_atomic_int_set(&(midi_event_ring->head),
+		   head + 1);
+
+  return(TRUE);
+}
+
+guint
+ags_midi_event_ring_message_length(unsigned char status)
+{
+  switch(0xf0 & status){
+  case 0x80:
+  case 0x90:
+  case 0xa0:
+  case 0xb0:
+  case 0xe0:
+    return(3);
+  case 0xc0:
+  case 0xd0:
+    return(2);
+  }
+
+  switch(status){
+  case 0xf1:
+  case 0xf3:
+    return(2);
+  case 0xf2:
+    return(3);
+  }
+
+  return(1);
+}
+
+guint
+ags_midi_event_ring_terminate_sysex(AgsMidiEventRing *midi_event_ring)
+{
+  AgsMidiEvent *message;
+
+  guint count;
+
+  message = &(midi_event_ring->message);
+  count = 0;
+
+  if(message->length == AGS_MIDI_EVENT_DATA_SIZE){
+    message->flags = AGS_MIDI_EVENT_CONTINUED;
+
+    if(ags_midi_event_ring_push(midi_event_ring,
+				message)){
+      count++;
+    }
+
+    message->flags = 0;
+    message->length = 0;
+  }
+
+  message->data[message->length] = 0xf7;
+  message->length += 1;
+
+  if(ags_midi_event_ring_push(midi_event_ring,
+			      message)){
+    count++;
+  }
+
+  message->length = 0;
+  midi_event_ring->sysex = FALSE;
+
+  return(count);
+}
+
+/**
+ * ags_midi_event_ring_parse:
+ * @midi_event_ring: the #AgsMidiEventRing
+ * @buffer: the raw MIDI bytes
+ * @buffer_length: the length of @buffer
+ * @frame: the frame the bytes arrived at
+ *
+ * Split @buffer into messages and push them stamped with @frame. Messages
+ * may span several calls, running status is expanded and system exclusive
+ * messages exceeding %AGS_MIDI_EVENT_DATA_SIZE are split into events
+ * flagged with %AGS_MIDI_EVENT_CONTINUED. Called by the producer only.
+ *
+ * Returns: the count of events pushed
+ *
+ * Since: 0.7.136
+ */
+guint
+ags_midi_event_ring_parse(AgsMidiEventRing *midi_event_ring,
+			  unsigned char *buffer, guint buffer_length,
+			  guint64 frame)
+{
+  AgsMidiEvent *message;
+
+  unsigned char c;
+  guint count;
+  guint i;
+
+  if(midi_event_ring == NULL ||
+     buffer == NULL){
+    return(0);
+  }
+
+  message = &(midi_event_ring->message);
+  count = 0;
+
+  for(i = 0; i < buffer_length; i++){
+    c = buffer[i];
+
+    /* real-time messages may interleave any other message */
+    if(c >= 0xf8){
+      AgsMidiEvent real_time;
+
+      real_time.frame = frame;
+      real_time.offset = 0;
+      real_time.flags = 0;
+      real_time.length = 1;
+      real_time.data[0] = c;
+
+      if(ags_midi_event_ring_push(midi_event_ring,
+				  &real_time)){
+	count++;
+      }
+
+      continue;
+    }
+
+    /* system exclusive */
+    if(midi_event_ring->sysex){
+      if((0x80 & c) == 0){
+	message->data[message->length] = c;
+	message->length += 1;
+
+	if(message->length == AGS_MIDI_EVENT_DATA_SIZE){
+	  message->flags = AGS_MIDI_EVENT_CONTINUED;
+
+	  if(ags_midi_event_ring_push(midi_event_ring,
+				      message)){
+	    count++;
+	  }
+
+	  message->flags = 0;
+	  message->length = 0;
+	}
+
+	continue;
+      }
+
+      /* end of exclusive or any other status byte terminates it */
+      count += ags_midi_event_ring_terminate_sysex(midi_event_ring);
+
+      if(c == 0xf7){
+	continue;
+      }
+    }
+
+    if((0x80 & c) != 0){
+      if(c == 0xf7){
+	continue;
+      }
+
+      /* status byte discards an incomplete message */
+      message->frame = frame;
+      message->offset = 0;
+      message->flags = 0;
+
+      message->data[0] = c;
+      message->length = 1;
+
+      if(c == 0xf0){
+	midi_event_ring->sysex = TRUE;
+	midi_event_ring->running_status = 0;
+
+	continue;
+      }
+
+      midi_event_ring->expected = ags_midi_event_ring_message_length(c);
+      midi_event_ring->running_status = (c < 0xf0) ? c: 0;
+    }else{
+      if(message->length == 0){
+	/* running status */
+	if(midi_event_ring->running_status == 0){
+	  continue;
+	}
+
+	message->frame = frame;
+	message->offset = 0;
+	message->flags = 0;
+
+	message->data[0] = midi_event_ring->running_status;
+	message->length = 1;
+
+	midi_event_ring->expected = ags_midi_event_ring_message_length(midi_event_ring->running_status);
+      }
+
+      message->data[message->length] = c;
+      message->length += 1;
+    }
+
+    /* complete */
+    if(message->length == midi_event_ring->expected){
+      if(ags_midi_event_ring_push(midi_event_ring,
+				  message)){
+	count++;
+      }
+
+      message->length = 0;
+    }
+  }
+
+  return(count);
+}
+
+/**
+ * ags_midi_event_ring_peek:
+ * @midi_event_ring: the #AgsMidiEventRing
+ *
+ * Get the oldest event of @midi_event_ring without removing it. Called by
+ * the consumer only.
+ *
+ * Returns: the #AgsMidiEvent or %NULL if empty
+ *
+ * Since: 0.7.136
+ */
+AgsMidiEvent*
+ags_midi_event_ring_peek(AgsMidiEventRing *midi_event_ring)
+{
+  guint head, tail;
+
+  if(midi_event_ring == NULL){
+    return(NULL);
+  }
+
+  tail = g_atomic_int_get(&(midi_event_ring->tail));
+  head = g_atomic_int_get(&(midi_event_ring->head));
+
+  if(head == tail){
+    return(NULL);
+  }
+
+  return(&(midi_event_ring->event[tail & (midi_event_ring->mask)]));
+}
+
+/**
+ * ags_midi_event_ring_pop:
+ * @midi_event_ring: the #AgsMidiEventRing
+ *
+ * Remove the oldest event of @midi_event_ring. Called by the consumer only.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_midi_event_ring_pop(AgsMidiEventRing *midi_event_ring)
+{
+  guint head, tail;
+
+  if(midi_event_ring == NULL){
+    return;
+  }
+
+  tail = g_atomic_int_get(&(midi_event_ring->tail));
+  head = g_atomic_int_get(&(midi_event_ring->head));
+
+  if(head == tail){
+    return;
+  }
+
+  /* release */
+  g_atomic_int_set(&(midi_event_ring->tail),
+		   tail + 1);
+}
+
+/**
+ * ags_midi_event_ring_count:
+ * @midi_event_ring: the #AgsMidiEventRing
+ *
+ * Count the events available to the consumer.
+ *
+ * Returns: the count of events
+ *
+ * Since: 0.7.136
+ */
+guint
+ags_midi_event_ring_count(AgsMidiEventRing *midi_event_ring)
+{
+  if(midi_event_ring == NULL){
+    return(0);
+  }
+
+  return(g_atomic_int_get(&(midi_event_ring->head)) - g_atomic_int_get(&(midi_event_ring->tail)));
+}
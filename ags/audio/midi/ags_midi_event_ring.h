@@ -0,0 +1,87 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_MIDI_EVENT_RING_H__
+#define __AGS_MIDI_EVENT_RING_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#define AGS_MIDI_EVENT(ptr) ((AgsMidiEvent *)(ptr))
+#define AGS_MIDI_EVENT_RING(ptr) ((AgsMidiEventRing *)(ptr))
+
+#define AGS_MIDI_EVENT_DATA_SIZE (12)
+#define AGS_MIDI_EVENT_RING_DEFAULT_SIZE (1024)
+
+typedef struct _AgsMidiEvent AgsMidiEvent;
+typedef struct _AgsMidiEventRing AgsMidiEventRing;
+
+typedef enum{
+  AGS_MIDI_EVENT_CONTINUED     = 1,
+}AgsMidiEventFlags;
+
+struct _AgsMidiEvent
+{
+  guint64 frame;
+  guint offset;
+
+  guint flags;
+
+  guint length;
+  unsigned char data[AGS_MIDI_EVENT_DATA_SIZE];
+};
+
+struct _AgsMidiEventRing
+{
+  AgsMidiEvent *event;
+
+  guint size;
+  guint mask;
+
+  volatile guint head;
+  volatile guint tail;
+
+  volatile guint dropped;
+
+  AgsMidiEvent message;
+
+  guint expected;
+  unsigned char running_status;
+  gboolean sysex;
+};
+
+AgsMidiEventRing* ags_midi_event_ring_alloc(guint size);
+void ags_midi_event_ring_free(AgsMidiEventRing *midi_event_ring);
+
+void ags_midi_event_ring_reset(AgsMidiEventRing *midi_event_ring);
+
+/* producer */
+gboolean ags_midi_event_ring_push(AgsMidiEventRing *midi_event_ring,
+				  AgsMidiEvent *midi_event);
+guint ags_midi_event_ring_parse(AgsMidiEventRing *midi_event_ring,
+				unsigned char *buffer, guint buffer_length,
+				guint64 frame);
+
+/* consumer */
+AgsMidiEvent* ags_midi_event_ring_peek(AgsMidiEventRing *midi_event_ring);
+void ags_midi_event_ring_pop(AgsMidiEventRing *midi_event_ring);
+
+guint ags_midi_event_ring_count(AgsMidiEventRing *midi_event_ring);
+
+#endif /*__AGS_MIDI_EVENT_RING_H__*/
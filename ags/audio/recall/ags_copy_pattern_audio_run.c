@@ -19,6 +19,8 @@
 
 #include <ags/audio/recall/ags_copy_pattern_audio_run.h>
 #include <ags/audio/recall/ags_copy_pattern_audio.h>
+#include <ags/audio/recall/ags_copy_pattern_channel.h>
+#include <ags/audio/recall/ags_copy_pattern_channel_run.h>
 
 #include <ags/util/ags_id_generator.h>
 
@@ -30,8 +32,16 @@
 #include <ags/file/ags_file_id_ref.h>
 #include <ags/file/ags_file_lookup.h>
 
+#include <ags/thread/ags_mutex_manager.h>
+
+#include <ags/audio/ags_audio.h>
+#include <ags/audio/ags_input.h>
+#include <ags/audio/ags_pattern.h>
+#include <ags/audio/ags_port.h>
 #include <ags/audio/ags_recall_container.h>
 
+#include <stdlib.h>
+
 void ags_copy_pattern_audio_run_class_init(AgsCopyPatternAudioRunClass *copy_pattern_audio_run);
 void ags_copy_pattern_audio_run_connectable_interface_init(AgsConnectableInterface *connectable);
 void ags_copy_pattern_audio_run_dynamic_connectable_interface_init(AgsDynamicConnectableInterface *dynamic_connectable);
@@ -65,6 +75,21 @@ void ags_copy_pattern_audio_run_write_resolve_dependency(AgsFileLookup *file_loo
 void ags_copy_pattern_audio_run_read_resolve_dependency(AgsFileLookup *file_lookup,
 							GObject *recall);
 
+void ags_copy_pattern_audio_run_sequencer_alloc_callback(AgsDelayAudioRun *delay_audio_run,
+							 guint run_order,
+							 gdouble delay, guint attack,
+							 AgsCopyPatternAudioRun *copy_pattern_audio_run);
+void ags_copy_pattern_audio_run_set_audio_channels_callback(AgsAudio *audio,
+							    guint audio_channels, guint audio_channels_old,
+							    AgsCopyPatternAudioRun *copy_pattern_audio_run);
+void ags_copy_pattern_audio_run_set_pads_callback(AgsAudio *audio,
+						  GType channel_type,
+						  guint pads, guint pads_old,
+						  AgsCopyPatternAudioRun *copy_pattern_audio_run);
+
+void ags_copy_pattern_audio_run_alloc_channel_run(AgsCopyPatternAudioRun *copy_pattern_audio_run,
+						  guint n_channel_run);
+
 /**
  * SECTION:ags_copy_pattern_audio_run
  * @short_description: copy pattern
@@ -73,6 +98,11 @@ void ags_copy_pattern_audio_run_read_resolve_dependency(AgsFileLookup *file_look
  * @include: ags/audio/recall/ags_copy_pattern_audio_run.h
  *
  * The #AgsCopyPatternAudioRun class copy pattern.
+ *
+ * Every step the pattern bitmaps of all input channels are scanned column-wise
+ * holding the audio's mutex once. Only the channels having the current bit set
+ * are played. The scan arrays are sized to the audio's input lines whenever its
+ * audio channels or pads change.
  */
 
 enum{
@@ -243,6 +273,14 @@ ags_copy_pattern_audio_run_init(AgsCopyPatternAudioRun *copy_pattern_audio_run)
 
   copy_pattern_audio_run->delay_audio_run = NULL;
   copy_pattern_audio_run->count_beats_audio_run = NULL;
+
+  copy_pattern_audio_run->sequencer_alloc_handler = 0;
+  copy_pattern_audio_run->set_audio_channels_handler = 0;
+  copy_pattern_audio_run->set_pads_handler = 0;
+
+  copy_pattern_audio_run->channel_run = NULL;
+  copy_pattern_audio_run->column = NULL;
+  copy_pattern_audio_run->allocated_channel_run = 0;
 }
 
 void
@@ -407,6 +445,10 @@ ags_copy_pattern_audio_run_finalize(GObject *gobject)
   if(copy_pattern_audio_run->count_beats_audio_run != NULL){
     g_object_unref(copy_pattern_audio_run->count_beats_audio_run);
   }
+
+  /* column scan */
+  free(copy_pattern_audio_run->channel_run);
+  free(copy_pattern_audio_run->column);
   
   /* call parent */
   G_OBJECT_CLASS(ags_copy_pattern_audio_run_parent_class)->finalize(gobject);
@@ -429,15 +471,90 @@ ags_copy_pattern_audio_run_disconnect(AgsConnectable *connectable)
 void
 ags_copy_pattern_audio_run_connect_dynamic(AgsDynamicConnectable *dynamic_connectable)
 {
+  AgsAudio *audio;
+  AgsCopyPatternAudioRun *copy_pattern_audio_run;
+
+  if((AGS_RECALL_DYNAMIC_CONNECTED & (AGS_RECALL(dynamic_connectable)->flags)) != 0){
+    return;
+  }
+
   /* call parent */
   ags_copy_pattern_audio_run_parent_dynamic_connectable_interface->connect_dynamic(dynamic_connectable);
+
+  copy_pattern_audio_run = AGS_COPY_PATTERN_AUDIO_RUN(dynamic_connectable);
+
+  /* connect sequencer_alloc in AgsDelayAudioRun */
+  if(copy_pattern_audio_run->delay_audio_run != NULL){
+    copy_pattern_audio_run->sequencer_alloc_handler =
+      g_signal_connect(G_OBJECT(copy_pattern_audio_run->delay_audio_run), "sequencer-alloc-input\0",
+		       G_CALLBACK(ags_copy_pattern_audio_run_sequencer_alloc_callback), copy_pattern_audio_run);
+  }
+
+  /* size the scan arrays and follow resizes of AgsAudio */
+  audio = NULL;
+
+  if(AGS_RECALL_AUDIO_RUN(copy_pattern_audio_run)->recall_audio != NULL){
+    audio = AGS_RECALL_AUDIO_RUN(copy_pattern_audio_run)->recall_audio->audio;
+  }
+
+  if(audio != NULL){
+    ags_copy_pattern_audio_run_alloc_channel_run(copy_pattern_audio_run,
+						 audio->input_lines);
+    
+    copy_pattern_audio_run->set_audio_channels_handler =
+      g_signal_connect_after(G_OBJECT(audio), "set-audio-channels\0",
+			     G_CALLBACK(ags_copy_pattern_audio_run_set_audio_channels_callback), copy_pattern_audio_run);
+    copy_pattern_audio_run->set_pads_handler =
+      g_signal_connect_after(G_OBJECT(audio), "set-pads\0",
+			     G_CALLBACK(ags_copy_pattern_audio_run_set_pads_callback), copy_pattern_audio_run);
+  }
 }
 
 void
 ags_copy_pattern_audio_run_disconnect_dynamic(AgsDynamicConnectable *dynamic_connectable)
 {
+  AgsAudio *audio;
+  AgsCopyPatternAudioRun *copy_pattern_audio_run;
+
+  if((AGS_RECALL_DYNAMIC_CONNECTED & (AGS_RECALL(dynamic_connectable)->flags)) == 0){
+    return;
+  }
+
+  copy_pattern_audio_run = AGS_COPY_PATTERN_AUDIO_RUN(dynamic_connectable);
+
+  /* disconnect sequencer_alloc in AgsDelayAudioRun */
+  if(copy_pattern_audio_run->delay_audio_run != NULL &&
+     copy_pattern_audio_run->sequencer_alloc_handler != 0){
+    g_signal_handler_disconnect(G_OBJECT(copy_pattern_audio_run->delay_audio_run),
+				copy_pattern_audio_run->sequencer_alloc_handler);
+  }
+
+  copy_pattern_audio_run->sequencer_alloc_handler = 0;
+
+  /* disconnect resize of AgsAudio */
+  audio = NULL;
+
+  if(AGS_RECALL_AUDIO_RUN(copy_pattern_audio_run)->recall_audio != NULL){
+    audio = AGS_RECALL_AUDIO_RUN(copy_pattern_audio_run)->recall_audio->audio;
+  }
+
+  if(audio != NULL){
+    if(copy_pattern_audio_run->set_audio_channels_handler != 0){
+      g_signal_handler_disconnect(G_OBJECT(audio),
+				  copy_pattern_audio_run->set_audio_channels_handler);
+    }
+
+    if(copy_pattern_audio_run->set_pads_handler != 0){
+      g_signal_handler_disconnect(G_OBJECT(audio),
+				  copy_pattern_audio_run->set_pads_handler);
+    }
+  }
+  
+  copy_pattern_audio_run->set_audio_channels_handler = 0;
+  copy_pattern_audio_run->set_pads_handler = 0;
+
   /* call parent */
-  ags_copy_pattern_audio_run_parent_dynamic_connectable_interface->connect_dynamic(dynamic_connectable);
+  ags_copy_pattern_audio_run_parent_dynamic_connectable_interface->disconnect_dynamic(dynamic_connectable);
 }
 
 void
@@ -674,6 +791,221 @@ ags_copy_pattern_audio_run_read_resolve_dependency(AgsFileLookup *file_lookup,
   }
 }
 
+void
+ags_copy_pattern_audio_run_sequencer_alloc_callback(AgsDelayAudioRun *delay_audio_run,
+						    guint run_order,
+						    gdouble delay, guint attack,
+						    AgsCopyPatternAudioRun *copy_pattern_audio_run)
+{
+  AgsAudio *audio;
+  AgsPattern *pattern;
+  AgsRecallContainer *recall_container;
+  AgsCopyPatternAudio *copy_pattern_audio;
+  AgsCopyPatternChannel *copy_pattern_channel;
+  AgsCopyPatternChannelRun *copy_pattern_channel_run;
+
+  AgsMutexManager *mutex_manager;
+
+  GList *list;
+
+  guint i, j;
+  guint bit;
+  guint offset, mask;
+  guint n_channel_run;
+  guint current;
+  guint k, nth;
+
+  GValue i_value = { 0, };
+  GValue j_value = { 0, };
+
+  pthread_mutex_t *application_mutex;
+  pthread_mutex_t *audio_mutex;
+
+  static const guint word_size = sizeof(guint) * 8;
+  
+  if(delay != 0.0){
+    return;
+  }
+
+  mutex_manager = ags_mutex_manager_get_instance();
+  application_mutex = ags_mutex_manager_get_application_mutex(mutex_manager);
+
+  /* get AgsCopyPatternAudio */
+  copy_pattern_audio = AGS_COPY_PATTERN_AUDIO(AGS_RECALL_AUDIO_RUN(copy_pattern_audio_run)->recall_audio);
+
+  recall_container = AGS_RECALL_CONTAINER(AGS_RECALL(copy_pattern_audio_run)->container);
+
+  /* lookup audio mutex */
+  audio = AGS_RECALL_AUDIO(copy_pattern_audio)->audio;
+  
+  pthread_mutex_lock(application_mutex);
+  
+  audio_mutex = ags_mutex_manager_lookup(mutex_manager,
+					 (GObject *) audio);
+  
+  pthread_mutex_unlock(application_mutex);
+
+  /* bank index, read once per step */
+  g_value_init(&i_value, G_TYPE_UINT64);
+  ags_port_safe_read(copy_pattern_audio->bank_index_0, &i_value);
+
+  g_value_init(&j_value, G_TYPE_UINT64);
+  ags_port_safe_read(copy_pattern_audio->bank_index_1, &j_value);
+
+  i = (guint) g_value_get_uint64(&i_value);
+  j = (guint) g_value_get_uint64(&j_value);
+
+  g_value_unset(&i_value);
+  g_value_unset(&j_value);
+
+  /* the word and mask of the current column */
+  bit = copy_pattern_audio_run->count_beats_audio_run->sequencer_counter;
+
+  offset = bit / word_size;
+  mask = 1U << (bit % word_size);
+
+  /* scan the column and collect the channels to play, ags_pattern_set_dim()
+   * swaps the bitmap holding the audio mutex and the scan arrays are resized
+   * by the set-audio-channels and set-pads handlers holding it, too
+   */
+  n_channel_run = 0;
+
+  pthread_mutex_lock(audio_mutex);
+
+  list = recall_container->recall_channel_run;
+
+  while(list != NULL &&
+	n_channel_run < copy_pattern_audio_run->allocated_channel_run){
+    copy_pattern_channel_run = AGS_COPY_PATTERN_CHANNEL_RUN(list->data);
+
+    if(AGS_RECALL_CHANNEL_RUN(copy_pattern_channel_run)->recall_audio_run != (AgsRecallAudioRun *) copy_pattern_audio_run){
+      list = list->next;
+
+      continue;
+    }
+
+    if(n_channel_run % word_size == 0){
+      copy_pattern_audio_run->column[n_channel_run / word_size] = 0;
+    }
+
+    /* test bit */
+    copy_pattern_channel = AGS_COPY_PATTERN_CHANNEL(AGS_RECALL_CHANNEL_RUN(copy_pattern_channel_run)->recall_channel);
+    pattern = (AgsPattern *) copy_pattern_channel->pattern->port_value.ags_port_object;
+
+    if(pattern != NULL &&
+       i < pattern->dim[0] &&
+       j < pattern->dim[1] &&
+       bit < pattern->dim[2]){
+      pattern->i = i;
+      pattern->j = j;
+
+      if((mask & (pattern->bitmap[(i * pattern->dim[1] + j) * pattern->stride + offset])) != 0){
+	copy_pattern_audio_run->column[n_channel_run / word_size] |= (1U << (n_channel_run % word_size));
+
+	g_object_ref(copy_pattern_channel_run);
+      }
+    }
+
+    copy_pattern_audio_run->channel_run[n_channel_run] = copy_pattern_channel_run;
+    n_channel_run++;
+
+    list = list->next;
+  }
+
+  /* play the channels of the set bits, empty words are skipped, the arrays
+   * are only valid while holding the audio mutex
+   */
+  for(k = 0; k * word_size < n_channel_run; k++){
+    current = copy_pattern_audio_run->column[k];
+
+    while(current != 0){
+      nth = g_bit_nth_lsf(current, -1);
+      current &= (~(1U << nth));
+
+      copy_pattern_channel_run = copy_pattern_audio_run->channel_run[k * word_size + nth];
+
+      ags_copy_pattern_channel_run_play(copy_pattern_channel_run,
+					attack);
+
+      g_object_unref(copy_pattern_channel_run);
+    }
+  }
+
+  pthread_mutex_unlock(audio_mutex);
+}
+
+void
+ags_copy_pattern_audio_run_set_audio_channels_callback(AgsAudio *audio,
+						       guint audio_channels, guint audio_channels_old,
+						       AgsCopyPatternAudioRun *copy_pattern_audio_run)
+{
+  ags_copy_pattern_audio_run_alloc_channel_run(copy_pattern_audio_run,
+					       audio->input_lines);
+}
+
+void
+ags_copy_pattern_audio_run_set_pads_callback(AgsAudio *audio,
+					     GType channel_type,
+					     guint pads, guint pads_old,
+					     AgsCopyPatternAudioRun *copy_pattern_audio_run)
+{
+  if(!g_type_is_a(channel_type, AGS_TYPE_INPUT)){
+    return;
+  }
+
+  ags_copy_pattern_audio_run_alloc_channel_run(copy_pattern_audio_run,
+					       audio->input_lines);
+}
+
+void
+ags_copy_pattern_audio_run_alloc_channel_run(AgsCopyPatternAudioRun *copy_pattern_audio_run,
+					     guint n_channel_run)
+{
+  AgsAudio *audio;
+
+  AgsMutexManager *mutex_manager;
+
+  guint allocated_channel_run;
+
+  pthread_mutex_t *application_mutex;
+  pthread_mutex_t *audio_mutex;
+
+  static const guint word_size = sizeof(guint) * 8;
+
+  /* lookup audio mutex */
+  audio = AGS_RECALL_AUDIO_RUN(copy_pattern_audio_run)->recall_audio->audio;
+
+  mutex_manager = ags_mutex_manager_get_instance();
+  application_mutex = ags_mutex_manager_get_application_mutex(mutex_manager);
+
+  pthread_mutex_lock(application_mutex);
+
+  audio_mutex = ags_mutex_manager_lookup(mutex_manager,
+					 (GObject *) audio);
+
+  pthread_mutex_unlock(application_mutex);
+
+  /* grow to whole words, the arrays never shrink */
+  allocated_channel_run = ((n_channel_run + word_size - 1) / word_size) * word_size;
+
+  pthread_mutex_lock(audio_mutex);
+
+  if(allocated_channel_run <= copy_pattern_audio_run->allocated_channel_run){
+    pthread_mutex_unlock(audio_mutex);
+
+    return;
+  }
+
+  copy_pattern_audio_run->channel_run = (AgsCopyPatternChannelRun **) realloc(copy_pattern_audio_run->channel_run,
+									      allocated_channel_run * sizeof(AgsCopyPatternChannelRun *));
+  copy_pattern_audio_run->column = (guint *) realloc(copy_pattern_audio_run->column,
+						     (allocated_channel_run / word_size) * sizeof(guint));
+
+  copy_pattern_audio_run->allocated_channel_run = allocated_channel_run;
+
+  pthread_mutex_unlock(audio_mutex);
+}
+
 /**
  * ags_copy_pattern_audio_run_new:
  * @count_beats_audio_run: an #AgsCountBeatsAudioRun as dependency
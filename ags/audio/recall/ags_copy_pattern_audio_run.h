@@ -26,6 +26,7 @@
 #include <ags/audio/ags_recall_audio_run.h>
 
 #include <ags/audio/recall/ags_count_beats_audio_run.h>
+#include <ags/audio/recall/ags_copy_pattern_channel_run.h>
 
 #define AGS_TYPE_COPY_PATTERN_AUDIO_RUN                (ags_copy_pattern_audio_run_get_type())
 #define AGS_COPY_PATTERN_AUDIO_RUN(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_COPY_PATTERN_AUDIO_RUN, AgsCopyPatternAudioRun))
@@ -46,6 +47,14 @@ struct _AgsCopyPatternAudioRun
 
   AgsDelayAudioRun *delay_audio_run;
   AgsCountBeatsAudioRun *count_beats_audio_run;
+
+  gulong sequencer_alloc_handler;
+  gulong set_audio_channels_handler;
+  gulong set_pads_handler;
+
+  AgsCopyPatternChannelRun **channel_run;
+  guint *column;
+  guint allocated_channel_run;
 };
 
 struct _AgsCopyPatternAudioRunClass
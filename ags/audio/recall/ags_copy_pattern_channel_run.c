@@ -59,11 +59,6 @@ AgsRecall* ags_copy_pattern_channel_run_duplicate(AgsRecall *recall,
 						  AgsRecallID *recall_id,
 						  guint *n_params, GParameter *parameter);
 
-void ags_copy_pattern_channel_run_sequencer_alloc_callback(AgsDelayAudioRun *delay_audio_run,
-							   guint run_order,
-							   gdouble delay, guint attack,
-							   AgsCopyPatternChannelRun *copy_pattern_channel_run);
-
 /**
  * SECTION:ags_copy_pattern_channel_run
  * @short_description: copys pattern
@@ -227,10 +222,6 @@ ags_copy_pattern_channel_run_disconnect(AgsConnectable *connectable)
 void
 ags_copy_pattern_channel_run_connect_dynamic(AgsDynamicConnectable *dynamic_connectable)
 {
-  AgsCopyPatternAudioRun *copy_pattern_audio_run;
-  AgsCopyPatternChannelRun *copy_pattern_channel_run;
-  AgsDelayAudioRun *delay_audio_run;
-
   if((AGS_RECALL_DYNAMIC_CONNECTED & (AGS_RECALL(dynamic_connectable)->flags)) != 0){
     return;
   }
@@ -238,43 +229,16 @@ ags_copy_pattern_channel_run_connect_dynamic(AgsDynamicConnectable *dynamic_conn
   /* call parent */
   ags_copy_pattern_channel_run_parent_dynamic_connectable_interface->connect_dynamic(dynamic_connectable);
 
-  /* AgsCopyPatternChannelRun */
-  copy_pattern_channel_run = AGS_COPY_PATTERN_CHANNEL_RUN(dynamic_connectable);
-
-  /* get AgsCopyPatternAudioRun */
-  copy_pattern_audio_run = AGS_COPY_PATTERN_AUDIO_RUN(AGS_RECALL_CHANNEL_RUN(copy_pattern_channel_run)->recall_audio_run);
-
-  /* connect sequencer_alloc in AgsDelayAudioRun */
-  delay_audio_run = copy_pattern_audio_run->delay_audio_run;
-
-  copy_pattern_channel_run->sequencer_alloc_handler =
-    g_signal_connect(G_OBJECT(delay_audio_run), "sequencer-alloc-input\0",
-		     G_CALLBACK(ags_copy_pattern_channel_run_sequencer_alloc_callback), copy_pattern_channel_run);
+  /* empty - AgsCopyPatternAudioRun dispatches the steps */
 }
 
 void
 ags_copy_pattern_channel_run_disconnect_dynamic(AgsDynamicConnectable *dynamic_connectable)
 {
-  AgsCopyPatternAudioRun *copy_pattern_audio_run;
-  AgsCopyPatternChannelRun *copy_pattern_channel_run;
-  AgsDelayAudioRun *delay_audio_run;
-
   if((AGS_RECALL_DYNAMIC_CONNECTED & (AGS_RECALL(dynamic_connectable)->flags)) == 0){
     return;
   }
 
-  /* AgsCopyPatternChannelRun */
-  copy_pattern_channel_run = AGS_COPY_PATTERN_CHANNEL_RUN(dynamic_connectable);
-
-  /* get AgsCopyPatternAudioRun */
-  copy_pattern_audio_run = AGS_COPY_PATTERN_AUDIO_RUN(AGS_RECALL_CHANNEL_RUN(copy_pattern_channel_run)->recall_audio_run);
-
-  /* disconnect sequencer_alloc in AgsDelayAudioRun */
-  delay_audio_run = copy_pattern_audio_run->delay_audio_run;
-
-  g_signal_handler_disconnect(G_OBJECT(delay_audio_run),
-			      copy_pattern_channel_run->sequencer_alloc_handler);
-
   /* call parent */
   ags_copy_pattern_channel_run_parent_dynamic_connectable_interface->disconnect_dynamic(dynamic_connectable);
 }
@@ -359,33 +323,34 @@ ags_copy_pattern_channel_run_duplicate(AgsRecall *recall,
   return((AgsRecall *) copy);
 }
 
+/**
+ * ags_copy_pattern_channel_run_play:
+ * @copy_pattern_channel_run: the #AgsCopyPatternChannelRun
+ * @attack: the attack
+ *
+ * Play the current step of @copy_pattern_channel_run's source by creating a new
+ * #AgsAudioSignal for each of its recyclings. Called by #AgsCopyPatternAudioRun
+ * for the channels having the current bit set.
+ *
+ * Since: 0.7.136
+ */
 void
-ags_copy_pattern_channel_run_sequencer_alloc_callback(AgsDelayAudioRun *delay_audio_run,
-						      guint run_order,
-						      gdouble delay, guint attack,
-						      AgsCopyPatternChannelRun *copy_pattern_channel_run)
+ags_copy_pattern_channel_run_play(AgsCopyPatternChannelRun *copy_pattern_channel_run,
+				  guint attack)
 {
   AgsChannel *source;
-  AgsPattern *pattern;
+  AgsChannel *link;
+  AgsRecycling *recycling;
+  AgsRecycling *end_recycling;
+  AgsAudioSignal *audio_signal;
   AgsCopyPatternAudio *copy_pattern_audio;
-  AgsCopyPatternAudioRun *copy_pattern_audio_run;
   AgsCopyPatternChannel *copy_pattern_channel;
 
   AgsMutexManager *mutex_manager;
 
-  gboolean current_bit;
-
-  GValue pattern_value = { 0, };  
-  GValue i_value = { 0, };
-  GValue j_value = { 0, };
-
   pthread_mutex_t *application_mutex;
-  pthread_mutex_t *pattern_mutex;
   pthread_mutex_t *source_mutex;
-  
-  if(delay != 0.0){
-    return;
-  }
+  pthread_mutex_t *link_mutex;
 
   mutex_manager = ags_mutex_manager_get_instance();
   application_mutex = ags_mutex_manager_get_application_mutex(mutex_manager);
@@ -393,167 +358,102 @@ ags_copy_pattern_channel_run_sequencer_alloc_callback(AgsDelayAudioRun *delay_au
   /* get AgsCopyPatternAudio */
   copy_pattern_audio = AGS_COPY_PATTERN_AUDIO(AGS_RECALL_CHANNEL_RUN(copy_pattern_channel_run)->recall_audio_run->recall_audio);
 
-  /* get AgsCopyPatternAudioRun */
-  copy_pattern_audio_run = AGS_COPY_PATTERN_AUDIO_RUN(AGS_RECALL_CHANNEL_RUN(copy_pattern_channel_run)->recall_audio_run);
-
   /* get AgsCopyPatternChannel */
   copy_pattern_channel = AGS_COPY_PATTERN_CHANNEL(copy_pattern_channel_run->recall_channel_run.recall_channel);
 
-  g_value_init(&i_value, G_TYPE_UINT64);
-  ags_port_safe_read(copy_pattern_audio->bank_index_0, &i_value);
+  /* get source */
+  source = AGS_RECALL_CHANNEL(copy_pattern_channel)->source;
 
-  g_value_init(&j_value, G_TYPE_UINT64);
-  ags_port_safe_read(copy_pattern_audio->bank_index_1, &j_value);
-
-  /* get AgsPattern */
-  g_value_init(&pattern_value, G_TYPE_POINTER);
-  ags_port_safe_read(copy_pattern_channel->pattern,
-		     &pattern_value);
+  pthread_mutex_lock(application_mutex);
 
-  pattern = g_value_get_pointer(&pattern_value);
+  source_mutex = ags_mutex_manager_lookup(mutex_manager,
+					  (GObject *) source);
 
-  pthread_mutex_lock(application_mutex);
-  
-  pattern_mutex = ags_mutex_manager_lookup(mutex_manager,
-					   (GObject *) pattern);
-  
   pthread_mutex_unlock(application_mutex);
 
-  /* write pattern port - current offset */
-  ags_port_safe_set_property(copy_pattern_channel->pattern,
-			     "first-index\0", &i_value);
-  g_value_unset(&i_value);
-  
-  ags_port_safe_set_property(copy_pattern_channel->pattern,
-			     "second-index\0", &j_value);
-  g_value_unset(&j_value);
-  
-  /* read pattern port - current bit */
-  pthread_mutex_lock(pattern_mutex);
-  
-  current_bit = ags_pattern_get_bit(pattern,
-				    pattern->i,
-				    pattern->j,
-				    copy_pattern_audio_run->count_beats_audio_run->sequencer_counter);
-  
-  pthread_mutex_unlock(pattern_mutex);
-
-  g_value_unset(&pattern_value);
-
-  /*  */
-  if(current_bit){
-    AgsChannel *link;
-    AgsRecycling *recycling;
-    AgsRecycling *end_recycling;
-    AgsAudioSignal *audio_signal;
-
-    gdouble delay;
-    guint attack;
-  
-    pthread_mutex_t *link_mutex;
-    
-    //    g_message("ags_copy_pattern_channel_run_sequencer_alloc_callback - playing channel: %u; playing pattern: %u\0",
-    //	      AGS_RECALL_CHANNEL(copy_pattern_channel)->source->line,
-    //	      copy_pattern_audio_run->count_beats_audio_run->sequencer_counter);
+  /* source fields */
+  pthread_mutex_lock(source_mutex);
+
+  link = source->link;
 
-    /* get source */
-    source = AGS_RECALL_CHANNEL(copy_pattern_channel)->source;
+  recycling = source->first_recycling;
 
+  if(recycling != NULL){
+    end_recycling = source->last_recycling->next;
+  }
+
+  pthread_mutex_unlock(source_mutex);
+
+  /* link */
+  if(link != NULL){
     pthread_mutex_lock(application_mutex);
-  
-    source_mutex = ags_mutex_manager_lookup(mutex_manager,
-					    (GObject *) source);
-    
+
+    link_mutex = ags_mutex_manager_lookup(mutex_manager,
+					  (GObject *) link);
+
     pthread_mutex_unlock(application_mutex);
-    
-    /* source fields */
-    pthread_mutex_lock(source_mutex);
+  }
 
-    link = source->link;
-    
-    recycling = source->first_recycling;
+  /* create audio signals */
+  if(recycling != NULL){
+    AgsRecallID *child_recall_id;
 
-    if(recycling != NULL){
-      end_recycling = source->last_recycling->next;
-    }
-    
-    pthread_mutex_unlock(source_mutex);
-
-    /* link */
-    if(link != NULL){
-      pthread_mutex_lock(application_mutex);
-      
-      link_mutex = ags_mutex_manager_lookup(mutex_manager,
-					    (GObject *) link);
-      
-      pthread_mutex_unlock(application_mutex);
-    }
+    while(recycling != end_recycling){
+      if(link == NULL){
+	child_recall_id = AGS_RECALL(copy_pattern_channel_run)->recall_id;
+      }else{
+	GList *list;
 
-    /* create audio signals */
-    if(recycling != NULL){
-      AgsRecallID *child_recall_id;
-
-      while(recycling != end_recycling){
-	if(link == NULL){
-	  child_recall_id = AGS_RECALL(copy_pattern_channel_run)->recall_id;
-	}else{
-	  GList *list;
-
-	  pthread_mutex_lock(link_mutex);
-	  
-	  list = link->recall_id;
-
-	  while(list != NULL){
-	    if(AGS_RECALL_ID(list->data)->recycling_context->parent == AGS_RECALL(copy_pattern_channel_run)->recall_id->recycling_context){
-	      child_recall_id = (AgsRecallID *) list->data;
-	      break;
-	    }
-	  
-	    list = list->next;
-	  }
+	pthread_mutex_lock(link_mutex);
+
+	list = link->recall_id;
 
-	  if(list == NULL){
-	    child_recall_id = NULL;
+	while(list != NULL){
+	  if(AGS_RECALL_ID(list->data)->recycling_context->parent == AGS_RECALL(copy_pattern_channel_run)->recall_id->recycling_context){
+	    child_recall_id = (AgsRecallID *) list->data;
+	    break;
 	  }
 
-	  pthread_mutex_unlock(link_mutex);
+	  list = list->next;
 	}
 
-	audio_signal = ags_audio_signal_new(AGS_RECALL(copy_pattern_audio)->soundcard,
-					    (GObject *) recycling,
-					    (GObject *) child_recall_id);
-	ags_recycling_create_audio_signal_with_defaults(recycling,
-							audio_signal,
-							0.0, attack);
-	audio_signal->flags &= (~AGS_AUDIO_SIGNAL_TEMPLATE);
-	audio_signal->stream_current = audio_signal->stream_beginning;
-	ags_connectable_connect(AGS_CONNECTABLE(audio_signal));
-	
-	/*
-	 * emit add_audio_signal on AgsRecycling
-	 */
+	if(list == NULL){
+	  child_recall_id = NULL;
+	}
+
+	pthread_mutex_unlock(link_mutex);
+      }
+
+      audio_signal = ags_audio_signal_new(AGS_RECALL(copy_pattern_audio)->soundcard,
+					  (GObject *) recycling,
+					  (GObject *) child_recall_id);
+      ags_recycling_create_audio_signal_with_defaults(recycling,
+						      audio_signal,
+						      0.0, attack);
+      audio_signal->flags &= (~AGS_AUDIO_SIGNAL_TEMPLATE);
+      audio_signal->stream_current = audio_signal->stream_beginning;
+      ags_connectable_connect(AGS_CONNECTABLE(audio_signal));
+
+      /*
+       * emit add_audio_signal on AgsRecycling
+       */
 #ifdef AGS_DEBUG
-	g_message("play %x\0", AGS_RECALL(copy_pattern_channel_run)->recall_id);
+      g_message("play %x\0", AGS_RECALL(copy_pattern_channel_run)->recall_id);
 #endif
 
-	audio_signal->recall_id = (GObject *) child_recall_id;
-	ags_recycling_add_audio_signal(recycling,
-				       audio_signal);
-
-	/*
-	 * unref AgsAudioSignal because AgsCopyPatternChannelRun has no need for it
-	 * if you need a valid reference to audio_signal you have to g_object_ref(audio_signal)
-	 */
-	//	g_object_unref(audio_signal);
-		
-	recycling = recycling->next;
-      }
+      audio_signal->recall_id = (GObject *) child_recall_id;
+      ags_recycling_add_audio_signal(recycling,
+				     audio_signal);
+
+      /*
+       * unref AgsAudioSignal because AgsCopyPatternChannelRun has no need for it
+       * if you need a valid reference to audio_signal you have to g_object_ref(audio_signal)
+       */
+      //      g_object_unref(audio_signal);
+
+      recycling = recycling->next;
     }
   }
-  
-      //      g_message("%u\n\0", copy_pattern->shared_audio_run->bit);
-      //      copy_pattern->shared_audio_run->bit++;
-  //  }
 }
 
 /**
@@ -38,8 +38,6 @@ typedef struct _AgsCopyPatternChannelRunClass AgsCopyPatternChannelRunClass;
 struct _AgsCopyPatternChannelRun
 {
   AgsRecallChannelRun recall_channel_run;
-
-  gulong sequencer_alloc_handler;
 };
 
 struct _AgsCopyPatternChannelRunClass
@@ -49,6 +47,9 @@ struct _AgsCopyPatternChannelRunClass
 
 GType ags_copy_pattern_channel_run_get_type();
 
+void ags_copy_pattern_channel_run_play(AgsCopyPatternChannelRun *copy_pattern_channel_run,
+				       guint attack);
+
 AgsCopyPatternChannelRun* ags_copy_pattern_channel_run_new();
 
 #endif /*__AGS_COPY_PATTERN_CHANNEL_RUN_H__*/
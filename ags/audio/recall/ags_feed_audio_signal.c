@@ -215,7 +215,7 @@ ags_feed_audio_signal_run_pre(AgsRecall *recall)
     guint frame_count;
 
     if(audio_signal->recycling != NULL){
-      template = ags_audio_signal_get_template(AGS_RECYCLING(audio_signal->recycling)->audio_signal);
+      template = ags_recycling_get_template(AGS_RECYCLING(audio_signal->recycling));
     }
     
     /* get notation delay */
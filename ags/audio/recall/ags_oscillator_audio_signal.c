@@ -0,0 +1,350 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2017 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/audio/recall/ags_oscillator_audio_signal.h>
+#include <ags/audio/recall/ags_oscillator_channel.h>
+
+#include <ags/lib/ags_parameter.h>
+
+#include <ags/object/ags_connectable.h>
+#include <ags/object/ags_dynamic_connectable.h>
+
+#include <ags/thread/ags_mutex_manager.h>
+
+#include <ags/audio/ags_audio.h>
+#include <ags/audio/ags_channel.h>
+#include <ags/audio/ags_input.h>
+#include <ags/audio/ags_audio_signal.h>
+#include <ags/audio/ags_recall_channel_run.h>
+#include <ags/audio/ags_synth_generator.h>
+#include <ags/audio/ags_synth_util.h>
+#include <ags/audio/ags_audio_buffer_util.h>
+
+#include <stdlib.h>
+#include <math.h>
+
+void ags_oscillator_audio_signal_class_init(AgsOscillatorAudioSignalClass *oscillator_audio_signal);
+void ags_oscillator_audio_signal_connectable_interface_init(AgsConnectableInterface *connectable);
+void ags_oscillator_audio_signal_dynamic_connectable_interface_init(AgsDynamicConnectableInterface *dynamic_connectable);
+void ags_oscillator_audio_signal_init(AgsOscillatorAudioSignal *oscillator_audio_signal);
+void ags_oscillator_audio_signal_connect(AgsConnectable *connectable);
+void ags_oscillator_audio_signal_disconnect(AgsConnectable *connectable);
+void ags_oscillator_audio_signal_connect_dynamic(AgsDynamicConnectable *dynamic_connectable);
+void ags_oscillator_audio_signal_disconnect_dynamic(AgsDynamicConnectable *dynamic_connectable);
+void ags_oscillator_audio_signal_finalize(GObject *gobject);
+
+void ags_oscillator_audio_signal_run_pre(AgsRecall *recall);
+
+/**
+ * SECTION:ags_oscillator_audio_signal
+ * @short_description: renders voice of audio signal
+ * @title: AgsOscillatorAudioSignal
+ * @section_id:
+ * @include: ags/audio/recall/ags_oscillator_audio_signal.h
+ *
+ * The #AgsOscillatorAudioSignal class renders the current buffer of the audio
+ * signal every period. Each #AgsInput owning an #AgsSynthGenerator adds its
+ * wave, the phase of every oscillator is accumulated from period to period.
+ */
+
+static gpointer ags_oscillator_audio_signal_parent_class = NULL;
+static AgsConnectableInterface *ags_oscillator_audio_signal_parent_connectable_interface;
+static AgsDynamicConnectableInterface *ags_oscillator_audio_signal_parent_dynamic_connectable_interface;
+
+GType
+ags_oscillator_audio_signal_get_type()
+{
+  static GType ags_type_oscillator_audio_signal = 0;
+
+  if(!ags_type_oscillator_audio_signal){
+    static const GTypeInfo ags_oscillator_audio_signal_info = {
+      sizeof (AgsOscillatorAudioSignalClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) ags_oscillator_audio_signal_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (AgsOscillatorAudioSignal),
+      0,    /* n_preallocs */
+      (GInstanceInitFunc) ags_oscillator_audio_signal_init,
+    };
+
+    static const GInterfaceInfo ags_connectable_interface_info = {
+      (GInterfaceInitFunc) ags_oscillator_audio_signal_connectable_interface_init,
+      NULL, /* interface_finalize */
+      NULL, /* interface_data */
+    };
+
+    static const GInterfaceInfo ags_dynamic_connectable_interface_info = {
+      (GInterfaceInitFunc) ags_oscillator_audio_signal_dynamic_connectable_interface_init,
+      NULL, /* interface_finalize */
+      NULL, /* interface_data */
+    };
+
+    ags_type_oscillator_audio_signal = g_type_register_static(AGS_TYPE_RECALL_AUDIO_SIGNAL,
+							      "AgsOscillatorAudioSignal\0",
+							      &ags_oscillator_audio_signal_info,
+							      0);
+
+    g_type_add_interface_static(ags_type_oscillator_audio_signal,
+				AGS_TYPE_CONNECTABLE,
+				&ags_connectable_interface_info);
+
+    g_type_add_interface_static(ags_type_oscillator_audio_signal,
+				AGS_TYPE_DYNAMIC_CONNECTABLE,
+				&ags_dynamic_connectable_interface_info);
+  }
+
+  return (ags_type_oscillator_audio_signal);
+}
+
+void
+ags_oscillator_audio_signal_class_init(AgsOscillatorAudioSignalClass *oscillator_audio_signal)
+{
+  GObjectClass *gobject;
+  AgsRecallClass *recall;
+
+  ags_oscillator_audio_signal_parent_class = g_type_class_peek_parent(oscillator_audio_signal);
+
+  /* GObjectClass */
+  gobject = (GObjectClass *) oscillator_audio_signal;
+
+  gobject->finalize = ags_oscillator_audio_signal_finalize;
+
+  /* AgsRecallClass */
+  recall = (AgsRecallClass *) oscillator_audio_signal;
+
+  recall->run_pre = ags_oscillator_audio_signal_run_pre;
+}
+
+void
+ags_oscillator_audio_signal_connectable_interface_init(AgsConnectableInterface *connectable)
+{
+  ags_oscillator_audio_signal_parent_connectable_interface = g_type_interface_peek_parent(connectable);
+
+  connectable->connect = ags_oscillator_audio_signal_connect;
+  connectable->disconnect = ags_oscillator_audio_signal_disconnect;
+}
+
+void
+ags_oscillator_audio_signal_dynamic_connectable_interface_init(AgsDynamicConnectableInterface *dynamic_connectable)
+{
+  ags_oscillator_audio_signal_parent_dynamic_connectable_interface = g_type_interface_peek_parent(dynamic_connectable);
+
+  dynamic_connectable->connect_dynamic = ags_oscillator_audio_signal_connect_dynamic;
+  dynamic_connectable->disconnect_dynamic = ags_oscillator_audio_signal_disconnect_dynamic;
+}
+
+void
+ags_oscillator_audio_signal_init(AgsOscillatorAudioSignal *oscillator_audio_signal)
+{
+  AGS_RECALL(oscillator_audio_signal)->name = "ags-oscillator\0";
+  AGS_RECALL(oscillator_audio_signal)->version = AGS_RECALL_DEFAULT_VERSION;
+  AGS_RECALL(oscillator_audio_signal)->build_id = AGS_RECALL_DEFAULT_BUILD_ID;
+  AGS_RECALL(oscillator_audio_signal)->xml_type = "ags-oscillator-audio-signal\0";
+  AGS_RECALL(oscillator_audio_signal)->port = NULL;
+
+  oscillator_audio_signal->n_voices = 0;
+  oscillator_audio_signal->phase = NULL;
+}
+
+void
+ags_oscillator_audio_signal_finalize(GObject *gobject)
+{
+  AgsOscillatorAudioSignal *oscillator_audio_signal;
+
+  oscillator_audio_signal = AGS_OSCILLATOR_AUDIO_SIGNAL(gobject);
+
+  /* phase */
+  free(oscillator_audio_signal->phase);
+  
+  /* call parent */
+  G_OBJECT_CLASS(ags_oscillator_audio_signal_parent_class)->finalize(gobject);
+}
+
+void
+ags_oscillator_audio_signal_connect(AgsConnectable *connectable)
+{
+  /* call parent */
+  ags_oscillator_audio_signal_parent_connectable_interface->connect(connectable);
+
+  /* empty */
+}
+
+void
+ags_oscillator_audio_signal_disconnect(AgsConnectable *connectable)
+{
+  /* call parent */
+  ags_oscillator_audio_signal_parent_connectable_interface->disconnect(connectable);
+
+  /* empty */
+}
+
+void
+ags_oscillator_audio_signal_connect_dynamic(AgsDynamicConnectable *dynamic_connectable)
+{
+  /* call parent */
+  ags_oscillator_audio_signal_parent_dynamic_connectable_interface->connect_dynamic(dynamic_connectable);
+
+  /* empty */
+}
+
+void
+ags_oscillator_audio_signal_disconnect_dynamic(AgsDynamicConnectable *dynamic_connectable)
+{
+  /* call parent */
+  ags_oscillator_audio_signal_parent_dynamic_connectable_interface->disconnect_dynamic(dynamic_connectable);
+
+  /* empty */
+}
+
+void
+ags_oscillator_audio_signal_run_pre(AgsRecall *recall)
+{
+  AgsOscillatorChannel *oscillator_channel;
+  AgsOscillatorAudioSignal *oscillator_audio_signal;
+  AgsSynthGenerator *synth_generator;
+
+  AgsAudio *audio;
+  AgsChannel *channel, *input;
+  AgsAudioSignal *source;
+
+  AgsMutexManager *mutex_manager;
+
+  void *buffer;
+
+  guint audio_channel;
+  guint pad;
+  guint samplerate;
+  guint buffer_size;
+  guint format;
+  guint i;
+  gdouble lower;
+  gdouble frequency;
+
+  pthread_mutex_t *application_mutex;
+  pthread_mutex_t *audio_mutex;
+
+  GValue value = {0,};
+
+  AGS_RECALL_CLASS(ags_oscillator_audio_signal_parent_class)->run_pre(recall);
+
+  oscillator_audio_signal = AGS_OSCILLATOR_AUDIO_SIGNAL(recall);
+
+  source = AGS_RECALL_AUDIO_SIGNAL(recall)->source;
+
+  if(source->stream_current == NULL){
+    ags_recall_done(recall);
+
+    return;
+  }
+
+  oscillator_channel = AGS_OSCILLATOR_CHANNEL(AGS_RECALL_CHANNEL_RUN(recall->parent->parent)->recall_channel);
+  channel = AGS_RECALL_CHANNEL_RUN(recall->parent->parent)->source;
+
+  audio = AGS_AUDIO(channel->audio);
+
+  audio_channel = channel->audio_channel;
+  pad = channel->pad;
+
+  /* lower */
+  g_value_init(&value, G_TYPE_FLOAT);
+  ags_port_safe_read(oscillator_channel->lower, &value);
+
+  lower = (gdouble) g_value_get_float(&value);
+  g_value_unset(&value);
+
+  /* lookup audio mutex */
+  mutex_manager = ags_mutex_manager_get_instance();
+  application_mutex = ags_mutex_manager_get_application_mutex(mutex_manager);
+
+  pthread_mutex_lock(application_mutex);
+
+  audio_mutex = ags_mutex_manager_lookup(mutex_manager,
+					 (GObject *) audio);
+
+  pthread_mutex_unlock(application_mutex);
+
+  /* render current buffer */
+  buffer = source->stream_current->data;
+
+  samplerate = source->samplerate;
+  buffer_size = source->buffer_size;
+  format = ags_audio_buffer_util_format_from_soundcard(source->format);
+
+  ags_audio_buffer_util_clear_buffer(buffer, 1,
+				     buffer_size, format);
+
+  pthread_mutex_lock(audio_mutex);
+
+  input = audio->input;
+  i = 0;
+
+  while(input != NULL){
+    if(input->audio_channel == audio_channel &&
+       AGS_INPUT(input)->synth_generator != NULL){
+      synth_generator = AGS_SYNTH_GENERATOR(AGS_INPUT(input)->synth_generator);
+
+      frequency = synth_generator->frequency * exp2(((gdouble) pad - lower) / 12.0);
+
+      /* start voice, the phase of the generator is given in frames */
+      if(i >= oscillator_audio_signal->n_voices){
+	oscillator_audio_signal->phase = (gdouble *) realloc(oscillator_audio_signal->phase,
+							     (i + 1) * sizeof(gdouble));
+	oscillator_audio_signal->phase[i] = fmod(fabs(synth_generator->phase) * frequency / (gdouble) samplerate,
+						 1.0);
+
+	oscillator_audio_signal->n_voices = i + 1;
+      }
+
+      oscillator_audio_signal->phase[i] = ags_synth_util_oscillator(buffer,
+								    synth_generator->oscillator,
+								    frequency, oscillator_audio_signal->phase[i], synth_generator->volume,
+								    samplerate, format,
+								    0, buffer_size);
+      i++;
+    }
+
+    input = input->next;
+  }
+
+  pthread_mutex_unlock(audio_mutex);
+}
+
+/**
+ * ags_oscillator_audio_signal_new:
+ * @audio_signal: an #AgsAudioSignal
+ *
+ * Creates an #AgsOscillatorAudioSignal
+ *
+ * Returns: a new #AgsOscillatorAudioSignal
+ *
+ * Since: 0.7.136
+ */
+AgsOscillatorAudioSignal*
+ags_oscillator_audio_signal_new(AgsAudioSignal *audio_signal)
+{
+  AgsOscillatorAudioSignal *oscillator_audio_signal;
+
+  oscillator_audio_signal = (AgsOscillatorAudioSignal *) g_object_new(AGS_TYPE_OSCILLATOR_AUDIO_SIGNAL,
+								      "source\0", audio_signal,
+								      NULL);
+
+  return(oscillator_audio_signal);
+}
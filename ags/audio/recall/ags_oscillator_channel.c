@@ -0,0 +1,397 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/audio/recall/ags_oscillator_channel.h>
+
+#include <ags/object/ags_connectable.h>
+#include <ags/object/ags_plugin.h>
+
+#include <ags/plugin/ags_base_plugin.h>
+
+#include <string.h>
+
+void ags_oscillator_channel_class_init(AgsOscillatorChannelClass *oscillator_channel);
+void ags_oscillator_channel_connectable_interface_init(AgsConnectableInterface *connectable);
+void ags_oscillator_channel_plugin_interface_init(AgsPluginInterface *plugin);
+void ags_oscillator_channel_init(AgsOscillatorChannel *oscillator_channel);
+void ags_oscillator_channel_set_property(GObject *gobject,
+					 guint prop_id,
+					 const GValue *value,
+					 GParamSpec *param_spec);
+void ags_oscillator_channel_get_property(GObject *gobject,
+					 guint prop_id,
+					 GValue *value,
+					 GParamSpec *param_spec);
+void ags_oscillator_channel_connect(AgsConnectable *connectable);
+void ags_oscillator_channel_disconnect(AgsConnectable *connectable);
+void ags_oscillator_channel_set_ports(AgsPlugin *plugin, GList *port);
+void ags_oscillator_channel_dispose(GObject *gobject);
+void ags_oscillator_channel_finalize(GObject *gobject);
+
+static AgsPortDescriptor* ags_oscillator_channel_get_lower_port_descriptor();
+
+/**
+ * SECTION:ags_oscillator_channel
+ * @short_description: oscillates channel
+ * @title: AgsOscillatorChannel
+ * @section_id:
+ * @include: ags/audio/recall/ags_oscillator_channel.h
+ *
+ * The #AgsOscillatorChannel class provides ports to the effect processor. The
+ * voices are rendered per period from the #AgsSynthGenerator of the inputs,
+ * the key of the channel is transposed by the lower port in semitones.
+ */
+
+enum{
+  PROP_0,
+  PROP_LOWER,
+};
+
+static gpointer ags_oscillator_channel_parent_class = NULL;
+static AgsConnectableInterface *ags_oscillator_channel_parent_connectable_interface;
+
+static const gchar *ags_oscillator_channel_plugin_name = "ags-oscillator\0";
+static const gchar *ags_oscillator_channel_specifier[] = {
+  "./lower[0]\0"
+};
+static const gchar *ags_oscillator_channel_control_port[] = {
+  "1/1\0"
+};
+
+GType
+ags_oscillator_channel_get_type()
+{
+  static GType ags_type_oscillator_channel = 0;
+
+  if(!ags_type_oscillator_channel){
+    static const GTypeInfo ags_oscillator_channel_info = {
+      sizeof (AgsOscillatorChannelClass),
+      NULL, /* base_init */
+      NULL, /* base_finalize */
+      (GClassInitFunc) ags_oscillator_channel_class_init,
+      NULL, /* class_finalize */
+      NULL, /* class_data */
+      sizeof (AgsOscillatorChannel),
+      0,    /* n_preallocs */
+      (GInstanceInitFunc) ags_oscillator_channel_init,
+    };
+
+    static const GInterfaceInfo ags_connectable_interface_info = {
+      (GInterfaceInitFunc) ags_oscillator_channel_connectable_interface_init,
+      NULL, /* interface_finalize */
+      NULL, /* interface_data */
+    };
+
+    static const GInterfaceInfo ags_plugin_interface_info = {
+      (GInterfaceInitFunc) ags_oscillator_channel_plugin_interface_init,
+      NULL, /* interface_finalize */
+      NULL, /* interface_data */
+    };
+
+    ags_type_oscillator_channel = g_type_register_static(AGS_TYPE_RECALL_CHANNEL,
+							 "AgsOscillatorChannel\0",
+							 &ags_oscillator_channel_info,
+							 0);
+    
+    g_type_add_interface_static(ags_type_oscillator_channel,
+				AGS_TYPE_CONNECTABLE,
+				&ags_connectable_interface_info);
+
+    g_type_add_interface_static(ags_type_oscillator_channel,
+				AGS_TYPE_PLUGIN,
+				&ags_plugin_interface_info);
+  }
+
+  return (ags_type_oscillator_channel);
+}
+
+void
+ags_oscillator_channel_connectable_interface_init(AgsConnectableInterface *connectable)
+{
+  ags_oscillator_channel_parent_connectable_interface = g_type_interface_peek_parent(connectable);
+
+  connectable->connect = ags_oscillator_channel_connect;
+  connectable->disconnect = ags_oscillator_channel_disconnect;
+}
+
+void
+ags_oscillator_channel_plugin_interface_init(AgsPluginInterface *plugin)
+{
+  plugin->set_ports = ags_oscillator_channel_set_ports;
+}
+
+void
+ags_oscillator_channel_class_init(AgsOscillatorChannelClass *oscillator_channel)
+{
+  GObjectClass *gobject;
+  GParamSpec *param_spec;
+
+  ags_oscillator_channel_parent_class = g_type_class_peek_parent(oscillator_channel);
+
+  /* GObjectClass */
+  gobject = (GObjectClass *) oscillator_channel;
+
+  gobject->set_property = ags_oscillator_channel_set_property;
+  gobject->get_property = ags_oscillator_channel_get_property;
+
+  gobject->dispose = ags_oscillator_channel_dispose;
+  gobject->finalize = ags_oscillator_channel_finalize;
+
+  /* properties */
+  /**
+   * AgsOscillatorChannel:lower:
+   * 
+   * The lower port, the semitones the keys are shifted down.
+   * 
+   * Since: 0.7.136
+   */
+  param_spec = g_param_spec_object("lower\0",
+				   "lower key\0",
+				   "The semitones to shift the keys down\0",
+				   AGS_TYPE_PORT,
+				   G_PARAM_READABLE | G_PARAM_WRITABLE);
+  g_object_class_install_property(gobject,
+				  PROP_LOWER,
+				  param_spec);
+}
+
+void
+ags_oscillator_channel_init(AgsOscillatorChannel *oscillator_channel)
+{
+  GList *port;
+
+  AGS_RECALL(oscillator_channel)->name = "ags-oscillator\0";
+  AGS_RECALL(oscillator_channel)->version = AGS_RECALL_DEFAULT_VERSION;
+  AGS_RECALL(oscillator_channel)->build_id = AGS_RECALL_DEFAULT_BUILD_ID;
+  AGS_RECALL(oscillator_channel)->xml_type = "ags-oscillator-channel\0";
+
+  /* initialize the port */
+  port = NULL;
+
+  /* lower */
+  oscillator_channel->lower = g_object_new(AGS_TYPE_PORT,
+					   "plugin-name\0", "ags-oscillator\0",
+					   "specifier\0", "./lower[0]\0",
+					   "control-port\0", "1/1\0",
+					   "port-value-is-pointer\0", FALSE,
+					   "port-value-type\0", G_TYPE_FLOAT,
+					   "port-value-size\0", sizeof(gfloat),
+					   "port-value-length", 1,
+					   NULL);
+  g_object_ref(oscillator_channel->lower);
+  
+  oscillator_channel->lower->port_value.ags_port_float = 0.0;
+
+  /* port descriptor */
+  oscillator_channel->lower->port_descriptor = ags_oscillator_channel_get_lower_port_descriptor();
+
+  /* add to port */  
+  port = g_list_prepend(port, oscillator_channel->lower);
+  g_object_ref(oscillator_channel->lower);
+  
+  /* set port */
+  AGS_RECALL(oscillator_channel)->port = port;
+}
+
+void
+ags_oscillator_channel_set_property(GObject *gobject,
+				    guint prop_id,
+				    const GValue *value,
+				    GParamSpec *param_spec)
+{
+  AgsOscillatorChannel *oscillator_channel;
+
+  oscillator_channel = AGS_OSCILLATOR_CHANNEL(gobject);
+
+  switch(prop_id){
+  case PROP_LOWER:
+    {
+      AgsPort *port;
+
+      port = (AgsPort *) g_value_get_object(value);
+
+      if(port == oscillator_channel->lower){
+	return;
+      }
+
+      if(oscillator_channel->lower != NULL){
+	g_object_unref(G_OBJECT(oscillator_channel->lower));
+      }
+      
+      if(port != NULL){
+	g_object_ref(G_OBJECT(port));
+      }
+
+      oscillator_channel->lower = port;
+    }
+    break;
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
+    break;
+  }
+}
+
+void
+ags_oscillator_channel_get_property(GObject *gobject,
+				    guint prop_id,
+				    GValue *value,
+				    GParamSpec *param_spec)
+{
+  AgsOscillatorChannel *oscillator_channel;
+
+  oscillator_channel = AGS_OSCILLATOR_CHANNEL(gobject);
+
+  switch(prop_id){
+  case PROP_LOWER:
+    {
+      g_value_set_object(value, oscillator_channel->lower);
+    }
+    break;
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID(gobject, prop_id, param_spec);
+    break;
+  }
+}
+
+void
+ags_oscillator_channel_connect(AgsConnectable *connectable)
+{
+  AgsRecall *recall;
+  
+  recall = AGS_RECALL(connectable);
+  
+  if((AGS_RECALL_CONNECTED & (recall->flags)) != 0){
+    return;
+  }
+
+  /* load automation */
+  ags_recall_load_automation(recall,
+			     g_list_copy(recall->port));
+
+  /* call parent */
+  ags_oscillator_channel_parent_connectable_interface->connect(connectable);
+}
+
+void
+ags_oscillator_channel_disconnect(AgsConnectable *connectable)
+{
+  ags_oscillator_channel_parent_connectable_interface->disconnect(connectable);
+
+  /* empty */
+}
+
+void
+ags_oscillator_channel_set_ports(AgsPlugin *plugin, GList *port)
+{
+  while(port != NULL){
+    if(!strncmp(AGS_PORT(port->data)->specifier,
+		"./lower[0]\0",
+		11)){
+      g_object_set(G_OBJECT(plugin),
+		   "lower\0", AGS_PORT(port->data),
+		   NULL);
+    }
+
+    port = port->next;
+  }
+}
+
+void
+ags_oscillator_channel_dispose(GObject *gobject)
+{
+  AgsOscillatorChannel *oscillator_channel;
+
+  oscillator_channel = AGS_OSCILLATOR_CHANNEL(gobject);
+
+  /* lower */
+  if(oscillator_channel->lower != NULL){
+    g_object_unref(G_OBJECT(oscillator_channel->lower));
+  }
+
+  /* call parent */
+  G_OBJECT_CLASS(ags_oscillator_channel_parent_class)->dispose(gobject);
+}
+
+void
+ags_oscillator_channel_finalize(GObject *gobject)
+{
+  AgsOscillatorChannel *oscillator_channel;
+
+  oscillator_channel = AGS_OSCILLATOR_CHANNEL(gobject);
+
+  /* lower */
+  if(oscillator_channel->lower != NULL){
+    g_object_unref(G_OBJECT(oscillator_channel->lower));
+  }
+
+  /* call parent */
+  G_OBJECT_CLASS(ags_oscillator_channel_parent_class)->finalize(gobject);
+}
+
+static AgsPortDescriptor*
+ags_oscillator_channel_get_lower_port_descriptor()
+{
+  static AgsPortDescriptor *port_descriptor = NULL;
+
+  if(port_descriptor == NULL){
+    port_descriptor = ags_port_descriptor_alloc();
+
+    port_descriptor->flags |= (AGS_PORT_DESCRIPTOR_INPUT |
+			       AGS_PORT_DESCRIPTOR_CONTROL);
+
+    port_descriptor->port_index = 0;
+
+    /* range */
+    g_value_init(port_descriptor->default_value,
+		 G_TYPE_FLOAT);
+    g_value_init(port_descriptor->lower_value,
+		 G_TYPE_FLOAT);
+    g_value_init(port_descriptor->upper_value,
+		 G_TYPE_FLOAT);
+
+    g_value_set_float(port_descriptor->default_value,
+		      0.0);
+    g_value_set_float(port_descriptor->lower_value,
+		      -120.0);
+    g_value_set_float(port_descriptor->upper_value,
+		      120.0);
+  }
+  
+  return(port_descriptor);
+}
+
+/**
+ * ags_oscillator_channel_new:
+ *
+ * Creates an #AgsOscillatorChannel
+ *
+ * Returns: a new #AgsOscillatorChannel
+ *
+ * Since: 0.7.136
+ */
+AgsOscillatorChannel*
+ags_oscillator_channel_new()
+{
+  AgsOscillatorChannel *oscillator_channel;
+
+  oscillator_channel = (AgsOscillatorChannel *) g_object_new(AGS_TYPE_OSCILLATOR_CHANNEL,
+							     NULL);
+
+  return(oscillator_channel);
+}
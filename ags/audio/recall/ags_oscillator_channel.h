@@ -0,0 +1,54 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_OSCILLATOR_CHANNEL_H__
+#define __AGS_OSCILLATOR_CHANNEL_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/audio/ags_recall_channel.h>
+
+#define AGS_TYPE_OSCILLATOR_CHANNEL                (ags_oscillator_channel_get_type())
+#define AGS_OSCILLATOR_CHANNEL(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_OSCILLATOR_CHANNEL, AgsOscillatorChannel))
+#define AGS_OSCILLATOR_CHANNEL_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST((class), AGS_TYPE_OSCILLATOR_CHANNEL, AgsOscillatorChannelClass))
+#define AGS_IS_OSCILLATOR_CHANNEL(obj)             (G_TYPE_CHECK_INSTANCE_TYPE ((obj), AGS_TYPE_OSCILLATOR_CHANNEL))
+#define AGS_IS_OSCILLATOR_CHANNEL_CLASS(class)     (G_TYPE_CHECK_CLASS_TYPE ((class), AGS_TYPE_OSCILLATOR_CHANNEL))
+#define AGS_OSCILLATOR_CHANNEL_GET_CLASS(obj)      (G_TYPE_INSTANCE_GET_CLASS ((obj), AGS_TYPE_OSCILLATOR_CHANNEL, AgsOscillatorChannelClass))
+
+typedef struct _AgsOscillatorChannel AgsOscillatorChannel;
+typedef struct _AgsOscillatorChannelClass AgsOscillatorChannelClass;
+
+struct _AgsOscillatorChannel
+{
+  AgsRecallChannel recall_channel;
+
+  AgsPort *lower;
+};
+
+struct _AgsOscillatorChannelClass
+{
+  AgsRecallChannelClass recall_channel;
+};
+
+GType ags_oscillator_channel_get_type();
+
+AgsOscillatorChannel* ags_oscillator_channel_new();
+
+#endif /*__AGS_OSCILLATOR_CHANNEL_H__*/
@@ -218,14 +218,8 @@ ags_peak_audio_signal_run_inter(AgsRecall *recall)
 {
   AGS_RECALL_CLASS(ags_peak_audio_signal_parent_class)->run_inter(recall);
 
-  if(AGS_RECALL_AUDIO_SIGNAL(recall)->source->stream_current != NULL){
-    AgsPeakChannel *peak_channel;
-
-    peak_channel = AGS_PEAK_CHANNEL(AGS_RECALL_CHANNEL_RUN(recall->parent->parent)->recall_channel);
-
-    ags_peak_channel_retrieve_peak(peak_channel,
-				   TRUE);
-  }else{
+  /* the peak is retrieved once per period by AgsPeakChannelRun */
+  if(AGS_RECALL_AUDIO_SIGNAL(recall)->source->stream_current == NULL){
     ags_recall_done(recall);
   }
 }
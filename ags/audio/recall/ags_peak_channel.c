@@ -30,9 +30,10 @@
 #include <ags/audio/ags_audio.h>
 #include <ags/audio/ags_output.h>
 #include <ags/audio/ags_input.h>
-#include <ags/audio/ags_audio_buffer_util.h>
+#include <ags/audio/ags_meter_util.h>
 
-#include <math.h>
+#include <stdlib.h>
+#include <string.h>
 
 void ags_peak_channel_class_init(AgsPeakChannelClass *peak_channel);
 void ags_peak_channel_connectable_interface_init(AgsConnectableInterface *connectable);
@@ -192,6 +193,18 @@ ags_peak_channel_init(AgsPeakChannel *peak_channel)
   AGS_RECALL(peak_channel)->build_id = AGS_RECALL_DEFAULT_BUILD_ID;
   AGS_RECALL(peak_channel)->xml_type = "ags-peak-channel\0";
 
+  peak_channel->flags = 0;
+
+  /* tap */
+  peak_channel->mix_buffer = NULL;
+  peak_channel->mix_buffer_size = 0;
+
+  memset(peak_channel->true_peak_history,
+	 0,
+	 AGS_METER_UTIL_TRUE_PEAK_HISTORY * sizeof(gfloat));
+
+  peak_channel->meter_slot = ags_meter_slot_alloc();
+
   port = NULL;
 
   /* peak */
@@ -310,6 +323,11 @@ ags_peak_channel_finalize(GObject *gobject)
     g_object_unref(G_OBJECT(peak_channel->peak));
   }
 
+  /* tap */
+  free(peak_channel->mix_buffer);
+
+  ags_meter_slot_unref(peak_channel->meter_slot);
+
   /* call parent */
   G_OBJECT_CLASS(ags_peak_channel_parent_class)->finalize(gobject);
 }
@@ -350,27 +368,32 @@ ags_peak_channel_set_ports(AgsPlugin *plugin, GList *port)
   }
 }
 
+/**
+ * ags_peak_channel_retrieve_peak:
+ * @peak_channel: the #AgsPeakChannel
+ * @is_play: if %TRUE playback context
+ *
+ * Tap the current period of the audio signals of the source channel. They
+ * are mixed into a float buffer reused across periods, measured and the
+ * result published to the meter slot as well as to the peak
+ * port scaled to its range. #AgsPeakChannelRun calls it once per period.
+ *
+ * Since: 0.7.122.7
+ */
 void
 ags_peak_channel_retrieve_peak(AgsPeakChannel *peak_channel,
 			       gboolean is_play)
 {
   AgsChannel *source;
   AgsRecycling *recycling;
+  AgsAudioSignal *current;
   
   GList *audio_signal;
 
-  gchar *str;
-
-  static const double scale_precision = 10.0;
-
-  signed short *buffer;
-  double current_value;
+  gfloat peak, rms, true_peak;
   guint buffer_size;
-  guint limit;
-  guint i;
-  guint copy_mode;
   
-  GValue *value;
+  GValue value = {0,};
 
   if(peak_channel == NULL){
     return;
@@ -379,40 +402,36 @@ ags_peak_channel_retrieve_peak(AgsPeakChannel *peak_channel,
   source = AGS_RECALL_CHANNEL(peak_channel)->source;
   recycling = source->first_recycling;
 
+  if(recycling == NULL){
+    return;
+  }
+  
   buffer_size = source->buffer_size;
 
   /* initialize buffer */
-  buffer = (signed short *) malloc(buffer_size * sizeof(signed short));
-  memset(buffer,
+  if(peak_channel->mix_buffer_size != buffer_size){
+    free(peak_channel->mix_buffer);
+
+    peak_channel->mix_buffer = (gfloat *) malloc(buffer_size * sizeof(gfloat));
+    peak_channel->mix_buffer_size = buffer_size;
+  }
+  
+  memset(peak_channel->mix_buffer,
 	 0,
-	 buffer_size * sizeof(signed short));
+	 buffer_size * sizeof(gfloat));
 
+  /* tap */
   while(recycling != source->last_recycling->next){
     audio_signal = recycling->audio_signal;
 
     while(audio_signal != NULL){
-      copy_mode = ags_audio_buffer_util_get_copy_mode(ags_audio_buffer_util_format_from_soundcard(AGS_SOUNDCARD_SIGNED_16_BIT),
-						      ags_audio_buffer_util_format_from_soundcard(AGS_AUDIO_SIGNAL(audio_signal->data)->format));
-
-      if((AGS_IS_INPUT(source) &&
-	  (AGS_AUDIO_INPUT_HAS_RECYCLING & (AGS_AUDIO(source->audio)->flags)) != 0) ||
-	 (AGS_IS_OUTPUT(source) &&
-	  (AGS_AUDIO_OUTPUT_HAS_RECYCLING & (AGS_AUDIO(source->audio)->flags)) != 0)){
-	if((AGS_AUDIO_SIGNAL_TEMPLATE & (AGS_AUDIO_SIGNAL(audio_signal->data)->flags)) == 0 &&
-	   AGS_AUDIO_SIGNAL(audio_signal->data)->stream_current != NULL){
-	  /* copy buffer 1:1 */
-	  ags_audio_buffer_util_copy_buffer_to_buffer(buffer, 1, 0,
-						      AGS_AUDIO_SIGNAL(audio_signal->data)->stream_current->data, 1, 0,
-						      buffer_size, copy_mode);
-	}
-      }else{
-	if((AGS_AUDIO_SIGNAL_TEMPLATE & (AGS_AUDIO_SIGNAL(audio_signal->data)->flags)) == 0 &&
-	   AGS_AUDIO_SIGNAL(audio_signal->data)->stream_current != NULL){
-	  /* copy buffer 1:1 */
-	  ags_audio_buffer_util_copy_buffer_to_buffer(buffer, 1, 0,
-						      AGS_AUDIO_SIGNAL(audio_signal->data)->stream_current->data, 1, 0,
-						      buffer_size, copy_mode);
-	}
+      current = AGS_AUDIO_SIGNAL(audio_signal->data);
+      
+      if((AGS_AUDIO_SIGNAL_TEMPLATE & (current->flags)) == 0 &&
+	 current->stream_current != NULL){
+	ags_meter_util_mix(peak_channel->mix_buffer,
+			   current->stream_current->data, current->format,
+			   (current->buffer_size < buffer_size) ? current->buffer_size: buffer_size);
       }
 
       audio_signal = audio_signal->next;
@@ -421,76 +440,34 @@ ags_peak_channel_retrieve_peak(AgsPeakChannel *peak_channel,
     recycling = recycling->next;
   }
 
-  /* calculate average value */
-  current_value = 0.0;
-  
-  limit = buffer_size - 8;
-
-  for(i = 0; i < limit; i += 8){
-    /* unrolled loop */
-    if(buffer[i] != 0){
-      current_value += (1.0 / (1.0 / (double) G_MAXUINT16 * buffer[i]));
-    }
-
-    if(buffer[i + 1] != 0){
-      current_value += (1.0 / (1.0 / (double) G_MAXUINT16 * buffer[i + 1]));
-    }
-
-    if(buffer[i + 2] != 0){
-      current_value += (1.0 / (1.0 / (double) G_MAXUINT16 * buffer[i + 2]));
-    }
-
-    if(buffer[i + 3] != 0){
-      current_value += (1.0 / (1.0 / (double) G_MAXUINT16 * buffer[i + 3]));
-    }
-    
-    if(buffer[i + 4] != 0){
-      current_value += (1.0 / (1.0 / (double) G_MAXUINT16 * buffer[i + 4]));
-    }
-
-    if(buffer[i + 5] != 0){
-      current_value += (1.0 / (1.0 / (double) G_MAXUINT16 * buffer[i + 5]));
-    }
-    
-    if(buffer[i + 6] != 0){
-      current_value += (1.0 / (1.0 / (double) G_MAXUINT16 * buffer[i + 6]));
-    }
-
-    if(buffer[i + 7] != 0){
-      current_value += (1.0 / (1.0 / (double) G_MAXUINT16 * buffer[i + 7]));
-    }
+  /* measure */
+  ags_meter_util_peak_rms(peak_channel->mix_buffer,
+			  buffer_size,
+			  &peak, &rms);
+
+  if((AGS_PEAK_CHANNEL_TRUE_PEAK & (peak_channel->flags)) != 0){
+    true_peak = ags_meter_util_true_peak(peak_channel->mix_buffer,
+					 buffer_size,
+					 peak_channel->true_peak_history);
+  }else{
+    true_peak = peak;
   }
 
-  for(; i < buffer_size; i++){
-    if(buffer[i] != 0){
-      current_value += (1.0 / (1.0 / (double) G_MAXUINT16 * buffer[i]));
-    }
-  }
-  
-  /* break down to scale */
-  //TODO:JK: verify me
-  if(current_value != 0.0){
-    current_value = scale_precision * (atan(1.0 / 440.0) / sin(current_value / 22000.0));
-  }
-
-  value = g_new0(GValue,
-		 1);
-  g_value_init(value, G_TYPE_FLOAT);
+  ags_meter_slot_publish(peak_channel->meter_slot,
+			 peak, rms, true_peak);
 
-  if(current_value < 0.0){
-    current_value *= -1.0;
+  /* port - full scale maps to the upper value of 10.0 */
+  if(peak > 1.0){
+    peak = 1.0;
   }
-
-  g_value_set_float(value,
-		    current_value);
+  
+  g_value_init(&value, G_TYPE_FLOAT);
+  g_value_set_float(&value,
+		    10.0 * peak);
 
   ags_port_safe_write(peak_channel->peak,
-		      value);
-  g_value_unset(value);
-  g_free(value);
-  
-  /* free buffer */
-  free(buffer);
+		      &value);
+  g_value_unset(&value);
 }
 
 static AgsPortDescriptor*
@@ -25,6 +25,7 @@
 
 #include <ags/audio/ags_recall_channel.h>
 #include <ags/audio/ags_channel.h>
+#include <ags/audio/ags_meter_util.h>
 
 #define AGS_TYPE_PEAK_CHANNEL                (ags_peak_channel_get_type())
 #define AGS_PEAK_CHANNEL(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_PEAK_CHANNEL, AgsPeakChannel))
@@ -36,10 +37,23 @@
 typedef struct _AgsPeakChannel AgsPeakChannel;
 typedef struct _AgsPeakChannelClass AgsPeakChannelClass;
 
+typedef enum{
+  AGS_PEAK_CHANNEL_TRUE_PEAK   = 1,
+}AgsPeakChannelFlags;
+
 struct _AgsPeakChannel
 {
   AgsRecallChannel recall_channel;
 
+  guint flags;
+
+  gfloat *mix_buffer;
+  guint mix_buffer_size;
+
+  gfloat true_peak_history[AGS_METER_UTIL_TRUE_PEAK_HISTORY];
+
+  AgsMeterSlot *meter_slot;
+
   AgsPort *peak;
 };
 
@@ -18,6 +18,7 @@
  */
 
 #include <ags/audio/recall/ags_peak_channel_run.h>
+#include <ags/audio/recall/ags_peak_channel.h>
 #include <ags/audio/recall/ags_peak_recycling.h>
 
 #include <ags/lib/ags_parameter.h>
@@ -42,6 +43,7 @@ void ags_peak_channel_run_connect_dynamic(AgsDynamicConnectable *dynamic_connect
 void ags_peak_channel_run_disconnect_dynamic(AgsDynamicConnectable *dynamic_connectable);
 void ags_peak_channel_run_finalize(GObject *gobject);
 
+void ags_peak_channel_run_run_inter(AgsRecall *recall);
 AgsRecall* ags_peak_channel_run_duplicate(AgsRecall *recall,
 					    AgsRecallID *recall_id,
 					    guint *n_params, GParameter *parameter);
@@ -53,7 +55,8 @@ AgsRecall* ags_peak_channel_run_duplicate(AgsRecall *recall,
  * @section_id:
  * @include: ags/audio/recall/ags_peak_channel_run.h
  *
- * The #AgsPeakChannelRun class peaks the channel.
+ * The #AgsPeakChannelRun class peaks the channel. The audio signals of the
+ * source are tapped once per period after its children did run.
  */
 
 static gpointer ags_peak_channel_run_parent_class = NULL;
@@ -123,6 +126,7 @@ ags_peak_channel_run_class_init(AgsPeakChannelRunClass *peak_channel_run)
   /* AgsRecallClass */
   recall = (AgsRecallClass *) peak_channel_run;
 
+  recall->run_inter = ags_peak_channel_run_run_inter;
   recall->duplicate = ags_peak_channel_run_duplicate;
 }
 
@@ -192,6 +196,21 @@ ags_peak_channel_run_disconnect_dynamic(AgsDynamicConnectable *dynamic_connectab
   ags_peak_channel_run_parent_dynamic_connectable_interface->disconnect_dynamic(dynamic_connectable);
 }
 
+void
+ags_peak_channel_run_run_inter(AgsRecall *recall)
+{
+  AgsPeakChannel *peak_channel;
+
+  /* call parent */
+  AGS_RECALL_CLASS(ags_peak_channel_run_parent_class)->run_inter(recall);
+
+  /* tap all audio signals of the source at once */
+  peak_channel = AGS_PEAK_CHANNEL(AGS_RECALL_CHANNEL_RUN(recall)->recall_channel);
+
+  ags_peak_channel_retrieve_peak(peak_channel,
+				 TRUE);
+}
+
 AgsRecall*
 ags_peak_channel_run_duplicate(AgsRecall *recall,
 			     AgsRecallID *recall_id,
@@ -768,17 +768,16 @@ ags_play_notation_audio_run_alloc_input_callback(AgsDelayAudioRun *delay_audio_r
   AgsMutexManager *mutex_manager;
 
   AgsConfig *config;
+  AgsConfigSnapshot *snapshot;
   
   GList *current_position;
   GList *list;
 
-  gchar *str;
-
   gboolean reset_current;
   guint notation_counter;
   guint input_pads;
   guint audio_channel;
-  guint samplerate;
+  guint buffer_size;
   guint i;
   
   pthread_mutex_t *application_mutex;
@@ -802,30 +801,17 @@ ags_play_notation_audio_run_alloc_input_callback(AgsDelayAudioRun *delay_audio_r
 
   config = ags_config_get_instance();
   
-  /* read config and audio mutex */
-  pthread_mutex_lock(application_mutex);
+  /* buffer size */
+  snapshot = ags_config_get_snapshot(config);
   
-  /* samplerate */
-  str = ags_config_get_value(config,
-			     AGS_CONFIG_SOUNDCARD,
-			     "samplerate\0");
-
-  if(str == NULL){
-    str = ags_config_get_value(config,
-			       AGS_CONFIG_SOUNDCARD_0,
-			       "samplerate\0");
-  }
-  
-  if(str != NULL){  
-    samplerate = g_ascii_strtoull(str,
-				  NULL,
-				  10);
-    free(str);
-  }else{
-    samplerate = AGS_SOUNDCARD_DEFAULT_SAMPLERATE;
-  }
+  buffer_size = snapshot->buffer_size;
+
+  ags_config_release_snapshot(config,
+			      snapshot);
 
-  /*  */
+  /* audio mutex */
+  pthread_mutex_lock(application_mutex);
+  
   audio_mutex = ags_mutex_manager_lookup(mutex_manager,
 					 (GObject *) audio);
   
@@ -976,7 +962,7 @@ ags_play_notation_audio_run_alloc_input_callback(AgsDelayAudioRun *delay_audio_r
 	if((AGS_AUDIO_PATTERN_MODE & (audio->flags)) != 0){
 	  ags_recycling_create_audio_signal_with_defaults(recycling,
 							  audio_signal,
-							  0.0, 0);
+							  0.0, attack + note->stream_attack);
 	}else{
 	  gdouble notation_delay;
 
@@ -991,11 +977,11 @@ ags_play_notation_audio_run_alloc_input_callback(AgsDelayAudioRun *delay_audio_r
 	  notation_delay = g_value_get_double(&value);
 	  g_value_unset(&value);
 
-	  /* create audio signal with frame count */
+	  /* create audio signal with frame count - starts at the tic's frame within the period */
 	  ags_recycling_create_audio_signal_with_frame_count(recycling,
 							     audio_signal,
-							     (guint) (((gdouble) samplerate / notation_delay) * (gdouble) (note->x[1] - note->x[0])),
-							     0.0, 0);
+							     (guint) (notation_delay * (gdouble) buffer_size * (gdouble) (note->x[1] - note->x[0])),
+							     0.0, attack + note->stream_attack);
 	}
 	  
 	ags_connectable_connect(AGS_CONNECTABLE(audio_signal));
@@ -26,6 +26,7 @@
 #include <ags/object/ags_connectable.h>
 #include <ags/object/ags_dynamic_connectable.h>
 #include <ags/object/ags_sequencer.h>
+#include <ags/object/ags_soundcard.h>
 #include <ags/object/ags_plugin.h>
 
 #include <ags/thread/ags_mutex_manager.h>
@@ -36,6 +37,7 @@
 
 #include <ags/thread/ags_timestamp_thread.h>
 
+#include <ags/audio/ags_midiin.h>
 #include <ags/audio/ags_recall_id.h>
 #include <ags/audio/ags_recall_container.h>
 #include <ags/audio/ags_notation.h>
@@ -47,6 +49,8 @@
 #include <ags/audio/midi/ags_midi_util.h>
 #include <ags/audio/midi/ags_midi_file.h>
 
+#include <stdlib.h>
+
 void ags_record_midi_audio_run_class_init(AgsRecordMidiAudioRunClass *record_midi_audio_run);
 void ags_record_midi_audio_run_connectable_interface_init(AgsConnectableInterface *connectable);
 void ags_record_midi_audio_run_dynamic_connectable_interface_init(AgsDynamicConnectableInterface *dynamic_connectable);
@@ -727,6 +731,8 @@ ags_record_midi_audio_run_run_pre(AgsRecall *recall)
   GList *list;
   GList *note, *note_next;
   
+  AgsMidiEvent *midi_event;
+  
   unsigned char *midi_buffer;
 
   glong division, tempo, bpm;
@@ -740,12 +746,15 @@ ags_record_midi_audio_run_run_pre(AgsRecall *recall)
   guint input_pads;
   guint audio_channel;
   guint buffer_length;
+  guint event_count;
+  guint tic_offset, tic_attack;
   guint i;
   
   GValue value = {0,};
 
   pthread_mutex_t *application_mutex;
   pthread_mutex_t *sequencer_mutex;
+  pthread_mutex_t *soundcard_mutex;
   pthread_mutex_t *audio_mutex;
   pthread_mutex_t *channel_mutex;
 
@@ -845,9 +854,29 @@ ags_record_midi_audio_run_run_pre(AgsRecall *recall)
   
   /*  */
   notation_counter = count_beats_audio_run->notation_counter;
+
+  /* frames elapsed since the current tic */
+  tic_offset = delay_audio_run->notation_counter * audio->buffer_size;
   
   pthread_mutex_unlock(audio_mutex);
 
+  tic_attack = 0;
+  
+  if(recall->soundcard != NULL){
+    pthread_mutex_lock(application_mutex);
+  
+    soundcard_mutex = ags_mutex_manager_lookup(mutex_manager,
+					       recall->soundcard);
+  
+    pthread_mutex_unlock(application_mutex);
+
+    pthread_mutex_lock(soundcard_mutex);
+
+    tic_attack = ags_soundcard_get_attack(AGS_SOUNDCARD(recall->soundcard));
+  
+    pthread_mutex_unlock(soundcard_mutex);
+  }
+
   /* get mode */
   g_value_init(&value,
 	       G_TYPE_BOOLEAN);
@@ -890,17 +919,41 @@ ags_record_midi_audio_run_run_pre(AgsRecall *recall)
   midi_buffer = ags_sequencer_get_buffer(AGS_SEQUENCER(sequencer),
 					 &buffer_length);
 
+  /* the events carry the frame within the period */
+  midi_event = NULL;
+  event_count = 0;
+  
+  if(AGS_IS_MIDIIN(sequencer)){
+    midi_event = ags_midiin_get_event(AGS_MIDIIN(sequencer),
+				      &event_count);
+  }
+  
   pthread_mutex_unlock(sequencer_mutex);
 
   /* playback */
   if(midi_buffer != NULL){
     if(playback){
       unsigned char *midi_iter;
+
+      guint nth_event;
+      guint event_position;
+      guint frame_offset;
       
       /* parse bytes */
       midi_iter = midi_buffer;
+
+      nth_event = 0;
+      event_position = 0;
       
       while(midi_iter < midi_buffer + buffer_length){
+	/* find the event of the current message */
+	while(nth_event < event_count &&
+	      event_position + midi_event[nth_event].length <= midi_iter - midi_buffer){
+	  event_position += midi_event[nth_event].length;
+	  nth_event++;
+	}
+
+	frame_offset = (nth_event < event_count) ? midi_event[nth_event].offset: 0;
 
 #ifdef AGS_DEBUG
 	g_message("0x%x\0", *midi_iter);
@@ -949,6 +1002,9 @@ ags_record_midi_audio_run_run_pre(AgsRecall *recall)
 	    
 		  current_note->x[0] = notation_counter;
 		  current_note->x[1] = notation_counter + 1;
+
+		  /* frames after the tic the note belongs to */
+		  current_note->stream_attack = (tic_offset + frame_offset > tic_attack) ? (tic_offset + frame_offset - tic_attack): 0;
 	      
 		  if(reverse_mapping){
 		    current_note->y = input_pads - ((0x7f & midi_iter[1]) - midi_start_mapping) - 1;
@@ -1166,7 +1222,8 @@ ags_record_midi_audio_run_run_pre(AgsRecall *recall)
     }
 
     /* record */
-    if(record){
+    if(record &&
+       buffer_length > 0){
       unsigned char *smf_buffer;
 
       glong delta_time;
@@ -1181,8 +1238,12 @@ ags_record_midi_audio_run_run_pre(AgsRecall *recall)
 					delta_time,
 					&smf_buffer_length);
       
-      ags_midi_file_write(record_midi_audio_run->midi_file,
-			  smf_buffer, smf_buffer_length);
+      if(smf_buffer != NULL){
+	ags_midi_file_write(record_midi_audio_run->midi_file,
+			    smf_buffer, smf_buffer_length);
+
+	free(smf_buffer);
+      }
     }
   }
 
@@ -254,8 +254,13 @@ ags_stream_audio_signal_run_post(AgsRecall *recall)
 {
   AgsStreamChannel *stream_channel;
   AgsStreamChannelRun *stream_channel_run;
+  AgsAudioSignal *source;
 
+  AgsMutexManager *mutex_manager;
   AgsApplicationContext *application_context;
+
+  pthread_mutex_t *application_mutex;
+  pthread_mutex_t *recycling_mutex;
   
   if(recall->parent != NULL &&
      recall->parent->parent != NULL){
@@ -266,7 +271,33 @@ ags_stream_audio_signal_run_post(AgsRecall *recall)
     stream_channel = NULL;
   }
   
-  if(AGS_RECALL_AUDIO_SIGNAL(recall)->source->stream_current != NULL){
+  source = AGS_RECALL_AUDIO_SIGNAL(recall)->source;
+  
+  if(source->stream_current != NULL){
+    /* pull the next buffer from the template */
+    if((AGS_AUDIO_SIGNAL_CURSOR & (source->flags)) != 0 &&
+       source->stream_current->next == NULL){
+      mutex_manager = ags_mutex_manager_get_instance();
+      application_mutex = ags_mutex_manager_get_application_mutex(mutex_manager);
+
+      pthread_mutex_lock(application_mutex);
+  
+      recycling_mutex = ags_mutex_manager_lookup(mutex_manager,
+						 (GObject *) source->recycling);
+
+      pthread_mutex_unlock(application_mutex);
+
+      if(recycling_mutex != NULL){
+	pthread_mutex_lock(recycling_mutex);
+      }
+      
+      ags_audio_signal_pull_stream(source);
+
+      if(recycling_mutex != NULL){
+	pthread_mutex_unlock(recycling_mutex);
+      }
+    }
+    
     if(stream_channel != NULL &&
        AGS_RECALL_AUDIO_SIGNAL(recall)->source->stream_current->next == NULL){
       GValue value = {0,};
@@ -173,11 +173,10 @@ void
 ags_stream_channel_init(AgsStreamChannel *stream_channel)
 {
   AgsConfig *config;
+  AgsConfigSnapshot *snapshot;
   
   GList *port;
   
-  gchar *str;
-  
   AGS_RECALL(stream_channel)->name = "ags-stream\0";
   AGS_RECALL(stream_channel)->version = AGS_RECALL_DEFAULT_VERSION;
   AGS_RECALL(stream_channel)->build_id = AGS_RECALL_DEFAULT_BUILD_ID;
@@ -200,12 +199,13 @@ ags_stream_channel_init(AgsStreamChannel *stream_channel)
   
   config = ags_config_get_instance();
   
-  str = ags_config_get_value(config,
-			     AGS_CONFIG_RECALL,
-			     "auto-sense\0");
-  stream_channel->auto_sense->port_value.ags_port_boolean = ((!g_strcmp0(str, "true\0")
+  snapshot = ags_config_get_snapshot(config);
+  
+  stream_channel->auto_sense->port_value.ags_port_boolean = (((AGS_CONFIG_SNAPSHOT_AUTO_SENSE & (snapshot->flags)) != 0
 							      ) ? TRUE: FALSE);
-  free(str);
+
+  ags_config_release_snapshot(config,
+			      snapshot);
 
   /* add to port */
   port = g_list_prepend(port, stream_channel->auto_sense);
@@ -409,7 +409,7 @@ ags_add_audio_signal_launch(AgsTask *task)
 
   /* check for template to remove */
   if((AGS_AUDIO_SIGNAL_TEMPLATE & (add_audio_signal->audio_signal_flags)) != 0){
-    old_template = ags_audio_signal_get_template(add_audio_signal->recycling->audio_signal);
+    old_template = ags_recycling_get_template(add_audio_signal->recycling);
   }else{
     old_template = NULL;
   }
@@ -20,6 +20,11 @@
 #include <ags/audio/task/ags_add_note.h>
 
 #include <ags/object/ags_connectable.h>
+#include <ags/object/ags_application_context.h>
+
+#include <ags/thread/ags_history.h>
+
+#include <ags/audio/task/ags_remove_note.h>
 
 void ags_add_note_class_init(AgsAddNoteClass *add_note);
 void ags_add_note_connectable_interface_init(AgsConnectableInterface *connectable);
@@ -309,12 +314,35 @@ ags_add_note_launch(AgsTask *task)
 {
   AgsAddNote *add_note;
 
+  AgsHistory *history;
+  AgsHistoryEntry *entry;
+
   add_note = AGS_ADD_NOTE(task);
 
   /* add note */
   ags_notation_add_note(add_note->notation,
 			add_note->note,
 			add_note->use_selection_list);
+
+  /* record inverse, the selection isn't part of the history */
+  history = (AgsHistory *) ags_application_context_get_instance()->history;
+
+  if(!add_note->use_selection_list &&
+     ags_history_is_recording(history,
+			      task)){
+    entry = ags_history_entry_alloc((AgsTask *) ags_remove_note_new(add_note->notation,
+								    add_note->note->x[0], add_note->note->y),
+				    (AgsTask *) ags_add_note_new(add_note->notation,
+								 add_note->note,
+								 FALSE));
+    ags_history_entry_add_reference(entry,
+				    (GObject *) add_note->notation);
+    ags_history_entry_add_reference(entry,
+				    (GObject *) add_note->note);
+
+    ags_history_append(history,
+		       entry);
+  }
 }
 
 /**
@@ -25,11 +25,16 @@
 
 #include <ags/audio/ags_audio.h>
 #include <ags/audio/ags_input.h>
+#include <ags/audio/ags_output.h>
 #include <ags/audio/ags_audio_signal.h>
 #include <ags/audio/ags_synth_generator.h>
 #include <ags/audio/ags_audio_buffer_util.h>
 #include <ags/audio/ags_synth_util.h>
 
+#include <ags/audio/recall/ags_oscillator_channel.h>
+
+#include <ags/thread/ags_mutex_manager.h>
+
 #include <math.h>
 
 void ags_apply_synth_class_init(AgsApplySynthClass *apply_synth);
@@ -527,8 +532,11 @@ ags_apply_synth_launch(AgsTask *task)
 {
   AgsApplySynth *apply_synth;
 
+  AgsAudio *audio;
   AgsChannel *channel;
   AgsAudioSignal *audio_signal;
+
+  AgsMutexManager *mutex_manager;
   
   AgsSoundcard *soundcard;
 
@@ -544,8 +552,13 @@ ags_apply_synth_launch(AgsTask *task)
   guint buffer_size;
   guint samplerate;
   guint audio_buffer_util_format;
+  guint oscillator;
+  gboolean realtime;
   gchar *str;
 
+  pthread_mutex_t *application_mutex;
+  pthread_mutex_t *recycling_mutex;
+
   auto double ags_apply_synth_calculate_factor(guint base_frequency, guint wished_frequency, guint wave);
   auto void ags_apply_synth_launch_write(GList *stream,
 					 guint frequency, guint phase, gdouble volume,
@@ -621,11 +634,35 @@ ags_apply_synth_launch(AgsTask *task)
 
   factor = 1.0;
 
+  switch(wave){
+  case AGS_APPLY_SYNTH_SAW:
+    oscillator = AGS_SYNTH_GENERATOR_OSCILLATOR_SAWTOOTH;
+    break;
+  case AGS_APPLY_SYNTH_SQUARE:
+    oscillator = AGS_SYNTH_GENERATOR_OSCILLATOR_SQUARE;
+    break;
+  case AGS_APPLY_SYNTH_TRIANGLE:
+    oscillator = AGS_SYNTH_GENERATOR_OSCILLATOR_TRIANGLE;
+    break;
+  default:
+    oscillator = AGS_SYNTH_GENERATOR_OSCILLATOR_SIN;
+  }
+
+  /* voices rendered per period by ags-oscillator */
+  audio = AGS_AUDIO(channel->audio);
+  
+  realtime = (audio->output != NULL &&
+	      ags_recall_find_type(audio->output->play,
+				   AGS_TYPE_OSCILLATOR_CHANNEL) != NULL) ? TRUE: FALSE;
+
+  mutex_manager = ags_mutex_manager_get_instance();
+  application_mutex = ags_mutex_manager_get_application_mutex(mutex_manager);
+
   /* fill */
   channel = apply_synth->start_channel;
 
   for(i = 0; channel != NULL && i < apply_synth->count; i++){
-    audio_signal = ags_audio_signal_get_template(channel->first_recycling->audio_signal);
+    audio_signal = ags_recycling_get_template(channel->first_recycling);
 
     buffer_size = audio_signal->buffer_size;
     stop = (guint) ceil((double)(attack + frame_count) / (double) buffer_size);
@@ -640,8 +677,35 @@ ags_apply_synth_launch(AgsTask *task)
 		   "frequency\0", frequency,
 		   "phase\0", phase,
 		   "volume\0", volume,
+		   "oscillator\0", oscillator,
 		   NULL);
     }
+
+    if(realtime){
+      /* the template only defines the length and loop of the voices */
+      if(AGS_IS_OUTPUT(channel)){
+	pthread_mutex_lock(application_mutex);
+	
+	recycling_mutex = ags_mutex_manager_lookup(mutex_manager,
+						   (GObject *) channel->first_recycling);
+	
+	pthread_mutex_unlock(application_mutex);
+
+	pthread_mutex_lock(recycling_mutex);
+	
+	if(audio_signal->length != stop){
+	  ags_audio_signal_stream_resize(audio_signal, stop);
+	}
+
+	audio_signal->loop_start = apply_synth->loop_start;
+	audio_signal->loop_end = apply_synth->loop_end;
+
+	pthread_mutex_unlock(recycling_mutex);
+      }
+      
+      channel = channel->next;
+      continue;
+    }
     
     /* calculate wished frequncy and phase */
     current_frequency = (guint) ((double) frequency * exp2((double)((apply_synth->start_frequency * -1.0) + (double)i) / 12.0));
@@ -662,12 +726,23 @@ ags_apply_synth_launch(AgsTask *task)
     /* create AgsAudioSignal */
     //    g_message("%d\0", current_stop);
     
+    pthread_mutex_lock(application_mutex);
+	
+    recycling_mutex = ags_mutex_manager_lookup(mutex_manager,
+					       (GObject *) channel->first_recycling);
+	
+    pthread_mutex_unlock(application_mutex);
+
+    pthread_mutex_lock(recycling_mutex);
+
     if(audio_signal->length < current_stop){
       ags_audio_signal_stream_resize(audio_signal, current_stop);
     }
     
     audio_signal->loop_start = (guint) ((double) apply_synth->loop_start) * factor;
     audio_signal->loop_end = (guint) ((double) apply_synth->loop_end) * factor;
+
+    pthread_mutex_unlock(recycling_mutex);
     
     /* fill in the stream */
     stream = g_list_nth(audio_signal->stream_beginning, stream_start);
@@ -19,7 +19,12 @@
 
 #include <ags/audio/task/ags_link_channel.h>
 
+#include <ags/audio/ags_input.h>
+
 #include <ags/object/ags_connectable.h>
+#include <ags/object/ags_application_context.h>
+
+#include <ags/thread/ags_history.h>
 
 void ags_link_channel_class_init(AgsLinkChannelClass *link_channel);
 void ags_link_channel_connectable_interface_init(AgsConnectableInterface *connectable);
@@ -181,6 +186,9 @@ ags_link_channel_init(AgsLinkChannel *link_channel)
   link_channel->channel = NULL;
   link_channel->link = NULL;
 
+  link_channel->file_link = NULL;
+  link_channel->next = NULL;
+
   link_channel->error = NULL;
 }
 
@@ -303,18 +311,54 @@ ags_link_channel_disconnect(AgsConnectable *connectable)
 void
 ags_link_channel_finalize(GObject *gobject)
 {
-  G_OBJECT_CLASS(ags_link_channel_parent_class)->finalize(gobject);
+  AgsLinkChannel *link_channel;
 
-  /* empty */
+  link_channel = AGS_LINK_CHANNEL(gobject);
+
+  if(link_channel->file_link != NULL){
+    g_object_unref(link_channel->file_link);
+  }
+
+  if(link_channel->next != NULL){
+    g_object_unref(link_channel->next);
+  }
+
+  G_OBJECT_CLASS(ags_link_channel_parent_class)->finalize(gobject);
 }
 
 void
 ags_link_channel_launch(AgsTask *task)
 {
   AgsLinkChannel *link_channel;
+  AgsLinkChannel *undo;
+
+  AgsChannel *old_link, *old_link_link;
+
+  AgsHistory *history;
+  AgsHistoryEntry *entry;
+
+  GObject *old_file_link;
 
   link_channel = AGS_LINK_CHANNEL(task);
 
+  /* ags_channel_set_link() rewrites both pairs, save them */
+  old_link = link_channel->channel->link;
+
+  if(link_channel->link != NULL &&
+     link_channel->link->link != link_channel->channel){
+    old_link_link = link_channel->link->link;
+  }else{
+    old_link_link = NULL;
+  }
+
+  old_file_link = NULL;
+
+  if(AGS_IS_INPUT(link_channel->channel) &&
+     AGS_INPUT(link_channel->channel)->file_link != NULL){
+    old_file_link = AGS_INPUT(link_channel->channel)->file_link;
+    g_object_ref(old_file_link);
+  }
+  
   /* link channel */
   g_object_set(link_channel->channel,
 	       "file-link", NULL,
@@ -324,6 +368,58 @@ ags_link_channel_launch(AgsTask *task)
 
   if(link_channel->error != NULL){
     g_message("%s\0", link_channel->error->message);
+
+    if(old_file_link != NULL){
+      g_object_unref(old_file_link);
+    }
+    
+    return;
+  }
+
+  /* restore the file link of an undone unlink */
+  if(link_channel->file_link != NULL){
+    g_object_set(link_channel->channel,
+		 "file-link", link_channel->file_link,
+		 NULL);
+  }
+
+  /* relink the pair broken up, it is replayed as part of this task */
+  if(link_channel->next != NULL){
+    AGS_TASK(link_channel->next)->flags |= (AGS_TASK_HISTORY & (task->flags));
+    
+    ags_task_launch((AgsTask *) link_channel->next);
+  }
+  
+  /* record inverse */
+  history = (AgsHistory *) ags_application_context_get_instance()->history;
+
+  if(ags_history_is_recording(history,
+			      task)){
+    undo = ags_link_channel_new(link_channel->channel,
+				old_link);
+    undo->file_link = old_file_link;
+
+    if(old_link_link != NULL){
+      undo->next = ags_link_channel_new(link_channel->link,
+					old_link_link);
+    }
+    
+    entry = ags_history_entry_alloc((AgsTask *) undo,
+				    (AgsTask *) ags_link_channel_new(link_channel->channel,
+								     link_channel->link));
+    ags_history_entry_add_reference(entry,
+				    (GObject *) link_channel->channel);
+    ags_history_entry_add_reference(entry,
+				    (GObject *) old_link);
+    ags_history_entry_add_reference(entry,
+				    (GObject *) link_channel->link);
+    ags_history_entry_add_reference(entry,
+				    (GObject *) old_link_link);
+
+    ags_history_append(history,
+		       entry);
+  }else if(old_file_link != NULL){
+    g_object_unref(old_file_link);
   }
 }
 
@@ -44,6 +44,9 @@ struct _AgsLinkChannel
   AgsChannel *channel;
   AgsChannel *link;
 
+  GObject *file_link;
+  AgsLinkChannel *next;
+
   GError *error;
 };
 
@@ -20,6 +20,11 @@
 #include <ags/audio/task/ags_remove_note.h>
 
 #include <ags/object/ags_connectable.h>
+#include <ags/object/ags_application_context.h>
+
+#include <ags/thread/ags_history.h>
+
+#include <ags/audio/task/ags_add_note.h>
 
 void ags_remove_note_class_init(AgsRemoveNoteClass *remove_note);
 void ags_remove_note_connectable_interface_init(AgsConnectableInterface *connectable);
@@ -297,11 +302,42 @@ ags_remove_note_launch(AgsTask *task)
 {
   AgsRemoveNote *remove_note;
 
+  AgsNote *note;
+
+  AgsHistory *history;
+  AgsHistoryEntry *entry;
+
   remove_note = AGS_REMOVE_NOTE(task);
 
+  /* keep the note to re-add */
+  history = (AgsHistory *) ags_application_context_get_instance()->history;
+
+  entry = NULL;
+
+  if(ags_history_is_recording(history,
+			      task) &&
+     (note = ags_notation_find_point(remove_note->notation,
+				     remove_note->x, remove_note->y,
+				     FALSE)) != NULL){
+    entry = ags_history_entry_alloc((AgsTask *) ags_add_note_new(remove_note->notation,
+								 note,
+								 FALSE),
+				    (AgsTask *) ags_remove_note_new(remove_note->notation,
+								    remove_note->x, remove_note->y));
+    ags_history_entry_add_reference(entry,
+				    (GObject *) remove_note->notation);
+    ags_history_entry_add_reference(entry,
+				    (GObject *) note);
+  }
+
   /* remove note */
-  ags_notation_remove_note_at_position(remove_note->notation,
-				       remove_note->x, remove_note->y);
+  if(ags_notation_remove_note_at_position(remove_note->notation,
+					  remove_note->x, remove_note->y)){
+    ags_history_append(history,
+		       entry);
+  }else{
+    ags_history_entry_free(entry);
+  }
 }
 
 /**
@@ -20,6 +20,9 @@
 #include <ags/audio/task/ags_toggle_pattern_bit.h>
 
 #include <ags/object/ags_connectable.h>
+#include <ags/object/ags_application_context.h>
+
+#include <ags/thread/ags_history.h>
 
 void ags_toggle_pattern_bit_class_init(AgsTogglePatternBitClass *toggle_pattern_bit);
 void ags_toggle_pattern_bit_connectable_interface_init(AgsConnectableInterface *connectable);
@@ -377,6 +380,9 @@ ags_toggle_pattern_bit_launch(AgsTask *task)
 {
   AgsTogglePatternBit *toggle_pattern_bit;
 
+  AgsHistory *history;
+  AgsHistoryEntry *entry;
+
   toggle_pattern_bit = AGS_TOGGLE_PATTERN_BIT(task);
 
 #ifdef AGS_DEBUG
@@ -388,6 +394,26 @@ ags_toggle_pattern_bit_launch(AgsTask *task)
 			 toggle_pattern_bit->bit);
 
   ags_toggle_pattern_bit_refresh_gui(toggle_pattern_bit);
+
+  /* record inverse, toggling is its own inverse */
+  history = (AgsHistory *) ags_application_context_get_instance()->history;
+
+  if(ags_history_is_recording(history,
+			      task)){
+    entry = ags_history_entry_alloc((AgsTask *) ags_toggle_pattern_bit_new(toggle_pattern_bit->pattern,
+									   toggle_pattern_bit->line,
+									   toggle_pattern_bit->index_i, toggle_pattern_bit->index_j,
+									   toggle_pattern_bit->bit),
+				    (AgsTask *) ags_toggle_pattern_bit_new(toggle_pattern_bit->pattern,
+									   toggle_pattern_bit->line,
+									   toggle_pattern_bit->index_i, toggle_pattern_bit->index_j,
+									   toggle_pattern_bit->bit));
+    ags_history_entry_add_reference(entry,
+				    (GObject *) toggle_pattern_bit->pattern);
+
+    ags_history_append(history,
+		       entry);
+  }
 }
 
 void
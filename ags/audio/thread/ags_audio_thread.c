@@ -187,8 +187,7 @@ ags_audio_thread_init(AgsAudioThread *audio_thread)
   AgsThread *thread;
 
   AgsConfig *config;
-
-  gchar *str0, *str1;
+  AgsConfigSnapshot *snapshot;
   
   thread = (AgsThread *) audio_thread;
 
@@ -197,44 +196,12 @@ ags_audio_thread_init(AgsAudioThread *audio_thread)
   
   config = ags_config_get_instance();
 
-  str0 = ags_config_get_value(config,
-			      AGS_CONFIG_SOUNDCARD,
-			      "samplerate\0");
-
-  if(str0 == NULL){
-    str0 = ags_config_get_value(config,
-				AGS_CONFIG_SOUNDCARD_0,
-				"samplerate\0");
-  }
+  snapshot = ags_config_get_snapshot(config);
   
-  str1 = ags_config_get_value(config,
-			      AGS_CONFIG_SOUNDCARD,
-			      "buffer-size\0");
-
-  if(str1 == NULL){
-    str1 = ags_config_get_value(config,
-				AGS_CONFIG_SOUNDCARD_0,
-				"buffer-size\0");
-  }
-  
-  if(str0 == NULL || str1 == NULL){
-    thread->freq = AGS_AUDIO_THREAD_DEFAULT_JIFFIE;
-  }else{
-    guint samplerate;
-    guint buffer_size;
-
-    samplerate = g_ascii_strtoull(str0,
-				  NULL,
-				  10);
-    buffer_size = g_ascii_strtoull(str1,
-				   NULL,
-				   10);
-
-    thread->freq = ceil((gdouble) samplerate / (gdouble) buffer_size) + AGS_SOUNDCARD_DEFAULT_OVERCLOCK;
-  }
+  thread->freq = ceil((gdouble) snapshot->samplerate / (gdouble) snapshot->buffer_size) + AGS_SOUNDCARD_DEFAULT_OVERCLOCK;
 
-  g_free(str0);
-  g_free(str1);
+  ags_config_release_snapshot(config,
+			      snapshot);
 
   g_atomic_int_set(&(audio_thread->flags),
 		   0);
@@ -180,8 +180,7 @@ ags_channel_thread_init(AgsChannelThread *channel_thread)
   AgsThread *thread;
 
   AgsConfig *config;
-
-  gchar *str0, *str1;
+  AgsConfigSnapshot *snapshot;
   
   thread = (AgsThread *) channel_thread;
 
@@ -190,44 +189,12 @@ ags_channel_thread_init(AgsChannelThread *channel_thread)
   
   config = ags_config_get_instance();
   
-  str0 = ags_config_get_value(config,
-			      AGS_CONFIG_SOUNDCARD,
-			      "samplerate\0");
-
-  if(str0 == NULL){
-    str0 = ags_config_get_value(config,
-				AGS_CONFIG_SOUNDCARD_0,
-				"samplerate\0");
-  }
+  snapshot = ags_config_get_snapshot(config);
   
-  str1 = ags_config_get_value(config,
-			      AGS_CONFIG_SOUNDCARD,
-			      "buffer-size\0");
-
-  if(str1 == NULL){
-    str1 = ags_config_get_value(config,
-				AGS_CONFIG_SOUNDCARD_0,
-				"buffer-size\0");
-  }
-  
-  if(str0 == NULL || str1 == NULL){
-    thread->freq = AGS_CHANNEL_THREAD_DEFAULT_JIFFIE;
-  }else{
-    guint samplerate;
-    guint buffer_size;
-
-    samplerate = g_ascii_strtoull(str0,
-				  NULL,
-				  10);
-    buffer_size = g_ascii_strtoull(str1,
-				   NULL,
-				   10);
-
-    thread->freq = ceil((gdouble) samplerate / (gdouble) buffer_size) + AGS_SOUNDCARD_DEFAULT_OVERCLOCK;
-  }
+  thread->freq = ceil((gdouble) snapshot->samplerate / (gdouble) snapshot->buffer_size) + AGS_SOUNDCARD_DEFAULT_OVERCLOCK;
 
-  g_free(str0);
-  g_free(str1);
+  ags_config_release_snapshot(config,
+			      snapshot);
 
   g_atomic_int_set(&(channel_thread->flags),
 		   0);
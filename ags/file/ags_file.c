@@ -29,6 +29,7 @@
 #include <ags/file/ags_file_lookup.h>
 #include <ags/file/ags_file_id_ref.h>
 #include <ags/file/ags_file_launch.h>
+#include <ags/file/ags_file_util.h>
 
 #include <ags/thread/ags_thread_pool.h>
 
@@ -451,6 +452,23 @@ ags_file_init(AgsFile *file)
   file->lookup = NULL;
   file->launch = NULL;
 
+  file->id_ref_by_node = g_hash_table_new(g_direct_hash,
+					  g_direct_equal);
+  file->id_ref_by_reference = g_hash_table_new(g_direct_hash,
+					       g_direct_equal);
+  file->node_by_id = NULL;
+
+  file->lookup_by_node = g_hash_table_new_full(g_direct_hash,
+					       g_direct_equal,
+					       NULL,
+					       (GDestroyNotify) g_list_free);
+  file->lookup_by_reference = g_hash_table_new_full(g_direct_hash,
+						    g_direct_equal,
+						    NULL,
+						    (GDestroyNotify) g_list_free);
+
+  file->xpath_context = NULL;
+
   file->application_context = NULL;
 
   file->clipboard = NULL;
@@ -628,6 +646,20 @@ ags_file_finalize(GObject *gobject)
     return;
   }
 
+  g_hash_table_destroy(file->id_ref_by_node);
+  g_hash_table_destroy(file->id_ref_by_reference);
+
+  if(file->node_by_id != NULL){
+    g_hash_table_destroy(file->node_by_id);
+  }
+
+  g_hash_table_destroy(file->lookup_by_node);
+  g_hash_table_destroy(file->lookup_by_reference);
+
+  if(file->xpath_context != NULL){
+    xmlXPathFreeContext(file->xpath_context);
+  }
+
   xmlFreeDoc(file->doc);
   //  xmlCleanupParser();
   //  xmlMemoryDump();
@@ -671,6 +703,8 @@ ags_file_str2md5(gchar *content, guint content_length)
 void
 ags_file_add_id_ref(AgsFile *file, GObject *id_ref)
 {
+  AgsFileIdRef *file_id_ref;
+
   if(id_ref == NULL)
     return;
 
@@ -678,6 +712,21 @@ ags_file_add_id_ref(AgsFile *file, GObject *id_ref)
 
   file->id_refs = g_list_prepend(file->id_refs,
 				 id_ref);
+
+  /* index - the most recently added reference wins like the list scan did */
+  file_id_ref = AGS_FILE_ID_REF(id_ref);
+
+  if(file_id_ref->node != NULL){
+    g_hash_table_insert(file->id_ref_by_node,
+			file_id_ref->node,
+			file_id_ref);
+  }
+
+  if(file_id_ref->ref != NULL){
+    g_hash_table_insert(file->id_ref_by_reference,
+			file_id_ref->ref,
+			file_id_ref);
+  }
 }
 
 /**
@@ -694,22 +743,13 @@ ags_file_add_id_ref(AgsFile *file, GObject *id_ref)
 GObject*
 ags_file_find_id_ref_by_node(AgsFile *file, xmlNode *node)
 {
-  AgsFileIdRef *file_id_ref;
-  GList *list;
-
-  list = file->id_refs;
-
-  while(list != NULL){
-    file_id_ref = AGS_FILE_ID_REF(list->data);
-
-    if(file_id_ref->node == node){
-      return((GObject *) file_id_ref);
-    }
-
-    list = list->next;
+  if(file == NULL ||
+     node == NULL){
+    return(NULL);
   }
 
-  return(NULL);
+  return((GObject *) g_hash_table_lookup(file->id_ref_by_node,
+					 node));
 }
 
 /**
@@ -717,7 +757,9 @@ ags_file_find_id_ref_by_node(AgsFile *file, xmlNode *node)
  * @file: the #AgsFile
  * @xpath: a XPath expression
  *
- * Lookup a reference by @xpath.
+ * Lookup a reference by @xpath. Expressions of the form //*[@id='...'] are
+ * resolved by the id index, anything else is evaluated with a shared
+ * XPath context.
  * 
  * Returns: the matching #GObject
  *
@@ -726,10 +768,14 @@ ags_file_find_id_ref_by_node(AgsFile *file, xmlNode *node)
 GObject*
 ags_file_find_id_ref_by_xpath(AgsFile *file, gchar *xpath)
 {
-  AgsFileIdRef *file_id_ref;
-  xmlXPathContext *xpath_context; 
+  GObject *gobject;
+  
   xmlXPathObject *xpath_object;
   xmlNode **node;
+  xmlNode *id_node;
+
+  gchar *node_name, *id;
+  
   guint i;
 
   if(file == NULL || xpath == NULL || !g_str_has_prefix(xpath, "xpath=\0")){
@@ -738,39 +784,95 @@ ags_file_find_id_ref_by_xpath(AgsFile *file, gchar *xpath)
     return(NULL);
   }
 
-  xpath = &(xpath[6]);
-
-  /* Create xpath evaluation context */
-  xpath_context = xmlXPathNewContext(file->doc);
+  /* Create xpath evaluation context or reuse it, the id index is bound to the same document */
+  if(file->xpath_context != NULL &&
+     file->xpath_context->doc != file->doc){
+    xmlXPathFreeContext(file->xpath_context);
+    file->xpath_context = NULL;
 
-  if(xpath_context == NULL) {
+    if(file->node_by_id != NULL){
+      g_hash_table_destroy(file->node_by_id);
+      file->node_by_id = NULL;
+    }
+  }
+  
+  if(file->xpath_context == NULL){
+    file->xpath_context = xmlXPathNewContext(file->doc);
+  }
+  
+  if(file->xpath_context == NULL) {
     g_warning("Error: unable to create new XPath context\0");
 
     return(NULL);
   }
 
+  /* fast path by id */
+  if(ags_file_util_parse_id_xpath(xpath,
+				  &node_name, &id)){
+    if(file->node_by_id == NULL){
+      file->node_by_id = g_hash_table_new_full(g_str_hash,
+					       g_str_equal,
+					       (GDestroyNotify) xmlFree,
+					       NULL);
+      ags_file_util_index_node_by_id(file->node_by_id,
+				     xmlDocGetRootElement(file->doc));
+    }
+
+    id_node = g_hash_table_lookup(file->node_by_id,
+				  id);
+
+    if(id_node != NULL &&
+       (node_name == NULL ||
+	!xmlStrcmp(id_node->name,
+		   node_name))){
+      gobject = ags_file_find_id_ref_by_node(file,
+					     id_node);
+      
+      g_free(node_name);
+      g_free(id);
+      
+      if(gobject != NULL){
+	return(gobject);
+      }
+    }else{
+      g_free(node_name);
+      g_free(id);
+    }
+  }
+  
+  xpath = &(xpath[6]);
+
   /* Evaluate xpath expression */
-  xpath_object = xmlXPathEval(xpath, xpath_context);
+  xpath_object = xmlXPathEval(xpath, file->xpath_context);
 
   if(xpath_object == NULL) {
     g_warning("Error: unable to evaluate xpath expression \"%s\"\0", xpath);
-    xmlXPathFreeContext(xpath_context); 
 
     return(NULL);
   }
 
-  node = xpath_object->nodesetval->nodeTab;
+  gobject = NULL;
+  
+  if(xpath_object->nodesetval != NULL){
+    node = xpath_object->nodesetval->nodeTab;
+
+    for(i = 0; i < xpath_object->nodesetval->nodeNr; i++){
+      if(node[i]->type == XML_ELEMENT_NODE){
+	gobject = ags_file_find_id_ref_by_node(file,
+					       node[i]);
 
-  for(i = 0; i < xpath_object->nodesetval->nodeNr; i++){
-    if(node[i]->type == XML_ELEMENT_NODE){
-      return(ags_file_find_id_ref_by_node(file,
-					  node[i]));
+	break;
+      }
     }
   }
 
-  g_message("no xpath match: %s\0", xpath);
+  xmlXPathFreeObject(xpath_object);
+
+  if(gobject == NULL){
+    g_message("no xpath match: %s\0", xpath);
+  }
   
-  return(NULL);
+  return(gobject);
 }
 
 /**
@@ -787,22 +889,13 @@ ags_file_find_id_ref_by_xpath(AgsFile *file, gchar *xpath)
 GObject*
 ags_file_find_id_ref_by_reference(AgsFile *file, gpointer ref)
 {
-  AgsFileIdRef *file_id_ref;
-  GList *list;
-
-  list = file->id_refs;
-
-  while(list != NULL){
-    file_id_ref = AGS_FILE_ID_REF(list->data);
-
-    if(file_id_ref->ref == ref){
-      return((GObject *) file_id_ref);
-    }
-
-    list = list->next;
+  if(file == NULL ||
+     ref == NULL){
+    return(NULL);
   }
 
-  return(NULL);
+  return((GObject *) g_hash_table_lookup(file->id_ref_by_reference,
+					 ref));
 }
 
 /**
@@ -817,6 +910,12 @@ ags_file_find_id_ref_by_reference(AgsFile *file, gpointer ref)
 void
 ags_file_add_lookup(AgsFile *file, GObject *file_lookup)
 {
+  xmlNode *node;
+  
+  GList *list;
+  
+  gpointer ref;
+  
   if(file == NULL || file_lookup == NULL){
     return;
   }
@@ -825,6 +924,81 @@ ags_file_add_lookup(AgsFile *file, GObject *file_lookup)
 
   file->lookup = g_list_prepend(file->lookup,
 				file_lookup);
+
+  /* index */
+  node = AGS_FILE_LOOKUP(file_lookup)->node;
+  
+  if(node != NULL){
+    list = g_hash_table_lookup(file->lookup_by_node,
+			       node);
+    g_hash_table_steal(file->lookup_by_node,
+		       node);
+    
+    g_hash_table_insert(file->lookup_by_node,
+			node,
+			g_list_prepend(list,
+				       file_lookup));
+  }
+
+  ref = AGS_FILE_LOOKUP(file_lookup)->ref;
+  
+  if(ref != NULL){
+    list = g_hash_table_lookup(file->lookup_by_reference,
+			       ref);
+    g_hash_table_steal(file->lookup_by_reference,
+		       ref);
+    
+    g_hash_table_insert(file->lookup_by_reference,
+			ref,
+			g_list_prepend(list,
+				       file_lookup));
+  }
+}
+
+/**
+ * ags_file_find_lookup_by_node:
+ * @file: the #AgsFile
+ * @node: a #xmlNode
+ *
+ * Find all #AgsFileLookup added to @file with @node, most recent first.
+ *
+ * Returns: the #GList containing #AgsFileLookup owned by @file or %NULL
+ *
+ * Since: 0.7.136
+ */
+GList*
+ags_file_find_lookup_by_node(AgsFile *file, xmlNode *node)
+{
+  if(file == NULL ||
+     node == NULL){
+    return(NULL);
+  }
+
+  return(g_hash_table_lookup(file->lookup_by_node,
+			     node));
+}
+
+/**
+ * ags_file_find_lookup_by_reference:
+ * @file: the #AgsFile
+ * @ref: a #gpointer
+ *
+ * Find all #AgsFileLookup added to @file with @ref, most recent first.
+ *
+ * Returns: the #GList containing #AgsFileLookup owned by @file or %NULL
+ *
+ * Since: 0.7.136
+ */
+GList*
+ags_file_find_lookup_by_reference(AgsFile *file, gpointer ref)
+{
+  if(file == NULL ||
+     ref == NULL){
+    return(NULL);
+  }
+
+  return(g_hash_table_lookup(file->lookup_by_reference,
+			     ref));
 }
 
 /**
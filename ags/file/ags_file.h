@@ -24,6 +24,7 @@
 #include <glib-object.h>
 
 #include <libxml/tree.h>
+#include <libxml/xpath.h>
 
 #define AGS_TYPE_FILE                (ags_file_get_type())
 #define AGS_FILE(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_FILE, AgsFile))
@@ -81,6 +82,15 @@ struct _AgsFile
   GList *lookup;
   GList *launch;
 
+  GHashTable *id_ref_by_node;
+  GHashTable *id_ref_by_reference;
+  GHashTable *node_by_id;
+
+  GHashTable *lookup_by_node;
+  GHashTable *lookup_by_reference;
+
+  xmlXPathContext *xpath_context;
+
   GObject *application_context;
 
   GObject *clipboard;
@@ -130,6 +140,9 @@ GObject* ags_file_find_id_ref_by_reference(AgsFile *file, gpointer ref);
 
 void ags_file_add_lookup(AgsFile *file, GObject *file_lookup);
 
+GList* ags_file_find_lookup_by_node(AgsFile *file, xmlNode *node);
+GList* ags_file_find_lookup_by_reference(AgsFile *file, gpointer ref);
+
 void ags_file_add_launch(AgsFile *file, GObject *file_launch);
 
 /*  */
@@ -1145,3 +1145,113 @@ ags_file_write_file_link_list(AgsFile *file, xmlNode *parent, GList *file_link)
   /* return created node */
   return(node);
 }
+
+/**
+ * ags_file_util_parse_id_xpath:
+ * @xpath: the XPath expression prefixed with "xpath="
+ * @node_name: return location of the node name or %NULL for any node
+ * @id: return location of the id
+ *
+ * Check if @xpath is a plain lookup by id like //*[@id='...'] or
+ * //ags-sf-line[@id='...'], so it can be resolved without evaluating it.
+ *
+ * Returns: %TRUE if @xpath is a lookup by id, otherwise %FALSE
+ *
+ * Since: 0.7.136
+ */
+gboolean
+ags_file_util_parse_id_xpath(gchar *xpath,
+			     gchar **node_name, gchar **id)
+{
+  gchar *name_start, *name_end;
+  gchar *id_start, *id_end;
+
+  if(xpath == NULL ||
+     !g_str_has_prefix(xpath, "xpath=//\0")){
+    return(FALSE);
+  }
+
+  name_start = &(xpath[8]);
+  name_end = strchr(name_start, '[');
+
+  if(name_end == NULL ||
+     name_end == name_start ||
+     !g_str_has_prefix(name_end, "[@id='\0")){
+    return(FALSE);
+  }
+
+  id_start = &(name_end[6]);
+  id_end = strchr(id_start, '\'');
+
+  if(id_end == NULL ||
+     id_end == id_start ||
+     strcmp(id_end, "']\0") != 0){
+    return(FALSE);
+  }
+
+  /* no nested expressions */
+  if(memchr(name_start, '/', name_end - name_start) != NULL ||
+     memchr(name_start, '@', name_end - name_start) != NULL){
+    return(FALSE);
+  }
+  
+  if(node_name != NULL){
+    if(name_end - name_start == 1 &&
+       name_start[0] == '*'){
+      *node_name = NULL;
+    }else{
+      *node_name = g_strndup(name_start,
+			     name_end - name_start);
+    }
+  }
+
+  if(id != NULL){
+    *id = g_strndup(id_start,
+		    id_end - id_start);
+  }
+  
+  return(TRUE);
+}
+
+/**
+ * ags_file_util_index_node_by_id:
+ * @node_by_id: the #GHashTable mapping id to #xmlNode
+ * @node: the #xmlNode to index recursively
+ *
+ * Index all element nodes having an id property below and including @node.
+ * The first node in document order wins. The keys are allocated by libxml2
+ * so use xmlFree() as key destroy function.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_file_util_index_node_by_id(GHashTable *node_by_id,
+			       xmlNode *node)
+{
+  xmlChar *id;
+  
+  while(node != NULL){
+    if(node->type == XML_ELEMENT_NODE){
+      id = xmlGetProp(node,
+		      AGS_FILE_ID_PROP);
+
+      if(id != NULL){
+	if(g_hash_table_lookup(node_by_id,
+			       id) == NULL){
+	  g_hash_table_insert(node_by_id,
+			      id,
+			      node);
+	}else{
+	  xmlFree(id);
+	}
+      }
+
+      if(node->children != NULL){
+	ags_file_util_index_node_by_id(node_by_id,
+				       node->children);
+      }
+    }
+
+    node = node->next;
+  }
+}
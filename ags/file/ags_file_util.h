@@ -79,4 +79,10 @@ xmlNode* ags_file_write_file_link(AgsFile *file, xmlNode *parent, AgsFileLink *f
 void ags_file_read_file_link_list(AgsFile *file, xmlNode *node, GList **file_link);
 xmlNode* ags_file_write_file_link_list(AgsFile *file, xmlNode *parent, GList *file_link);
 
+/* id index */
+gboolean ags_file_util_parse_id_xpath(gchar *xpath,
+				      gchar **node_name, gchar **id);
+void ags_file_util_index_node_by_id(GHashTable *node_by_id,
+				    xmlNode *node);
+
 #endif /*__AGS_FILE_UTIL_H__*/
@@ -29,6 +29,7 @@
 #include <pthread.h>
 
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
 #include <libxml/parser.h>
@@ -42,8 +43,14 @@
  * @section_id:
  * @include: ags/lib/ags_turtle.h
  *
- * The #AgsTurtle object converts Terse RDF Triple Language files
- * into XML.
+ * The #AgsTurtle object reads Terse RDF Triple Language files.
+ *
+ * All triples are kept in an index of interned strings, prefixed names
+ * are expanded to their IRI. Use ags_turtle_find_triple(),
+ * ags_turtle_find_object() or ags_turtle_find_subject() for lookups.
+ *
+ * The XML representation is only built on demand by ags_turtle_export_doc()
+ * or the first XPath lookup.
  */
 
 void ags_turtle_class_init(AgsTurtleClass *turtle);
@@ -58,6 +65,54 @@ void ags_turtle_get_property(GObject *gobject,
 			     GParamSpec *param_spec);
 void ags_turtle_finalize(GObject *gobject);
 
+gchar* ags_turtle_index_new_blank_node(AgsTurtle *turtle);
+void ags_turtle_index_add_triple(AgsTurtle *turtle,
+				 gchar *subject,
+				 gchar *predicate,
+				 gchar *object);
+
+gchar* ags_turtle_map_file(AgsTurtle *turtle,
+			   struct stat *sb,
+			   gboolean *is_mapped);
+void ags_turtle_unmap_file(gchar *buffer,
+			   struct stat *sb,
+			   gboolean is_mapped);
+
+void ags_turtle_regex_init();
+
+guint ags_turtle_scan_regex(guint regex,
+			    gchar *offset,
+			    gchar *end_ptr);
+guint ags_turtle_scan_pname_ns(gchar *offset,
+			       gchar *end_ptr);
+guint ags_turtle_scan_pname_ln(gchar *offset,
+			       gchar *end_ptr);
+guint ags_turtle_scan_blank_node_label(gchar *offset,
+				       gchar *end_ptr);
+guint ags_turtle_scan_string(gchar *offset,
+			     gchar *end_ptr);
+guint ags_turtle_scan_string_literal_long(gchar *offset,
+					  gchar *end_ptr,
+					  gchar *delimiter);
+guint ags_turtle_scan_pn_chars_u(gchar *offset,
+				 gchar *end_ptr);
+guint ags_turtle_scan_pn_chars(gchar *offset,
+			       gchar *end_ptr);
+guint ags_turtle_scan_pn_prefix(gchar *offset,
+				gchar *end_ptr);
+guint ags_turtle_scan_pn_local(gchar *offset,
+			       gchar *end_ptr);
+guint ags_turtle_scan_plx(gchar *offset,
+			  gchar *end_ptr);
+guint ags_turtle_scan_percent(gchar *offset,
+			      gchar *end_ptr);
+guint ags_turtle_scan_pn_local_esc(gchar *offset,
+				   gchar *end_ptr);
+
+gchar* ags_turtle_expand_pname_len(AgsTurtle *turtle,
+				   gchar *pname,
+				   gsize length);
+
 enum{
   PROP_0,
   PROP_FILENAME,
@@ -66,6 +121,77 @@ enum{
 
 static gpointer ags_turtle_parent_class = NULL;
 
+#define AGS_TURTLE_UTF8_RANGE_0 "([A-Za-z])"
+#define AGS_TURTLE_UTF8_RANGE_1 "(\xC3[\x80-\x96])"
+#define AGS_TURTLE_UTF8_RANGE_2 "(\xC3[\x98-\xB6])"
+#define AGS_TURTLE_UTF8_RANGE_3 "((\xC3[\xB8-\xBF])|([\xC3-\xCA][\x80-\xBF])|(\xCB[\x80-\xBF]))"
+#define AGS_TURTLE_UTF8_RANGE_4 "(\xCD[\xB0-\xBD])"
+#define AGS_TURTLE_UTF8_RANGE_5 "((\xCD[\xBF-\xDF])|([\xCE-\xDF][\x80-\xBF])|([\xE0-\xE1][\x80-\xBF][\x80-\xBF]))"
+#define AGS_TURTLE_UTF8_RANGE_6 "(\xE2\x80[\x8C-\x8D])"
+#define AGS_TURTLE_UTF8_RANGE_7 "((\xE2\x81[\xB0-\xBF])|(\xE2[\x81-\x85][\x80-\xBF])|(\xE2\x86[\x80-\x8F]))"
+#define AGS_TURTLE_UTF8_RANGE_8 "((\xE2[\xB0-\xBE][\x80-\xBF])|(\xE2\xBF[\x80-\xAF]))"
+#define AGS_TURTLE_UTF8_RANGE_9 "((\xE3[\x80-\xBF][\x81-\xBF])|([\xE4-\xEC][\x80-\x9F][\x80-\xBF]))"
+#define AGS_TURTLE_UTF8_RANGE_10 "((\xEF[\xA4-\xB6][\x80-\xBF])|(\xEF\xB7[\x80-\x8F]))"
+#define AGS_TURTLE_UTF8_RANGE_11 "((\xEF\xB7[\xB0-\xBF])|(\xEF[\xB8-\xBE][\x80-\xBF])|(\xEF\xBF[\x80-\xBD]))"
+#define AGS_TURTLE_UTF8_RANGE_12 "(([\xF0-\xF3][\x90-\xAF][\x80-\xBF][\x80-\xBF]))"
+
+#define AGS_TURTLE_UTF8_RANGE_ALL "(" AGS_TURTLE_UTF8_RANGE_0 "|" \
+  AGS_TURTLE_UTF8_RANGE_1 "|" \
+  AGS_TURTLE_UTF8_RANGE_2 "|" \
+  AGS_TURTLE_UTF8_RANGE_3 "|" \
+  AGS_TURTLE_UTF8_RANGE_4 "|" \
+  AGS_TURTLE_UTF8_RANGE_5 "|" \
+  AGS_TURTLE_UTF8_RANGE_6 "|" \
+  AGS_TURTLE_UTF8_RANGE_7 "|" \
+  AGS_TURTLE_UTF8_RANGE_8 "|" \
+  AGS_TURTLE_UTF8_RANGE_9 "|" \
+  AGS_TURTLE_UTF8_RANGE_10 "|" \
+  AGS_TURTLE_UTF8_RANGE_11 "|" \
+  AGS_TURTLE_UTF8_RANGE_12 ")"
+
+#define AGS_TURLTE_UTF8_RANGE_ALL_PATTERN "^" AGS_TURTLE_UTF8_RANGE_ALL
+
+enum{
+  AGS_TURTLE_REGEX_IRIREF = 0,
+  AGS_TURTLE_REGEX_LANGTAG,
+  AGS_TURTLE_REGEX_BOOLEAN_LITERAL,
+  AGS_TURTLE_REGEX_INTEGER_LITERAL,
+  AGS_TURTLE_REGEX_DECIMAL_LITERAL,
+  AGS_TURTLE_REGEX_DOUBLE_LITERAL,
+  AGS_TURTLE_REGEX_EXPONENT_LITERAL,
+  AGS_TURTLE_REGEX_STRING_LITERAL_DOUBLE_QUOTE,
+  AGS_TURTLE_REGEX_STRING_LITERAL_SINGLE_QUOTE,
+  AGS_TURTLE_REGEX_PN_CHARS_BASE,
+  AGS_TURTLE_REGEX_PN_CHARS,
+  AGS_TURTLE_REGEX_PREFIX_ID,
+  AGS_TURTLE_REGEX_BASE,
+  AGS_TURTLE_REGEX_SPARQL_PREFIX,
+  AGS_TURTLE_REGEX_SPARQL_BASE,
+  AGS_TURTLE_REGEX_LAST,
+};
+
+static const gchar *ags_turtle_regex_pattern[] = {
+  //FIXME:JK: do like in specs explained
+  "^(<([^>\x20]*)>)\0",
+  "^(@[a-zA-Z]+(-[a-zA-Z0-9]+)*)\0",
+  "^(true|false)\0",
+  "^([+-]?[0-9]+)\0",
+  "^([\\+\\-]?[0-9]*\\.[0-9]+)\0",
+  "^([\\+\\-]?(([0-9]+\\.[0-9]*[eE][\\+\\-]?[0-9]+)|(\\.[0-9]+[eE][\\+\\-]?[0-9]+)|([0-9]+[eE][+-]?[0-9]+)))\0",
+  "^([eE][+-]?[0-9]+)\0",
+  "^(\"((([\\\\]['])|[^\"])*)\")\0",
+  "^('((([\\\\]['])|[^'])*)')\0",
+  AGS_TURLTE_UTF8_RANGE_ALL_PATTERN,
+  "^(([0-9])|(\xC2\xB7)|((\xCC[\x80-\xBF])|(\xCD[\x80-\xAF]))|((\xE2\x80\xBF)|(\xE2\x81\x80)))\0",
+  "^(@prefix)\0",
+  "^(@base)\0",
+  "^(\"PREFIX\")\0",
+  "^(\"BASE\")\0",
+};
+
+static pthread_once_t ags_turtle_regex_once = PTHREAD_ONCE_INIT;
+static regex_t ags_turtle_regex[AGS_TURTLE_REGEX_LAST];
+
 GType
 ags_turtle_get_type(void)
 {
@@ -150,6 +276,25 @@ ags_turtle_init(AgsTurtle *turtle)
   turtle->filename = NULL;
 
   turtle->doc = NULL;
+
+  /* triple index */
+  turtle->string_chunk = g_string_chunk_new(4096);
+  turtle->string_table = g_hash_table_new(g_str_hash,
+					  g_str_equal);
+  turtle->scratch = g_string_sized_new(256);
+
+  turtle->prefix = g_hash_table_new(g_str_hash,
+				    g_str_equal);
+  turtle->n_blank_node = 0;
+  
+  turtle->triple = NULL;
+
+  turtle->subject_index = g_hash_table_new(g_direct_hash,
+					   g_direct_equal);
+  turtle->predicate_index = g_hash_table_new(g_direct_hash,
+					     g_direct_equal);
+  turtle->object_index = g_hash_table_new(g_direct_hash,
+					  g_direct_equal);
 }
 
 void
@@ -226,7 +371,15 @@ void
 ags_turtle_finalize(GObject *gobject)
 {
   AgsTurtle *turtle;
+
+  GHashTable *index[3];
+  GHashTableIter iter;
+
+  gpointer list;
+  
   gchar **str;
+
+  guint i;
   
   turtle = AGS_TURTLE(gobject);
 
@@ -237,243 +390,171 @@ ags_turtle_finalize(GObject *gobject)
   if(turtle->doc != NULL){
     xmlFreeDoc(turtle->doc);
   }
+
+  /* triple index */
+  index[0] = turtle->subject_index;
+  index[1] = turtle->predicate_index;
+  index[2] = turtle->object_index;
+  
+  for(i = 0; i < 3; i++){
+    g_hash_table_iter_init(&iter,
+			   index[i]);
+
+    while(g_hash_table_iter_next(&iter,
+				 NULL,
+				 &list)){
+      g_list_free(list);
+    }
+
+    g_hash_table_destroy(index[i]);
+  }
+
+  g_list_free_full(turtle->triple,
+		   free);
+  
+  g_hash_table_destroy(turtle->prefix);
+  g_hash_table_destroy(turtle->string_table);
+
+  g_string_chunk_free(turtle->string_chunk);
+  g_string_free(turtle->scratch,
+		TRUE);
   
   /* call parent */
   G_OBJECT_CLASS(ags_turtle_parent_class)->finalize(gobject);
 }
 
-/**
- * ags_turtle_read_iriref:
- * @offset: the string pointer
- * @end_ptr: the end of @offset
- *
- * Read iriref value.
- *
- * Returns: a string on success otherwise %NULL
- * 
- * Since: 0.7.4
- */
-gchar*
-ags_turtle_read_iriref(gchar *offset,
-		       gchar *end_ptr)
+void
+ags_turtle_regex_init()
+{
+  guint i;
+
+  for(i = 0; i < AGS_TURTLE_REGEX_LAST; i++){
+    if(regcomp(&(ags_turtle_regex[i]), ags_turtle_regex_pattern[i], REG_EXTENDED)){
+      g_warning("failed to compile regex: %s\0", ags_turtle_regex_pattern[i]);
+    }
+  }
+}
+
+guint
+ags_turtle_scan_regex(guint regex,
+		      gchar *offset,
+		      gchar *end_ptr)
 {
   regmatch_t match_arr[1];
-    
-  gchar *str;
 
-  static regex_t iriref_regex;
-    
-  static gboolean regex_compiled = FALSE;
+  if(offset == NULL ||
+     offset >= end_ptr){
+    return(0);
+  }
 
-  //FIXME:JK: do like in specs explained
-  static const gchar *iriref_pattern = "^(<([^>\x20]*)>)\0";
+  pthread_once(&ags_turtle_regex_once,
+	       ags_turtle_regex_init);
 
-  static const size_t max_matches = 1;
+#ifdef REG_STARTEND
+  /* if end_ptr is the terminating NUL, pass the range, otherwise regexec() measures the remaining buffer on every call */
+  if(*end_ptr == '\0'){
+    match_arr[0].rm_so = 0;
+    match_arr[0].rm_eo = end_ptr - offset;
   
-  str = NULL;
+    if(regexec(&(ags_turtle_regex[regex]), offset, 1, match_arr, REG_STARTEND) != 0){
+      return(0);
+    }
 
-  if(!regex_compiled){
-    regex_compiled = TRUE;
-    
-    regcomp(&iriref_regex, iriref_pattern, REG_EXTENDED);
+    return(match_arr[0].rm_eo - match_arr[0].rm_so);
   }
-
-  if(regexec(&iriref_regex, offset, max_matches, match_arr, 0) == 0){
-    str = g_strndup(offset,
-		    match_arr[0].rm_eo - match_arr[0].rm_so);
-
-#ifdef AGS_DEBUG
-    g_message("iriref %s\0", str);
 #endif
+
+  if(regexec(&(ags_turtle_regex[regex]), offset, 1, match_arr, 0) != 0){
+    return(0);
   }
-  
-  return(str);
+
+  return(match_arr[0].rm_eo - match_arr[0].rm_so);
 }
 
-/**
- * ags_turtle_read_pname_ns:
- * @offset: the string pointer
- * @end_ptr: the end of @offset
- *
- * Read prefixed-name namespace value.
- *
- * Returns: a string on success otherwise %NULL
- * 
- * Since: 0.7.4
- */
-gchar*
-ags_turtle_read_pname_ns(gchar *offset,
+guint
+ags_turtle_scan_pname_ns(gchar *offset,
 			 gchar *end_ptr)
 {
-  gchar *pn_prefix;
-  gchar *str;
+  guint length;
 
-  pn_prefix = ags_turtle_read_pn_prefix(offset,
-					end_ptr);
+  length = ags_turtle_scan_pn_prefix(offset,
+				     end_ptr);
 
-  if(pn_prefix != NULL &&
-     &(offset[strlen(pn_prefix)]) < end_ptr &&
-     offset[strlen(pn_prefix)] == ':'){
-    str = g_strdup_printf("%s:\0",
-			  pn_prefix);
-  }else{
-    if(offset[0] == ':'){
-      str = g_strdup(":\0");
-    }else{
-      str = NULL;
-    }
+  if(length > 0 &&
+     offset + length < end_ptr &&
+     offset[length] == ':'){
+    return(length + 1);
   }
 
-  if(pn_prefix != NULL){
-    free(pn_prefix);
+  if(offset < end_ptr &&
+     offset[0] == ':'){
+    return(1);
   }
-  
-  return(str);
+
+  return(0);
 }
 
-/**
- * ags_turtle_read_pname_ln:
- * @offset: the string pointer
- * @end_ptr: the end of @offset
- *
- * Read prefixed-name localized name value.
- *
- * Returns: a string on success otherwise %NULL
- * 
- * Since: 0.7.4
- */
-gchar*
-ags_turtle_read_pname_ln(gchar *offset,
+guint
+ags_turtle_scan_pname_ln(gchar *offset,
 			 gchar *end_ptr)
 {
-  gchar *pname_ns, *pn_local;
-  gchar *str;
-
-  str = NULL;
+  guint length, local_length;
 
-  pname_ns = ags_turtle_read_pname_ns(offset,
-				      end_ptr);
-  pn_local = NULL;
-  
-  if(pname_ns != NULL){
-    offset += strlen(pname_ns);
-    
-    pn_local = ags_turtle_read_pn_local(offset,
-					end_ptr);
+  length = ags_turtle_scan_pname_ns(offset,
+				    end_ptr);
 
-    if(pn_local != NULL){
-      str = g_strdup_printf("%s%s\0",
-			    pname_ns,
-			    pn_local);
-    }
+  if(length == 0){
+    return(0);
   }
 
-  if(pname_ns != NULL){
-    free(pname_ns);
-  }
+  local_length = ags_turtle_scan_pn_local(offset + length,
+					  end_ptr);
 
-  if(pn_local != NULL){
-    free(pn_local);
+  if(local_length == 0){
+    return(0);
   }
   
-  return(str);
+  return(length + local_length);
 }
 
-/**
- * ags_turtle_read_blank_node_label:
- * @offset: the string pointer
- * @end_ptr: the end of @offset
- *
- * Read blank node label value.
- *
- * Returns: a string on success otherwise %NULL
- * 
- * Since: 0.7.4
- */
-gchar*
-ags_turtle_read_blank_node_label(gchar *offset,
+guint
+ags_turtle_scan_blank_node_label(gchar *offset,
 				 gchar *end_ptr)
 {
-  gchar *str;
-  gchar *tmp, *tmp_str;
-  
-  gboolean initial_find, found_str;
+  guint length, n_chars;
   gboolean last_is_point;
   
-  if(offset + 2 >= end_ptr){
-    return(NULL);
+  if(offset + 2 >= end_ptr ||
+     offset[0] != '_' ||
+     offset[1] != ':'){
+    return(0);
   }
-  
-  str = NULL;
-
-  tmp_str = NULL;
 
-  if(!g_str_has_prefix(offset,
-		       "_:\0")){
-    return(NULL);
-  }
-  
-  if((tmp = ags_turtle_read_pn_chars_u(offset + 2,
-				       end_ptr)) != NULL ||
-     g_ascii_isdigit(offset[2])){
-    if(tmp == NULL){
-      str = g_strdup_printf("_:%c\0", offset[2]);
-      offset += 3;
-    }else{
-      str = g_strdup_printf("_:%s\0", tmp);
-      offset += (2 + strlen(tmp));
-	
-      free(tmp);
+  if((length = ags_turtle_scan_pn_chars_u(offset + 2,
+					  end_ptr)) == 0){
+    if(!g_ascii_isdigit(offset[2])){
+      return(0);
     }
-  }
-  
-  initial_find = TRUE;
-  found_str = FALSE;
-  
-  last_is_point = FALSE;
-    
-  while(initial_find ||
-	found_str){
-    initial_find = FALSE;
-    found_str = FALSE;
-    
-    last_is_point = FALSE;
-
-    tmp = ags_turtle_read_pn_chars(offset,
-				   end_ptr);
 
-    if(tmp == NULL){
-      if(*offset == '.'){
-	tmp_str = g_strdup_printf("%s.\0",
-				  str);
+    length = 1;
+  }
 
-	free(str);
+  length += 2;
+  last_is_point = FALSE;
+  
+  while(TRUE){
+    if((n_chars = ags_turtle_scan_pn_chars(offset + length,
+					   end_ptr)) > 0){
+      length += n_chars;
 
-	str = tmp_str;
+      last_is_point = FALSE;
+    }else if(offset + length < end_ptr &&
+	     offset[length] == '.'){
+      length++;
 
-	offset++;
-	
-	found_str = TRUE;
-	
-	last_is_point = TRUE;
-      }else{
-	if(initial_find){
-	  return(NULL);
-	}else{
-	  break;
-	}
-      }
+      last_is_point = TRUE;
     }else{
-      tmp_str = g_strdup_printf("%s%s\0",
-				str, tmp);
-      offset += strlen(tmp);
-      
-      free(str);
-      free(tmp);
-
-      str = tmp_str;
-      
-      found_str = TRUE;
+      break;
     }
   }
 
@@ -481,357 +562,421 @@ ags_turtle_read_blank_node_label(gchar *offset,
     g_warning("ags_turtle.c - syntax error\0");
   }
   
-  return(str);
+  return(length);
 }
 
-/**
- * ags_turtle_read_langtag:
- * @offset: the string pointer
- * @end_ptr: the end of @offset
- *
- * Read langtag value.
- *
- * Returns: a string on success otherwise %NULL
- * 
- * Since: 0.7.4
- */
-gchar*
-ags_turtle_read_langtag(gchar *offset,
-			gchar *end_ptr)
+guint
+ags_turtle_scan_string(gchar *offset,
+		       gchar *end_ptr)
 {
-  regmatch_t match_arr[1];
-  
-  gchar *str;
+  guint length;
+
+  if((length = ags_turtle_scan_string_literal_long(offset,
+						   end_ptr,
+						   "\"\"\"\0")) == 0 &&
+     (length = ags_turtle_scan_string_literal_long(offset,
+						   end_ptr,
+						   "'''\0")) == 0 &&
+     (length = ags_turtle_scan_regex(AGS_TURTLE_REGEX_STRING_LITERAL_DOUBLE_QUOTE,
+				     offset,
+				     end_ptr)) == 0){
+    length = ags_turtle_scan_regex(AGS_TURTLE_REGEX_STRING_LITERAL_SINGLE_QUOTE,
+				   offset,
+				   end_ptr);
+  }
 
-  static regex_t langtag_regex;
+  return(length);
+}
 
-  static gboolean regex_compiled = FALSE;
-    
-  static const char *langtag_pattern = "^(@[a-zA-Z]+(-[a-zA-Z0-9]+)*)\0";
-  
-  static const size_t max_matches = 1;
-  
-  str = NULL;
+guint
+ags_turtle_scan_string_literal_long(gchar *offset,
+				    gchar *end_ptr,
+				    gchar *delimiter)
+{
+  gchar *end;
 
-  if(!regex_compiled){
-    regex_compiled = TRUE;
-      
-    regcomp(&langtag_regex, langtag_pattern, REG_EXTENDED);
+  if(!g_str_has_prefix(offset,
+		       delimiter)){
+    return(0);
   }
 
-  if(regexec(&langtag_regex, offset, max_matches, match_arr, 0) == 0){
-    if(match_arr[0].rm_eo > match_arr[0].rm_so){
-      str = g_strndup(offset,
-		      match_arr[0].rm_eo - match_arr[0].rm_so);
-    }
+  end = offset + 3;
+    
+  while((end = strstr(end,
+		      delimiter)) != NULL &&
+	*(end - 1) == '\\'){
+    end++;
   }
-  
-  return(str);
+
+  if(end == NULL){
+    return(0);
+  }
+
+  return(end - offset + 3);
 }
 
-/**
- * ags_turtle_read_boolean:
- * @offset: the string pointer
- * @end_ptr: the end of @offset
- *
- * Read boolean value.
- *
- * Returns: a string on success otherwise %NULL
- * 
- * Since: 0.7.4
- */
-gchar*
-ags_turtle_read_boolean(gchar *offset,
-			gchar *end_ptr)
+guint
+ags_turtle_scan_pn_chars_u(gchar *offset,
+			   gchar *end_ptr)
 {
-  regmatch_t match_arr[1];
-  
-  gchar *str;
-  
-  static regex_t boolean_literal_regex;
+  guint length;
 
-  static gboolean regex_compiled = FALSE;
-    
-  static const char *boolean_literal_pattern = "^(true|false)\0";
+  length = ags_turtle_scan_regex(AGS_TURTLE_REGEX_PN_CHARS_BASE,
+				 offset,
+				 end_ptr);
 
-  static const size_t max_matches = 1;
+  if(length == 0 &&
+     offset < end_ptr &&
+     *offset == '_'){
+    length = 1;
+  }
+
+  return(length);
+}
+
+guint
+ags_turtle_scan_pn_chars(gchar *offset,
+			 gchar *end_ptr)
+{
+  guint length;
+
+  length = ags_turtle_scan_pn_chars_u(offset,
+				      end_ptr);
+
+  if(length == 0 &&
+     offset < end_ptr &&
+     *offset == '-'){
+    length = 1;
+  }
+
+  if(length == 0){
+    length = ags_turtle_scan_regex(AGS_TURTLE_REGEX_PN_CHARS,
+				   offset,
+				   end_ptr);
+  }
+
+  return(length);
+}
+
+guint
+ags_turtle_scan_pn_prefix(gchar *offset,
+			  gchar *end_ptr)
+{
+  guint length, n_chars;
+
+  length = ags_turtle_scan_regex(AGS_TURTLE_REGEX_PN_CHARS_BASE,
+				 offset,
+				 end_ptr);
+
+  if(length == 0){
+    return(0);
+  }
+
+  while(TRUE){
+    if((n_chars = ags_turtle_scan_pn_chars(offset + length,
+					   end_ptr)) > 0){
+      length += n_chars;
+    }else if(offset + length < end_ptr &&
+	     offset[length] == '.'){
+      length++;
+    }else{
+      break;
+    }
+  }
   
-  str = NULL;
+  return(length);
+}
 
-  if(!regex_compiled){
-    regex_compiled = TRUE;
-      
-    regcomp(&boolean_literal_regex, boolean_literal_pattern, REG_EXTENDED);
+guint
+ags_turtle_scan_pn_local(gchar *offset,
+			 gchar *end_ptr)
+{
+  gchar *current;
+  
+  guint length, n_chars;
+
+  if(offset >= end_ptr){
+    return(0);
   }
 
-  if(regexec(&boolean_literal_regex, offset, max_matches, match_arr, 0) == 0){
-    str = g_strndup(offset,
-		    match_arr[0].rm_eo - match_arr[0].rm_so);
+  length = ags_turtle_scan_pn_chars_u(offset,
+				      end_ptr);
+
+  if(length == 0){
+    if(*offset == ':' ||
+       g_ascii_isdigit(*offset)){
+      length = 1;
+    }else{
+      length = ags_turtle_scan_plx(offset,
+				   end_ptr);
+    }
+  }
+
+  if(length == 0){
+    return(0);
   }
   
-  return(str);
+  while(TRUE){
+    current = offset + length;
+    
+    n_chars = ags_turtle_scan_pn_chars(current,
+				       end_ptr);
+
+    if(n_chars == 0){
+      if(current < end_ptr &&
+	 (*current == '.' ||
+	  *current == ':')){
+	n_chars = 1;
+      }else{
+	n_chars = ags_turtle_scan_plx(current,
+				      end_ptr);
+      }
+    }
+
+    if(n_chars == 0){
+      break;
+    }
+
+    length += n_chars;
+  }
+  
+  return(length);
+}
+
+guint
+ags_turtle_scan_plx(gchar *offset,
+		    gchar *end_ptr)
+{
+  guint length;
+
+  length = ags_turtle_scan_percent(offset,
+				   end_ptr);
+
+  if(length == 0){
+    length = ags_turtle_scan_pn_local_esc(offset,
+					  end_ptr);
+  }
+
+  return(length);
+}
+
+guint
+ags_turtle_scan_percent(gchar *offset,
+			gchar *end_ptr)
+{
+  if(offset != NULL &&
+     offset + 2 < end_ptr &&
+     offset[0] == '%' &&
+     g_ascii_isxdigit(offset[1]) &&
+     g_ascii_isxdigit(offset[2])){
+    return(3);
+  }
+
+  return(0);
+}
+
+guint
+ags_turtle_scan_pn_local_esc(gchar *offset,
+			     gchar *end_ptr)
+{
+  static const gchar *escapes = "_~.-!$&'()*+,;=/?#@%\0";
+
+  if(offset != NULL &&
+     offset + 1 < end_ptr &&
+     *offset == '\\' &&
+     (index(escapes,
+	    offset[1])) != NULL){
+    return(2);
+  }
+
+  return(0);
 }
 
 /**
- * ags_turtle_read_integer:
+ * ags_turtle_read_iriref:
  * @offset: the string pointer
  * @end_ptr: the end of @offset
  *
- * Read integer value.
+ * Read iriref value.
  *
  * Returns: a string on success otherwise %NULL
  * 
  * Since: 0.7.4
  */
 gchar*
-ags_turtle_read_integer(gchar *offset,
-			gchar *end_ptr)
+ags_turtle_read_iriref(gchar *offset,
+		       gchar *end_ptr)
 {
   regmatch_t match_arr[1];
-  
-  gchar *str;
-  
-  static regex_t integer_literal_regex;
-
-  static gboolean regex_compiled = FALSE;
     
-  static const char *integer_literal_pattern = "^([+-]?[0-9]+)\0";
+  gchar *str;
 
   static const size_t max_matches = 1;
   
   str = NULL;
 
-  if(!regex_compiled){
-    regex_compiled = TRUE;
-      
-    regcomp(&integer_literal_regex, integer_literal_pattern, REG_EXTENDED);
-  }
+  pthread_once(&ags_turtle_regex_once,
+	       ags_turtle_regex_init);
 
-  if(regexec(&integer_literal_regex, offset, max_matches, match_arr, 0) == 0){
+  if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_IRIREF]), offset, max_matches, match_arr, 0) == 0){
     str = g_strndup(offset,
 		    match_arr[0].rm_eo - match_arr[0].rm_so);
+
+#ifdef AGS_DEBUG
+    g_message("iriref %s\0", str);
+#endif
   }
   
   return(str);
 }
 
 /**
- * ags_turtle_read_decimal:
+ * ags_turtle_read_pname_ns:
  * @offset: the string pointer
  * @end_ptr: the end of @offset
  *
- * Read decimal value.
+ * Read prefixed-name namespace value.
  *
  * Returns: a string on success otherwise %NULL
  * 
  * Since: 0.7.4
  */
 gchar*
-ags_turtle_read_decimal(gchar *offset,
-			gchar *end_ptr)
+ags_turtle_read_pname_ns(gchar *offset,
+			 gchar *end_ptr)
 {
-  regmatch_t match_arr[1];
-  
-  gchar *str;
+  guint length;
 
-  static regex_t decimal_literal_regex;
-
-  static gboolean regex_compiled = FALSE;
-
-  static const char *decimal_literal_pattern = "^([\\+\\-]?[0-9]*\\.[0-9]+)\0";
-
-  static const size_t max_matches = 1;
-    
-  str = NULL;
+  length = ags_turtle_scan_pname_ns(offset,
+				    end_ptr);
 
-  if(!regex_compiled){
-    regex_compiled = TRUE;
-      
-    regcomp(&decimal_literal_regex, decimal_literal_pattern, REG_EXTENDED);
+  if(length == 0){
+    return(NULL);
   }
 
-  if(regexec(&decimal_literal_regex, offset, max_matches, match_arr, 0) == 0){
-    str = g_strndup(offset,
-		    match_arr[0].rm_eo - match_arr[0].rm_so);
-  }
-  
-  return(str);
+  return(g_strndup(offset,
+		   length));
 }
 
 /**
- * ags_turtle_read_double:
+ * ags_turtle_read_pname_ln:
  * @offset: the string pointer
  * @end_ptr: the end of @offset
  *
- * Read double value.
+ * Read prefixed-name localized name value.
  *
  * Returns: a string on success otherwise %NULL
  * 
  * Since: 0.7.4
  */
 gchar*
-ags_turtle_read_double(gchar *offset,
-		       gchar *end_ptr)
+ags_turtle_read_pname_ln(gchar *offset,
+			 gchar *end_ptr)
 {
-  regmatch_t match_arr[1];
-  
-  gchar *str;
+  guint length;
 
-  static regex_t double_literal_regex;
-  
-  static gboolean regex_compiled = FALSE;
-  
-  static const char *double_literal_pattern = "^([\\+\\-]?(([0-9]+\\.[0-9]*[eE][\\+\\-]?[0-9]+)|(\\.[0-9]+[eE][\\+\\-]?[0-9]+)|([0-9]+[eE][+-]?[0-9]+)))\0";
-
-  static const size_t max_matches = 1;
-    
-  str = NULL;
+  length = ags_turtle_scan_pname_ln(offset,
+				    end_ptr);
 
-  if(!regex_compiled){
-    regex_compiled = TRUE;
-      
-    regcomp(&double_literal_regex, double_literal_pattern, REG_EXTENDED);
+  if(length == 0){
+    return(NULL);
   }
 
-  if(regexec(&double_literal_regex, offset, max_matches, match_arr, 0) == 0){
-    str = g_strndup(offset,
-		    match_arr[0].rm_eo - match_arr[0].rm_so);
-  }
-  
-  return(str);
+  return(g_strndup(offset,
+		   length));
 }
 
 /**
- * ags_turtle_read_exponent:
+ * ags_turtle_read_blank_node_label:
  * @offset: the string pointer
  * @end_ptr: the end of @offset
  *
- * Read exponent value.
+ * Read blank node label value.
  *
  * Returns: a string on success otherwise %NULL
  * 
  * Since: 0.7.4
  */
 gchar*
-ags_turtle_read_exponent(gchar *offset,
-			 gchar *end_ptr)
+ags_turtle_read_blank_node_label(gchar *offset,
+				 gchar *end_ptr)
 {
-  regmatch_t match_arr[1];
-  
-  gchar *str;
-
-  static regex_t exponent_literal_regex;
-
-  static gboolean regex_compiled = FALSE;
-  
-  static const char *exponent_literal_pattern = "^([eE][+-]?[0-9]+)\0";
-
-  static const size_t max_matches = 1;
-    
-  str = NULL;
+  guint length;
 
-  if(!regex_compiled){
-    regex_compiled = TRUE;
+  length = ags_turtle_scan_blank_node_label(offset,
+					    end_ptr);
 
-    regcomp(&exponent_literal_regex, exponent_literal_pattern, REG_EXTENDED);
+  if(length == 0){
+    return(NULL);
   }
 
-  if(regexec(&exponent_literal_regex, offset, max_matches, match_arr, 0) == 0){
-    str = g_strndup(offset,
-		    match_arr[0].rm_eo - match_arr[0].rm_so);
-  }
-  
-  return(str);
+  return(g_strndup(offset,
+		   length));
 }
 
 /**
- * ags_turtle_read_string:
+ * ags_turtle_read_langtag:
  * @offset: the string pointer
  * @end_ptr: the end of @offset
  *
- * Read string value.
+ * Read langtag value.
  *
  * Returns: a string on success otherwise %NULL
  * 
  * Since: 0.7.4
  */
 gchar*
-ags_turtle_read_string(gchar *offset,
-		       gchar *end_ptr)
+ags_turtle_read_langtag(gchar *offset,
+			gchar *end_ptr)
 {
+  regmatch_t match_arr[1];
+  
   gchar *str;
 
-  str = ags_turtle_read_string_literal_long_quote(offset,
-						  end_ptr);
+  static const size_t max_matches = 1;
   
-  if(str != NULL){
-    return(str);
-  }
+  str = NULL;
 
-  str = ags_turtle_read_string_literal_long_single_quote(offset,
-							 end_ptr);
-  
-  if(str != NULL){
-    return(str);
-  }
+  pthread_once(&ags_turtle_regex_once,
+	       ags_turtle_regex_init);
 
-  str = ags_turtle_read_string_literal_quote(offset,
-					     end_ptr);
-  
-  if(str != NULL){
-    return(str);
+  if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_LANGTAG]), offset, max_matches, match_arr, 0) == 0){
+    if(match_arr[0].rm_eo > match_arr[0].rm_so){
+      str = g_strndup(offset,
+		      match_arr[0].rm_eo - match_arr[0].rm_so);
+    }
   }
-
-  str = ags_turtle_read_string_literal_single_quote(offset,
-						    end_ptr);
   
-  if(str != NULL){
-    return(str);
-  }
-
-  return(NULL);
+  return(str);
 }
 
 /**
- * ags_turtle_read_string_literal_quote:
+ * ags_turtle_read_boolean:
  * @offset: the string pointer
  * @end_ptr: the end of @offset
  *
- * Read string literal quote value.
+ * Read boolean value.
  *
  * Returns: a string on success otherwise %NULL
  * 
  * Since: 0.7.4
  */
 gchar*
-ags_turtle_read_string_literal_quote(gchar *offset,
-				     gchar *end_ptr)
+ags_turtle_read_boolean(gchar *offset,
+			gchar *end_ptr)
 {
   regmatch_t match_arr[1];
   
   gchar *str;
 
-  static regex_t string_literal_double_quote_regex;
-
-  static gboolean regex_compiled = FALSE;
-  
-  static const char *string_literal_double_quote_pattern = "^(\"((([\\\\]['])|[^\"])*)\")\0";
-
   static const size_t max_matches = 1;
-
-  if(offset >= end_ptr){
-    return(NULL);
-  }
   
   str = NULL;
-  
-  if(!regex_compiled){
-    regex_compiled = TRUE;
-      
-    regcomp(&string_literal_double_quote_regex, string_literal_double_quote_pattern, REG_EXTENDED);
-  }
 
-  if(regexec(&string_literal_double_quote_regex, offset, max_matches, match_arr, 0) == 0){
+  pthread_once(&ags_turtle_regex_once,
+	       ags_turtle_regex_init);
+
+  if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_BOOLEAN_LITERAL]), offset, max_matches, match_arr, 0) == 0){
     str = g_strndup(offset,
 		    match_arr[0].rm_eo - match_arr[0].rm_so);
   }
@@ -840,45 +985,32 @@ ags_turtle_read_string_literal_quote(gchar *offset,
 }
 
 /**
- * ags_turtle_read_string_literal_single_quote:
+ * ags_turtle_read_integer:
  * @offset: the string pointer
  * @end_ptr: the end of @offset
  *
- * Read string literal single quote value.
+ * Read integer value.
  *
  * Returns: a string on success otherwise %NULL
  * 
  * Since: 0.7.4
  */
 gchar*
-ags_turtle_read_string_literal_single_quote(gchar *offset,
-					    gchar *end_ptr)
+ags_turtle_read_integer(gchar *offset,
+			gchar *end_ptr)
 {
   regmatch_t match_arr[1];
   
   gchar *str;
 
-  static regex_t string_literal_single_quote_regex;
-
-  static gboolean regex_compiled = FALSE;
-  
-  static const char *string_literal_single_quote_pattern = "^('((([\\\\]['])|[^'])*)')\0";
-
   static const size_t max_matches = 1;
-    
-  if(offset >= end_ptr){
-    return(NULL);
-  }
   
   str = NULL;
-  
-  if(!regex_compiled){
-    regex_compiled = TRUE;
-      
-    regcomp(&string_literal_single_quote_regex, string_literal_single_quote_pattern, REG_EXTENDED);
-  }
 
-  if(regexec(&string_literal_single_quote_regex, offset, max_matches, match_arr, 0) == 0){
+  pthread_once(&ags_turtle_regex_once,
+	       ags_turtle_regex_init);
+
+  if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_INTEGER_LITERAL]), offset, max_matches, match_arr, 0) == 0){
     str = g_strndup(offset,
 		    match_arr[0].rm_eo - match_arr[0].rm_so);
   }
@@ -887,43 +1019,240 @@ ags_turtle_read_string_literal_single_quote(gchar *offset,
 }
 
 /**
- * ags_turtle_read_string_literal_long_quote:
+ * ags_turtle_read_decimal:
  * @offset: the string pointer
  * @end_ptr: the end of @offset
  *
- * Read string literal long quote value.
+ * Read decimal value.
  *
  * Returns: a string on success otherwise %NULL
  * 
  * Since: 0.7.4
  */
 gchar*
-ags_turtle_read_string_literal_long_quote(gchar *offset,
-					  gchar *end_ptr)
+ags_turtle_read_decimal(gchar *offset,
+			gchar *end_ptr)
 {
-  gchar *str, *end;
-
+  regmatch_t match_arr[1];
+  
+  gchar *str;
+
+  static const size_t max_matches = 1;
+    
   str = NULL;
+
+  pthread_once(&ags_turtle_regex_once,
+	       ags_turtle_regex_init);
+
+  if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_DECIMAL_LITERAL]), offset, max_matches, match_arr, 0) == 0){
+    str = g_strndup(offset,
+		    match_arr[0].rm_eo - match_arr[0].rm_so);
+  }
   
-  if(g_str_has_prefix(offset,
-		      "\"\"\"\0")){
-    end = offset + 3;
+  return(str);
+}
+
+/**
+ * ags_turtle_read_double:
+ * @offset: the string pointer
+ * @end_ptr: the end of @offset
+ *
+ * Read double value.
+ *
+ * Returns: a string on success otherwise %NULL
+ * 
+ * Since: 0.7.4
+ */
+gchar*
+ags_turtle_read_double(gchar *offset,
+		       gchar *end_ptr)
+{
+  regmatch_t match_arr[1];
+  
+  gchar *str;
+
+  static const size_t max_matches = 1;
     
-    while((end = strstr(end,
-			"\"\"\"\0")) != NULL &&
-	  *(end - 1) == '\\'){
-      end++;
-    }
+  str = NULL;
 
-    if(end != NULL){
-      str = g_strndup(offset,
-		      end - offset + 3);
-    }
+  pthread_once(&ags_turtle_regex_once,
+	       ags_turtle_regex_init);
+
+  if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_DOUBLE_LITERAL]), offset, max_matches, match_arr, 0) == 0){
+    str = g_strndup(offset,
+		    match_arr[0].rm_eo - match_arr[0].rm_so);
+  }
+  
+  return(str);
+}
+
+/**
+ * ags_turtle_read_exponent:
+ * @offset: the string pointer
+ * @end_ptr: the end of @offset
+ *
+ * Read exponent value.
+ *
+ * Returns: a string on success otherwise %NULL
+ * 
+ * Since: 0.7.4
+ */
+gchar*
+ags_turtle_read_exponent(gchar *offset,
+			 gchar *end_ptr)
+{
+  regmatch_t match_arr[1];
+  
+  gchar *str;
+
+  static const size_t max_matches = 1;
+    
+  str = NULL;
+
+  pthread_once(&ags_turtle_regex_once,
+	       ags_turtle_regex_init);
+
+  if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_EXPONENT_LITERAL]), offset, max_matches, match_arr, 0) == 0){
+    str = g_strndup(offset,
+		    match_arr[0].rm_eo - match_arr[0].rm_so);
+  }
+  
+  return(str);
+}
+
+/**
+ * ags_turtle_read_string:
+ * @offset: the string pointer
+ * @end_ptr: the end of @offset
+ *
+ * Read string value.
+ *
+ * Returns: a string on success otherwise %NULL
+ * 
+ * Since: 0.7.4
+ */
+gchar*
+ags_turtle_read_string(gchar *offset,
+		       gchar *end_ptr)
+{
+  guint length;
+
+  length = ags_turtle_scan_string(offset,
+				  end_ptr);
+
+  if(length == 0){
+    return(NULL);
+  }
+
+  return(g_strndup(offset,
+		   length));
+}
+
+/**
+ * ags_turtle_read_string_literal_quote:
+ * @offset: the string pointer
+ * @end_ptr: the end of @offset
+ *
+ * Read string literal quote value.
+ *
+ * Returns: a string on success otherwise %NULL
+ * 
+ * Since: 0.7.4
+ */
+gchar*
+ags_turtle_read_string_literal_quote(gchar *offset,
+				     gchar *end_ptr)
+{
+  regmatch_t match_arr[1];
+  
+  gchar *str;
+
+  static const size_t max_matches = 1;
+
+  if(offset >= end_ptr){
+    return(NULL);
+  }
+  
+  str = NULL;
+  
+  pthread_once(&ags_turtle_regex_once,
+	       ags_turtle_regex_init);
+
+  if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_STRING_LITERAL_DOUBLE_QUOTE]), offset, max_matches, match_arr, 0) == 0){
+    str = g_strndup(offset,
+		    match_arr[0].rm_eo - match_arr[0].rm_so);
+  }
+  
+  return(str);
+}
+
+/**
+ * ags_turtle_read_string_literal_single_quote:
+ * @offset: the string pointer
+ * @end_ptr: the end of @offset
+ *
+ * Read string literal single quote value.
+ *
+ * Returns: a string on success otherwise %NULL
+ * 
+ * Since: 0.7.4
+ */
+gchar*
+ags_turtle_read_string_literal_single_quote(gchar *offset,
+					    gchar *end_ptr)
+{
+  regmatch_t match_arr[1];
+  
+  gchar *str;
+
+  static const size_t max_matches = 1;
+    
+  if(offset >= end_ptr){
+    return(NULL);
   }
+  
+  str = NULL;
+  
+  pthread_once(&ags_turtle_regex_once,
+	       ags_turtle_regex_init);
 
+  if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_STRING_LITERAL_SINGLE_QUOTE]), offset, max_matches, match_arr, 0) == 0){
+    str = g_strndup(offset,
+		    match_arr[0].rm_eo - match_arr[0].rm_so);
+  }
+  
   return(str);
 }
 
+/**
+ * ags_turtle_read_string_literal_long_quote:
+ * @offset: the string pointer
+ * @end_ptr: the end of @offset
+ *
+ * Read string literal long quote value.
+ *
+ * Returns: a string on success otherwise %NULL
+ * 
+ * Since: 0.7.4
+ */
+gchar*
+ags_turtle_read_string_literal_long_quote(gchar *offset,
+					  gchar *end_ptr)
+{
+  guint length;
+
+  length = ags_turtle_scan_string_literal_long(offset,
+					       end_ptr,
+					       "\"\"\"\0");
+
+  if(length == 0){
+    return(NULL);
+  }
+
+  return(g_strndup(offset,
+		   length));
+}
+
 /**
  * ags_turtle_read_string_literal_long_single_quote:
  * @offset: the string pointer
@@ -939,27 +1268,18 @@ gchar*
 ags_turtle_read_string_literal_long_single_quote(gchar *offset,
 						 gchar *end_ptr)
 {
-  gchar *str, *end;
+  guint length;
 
-  str = NULL;
-  
-  if(g_str_has_prefix(offset,
-		      "'''\0")){
-    end = offset + 3;
-    
-    while((end = strstr(end,
-			"'''\0")) != NULL &&
-	  *(end - 1) == '\\'){
-      end++;
-    }
+  length = ags_turtle_scan_string_literal_long(offset,
+					       end_ptr,
+					       "'''\0");
 
-    if(end != NULL){
-      str = g_strndup(offset,
-		      end - offset + 3);
-    }
+  if(length == 0){
+    return(NULL);
   }
 
-  return(str);
+  return(g_strndup(offset,
+		   length));
 }
 
 /**
@@ -1139,36 +1459,6 @@ ags_turtle_read_anon(gchar *offset,
   return(str);
 }
 
-#define AGS_TURTLE_UTF8_RANGE_0 "([A-Za-z])"
-#define AGS_TURTLE_UTF8_RANGE_1 "(\xC3[\x80-\x96])"
-#define AGS_TURTLE_UTF8_RANGE_2 "(\xC3[\x98-\xB6])"
-#define AGS_TURTLE_UTF8_RANGE_3 "((\xC3[\xB8-\xBF])|([\xC3-\xCA][\x80-\xBF])|(\xCB[\x80-\xBF]))"
-#define AGS_TURTLE_UTF8_RANGE_4 "(\xCD[\xB0-\xBD])"
-#define AGS_TURTLE_UTF8_RANGE_5 "((\xCD[\xBF-\xDF])|([\xCE-\xDF][\x80-\xBF])|([\xE0-\xE1][\x80-\xBF][\x80-\xBF]))"
-#define AGS_TURTLE_UTF8_RANGE_6 "(\xE2\x80[\x8C-\x8D])"
-#define AGS_TURTLE_UTF8_RANGE_7 "((\xE2\x81[\xB0-\xBF])|(\xE2[\x81-\x85][\x80-\xBF])|(\xE2\x86[\x80-\x8F]))"
-#define AGS_TURTLE_UTF8_RANGE_8 "((\xE2[\xB0-\xBE][\x80-\xBF])|(\xE2\xBF[\x80-\xAF]))"
-#define AGS_TURTLE_UTF8_RANGE_9 "((\xE3[\x80-\xBF][\x81-\xBF])|([\xE4-\xEC][\x80-\x9F][\x80-\xBF]))"
-#define AGS_TURTLE_UTF8_RANGE_10 "((\xEF[\xA4-\xB6][\x80-\xBF])|(\xEF\xB7[\x80-\x8F]))"
-#define AGS_TURTLE_UTF8_RANGE_11 "((\xEF\xB7[\xB0-\xBF])|(\xEF[\xB8-\xBE][\x80-\xBF])|(\xEF\xBF[\x80-\xBD]))"
-#define AGS_TURTLE_UTF8_RANGE_12 "(([\xF0-\xF3][\x90-\xAF][\x80-\xBF][\x80-\xBF]))"
-
-#define AGS_TURTLE_UTF8_RANGE_ALL "(" AGS_TURTLE_UTF8_RANGE_0 "|" \
-  AGS_TURTLE_UTF8_RANGE_1 "|" \
-  AGS_TURTLE_UTF8_RANGE_2 "|" \
-  AGS_TURTLE_UTF8_RANGE_3 "|" \
-  AGS_TURTLE_UTF8_RANGE_4 "|" \
-  AGS_TURTLE_UTF8_RANGE_5 "|" \
-  AGS_TURTLE_UTF8_RANGE_6 "|" \
-  AGS_TURTLE_UTF8_RANGE_7 "|" \
-  AGS_TURTLE_UTF8_RANGE_8 "|" \
-  AGS_TURTLE_UTF8_RANGE_9 "|" \
-  AGS_TURTLE_UTF8_RANGE_10 "|" \
-  AGS_TURTLE_UTF8_RANGE_11 "|" \
-  AGS_TURTLE_UTF8_RANGE_12 ")"
-
-#define AGS_TURLTE_UTF8_RANGE_ALL_PATTERN "^" AGS_TURTLE_UTF8_RANGE_ALL
-
 /**
  * ags_turtle_read_pn_chars_base:
  * @offset: the string pointer
@@ -1187,12 +1477,6 @@ ags_turtle_read_pn_chars_base(gchar *offset,
   regmatch_t match_arr[1];
     
   gchar *str;
-  
-  static regex_t chars_base_regex;
-    
-  static gboolean regex_compiled = FALSE;
-
-  static const char *chars_base_pattern = AGS_TURLTE_UTF8_RANGE_ALL_PATTERN;
 
   static const size_t max_matches = 1;
 
@@ -1203,15 +1487,10 @@ ags_turtle_read_pn_chars_base(gchar *offset,
 
   str = NULL;
 
-  if(!regex_compiled){
-    regex_compiled = TRUE;
-    
-    if(regcomp(&chars_base_regex, chars_base_pattern, REG_EXTENDED)){
-      g_warning("failed to compile regex: %s\0", chars_base_pattern);
-    }
-  }
+  pthread_once(&ags_turtle_regex_once,
+	       ags_turtle_regex_init);
 
-  if(regexec(&chars_base_regex, offset, max_matches, match_arr, 0) == 0){
+  if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_PN_CHARS_BASE]), offset, max_matches, match_arr, 0) == 0){
     str = g_strndup(offset,
 		    match_arr[0].rm_eo - match_arr[0].rm_so);
   }
@@ -1234,18 +1513,17 @@ gchar*
 ags_turtle_read_pn_chars_u(gchar *offset,
 			   gchar *end_ptr)
 {
-  gchar *str;
+  guint length;
 
-  str = ags_turtle_read_pn_chars_base(offset,
+  length = ags_turtle_scan_pn_chars_u(offset,
 				      end_ptr);
 
-  if(str == NULL &&
-     offset < end_ptr &&
-     *offset == '_'){
-    str = g_strdup("_\0");
+  if(length == 0){
+    return(NULL);
   }
-  
-  return(str);
+
+  return(g_strndup(offset,
+		   length));
 }
 
 /**
@@ -1263,43 +1541,18 @@ gchar*
 ags_turtle_read_pn_chars(gchar *offset,
 			 gchar *end_ptr)
 {
-  regmatch_t match_arr[1];
-    
-  gchar *str;
-  
-  static regex_t chars_regex;
-    
-  static gboolean regex_compiled = FALSE;
-  
-  static const char *chars_pattern = "^(([0-9])|(\xC2\xB7)|((\xCC[\x80-\xBF])|(\xCD[\x80-\xAF]))|((\xE2\x80\xBF)|(\xE2\x81\x80)))\0";
-
-  static const size_t max_matches = 1;
+  guint length;
 
-  str = ags_turtle_read_pn_chars_u(offset,
-				   end_ptr);
+  length = ags_turtle_scan_pn_chars(offset,
+				    end_ptr);
 
-  if(str == NULL &&
-     offset < end_ptr &&
-     *offset == '-'){
-    str = g_strdup("-\0");
+  if(length == 0){
+    return(NULL);
   }
 
-  if(str == NULL &&
-     offset < end_ptr){
-    if(!regex_compiled){
-      regex_compiled = TRUE;
-    
-      regcomp(&chars_regex, chars_pattern, REG_EXTENDED);
-    }
-
-    if(regexec(&chars_regex, offset, max_matches, match_arr, 0) == 0){
-      str = g_strndup(offset,
-		      match_arr[0].rm_eo - match_arr[0].rm_so);
-    }
-  }
-  
-  return(str);
-}
+  return(g_strndup(offset,
+		   length));
+}
 
 /**
  * ags_turtle_read_pn_prefix:
@@ -1316,54 +1569,17 @@ gchar*
 ags_turtle_read_pn_prefix(gchar *offset,
 			  gchar *end_ptr)
 {
-  gchar *str;
-  gchar *tmp, *str_tmp;
+  guint length;
 
-  gboolean last_is_point;
+  length = ags_turtle_scan_pn_prefix(offset,
+				     end_ptr);
 
-  if(offset == NULL ||
-     offset >= end_ptr){
+  if(length == 0){
     return(NULL);
   }
-    
-  str = ags_turtle_read_pn_chars_base(offset,
-				      end_ptr);
-  
-  if(str != NULL){
-    offset += strlen(str);
-    last_is_point = FALSE;
-    
-    while((tmp = ags_turtle_read_pn_chars(offset,
-					  end_ptr)) != NULL ||
-	  *offset == '.'){
-      if(tmp == NULL){
-	last_is_point = TRUE;
-      }else{
-	last_is_point = FALSE;
-      }
-
-      if(tmp != NULL){
-	str_tmp = g_strdup_printf("%s%s\0",
-				  str, tmp);
-	offset += strlen(tmp);
-
-	free(str);
-	free(tmp);
 
-	str = str_tmp;
-      }else{
-	str_tmp = g_strdup_printf("%s.\0",
-				  str);
-	offset++;	
-
-	free(str);
-
-	str = str_tmp;
-      }
-    }
-  }
-  
-  return(str);
+  return(g_strndup(offset,
+		   length));
 }
 
 /**
@@ -1381,374 +1597,1477 @@ gchar*
 ags_turtle_read_pn_local(gchar *offset,
 			 gchar *end_ptr)
 {
-  gchar *str;
-  gchar *tmp_str, *tmp;
+  guint length;
 
-  gboolean initial_find, found_str;
-  gboolean last_is_point;
+  length = ags_turtle_scan_pn_local(offset,
+				    end_ptr);
 
-  if(offset >= end_ptr){
+  if(length == 0){
     return(NULL);
   }
-  
-  tmp_str = NULL;
-
-  found_str = FALSE;
-  
-  tmp = ags_turtle_read_pn_chars_u(offset,
-				   end_ptr);
-        
-  if(tmp == NULL &&
-     *offset == ':'){
-    tmp = g_strdup(":\0");
-  }
 
-  if(tmp == NULL &&
-     g_ascii_isdigit(*offset)){
-    tmp = g_strndup(offset,
-		    1);
-  }
+  return(g_strndup(offset,
+		   length));
+}
 
-  if(tmp == NULL){
-    tmp = ags_turtle_read_plx(offset, end_ptr);
-  }
+/**
+ * ags_turtle_read_plx:
+ * @offset: the string pointer
+ * @end_ptr: the end of @offset
+ *
+ * Read plx value.
+ *
+ * Returns: a string on success otherwise %NULL
+ * 
+ * Since: 0.7.4
+ */
+gchar*
+ags_turtle_read_plx(gchar *offset,
+		    gchar *end_ptr)
+{
+  guint length;
 
-  str = tmp;
-  
-  if(str != NULL){
-    offset += strlen(str);
+  length = ags_turtle_scan_plx(offset,
+			       end_ptr);
 
-    initial_find = TRUE;
-    last_is_point = FALSE;
-    
-    while(initial_find ||
-	  found_str){
-      found_str = FALSE;
-      initial_find = FALSE;
-    
-      last_is_point = FALSE;
+  if(length == 0){
+    return(NULL);
+  }
 
-      tmp = ags_turtle_read_pn_chars(offset,
-				     end_ptr);
-      
-      if(tmp == NULL &&
-	 *offset == '.'){
-	tmp = g_strdup(".\0");
-	
-	last_is_point = TRUE;
-      }
+  return(g_strndup(offset,
+		   length));
+}
 
-      if(tmp == NULL &&
-	 *offset == ':'){
-	tmp = g_strdup(":\0");	
-      }
+/**
+ * ags_turtle_read_percent:
+ * @offset: the string pointer
+ * @end_ptr: the end of @offset
+ *
+ * Read percent value.
+ *
+ * Returns: a string on success otherwise %NULL
+ * 
+ * Since: 0.7.4
+ */
+gchar*
+ags_turtle_read_percent(gchar *offset,
+			gchar *end_ptr)
+{
+  guint length;
 
-      if(tmp == NULL){
-	tmp = ags_turtle_read_plx(offset,
-				  end_ptr);
-      }
-    
-      /* concat new strings */
-      if(tmp != NULL){
-	found_str = TRUE;
+  length = ags_turtle_scan_percent(offset,
+				   end_ptr);
 
-	if(str != NULL){
-	  tmp_str = g_strdup_printf("%s%s\0",
-				    str,
-				    tmp);
-	  offset += strlen(tmp);
-	
-	  free(str);
-	  free(tmp);
-	
-	  str = tmp_str;
-	}else{
-	  str = tmp;
-	  offset += strlen(tmp);
-	}
-      }
-    }
+  if(length == 0){
+    return(NULL);
   }
-  
-  return(str);
+
+  return(g_strndup(offset,
+		   length));
 }
 
 /**
- * ags_turtle_read_plx:
+ * ags_turtle_read_hex:
  * @offset: the string pointer
  * @end_ptr: the end of @offset
  *
- * Read plx value.
+ * Read hex value.
  *
  * Returns: a string on success otherwise %NULL
  * 
  * Since: 0.7.4
  */
 gchar*
-ags_turtle_read_plx(gchar *offset,
+ags_turtle_read_hex(gchar *offset,
 		    gchar *end_ptr)
 {
   gchar *str;
 
-  str = ags_turtle_read_percent(offset,
-				end_ptr);
+  str = NULL;
 
-  if(str == NULL){
-    str = ags_turtle_read_pn_local_esc(offset,
-				       end_ptr);
+  if(g_ascii_isxdigit(*offset)){
+    str = g_strndup(offset,
+		    1);
   }
   
   return(str);
 }
 
 /**
- * ags_turtle_read_percent:
+ * ags_turtle_read_pn_local_esc:
  * @offset: the string pointer
  * @end_ptr: the end of @offset
  *
- * Read percent value.
+ * Read prefixed name local escapes.
  *
  * Returns: a string on success otherwise %NULL
  * 
  * Since: 0.7.4
  */
 gchar*
-ags_turtle_read_percent(gchar *offset,
-			gchar *end_ptr)
+ags_turtle_read_pn_local_esc(gchar *offset,
+			     gchar *end_ptr)
 {
-  gchar *str;
+  guint length;
+
+  length = ags_turtle_scan_pn_local_esc(offset,
+					end_ptr);
+
+  if(length == 0){
+    return(NULL);
+  }
+
+  return(g_strndup(offset,
+		   length));
+}
+
+/**
+ * ags_turtle_find_xpath:
+ * @turtle: the #AgsTurtle
+ * @xpath: a XPath expression as string
+ *
+ * Lookup XPath expression withing @turtle.
+ *
+ * Returns: a #GList-struct containing xmlNode
+ *
+ * Since: 0.4.3
+ */
+GList*
+ags_turtle_find_xpath(AgsTurtle *turtle,
+		      gchar *xpath)
+{
+  xmlXPathContext *xpath_context;
+  xmlXPathObject *xpath_object;
+  xmlNode **node;
+  GList *list;
+
+  guint i;
+
+  if(turtle->doc == NULL){
+    ags_turtle_export_doc(turtle);
+  }
+  
+  xpath_context = xmlXPathNewContext(turtle->doc);
+  xpath_object = xmlXPathEval((xmlChar *) xpath,
+			      xpath_context);
+  
+  list = NULL;
+
+  if(xpath_object->nodesetval != NULL){
+    node = xpath_object->nodesetval->nodeTab;
+
+    for(i = 0; i < xpath_object->nodesetval->nodeNr; i++){
+      if(node[i]->type == XML_ELEMENT_NODE){
+	list = g_list_prepend(list,
+			      node[i]);
+      }
+    }
+  }
+
+  list = g_list_reverse(list);
+  
+  return(list);
+}
+
+/**
+ * ags_turtle_find_xpath_with_context_node:
+ * @turtle: the #AgsTurtle
+ * @xpath: a XPath expression as string
+ * @context_node: a #xmlNode-struct
+ *
+ * Lookup XPath expression from @context_node withing @turtle.
+ *
+ * Returns: a #GList-struct containing xmlNode
+ *
+ * Since: 0.4.3
+ */
+GList*
+ags_turtle_find_xpath_with_context_node(AgsTurtle *turtle,
+					gchar *xpath,
+					xmlNode *context_node)
+{
+  xmlXPathContext *xpath_context;
+  xmlXPathObject *xpath_object;
+  xmlNode **node;
+  GList *list;
+
+  guint i;
+  
+  xpath_context = xmlXPathNewContext(turtle->doc);
+  xpath_context->node = context_node;
+  xpath_object = xmlXPathEval((xmlChar *) xpath,
+			      xpath_context);
+  
+  list = NULL;
+
+  if(xpath_object->nodesetval != NULL){
+    node = xpath_object->nodesetval->nodeTab;
+
+    for(i = 0; i < xpath_object->nodesetval->nodeNr; i++){
+      if(node[i]->type == XML_ELEMENT_NODE){
+	list = g_list_prepend(list,
+			      node[i]);
+      }
+    }
+  }
+
+  if(list != NULL){
+    list = g_list_reverse(list);
+  }
+  
+  return(list);
+}
+
+gchar*
+ags_turtle_string_convert(AgsTurtle *turtle, gchar *str)
+{
+  if((AGS_TURTLE_TOLOWER & (turtle->flags)) != 0){
+    str = g_ascii_strdown(str,
+			  -1);
+  }
+  
+  return(str);
+}
+
+/**
+ * ags_turtle_intern_string:
+ * @turtle: the #AgsTurtle
+ * @str: the string
+ *
+ * Intern @str within @turtle. Equal strings share the very same pointer,
+ * so the returned string might be compared by address.
+ *
+ * Returns: the interned string owned by @turtle
+ *
+ * Since: 0.7.136
+ */
+gchar*
+ags_turtle_intern_string(AgsTurtle *turtle,
+			 gchar *str)
+{
+  gchar *interned;
+  
+  if(turtle == NULL ||
+     str == NULL){
+    return(NULL);
+  }
+
+  interned = g_hash_table_lookup(turtle->string_table,
+				 str);
+
+  if(interned == NULL){
+    interned = g_string_chunk_insert(turtle->string_chunk,
+				     str);
+    g_hash_table_insert(turtle->string_table,
+			interned,
+			interned);
+  }
+
+  return(interned);
+}
+
+/**
+ * ags_turtle_intern_string_len:
+ * @turtle: the #AgsTurtle
+ * @str: the string, not necessarily terminated
+ * @length: the length of @str in bytes
+ *
+ * Intern the first @length bytes of @str within @turtle, like
+ * ags_turtle_intern_string(). This allows to intern a token directly
+ * from the file buffer without copying it first.
+ *
+ * Returns: the interned string owned by @turtle
+ *
+ * Since: 0.7.136
+ */
+gchar*
+ags_turtle_intern_string_len(AgsTurtle *turtle,
+			     gchar *str,
+			     gsize length)
+{
+  gchar *interned;
+  
+  if(turtle == NULL ||
+     str == NULL){
+    return(NULL);
+  }
+
+  /* the string table needs a terminated key */
+  if(str != turtle->scratch->str){
+    g_string_truncate(turtle->scratch,
+		      0);
+    g_string_append_len(turtle->scratch,
+			str,
+			length);
+  }else{
+    g_string_truncate(turtle->scratch,
+		      length);
+  }
+
+  interned = g_hash_table_lookup(turtle->string_table,
+				 turtle->scratch->str);
+
+  if(interned == NULL){
+    interned = g_string_chunk_insert_len(turtle->string_chunk,
+					 turtle->scratch->str,
+					 turtle->scratch->len);
+    g_hash_table_insert(turtle->string_table,
+			interned,
+			interned);
+  }
+
+  return(interned);
+}
+
+/**
+ * ags_turtle_lookup_string:
+ * @turtle: the #AgsTurtle
+ * @str: the string
+ *
+ * Lookup the interned string equal to @str without adding it.
+ *
+ * Returns: the interned string or %NULL if not present
+ *
+ * Since: 0.7.136
+ */
+gchar*
+ags_turtle_lookup_string(AgsTurtle *turtle,
+			 gchar *str)
+{
+  if(turtle == NULL ||
+     str == NULL){
+    return(NULL);
+  }
+
+  return(g_hash_table_lookup(turtle->string_table,
+			     str));
+}
+
+/**
+ * ags_turtle_expand_pname:
+ * @turtle: the #AgsTurtle
+ * @pname: the prefixed name, like "lv2:binary"
+ *
+ * Expand @pname by the prefixes declared in @turtle. The index keeps the
+ * case of the document, so does the expansion.
+ *
+ * Returns: the interned IRI enclosed by angle brackets or %NULL if
+ * the prefix wasn't declared
+ *
+ * Since: 0.7.136
+ */
+gchar*
+ags_turtle_expand_pname(AgsTurtle *turtle,
+			gchar *pname)
+{
+  if(turtle == NULL ||
+     pname == NULL){
+    return(NULL);
+  }
+
+  return(ags_turtle_expand_pname_len(turtle,
+				     pname,
+				     strlen(pname)));
+}
+
+gchar*
+ags_turtle_expand_pname_len(AgsTurtle *turtle,
+			    gchar *pname,
+			    gsize length)
+{
+  GString *scratch;
+  
+  gchar *offset;
+  gchar *iri;
+  
+  offset = memchr(pname,
+		  ':',
+		  length);
+
+  if(offset == NULL){
+    return(NULL);
+  }
+
+  /* the prefix is declared including the colon */
+  scratch = turtle->scratch;
+
+  g_string_truncate(scratch,
+		    0);
+  g_string_append_len(scratch,
+		      pname,
+		      offset - pname + 1);
+  
+  iri = g_hash_table_lookup(turtle->prefix,
+			    scratch->str);
+
+  if(iri == NULL ||
+     strlen(iri) < 2){
+    return(NULL);
+  }
+
+  /* replace the closing angle bracket by the local name */
+  g_string_truncate(scratch,
+		    0);
+  g_string_append_len(scratch,
+		      iri,
+		      strlen(iri) - 1);
+  g_string_append_len(scratch,
+		      offset + 1,
+		      length - (offset - pname) - 1);
+  g_string_append_c(scratch,
+		    '>');
+
+  return(ags_turtle_intern_string_len(turtle,
+				      scratch->str,
+				      scratch->len));
+}
+
+/**
+ * ags_turtle_find_triple:
+ * @turtle: the #AgsTurtle
+ * @subject: the subject or %NULL to match any
+ * @predicate: the predicate or %NULL to match any
+ * @object: the object or %NULL to match any
+ *
+ * Find all triples matching @subject, @predicate and @object. IRIs are
+ * enclosed by angle brackets, literals by their quotes.
+ *
+ * Returns: a #GList-struct containing #AgsTurtleTriple owned by @turtle,
+ * free the list with g_list_free()
+ *
+ * Since: 0.7.136
+ */
+GList*
+ags_turtle_find_triple(AgsTurtle *turtle,
+		       gchar *subject,
+		       gchar *predicate,
+		       gchar *object)
+{
+  AgsTurtleTriple *triple;
+
+  GList *list, *retval;
+
+  if(turtle == NULL){
+    return(NULL);
+  }
+
+  /* interned strings compare by address */
+  if((subject != NULL &&
+      (subject = ags_turtle_lookup_string(turtle, subject)) == NULL) ||
+     (predicate != NULL &&
+      (predicate = ags_turtle_lookup_string(turtle, predicate)) == NULL) ||
+     (object != NULL &&
+      (object = ags_turtle_lookup_string(turtle, object)) == NULL)){
+    return(NULL);
+  }
+
+  /* pick the most selective index */
+  if(subject != NULL){
+    list = g_hash_table_lookup(turtle->subject_index,
+			       subject);
+  }else if(object != NULL){
+    list = g_hash_table_lookup(turtle->object_index,
+			       object);
+  }else if(predicate != NULL){
+    list = g_hash_table_lookup(turtle->predicate_index,
+			       predicate);
+  }else{
+    list = turtle->triple;
+  }
+
+  retval = NULL;
+  
+  while(list != NULL){
+    triple = AGS_TURTLE_TRIPLE(list->data);
+    
+    if((subject == NULL || triple->subject == subject) &&
+       (predicate == NULL || triple->predicate == predicate) &&
+       (object == NULL || triple->object == object)){
+      retval = g_list_prepend(retval,
+			      triple);
+    }
+
+    list = list->next;
+  }
+
+  return(g_list_reverse(retval));
+}
+
+/**
+ * ags_turtle_find_object:
+ * @turtle: the #AgsTurtle
+ * @subject: the subject or %NULL to match any
+ * @predicate: the predicate or %NULL to match any
+ *
+ * Find the objects of @subject and @predicate.
+ *
+ * Returns: a #GList-struct containing strings owned by @turtle,
+ * free the list with g_list_free()
+ *
+ * Since: 0.7.136
+ */
+GList*
+ags_turtle_find_object(AgsTurtle *turtle,
+		       gchar *subject,
+		       gchar *predicate)
+{
+  GList *list, *current;
+
+  list = ags_turtle_find_triple(turtle,
+				subject,
+				predicate,
+				NULL);
+
+  /* replace by object */
+  current = list;
+
+  while(current != NULL){
+    current->data = AGS_TURTLE_TRIPLE(current->data)->object;
+
+    current = current->next;
+  }
+
+  return(list);
+}
+
+/**
+ * ags_turtle_find_subject:
+ * @turtle: the #AgsTurtle
+ * @predicate: the predicate or %NULL to match any
+ * @object: the object or %NULL to match any
+ *
+ * Find the subjects having @predicate and @object.
+ *
+ * Returns: a #GList-struct containing strings owned by @turtle,
+ * free the list with g_list_free()
+ *
+ * Since: 0.7.136
+ */
+GList*
+ags_turtle_find_subject(AgsTurtle *turtle,
+			gchar *predicate,
+			gchar *object)
+{
+  GList *list, *current;
+
+  list = ags_turtle_find_triple(turtle,
+				NULL,
+				predicate,
+				object);
+
+  /* replace by subject */
+  current = list;
+
+  while(current != NULL){
+    current->data = AGS_TURTLE_TRIPLE(current->data)->subject;
+
+    current = current->next;
+  }
+
+  return(list);
+}
+
+/**
+ * ags_turtle_term_value:
+ * @term: a term of the index
+ *
+ * Get the value of @term, that is an IRI without angle brackets or the
+ * lexical form of a literal without quotes, language tag and datatype.
+ *
+ * Returns: a newly allocated string, free it with g_free()
+ *
+ * Since: 0.7.136
+ */
+gchar*
+ags_turtle_term_value(gchar *term)
+{
+  gchar *end;
+
+  if(term == NULL){
+    return(NULL);
+  }
+
+  if(term[0] == '<' &&
+     (end = rindex(term, '>')) != NULL &&
+     end != term){
+    return(g_strndup(term + 1,
+		     end - term - 1));
+  }
+
+  if(term[0] == '"' &&
+     (end = rindex(term, '"')) != NULL &&
+     end != term){
+    return(g_strndup(term + 1,
+		     end - term - 1));
+  }
+
+  return(g_strdup(term));
+}
+
+gchar*
+ags_turtle_index_new_blank_node(AgsTurtle *turtle)
+{
+  gchar *str;
+  gchar *retval;
+  
+  str = g_strdup_printf("_:ags-blank-node-%u\0",
+			turtle->n_blank_node);
+  turtle->n_blank_node++;
+
+  retval = ags_turtle_intern_string(turtle,
+				    str);
+  g_free(str);
+
+  return(retval);
+}
+
+void
+ags_turtle_index_add_triple(AgsTurtle *turtle,
+			    gchar *subject,
+			    gchar *predicate,
+			    gchar *object)
+{
+  AgsTurtleTriple *triple;
+
+  if(subject == NULL ||
+     predicate == NULL ||
+     object == NULL){
+    return;
+  }
+  
+  triple = (AgsTurtleTriple *) malloc(sizeof(AgsTurtleTriple));
+
+  triple->subject = subject;
+  triple->predicate = predicate;
+  triple->object = object;
+
+  /* prepended and reversed by ags_turtle_load() */
+  turtle->triple = g_list_prepend(turtle->triple,
+				  triple);
+  
+  g_hash_table_insert(turtle->subject_index,
+		      subject,
+		      g_list_prepend(g_hash_table_lookup(turtle->subject_index,
+							 subject),
+				     triple));
+  g_hash_table_insert(turtle->predicate_index,
+		      predicate,
+		      g_list_prepend(g_hash_table_lookup(turtle->predicate_index,
+							 predicate),
+				     triple));
+  g_hash_table_insert(turtle->object_index,
+		      object,
+		      g_list_prepend(g_hash_table_lookup(turtle->object_index,
+							 object),
+				     triple));
+}
+
+gchar*
+ags_turtle_map_file(AgsTurtle *turtle,
+		    struct stat *sb,
+		    gboolean *is_mapped)
+{
+  FILE *file;
+
+  gchar *buffer;
+
+  size_t n_read;
+
+  *is_mapped = FALSE;
+
+  if(turtle->filename == NULL ||
+     stat(turtle->filename,
+	  sb) != 0){
+    return(NULL);
+  }
+  
+  file = fopen(turtle->filename,
+	       "r\0");
+
+  if(file == NULL){
+    return(NULL);
+  }
+
+  buffer = NULL;
+  
+  /* the parser relies on a terminating NUL, the remainder of a partial page is zero filled */
+  if(sb->st_size > 0 &&
+     (sb->st_size % sysconf(_SC_PAGESIZE)) != 0){
+    buffer = (gchar *) mmap(NULL,
+			    sb->st_size,
+			    PROT_READ | PROT_WRITE,
+			    MAP_PRIVATE,
+			    fileno(file),
+			    0);
+
+    if(buffer == MAP_FAILED){
+      buffer = NULL;
+    }else{
+      *is_mapped = TRUE;
+    }
+  }
+
+  if(buffer == NULL){
+    buffer = (gchar *) malloc((sb->st_size + 1) * sizeof(gchar));
+
+    if(buffer == NULL){
+      fclose(file);
+      
+      return(NULL);
+    }
+  
+    n_read = fread(buffer, sizeof(gchar), sb->st_size, file);
+
+    if(n_read != sb->st_size){
+      g_critical("number of read bytes doesn't match buffer size\0");
+    }
+  
+    buffer[sb->st_size] = '\0';
+  }
+  
+  fclose(file);
+
+  return(buffer);
+}
+
+void
+ags_turtle_unmap_file(gchar *buffer,
+		      struct stat *sb,
+		      gboolean is_mapped)
+{
+  if(buffer == NULL){
+    return;
+  }
+  
+  if(is_mapped){
+    munmap(buffer,
+	   sb->st_size);
+  }else{
+    free(buffer);
+  }
+}
+
+/**
+ * ags_turtle_load:
+ * @turtle: the #AgsTurtle
+ * @error: a pointer to a #GError
+ *
+ * Loads a RDF triple file. The tokens are interned and indexed while
+ * reading, no XML Document is built. Use ags_turtle_export_doc() if you
+ * need one.
+ *
+ * Returns: the exported #xmlDoc pointer or %NULL if not exported
+ *
+ * Since: 0.4.3
+ */
+xmlDoc*
+ags_turtle_load(AgsTurtle *turtle,
+		GError **error)
+{
+  struct stat *sb;
+
+  GHashTable *index[3];
+  GHashTableIter hash_iter;
+  
+  gpointer key, list;
+
+  gchar *buffer, *iter, *end_ptr;
+
+  gboolean is_mapped;
+  guint i;
+  
+  auto void ags_turtle_load_skip_comments_and_blanks(gchar **iter);
+  auto gchar* ags_turtle_load_read_iri(gchar **iter);
+  auto gchar* ags_turtle_load_read_blank_node(gchar **iter);
+  auto gchar* ags_turtle_load_read_literal(gchar **iter);
+  auto gchar* ags_turtle_load_read_collection(gchar **iter);
+  auto gchar* ags_turtle_load_read_blank_node_property_list(gchar **iter);
+  auto gchar* ags_turtle_load_read_subject(gchar **iter);
+  auto gchar* ags_turtle_load_read_verb(gchar **iter);
+  auto gchar* ags_turtle_load_read_object(gchar **iter);
+  auto gboolean ags_turtle_load_read_object_list(gchar **iter,
+						 gchar *subject,
+						 gchar *predicate);
+  auto gboolean ags_turtle_load_read_predicate_object_list(gchar **iter,
+							   gchar *subject);
+  auto gboolean ags_turtle_load_read_directive(gchar **iter);
+  auto gboolean ags_turtle_load_read_triples(gchar **iter);
+
+  void ags_turtle_load_skip_comments_and_blanks(gchar **iter){
+    gchar *look_ahead;
+
+    look_ahead = *iter;
+
+    while(look_ahead < end_ptr){
+      if(*look_ahead == '#'){
+	/* comment until end of line */
+	while(look_ahead < end_ptr &&
+	      *look_ahead != '\n'){
+	  look_ahead++;
+	}
+      }else if(*look_ahead == ' ' ||
+	       *look_ahead == '\t' ||
+	       *look_ahead == '\r' ||
+	       *look_ahead == '\n'){
+	look_ahead++;
+      }else{
+	break;
+      }
+    }
+
+    *iter = look_ahead;
+  }
+
+  gchar* ags_turtle_load_read_iri(gchar **iter){
+    gchar *term;
+
+    guint length;
+    
+    term = NULL;
+    
+    if((length = ags_turtle_scan_regex(AGS_TURTLE_REGEX_IRIREF,
+				       *iter,
+				       end_ptr)) > 0){
+      term = ags_turtle_intern_string_len(turtle,
+					  *iter,
+					  length);
+    }else if((length = ags_turtle_scan_pname_ln(*iter,
+						end_ptr)) > 0 ||
+	     (length = ags_turtle_scan_pname_ns(*iter,
+						end_ptr)) > 0){
+      /* undeclared prefixes are kept as is */
+      if((term = ags_turtle_expand_pname_len(turtle,
+					     *iter,
+					     length)) == NULL){
+	term = ags_turtle_intern_string_len(turtle,
+					    *iter,
+					    length);
+      }
+    }
+
+    *iter += length;
+    
+    return(term);
+  }
+
+  gchar* ags_turtle_load_read_blank_node(gchar **iter){
+    gchar *str;
+    gchar *term;
+
+    guint length;
+    
+    term = NULL;
+    
+    if((length = ags_turtle_scan_blank_node_label(*iter,
+						  end_ptr)) > 0){
+      term = ags_turtle_intern_string_len(turtle,
+					  *iter,
+					  length);
+
+      *iter += length;
+    }else if((str = ags_turtle_read_anon(*iter,
+					 end_ptr)) != NULL){
+      term = ags_turtle_index_new_blank_node(turtle);
+
+      *iter += strlen(str);
+
+      free(str);
+    }
+    
+    return(term);
+  }
+
+  gchar* ags_turtle_load_read_literal(gchar **iter){
+    GString *scratch;
+    
+    gchar *look_ahead;
+    gchar *value, *langtag;
+    gchar *datatype;
+    gchar *term;
+
+    guint length, langtag_length;
+    guint quote_length;
+    
+    look_ahead = *iter;
+    term = NULL;
+    
+    if((length = ags_turtle_scan_string(look_ahead,
+					end_ptr)) > 0){
+      value = look_ahead;
+      look_ahead += length;
+
+      /* all quote styles are normalized to double quotes */
+      if(length >= 6 &&
+	 (!strncmp(value, "\"\"\"\0", 3) ||
+	  !strncmp(value, "'''\0", 3))){
+	quote_length = 3;
+      }else{
+	quote_length = 1;
+      }
+
+      /* language tag or datatype, the datatype is interned first */
+      langtag = NULL;
+      langtag_length = 0;
+      
+      datatype = NULL;
+      
+      if((langtag_length = ags_turtle_scan_regex(AGS_TURTLE_REGEX_LANGTAG,
+						 look_ahead,
+						 end_ptr)) > 0){
+	langtag = look_ahead;
+	look_ahead += langtag_length;
+      }else if(look_ahead + 1 < end_ptr &&
+	       look_ahead[0] == '^' &&
+	       look_ahead[1] == '^'){
+	look_ahead += 2;
+	
+	datatype = ags_turtle_load_read_iri(&look_ahead);
+      }
+
+      /* build the key in the scratch buffer */
+      scratch = turtle->scratch;
+      
+      g_string_truncate(scratch,
+			0);
+      g_string_append_c(scratch,
+			'"');
+      g_string_append_len(scratch,
+			  value + quote_length,
+			  length - 2 * quote_length);
+      g_string_append_c(scratch,
+			'"');
+
+      if(langtag != NULL){
+	g_string_append_len(scratch,
+			    langtag,
+			    langtag_length);
+      }else if(datatype != NULL){
+	g_string_append(scratch,
+			"^^\0");
+	g_string_append(scratch,
+			datatype);
+      }
+      
+      term = ags_turtle_intern_string_len(turtle,
+					  scratch->str,
+					  scratch->len);
+
+      *iter = look_ahead;
+    }else if((length = ags_turtle_scan_regex(AGS_TURTLE_REGEX_DOUBLE_LITERAL,
+					     look_ahead,
+					     end_ptr)) > 0 ||
+	     (length = ags_turtle_scan_regex(AGS_TURTLE_REGEX_DECIMAL_LITERAL,
+					     look_ahead,
+					     end_ptr)) > 0 ||
+	     (length = ags_turtle_scan_regex(AGS_TURTLE_REGEX_INTEGER_LITERAL,
+					     look_ahead,
+					     end_ptr)) > 0 ||
+	     (length = ags_turtle_scan_regex(AGS_TURTLE_REGEX_BOOLEAN_LITERAL,
+					     look_ahead,
+					     end_ptr)) > 0){
+      term = ags_turtle_intern_string_len(turtle,
+					  look_ahead,
+					  length);
+
+      *iter += length;
+    }
+
+    return(term);
+  }
+
+  gchar* ags_turtle_load_read_collection(gchar **iter){
+    GList *member, *start;
+
+    gchar *look_ahead;
+    gchar *object;
+    gchar *blank_node;
+    gchar *term;
+    
+    look_ahead = *iter;
+
+    if(look_ahead >= end_ptr ||
+       *look_ahead != '('){
+      return(NULL);
+    }
+
+    look_ahead++;
+    member = NULL;
+
+    while(TRUE){
+      ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+
+      if(look_ahead >= end_ptr){
+	g_list_free(member);
+	
+	return(NULL);
+      }
+
+      if(*look_ahead == ')'){
+	look_ahead++;
+	
+	break;
+      }
+
+      if((object = ags_turtle_load_read_object(&look_ahead)) == NULL){
+	g_list_free(member);
+	
+	return(NULL);
+      }
+
+      member = g_list_prepend(member,
+			      object);
+    }
+
+    /* rdf:first and rdf:rest chain, built from the tail */
+    start = member;
+    term = ags_turtle_intern_string(turtle,
+				    AGS_TURTLE_RDF_NIL);
+    
+    while(member != NULL){
+      blank_node = ags_turtle_index_new_blank_node(turtle);
+      
+      ags_turtle_index_add_triple(turtle,
+				  blank_node,
+				  ags_turtle_intern_string(turtle,
+							   AGS_TURTLE_RDF_FIRST),
+				  member->data);
+      ags_turtle_index_add_triple(turtle,
+				  blank_node,
+				  ags_turtle_intern_string(turtle,
+							   AGS_TURTLE_RDF_REST),
+				  term);
+      term = blank_node;
+      
+      member = member->next;
+    }
+
+    g_list_free(start);
+
+    *iter = look_ahead;
+    
+    return(term);
+  }
+
+  gchar* ags_turtle_load_read_blank_node_property_list(gchar **iter){
+    gchar *look_ahead;
+    gchar *term;
+    
+    look_ahead = *iter;
+
+    if(look_ahead >= end_ptr ||
+       *look_ahead != '['){
+      return(NULL);
+    }
+
+    look_ahead++;
+    term = ags_turtle_index_new_blank_node(turtle);
+
+    if(!ags_turtle_load_read_predicate_object_list(&look_ahead,
+						   term)){
+      return(NULL);
+    }
+
+    ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+
+    if(look_ahead >= end_ptr ||
+       *look_ahead != ']'){
+      return(NULL);
+    }
+
+    *iter = look_ahead + 1;
+    
+    return(term);
+  }
+
+  gchar* ags_turtle_load_read_subject(gchar **iter){
+    gchar *term;
+
+    if((term = ags_turtle_load_read_iri(iter)) == NULL &&
+       (term = ags_turtle_load_read_blank_node(iter)) == NULL){
+      term = ags_turtle_load_read_collection(iter);
+    }
+
+    return(term);
+  }
+
+  gchar* ags_turtle_load_read_verb(gchar **iter){
+    gchar *look_ahead;
+
+    look_ahead = *iter;
+    
+    /* the keyword a */
+    if(look_ahead + 1 < end_ptr &&
+       look_ahead[0] == 'a' &&
+       (look_ahead[1] == ' ' ||
+	look_ahead[1] == '\t' ||
+	look_ahead[1] == '\r' ||
+	look_ahead[1] == '\n' ||
+	look_ahead[1] == '<' ||
+	look_ahead[1] == '[' ||
+	look_ahead[1] == '(')){
+      *iter = look_ahead + 1;
+      
+      return(ags_turtle_intern_string(turtle,
+				      AGS_TURTLE_RDF_TYPE));
+    }
+
+    return(ags_turtle_load_read_iri(iter));
+  }
+
+  gchar* ags_turtle_load_read_object(gchar **iter){
+    gchar *term;
+
+    if((term = ags_turtle_load_read_iri(iter)) == NULL &&
+       (term = ags_turtle_load_read_blank_node(iter)) == NULL &&
+       (term = ags_turtle_load_read_collection(iter)) == NULL &&
+       (term = ags_turtle_load_read_blank_node_property_list(iter)) == NULL){
+      term = ags_turtle_load_read_literal(iter);
+    }
+
+    return(term);
+  }
+
+  gboolean ags_turtle_load_read_object_list(gchar **iter,
+					    gchar *subject,
+					    gchar *predicate){
+    gchar *look_ahead;
+    gchar *object;
+
+    look_ahead = *iter;
+    
+    while(TRUE){
+      ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+
+      if((object = ags_turtle_load_read_object(&look_ahead)) == NULL){
+	return(FALSE);
+      }
+
+      ags_turtle_index_add_triple(turtle,
+				  subject,
+				  predicate,
+				  object);
+
+      ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+
+      if(look_ahead < end_ptr &&
+	 *look_ahead == ','){
+	look_ahead++;
+      }else{
+	break;
+      }
+    }
+
+    *iter = look_ahead;
+    
+    return(TRUE);
+  }
+
+  gboolean ags_turtle_load_read_predicate_object_list(gchar **iter,
+						      gchar *subject){
+    gchar *look_ahead, *next;
+    gchar *predicate;
+
+    look_ahead = *iter;
+
+    ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+
+    if((predicate = ags_turtle_load_read_verb(&look_ahead)) == NULL ||
+       !ags_turtle_load_read_object_list(&look_ahead,
+					 subject,
+					 predicate)){
+      return(FALSE);
+    }
+
+    while(TRUE){
+      ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+
+      if(look_ahead >= end_ptr ||
+	 *look_ahead != ';'){
+	break;
+      }
+
+      /* semicolons might repeat or trail */
+      while(look_ahead < end_ptr &&
+	    *look_ahead == ';'){
+	look_ahead++;
+	
+	ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+      }
 
-  str = NULL;
+      next = look_ahead;
+      
+      if((predicate = ags_turtle_load_read_verb(&next)) == NULL){
+	break;
+      }
 
-  if(offset != NULL &&
-     offset + 2 < end_ptr &&
-     offset[0] == '%' &&
-     g_ascii_isxdigit(offset[1]) &&
-     g_ascii_isxdigit(offset[2])){
-    str = g_strndup(offset,
-		     3);
+      if(!ags_turtle_load_read_object_list(&next,
+					   subject,
+					   predicate)){
+	return(FALSE);
+      }
+
+      look_ahead = next;
+    }
+
+    *iter = look_ahead;
+    
+    return(TRUE);
   }
-  
-  return(str);
-}
 
-/**
- * ags_turtle_read_hex:
- * @offset: the string pointer
- * @end_ptr: the end of @offset
- *
- * Read hex value.
- *
- * Returns: a string on success otherwise %NULL
- * 
- * Since: 0.7.4
- */
-gchar*
-ags_turtle_read_hex(gchar *offset,
-		    gchar *end_ptr)
-{
-  gchar *str;
+  gboolean ags_turtle_load_read_directive(gchar **iter){
+    gchar *look_ahead;
+    gchar *pname_ns, *iriref;
 
-  str = NULL;
+    guint pname_ns_length, iriref_length;
+    gboolean is_prefix, is_sparql;
+    
+    look_ahead = *iter;
+    
+    if(g_str_has_prefix(look_ahead,
+			"@prefix\0")){
+      look_ahead += 7;
+      
+      is_prefix = TRUE;
+      is_sparql = FALSE;
+    }else if(g_str_has_prefix(look_ahead,
+			      "@base\0")){
+      look_ahead += 5;
+      
+      is_prefix = FALSE;
+      is_sparql = FALSE;
+    }else if(look_ahead + 6 < end_ptr &&
+	     !g_ascii_strncasecmp(look_ahead,
+				  "PREFIX\0",
+				  6) &&
+	     g_ascii_isspace(look_ahead[6])){
+      look_ahead += 6;
+      
+      is_prefix = TRUE;
+      is_sparql = TRUE;
+    }else if(look_ahead + 4 < end_ptr &&
+	     !g_ascii_strncasecmp(look_ahead,
+				  "BASE\0",
+				  4) &&
+	     g_ascii_isspace(look_ahead[4])){
+      look_ahead += 4;
+      
+      is_prefix = FALSE;
+      is_sparql = TRUE;
+    }else{
+      return(FALSE);
+    }
 
-  if(g_ascii_isxdigit(*offset)){
-    str = g_strndup(offset,
-		    1);
-  }
-  
-  return(str);
-}
+    ags_turtle_load_skip_comments_and_blanks(&look_ahead);
 
-/**
- * ags_turtle_read_pn_local_esc:
- * @offset: the string pointer
- * @end_ptr: the end of @offset
- *
- * Read prefixed name local escapes.
- *
- * Returns: a string on success otherwise %NULL
- * 
- * Since: 0.7.4
- */
-gchar*
-ags_turtle_read_pn_local_esc(gchar *offset,
-			     gchar *end_ptr)
-{
-  static const gchar *escapes = "_~.-!$&'()*+,;=/?#@%\0";
-  gchar *str;
+    pname_ns = NULL;
+    pname_ns_length = 0;
+    
+    if(is_prefix){
+      if((pname_ns_length = ags_turtle_scan_pname_ns(look_ahead,
+						     end_ptr)) == 0){
+	return(FALSE);
+      }
 
-  str = NULL;
+      pname_ns = look_ahead;
+      look_ahead += pname_ns_length;
+      
+      ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    }
 
-  if(offset != NULL &&
-     offset + 1 < end_ptr &&
-     *offset == '\\' &&
-     (index(escapes,
-	    offset[1])) != NULL){
-    str = g_strndup(offset,
-		    2);
-  }
-  
-  return(str);
-}
+    if((iriref_length = ags_turtle_scan_regex(AGS_TURTLE_REGEX_IRIREF,
+					      look_ahead,
+					      end_ptr)) == 0){
+      return(FALSE);
+    }
 
-/**
- * ags_turtle_find_xpath:
- * @turtle: the #AgsTurtle
- * @xpath: a XPath expression as string
- *
- * Lookup XPath expression withing @turtle.
- *
- * Returns: a #GList-struct containing xmlNode
- *
- * Since: 0.4.3
- */
-GList*
-ags_turtle_find_xpath(AgsTurtle *turtle,
-		      gchar *xpath)
-{
-  xmlXPathContext *xpath_context;
-  xmlXPathObject *xpath_object;
-  xmlNode **node;
-  GList *list;
+    iriref = look_ahead;
+    look_ahead += iriref_length;
+
+    /* the base IRI is not resolved */
+    if(pname_ns != NULL){
+      pname_ns = ags_turtle_intern_string_len(turtle,
+					      pname_ns,
+					      pname_ns_length);
+      iriref = ags_turtle_intern_string_len(turtle,
+					    iriref,
+					    iriref_length);
+      
+      g_hash_table_insert(turtle->prefix,
+			  pname_ns,
+			  iriref);
+    }
+    
+    /* only the turtle form is terminated by a point */
+    if(!is_sparql){
+      ags_turtle_load_skip_comments_and_blanks(&look_ahead);
 
-  guint i;
-  
-  xpath_context = xmlXPathNewContext(turtle->doc);
-  xpath_object = xmlXPathEval((xmlChar *) xpath,
-			      xpath_context);
-  
-  list = NULL;
+      if(look_ahead >= end_ptr ||
+	 *look_ahead != '.'){
+	return(FALSE);
+      }
 
-  if(xpath_object->nodesetval != NULL){
-    node = xpath_object->nodesetval->nodeTab;
+      look_ahead++;
+    }
 
-    for(i = 0; i < xpath_object->nodesetval->nodeNr; i++){
-      if(node[i]->type == XML_ELEMENT_NODE){
-	list = g_list_prepend(list,
-			      node[i]);
+    *iter = look_ahead;
+    
+    return(TRUE);
+  }
+
+  gboolean ags_turtle_load_read_triples(gchar **iter){
+    gchar *look_ahead, *next;
+    gchar *subject;
+
+    look_ahead = *iter;
+    
+    if((subject = ags_turtle_load_read_subject(&look_ahead)) != NULL){
+      if(!ags_turtle_load_read_predicate_object_list(&look_ahead,
+						     subject)){
+	return(FALSE);
+      }
+    }else if((subject = ags_turtle_load_read_blank_node_property_list(&look_ahead)) != NULL){
+      /* the predicate object list is optional */
+      next = look_ahead;
+      
+      if(ags_turtle_load_read_predicate_object_list(&next,
+						    subject)){
+	look_ahead = next;
       }
+    }else{
+      return(FALSE);
+    }
+
+    ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+
+    if(look_ahead >= end_ptr ||
+       *look_ahead != '.'){
+      return(FALSE);
     }
+
+    *iter = look_ahead + 1;
+    
+    return(TRUE);
   }
 
-  list = g_list_reverse(list);
-  
-  return(list);
-}
+#ifdef AGS_DEBUG
+  g_message("file: %s\0", turtle->filename);
+#endif
 
-/**
- * ags_turtle_find_xpath_with_context_node:
- * @turtle: the #AgsTurtle
- * @xpath: a XPath expression as string
- * @context_node: a #xmlNode-struct
- *
- * Lookup XPath expression from @context_node withing @turtle.
- *
- * Returns: a #GList-struct containing xmlNode
- *
- * Since: 0.4.3
- */
-GList*
-ags_turtle_find_xpath_with_context_node(AgsTurtle *turtle,
-					gchar *xpath,
-					xmlNode *context_node)
-{
-  xmlXPathContext *xpath_context;
-  xmlXPathObject *xpath_object;
-  xmlNode **node;
-  GList *list;
+  /* entry point - map file */
+  sb = (struct stat *) malloc(sizeof(struct stat));
+  buffer = ags_turtle_map_file(turtle,
+			       sb,
+			       &is_mapped);
 
-  guint i;
-  
-  xpath_context = xmlXPathNewContext(turtle->doc);
-  xpath_context->node = context_node;
-  xpath_object = xmlXPathEval((xmlChar *) xpath,
-			      xpath_context);
+  if(buffer == NULL){
+    free(sb);
+    
+    return(NULL);
+  }
+
+  end_ptr = &(buffer[sb->st_size]);
   
-  list = NULL;
+  /* statements */
+  iter = buffer;
 
-  if(xpath_object->nodesetval != NULL){
-    node = xpath_object->nodesetval->nodeTab;
+  while(TRUE){
+    ags_turtle_load_skip_comments_and_blanks(&iter);
 
-    for(i = 0; i < xpath_object->nodesetval->nodeNr; i++){
-      if(node[i]->type == XML_ELEMENT_NODE){
-	list = g_list_prepend(list,
-			      node[i]);
+    if(iter >= end_ptr){
+      break;
+    }
+    
+    if(!ags_turtle_load_read_directive(&iter) &&
+       !ags_turtle_load_read_triples(&iter)){
+      /* recover after the next point */
+      while(iter < end_ptr &&
+	    *iter != '.'){
+	iter++;
       }
+
+      iter++;
     }
   }
 
-  if(list != NULL){
-    list = g_list_reverse(list);
-  }
-  
-  return(list);
-}
+  ags_turtle_unmap_file(buffer,
+			sb,
+			is_mapped);
+  free(sb);
 
-gchar*
-ags_turtle_string_convert(AgsTurtle *turtle, gchar *str)
-{
-  if((AGS_TURTLE_TOLOWER & (turtle->flags)) != 0){
-    str = g_ascii_strdown(str,
-			  -1);
-  }
+  /* keep document order */
+  turtle->triple = g_list_reverse(turtle->triple);
+
+  index[0] = turtle->subject_index;
+  index[1] = turtle->predicate_index;
+  index[2] = turtle->object_index;
   
-  return(str);
+  for(i = 0; i < 3; i++){
+    g_hash_table_iter_init(&hash_iter,
+			   index[i]);
+
+    while(g_hash_table_iter_next(&hash_iter,
+				 &key,
+				 &list)){
+      g_hash_table_iter_replace(&hash_iter,
+				g_list_reverse(list));
+    }
+  }
+
+  return(turtle->doc);
 }
 
 /**
- * ags_turtle_load:
+ * ags_turtle_export_doc:
  * @turtle: the #AgsTurtle
- * @error: a pointer to a #GError
  *
- * Loads a RDF triple file into an XML Document.
+ * Converts the RDF triple file of @turtle into an XML Document. The
+ * document is kept by @turtle, so it is built at most once.
  *
  * Returns: a #xmlDoc pointer
  *
- * Since: 0.4.3
+ * Since: 0.7.136
  */
 xmlDoc*
-ags_turtle_load(AgsTurtle *turtle,
-		GError **error)
+ags_turtle_export_doc(AgsTurtle *turtle)
 {
   xmlDoc *doc;
   xmlNode *root_node, *rdf_statement_node;
-  FILE *file;
 
   struct stat *sb;
   
   gchar *buffer, *iter;
 
-  size_t n_read;
+  gboolean is_mapped;
+  
+  auto gchar* ags_turtle_export_doc_skip_comments_and_blanks(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_iriref(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_anon(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_pname_ns(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_pname_ln(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_numeric(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_string(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_langtag(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_literal(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_iri(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_prefix_id(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_base(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_sparql_prefix(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_sparql_base(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_prefixed_name(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_blank_node(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_statement(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_verb(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_predicate(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_object(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_directive(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_triple(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_subject(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_object_list(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_collection(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_blank_node_property_list(gchar **iter);
+  auto xmlNode* ags_turtle_export_doc_read_predicate_object_list(gchar **iter);
   
-  auto gchar* ags_turtle_load_skip_comments_and_blanks(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_iriref(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_anon(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_pname_ns(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_pname_ln(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_numeric(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_string(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_langtag(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_literal(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_iri(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_prefix_id(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_base(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_sparql_prefix(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_sparql_base(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_prefixed_name(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_blank_node(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_statement(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_verb(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_predicate(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_object(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_directive(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_triple(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_subject(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_object_list(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_collection(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_blank_node_property_list(gchar **iter);
-  auto xmlNode* ags_turtle_load_read_predicate_object_list(gchar **iter);
-  
-  gchar* ags_turtle_load_skip_comments_and_blanks(gchar **iter){
+  gchar* ags_turtle_export_doc_skip_comments_and_blanks(gchar **iter){
     gchar *look_ahead;
 
     if(iter == NULL){
@@ -1783,7 +3102,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(look_ahead);
   }
 
-  xmlNode* ags_turtle_load_read_iriref(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_iriref(gchar **iter){
     xmlNode *node;
 
     gchar *look_ahead;
@@ -1793,7 +3112,7 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
     
     /* skip blanks and comments */
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
     /* read iriref */
     str = ags_turtle_read_iriref(look_ahead,
@@ -1818,7 +3137,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
   
-  xmlNode* ags_turtle_load_read_anon(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_anon(gchar **iter){
     xmlNode *node;
 
     gchar *look_ahead;
@@ -1828,7 +3147,7 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
     
     /* skip blanks and comments */
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
     /* read anon */
     str = ags_turtle_read_anon(look_ahead,
@@ -1851,7 +3170,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_pname_ns(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_pname_ns(gchar **iter){
     xmlNode *node;
 
     gchar *look_ahead;
@@ -1861,7 +3180,7 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
     
     /* skip blanks and comments */
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
     /* read pname-ns */
     str = ags_turtle_read_pname_ns(look_ahead,
@@ -1884,7 +3203,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
   
-  xmlNode* ags_turtle_load_read_pname_ln(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_pname_ln(gchar **iter){
     xmlNode *node;
 
     gchar *look_ahead;
@@ -1894,7 +3213,7 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
     
     /* skip blanks and comments */
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
     /* read pname-ln */
     str = ags_turtle_read_pname_ln(look_ahead,
@@ -1917,7 +3236,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_numeric(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_numeric(gchar **iter){
     xmlNode *node;
 
     gchar *look_ahead;
@@ -1927,7 +3246,7 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
     
     /* skip blanks and comments */
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
     /* read numeric */
     if(str == NULL){
@@ -1967,7 +3286,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_string(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_string(gchar **iter){
     xmlNode *node;
 
     gchar *look_ahead;
@@ -1977,7 +3296,7 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
     
     /* skip blanks and comments */
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
     /* read pname-ns */
     str = ags_turtle_read_string(look_ahead,
@@ -2000,7 +3319,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_langtag(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_langtag(gchar **iter){
     xmlNode *node;
 
     gchar *look_ahead;
@@ -2010,7 +3329,7 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
     
     /* skip blanks and comments */
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
     /* read langtag */
     str = ags_turtle_read_langtag(look_ahead,
@@ -2033,7 +3352,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_literal(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_literal(gchar **iter){
     xmlNode *node;
     xmlNode *rdf_string_node, *rdf_langtag_node, *rdf_iri_node;
     
@@ -2043,7 +3362,7 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
 
     /* read string */
-    rdf_string_node = ags_turtle_load_read_string(&look_ahead);
+    rdf_string_node = ags_turtle_export_doc_read_string(&look_ahead);
 
     if(rdf_string_node != NULL){
       node = xmlNewNode(NULL,
@@ -2054,7 +3373,7 @@ ags_turtle_load(AgsTurtle *turtle,
       *iter = look_ahead;
 
       /* read optional langtag */
-      rdf_langtag_node = ags_turtle_load_read_langtag(&look_ahead);
+      rdf_langtag_node = ags_turtle_export_doc_read_langtag(&look_ahead);
 
       if(rdf_langtag_node != NULL){
 	xmlAddChild(node,
@@ -2063,13 +3382,13 @@ ags_turtle_load(AgsTurtle *turtle,
 	*iter = look_ahead;
       }else{
 	/* skip blanks and comments */
-	look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+	look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
 	if(look_ahead + 2 < &(buffer[sb->st_size]) &&
 	   look_ahead[0] == '^' &&
 	   look_ahead[1] == '^'){
 	  /* alternate r2ead optional iri */
-	  rdf_iri_node = ags_turtle_load_read_iri(&look_ahead);
+	  rdf_iri_node = ags_turtle_export_doc_read_iri(&look_ahead);
 	
 	  if(rdf_iri_node != NULL){
 	    xmlAddChild(node,
@@ -2082,7 +3401,7 @@ ags_turtle_load(AgsTurtle *turtle,
     }else{
       xmlNode *rdf_numeric_node;
 
-      rdf_numeric_node = ags_turtle_load_read_numeric(&look_ahead);
+      rdf_numeric_node = ags_turtle_export_doc_read_numeric(&look_ahead);
 
       if(rdf_numeric_node != NULL){
 	node = xmlNewNode(NULL,
@@ -2097,7 +3416,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_iri(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_iri(gchar **iter){
     xmlNode *node;
     xmlNode *rdf_iriref_node, *rdf_prefixed_name_node;
     
@@ -2107,7 +3426,7 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
 
     /* read iriref */
-    rdf_iriref_node = ags_turtle_load_read_iriref(&look_ahead);
+    rdf_iriref_node = ags_turtle_export_doc_read_iriref(&look_ahead);
 
     if(rdf_iriref_node != NULL){
       node = xmlNewNode(NULL,
@@ -2118,7 +3437,7 @@ ags_turtle_load(AgsTurtle *turtle,
       *iter = look_ahead;
     }else{
       /* alternate read prefixed name */
-      rdf_prefixed_name_node = ags_turtle_load_read_prefixed_name(&look_ahead);
+      rdf_prefixed_name_node = ags_turtle_export_doc_read_prefixed_name(&look_ahead);
 
       if(rdf_prefixed_name_node != NULL){
 	node = xmlNewNode(NULL,
@@ -2133,41 +3452,32 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_prefix_id(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_prefix_id(gchar **iter){
     xmlNode *node;
     xmlNode *rdf_pname_ns_node, *rdf_iriref_node;
 
     regmatch_t match_arr[1];
 
     gchar *look_ahead;
-    
-    static regex_t prefix_id_regex;
-
-    static gboolean regex_compiled = FALSE;
 
-    static const char *prefix_id_pattern = "^(@prefix)\0";
-    
     static const size_t max_matches = 1;
 
     node = NULL;
     look_ahead = *iter;
 
-    if(!regex_compiled){
-      regex_compiled = TRUE;
-      
-      regcomp(&prefix_id_regex, prefix_id_pattern, REG_EXTENDED);
-    }
+    pthread_once(&ags_turtle_regex_once,
+		 ags_turtle_regex_init);
 
     /* skip blanks and comments */
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
     /* match @prefix */
-    if(regexec(&prefix_id_regex, look_ahead, max_matches, match_arr, 0) == 0){
+    if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_PREFIX_ID]), look_ahead, max_matches, match_arr, 0) == 0){
       look_ahead += (match_arr[0].rm_eo - match_arr[0].rm_so);
       
-      rdf_pname_ns_node = ags_turtle_load_read_pname_ns(&look_ahead);
+      rdf_pname_ns_node = ags_turtle_export_doc_read_pname_ns(&look_ahead);
       
-      rdf_iriref_node = ags_turtle_load_read_iriref(&look_ahead);
+      rdf_iriref_node = ags_turtle_export_doc_read_iriref(&look_ahead);
 
       /* create node if complete prefix id */
       if(rdf_pname_ns_node != NULL &&
@@ -2186,39 +3496,30 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
   
-  xmlNode* ags_turtle_load_read_base(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_base(gchar **iter){
     xmlNode *node;
     xmlNode *rdf_iriref_node;
 
     regmatch_t match_arr[1];
 
     gchar *look_ahead;
-    
-    static regex_t base_regex;
 
-    static gboolean regex_compiled = FALSE;
-
-    static const char *base_pattern = "^(@base)\0";
-    
     static const size_t max_matches = 1;
 
     node = NULL;
     look_ahead = *iter;
 
-    if(!regex_compiled){
-      regex_compiled = TRUE;
-      
-      regcomp(&base_regex, base_pattern, REG_EXTENDED);      
-    }
+    pthread_once(&ags_turtle_regex_once,
+		 ags_turtle_regex_init);
 
     /* skip blanks and comments */
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
     /* match @base */
-    if(regexec(&base_regex, look_ahead, max_matches, match_arr, 0) == 0){
+    if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_BASE]), look_ahead, max_matches, match_arr, 0) == 0){
       look_ahead += (match_arr[0].rm_eo - match_arr[0].rm_so);
       
-      rdf_iriref_node = ags_turtle_load_read_iriref(&look_ahead);
+      rdf_iriref_node = ags_turtle_export_doc_read_iriref(&look_ahead);
 
       /* create node if complete base */
       if(rdf_iriref_node != NULL){
@@ -2234,41 +3535,32 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
   
-  xmlNode* ags_turtle_load_read_sparql_prefix(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_sparql_prefix(gchar **iter){
     xmlNode *node;
     xmlNode *rdf_pname_ns_node, *rdf_iriref_node;
 
     regmatch_t match_arr[1];
 
     gchar *look_ahead;
-    
-    static regex_t sparql_prefix_regex;
-
-    static gboolean regex_compiled = FALSE;
 
-    static const char *sparql_prefix_pattern = "^(\"PREFIX\")\0";
-    
     static const size_t max_matches = 1;
 
     node = NULL;
     look_ahead = *iter;
 
-    if(!regex_compiled){
-      regex_compiled = TRUE;
-      
-      regcomp(&sparql_prefix_regex, sparql_prefix_pattern, REG_EXTENDED);
-    }
+    pthread_once(&ags_turtle_regex_once,
+		 ags_turtle_regex_init);
 
     /* skip blanks and comments */
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
     /* match @prefix */
-    if(regexec(&sparql_prefix_regex, look_ahead, max_matches, match_arr, 0) == 0){
+    if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_SPARQL_PREFIX]), look_ahead, max_matches, match_arr, 0) == 0){
       look_ahead += (match_arr[0].rm_eo - match_arr[0].rm_so);
       
-      rdf_pname_ns_node = ags_turtle_load_read_pname_ns(&look_ahead);
+      rdf_pname_ns_node = ags_turtle_export_doc_read_pname_ns(&look_ahead);
       
-      rdf_iriref_node = ags_turtle_load_read_iriref(&look_ahead);;
+      rdf_iriref_node = ags_turtle_export_doc_read_iriref(&look_ahead);;
 
       /* create node if complete sparql prefix */
       if(rdf_pname_ns_node != NULL &&
@@ -2287,39 +3579,30 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
   
-  xmlNode* ags_turtle_load_read_sparql_base(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_sparql_base(gchar **iter){
     xmlNode *node;
     xmlNode *rdf_iriref_node;
 
     regmatch_t match_arr[1];
 
     gchar *look_ahead;
-    
-    static regex_t sparql_base_regex;
 
-    static gboolean regex_compiled = FALSE;
-
-    static const char *sparql_base_pattern = "^(\"BASE\")\0";
-    
     static const size_t max_matches = 1;
 
     node = NULL;
     look_ahead = *iter;
 
-    if(!regex_compiled){
-      regex_compiled = TRUE;
-      
-      regcomp(&sparql_base_regex, sparql_base_pattern, REG_EXTENDED);      
-    }
+    pthread_once(&ags_turtle_regex_once,
+		 ags_turtle_regex_init);
 
     /* skip blanks and comments */
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
     /* match @base */
-    if(regexec(&sparql_base_regex, look_ahead, max_matches, match_arr, 0) == 0){
+    if(regexec(&(ags_turtle_regex[AGS_TURTLE_REGEX_SPARQL_BASE]), look_ahead, max_matches, match_arr, 0) == 0){
       look_ahead += (match_arr[0].rm_eo - match_arr[0].rm_so);
       
-      rdf_iriref_node = ags_turtle_load_read_iriref(&look_ahead);;
+      rdf_iriref_node = ags_turtle_export_doc_read_iriref(&look_ahead);;
 
       /* create node if complete sparqle base */
       if(rdf_iriref_node != NULL){
@@ -2335,7 +3618,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
   
-  xmlNode* ags_turtle_load_read_prefixed_name(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_prefixed_name(gchar **iter){
     xmlNode *node;
     xmlNode *rdf_pname_ns_node, *rdf_pname_ln_node;
 
@@ -2344,7 +3627,7 @@ ags_turtle_load(AgsTurtle *turtle,
     node = NULL;
     look_ahead = *iter;
 
-    rdf_pname_ln_node = ags_turtle_load_read_pname_ln(&look_ahead);
+    rdf_pname_ln_node = ags_turtle_export_doc_read_pname_ln(&look_ahead);
 
     if(rdf_pname_ln_node != NULL){
       node = xmlNewNode(NULL,
@@ -2354,7 +3637,7 @@ ags_turtle_load(AgsTurtle *turtle,
 
       *iter = look_ahead;
     }else{
-      rdf_pname_ns_node = ags_turtle_load_read_pname_ns(&look_ahead);
+      rdf_pname_ns_node = ags_turtle_export_doc_read_pname_ns(&look_ahead);
 
       if(rdf_pname_ns_node != NULL){
 	node = xmlNewNode(NULL,
@@ -2369,7 +3652,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_blank_node(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_blank_node(gchar **iter){
     xmlNode *node;
     xmlNode *rdf_anon_node;
 
@@ -2391,7 +3674,7 @@ ags_turtle_load(AgsTurtle *turtle,
 
       *iter = look_ahead;
     }else{
-      rdf_anon_node = ags_turtle_load_read_anon(&look_ahead);
+      rdf_anon_node = ags_turtle_export_doc_read_anon(&look_ahead);
 
       if(rdf_anon_node != NULL){
 	node = xmlNewNode(NULL,
@@ -2406,7 +3689,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_statement(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_statement(gchar **iter){
     xmlNode *node;
     xmlNode *rdf_directive_node, *rdf_triple_node;
     
@@ -2415,7 +3698,7 @@ ags_turtle_load(AgsTurtle *turtle,
     node = NULL;
     look_ahead = *iter;    
 
-    rdf_directive_node = ags_turtle_load_read_directive(&look_ahead);
+    rdf_directive_node = ags_turtle_export_doc_read_directive(&look_ahead);
 
     if(rdf_directive_node != NULL){
       node = xmlNewNode(NULL,
@@ -2430,7 +3713,7 @@ ags_turtle_load(AgsTurtle *turtle,
       *iter = index(look_ahead,
 		    '.') + 1;
     }else{
-      rdf_triple_node = ags_turtle_load_read_triple(&look_ahead);
+      rdf_triple_node = ags_turtle_export_doc_read_triple(&look_ahead);
 
       if(rdf_triple_node != NULL){
 	node = xmlNewNode(NULL,
@@ -2450,7 +3733,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_verb(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_verb(gchar **iter){
     xmlNode *node;
     xmlNode *predicate_node;
     
@@ -2460,7 +3743,7 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
 
     /* predicate */
-    predicate_node = ags_turtle_load_read_predicate(&look_ahead);
+    predicate_node = ags_turtle_export_doc_read_predicate(&look_ahead);
 	  
     if(predicate_node != NULL){
 #ifdef AGS_DEBUG
@@ -2476,7 +3759,7 @@ ags_turtle_load(AgsTurtle *turtle,
       *iter = look_ahead;
     }else{
       /* skip blanks and comments */
-      look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+      look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
       
       if(*look_ahead == 'a'){
 #ifdef AGS_DEBUG
@@ -2499,7 +3782,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_predicate(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_predicate(gchar **iter){
     xmlNode *node;
     xmlNode *iri_node;
 
@@ -2509,7 +3792,7 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
 
     /* iri - IRIREF */
-    iri_node = ags_turtle_load_read_iri(&look_ahead);
+    iri_node = ags_turtle_export_doc_read_iri(&look_ahead);
     
     if(iri_node != NULL){
 #ifdef AGS_DEBUG
@@ -2527,7 +3810,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
   
-  xmlNode* ags_turtle_load_read_object(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_object(gchar **iter){
     xmlNode *node;
     xmlNode *iri_node;
     xmlNode *blank_node;
@@ -2547,34 +3830,34 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
 
     /* iri - IRIREF */
-    iri_node = ags_turtle_load_read_iri(&look_ahead);
+    iri_node = ags_turtle_export_doc_read_iri(&look_ahead);
 
     if(iri_node != NULL){
-      goto ags_turtle_load_read_object_CREATE_NODE;
+      goto ags_turtle_export_doc_read_object_CREATE_NODE;
     }
 
     /* read blank node */
-    blank_node = ags_turtle_load_read_blank_node(&look_ahead);
+    blank_node = ags_turtle_export_doc_read_blank_node(&look_ahead);
 
     if(blank_node != NULL){
-      goto ags_turtle_load_read_object_CREATE_NODE;
+      goto ags_turtle_export_doc_read_object_CREATE_NODE;
     }
 
     /* skip blanks and comments */
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
     /* collection */
     if(*look_ahead == '('){
-      collection_node = ags_turtle_load_read_collection(&look_ahead);
+      collection_node = ags_turtle_export_doc_read_collection(&look_ahead);
 	
-      goto ags_turtle_load_read_object_CREATE_NODE;
+      goto ags_turtle_export_doc_read_object_CREATE_NODE;
     }
 
-    /* blank node property listimplemented ags_turtle_load_read_object() */
+    /* blank node property listimplemented ags_turtle_export_doc_read_object() */
     if(*look_ahead == '['){
-      blank_node_property_list_node = ags_turtle_load_read_blank_node_property_list(&look_ahead);
+      blank_node_property_list_node = ags_turtle_export_doc_read_blank_node_property_list(&look_ahead);
 	
-      goto ags_turtle_load_read_object_CREATE_NODE;
+      goto ags_turtle_export_doc_read_object_CREATE_NODE;
     }
 
     /* literal */
@@ -2582,14 +3865,14 @@ ags_turtle_load(AgsTurtle *turtle,
     g_message("*** PASS ***");
 #endif
     
-    literal_node = ags_turtle_load_read_literal(&look_ahead);
+    literal_node = ags_turtle_export_doc_read_literal(&look_ahead);
     
     if(literal_node != NULL){
-      goto ags_turtle_load_read_object_CREATE_NODE;
+      goto ags_turtle_export_doc_read_object_CREATE_NODE;
     }
 
     /* create node */
-  ags_turtle_load_read_object_CREATE_NODE:
+  ags_turtle_export_doc_read_object_CREATE_NODE:
 
     if(iri_node != NULL){
       node = xmlNewNode(NULL,
@@ -2637,7 +3920,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_directive(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_directive(gchar **iter){
     xmlNode *node;
     xmlNode *rdf_prefix_id_node, *rdf_base_node, *rdf_sparql_prefix_node, *rdf_sparql_base_node;
     
@@ -2646,32 +3929,32 @@ ags_turtle_load(AgsTurtle *turtle,
     node = NULL;
     look_ahead = *iter;
     
-    rdf_prefix_id_node = ags_turtle_load_read_prefix_id(&look_ahead);
+    rdf_prefix_id_node = ags_turtle_export_doc_read_prefix_id(&look_ahead);
 
     if(rdf_prefix_id_node != NULL){
-      goto ags_turtle_load_read_directive_CREATE_NODE;
+      goto ags_turtle_export_doc_read_directive_CREATE_NODE;
     }
     
-    rdf_base_node = ags_turtle_load_read_base(&look_ahead);
+    rdf_base_node = ags_turtle_export_doc_read_base(&look_ahead);
 
     if(rdf_base_node != NULL){
-      goto ags_turtle_load_read_directive_CREATE_NODE;
+      goto ags_turtle_export_doc_read_directive_CREATE_NODE;
     }
     
-    rdf_sparql_prefix_node = ags_turtle_load_read_sparql_prefix(&look_ahead);
+    rdf_sparql_prefix_node = ags_turtle_export_doc_read_sparql_prefix(&look_ahead);
 
     if(rdf_sparql_prefix_node != NULL){
-      goto ags_turtle_load_read_directive_CREATE_NODE;
+      goto ags_turtle_export_doc_read_directive_CREATE_NODE;
     }
     
-    rdf_sparql_base_node = ags_turtle_load_read_sparql_base(&look_ahead);
+    rdf_sparql_base_node = ags_turtle_export_doc_read_sparql_base(&look_ahead);
 
     if(rdf_sparql_base_node != NULL){
-      goto ags_turtle_load_read_directive_CREATE_NODE;
+      goto ags_turtle_export_doc_read_directive_CREATE_NODE;
     }
     
     /* create node */
-  ags_turtle_load_read_directive_CREATE_NODE:
+  ags_turtle_export_doc_read_directive_CREATE_NODE:
     
     if(rdf_prefix_id_node != NULL){
 #ifdef AGS_DEBUG
@@ -2726,7 +4009,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_triple(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_triple(gchar **iter){
     xmlNode *node;
     xmlNode *subject_node,  *predicate_object_list_node_0, *blank_node_object_list_node,  *predicate_object_list_node_1;
     
@@ -2736,12 +4019,12 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
 	
     /* subject */
-    subject_node = ags_turtle_load_read_subject(&look_ahead);
+    subject_node = ags_turtle_export_doc_read_subject(&look_ahead);
 
     /* create triple node */
     if(subject_node != NULL){
       /* first predicate object list */
-      predicate_object_list_node_0 = ags_turtle_load_read_predicate_object_list(&look_ahead);
+      predicate_object_list_node_0 = ags_turtle_export_doc_read_predicate_object_list(&look_ahead);
 
       if(predicate_object_list_node_0 != NULL){
 	node = xmlNewNode(NULL,
@@ -2753,7 +4036,7 @@ ags_turtle_load(AgsTurtle *turtle,
 		    predicate_object_list_node_0);
 
 	/* second predicate object list */
-	predicate_object_list_node_1 = ags_turtle_load_read_predicate_object_list(&look_ahead);
+	predicate_object_list_node_1 = ags_turtle_export_doc_read_predicate_object_list(&look_ahead);
 	
 	if(predicate_object_list_node_1 != NULL){
 	  xmlAddChild(node,
@@ -2767,7 +4050,7 @@ ags_turtle_load(AgsTurtle *turtle,
       	*iter = look_ahead;
       }else{
 	/* alternate first blank node object list */
-	blank_node_object_list_node = ags_turtle_load_read_blank_node_property_list(&look_ahead);
+	blank_node_object_list_node = ags_turtle_export_doc_read_blank_node_property_list(&look_ahead);
 
 	if(blank_node_object_list_node != NULL){
 	  node = xmlNewNode(NULL,
@@ -2777,7 +4060,7 @@ ags_turtle_load(AgsTurtle *turtle,
 		      blank_node_object_list_node);
 	  
 	  /* predicate object list */
-	  predicate_object_list_node_1 = ags_turtle_load_read_predicate_object_list(&look_ahead);
+	  predicate_object_list_node_1 = ags_turtle_export_doc_read_predicate_object_list(&look_ahead);
 	
 	  if(predicate_object_list_node_1 != NULL){
 	    xmlAddChild(node,
@@ -2796,7 +4079,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_subject(gchar **iter){
+  xmlNode* ags_turtle_export_doc_read_subject(gchar **iter){
     xmlNode *node;
     xmlNode *iri_node;
     xmlNode *blank_node;
@@ -2813,28 +4096,28 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
 
     /* iri - IRIREF */
-    iri_node = ags_turtle_load_read_iri(&look_ahead);
+    iri_node = ags_turtle_export_doc_read_iri(&look_ahead);
 
     if(iri_node != NULL){
-      goto ags_turtle_load_read_subject_CREATE_NODE;
+      goto ags_turtle_export_doc_read_subject_CREATE_NODE;
     }
 
     /* read blank node */
-    blank_node = ags_turtle_load_read_blank_node(&look_ahead);
+    blank_node = ags_turtle_export_doc_read_blank_node(&look_ahead);
 
     if(blank_node != NULL){
-      goto ags_turtle_load_read_subject_CREATE_NODE;
+      goto ags_turtle_export_doc_read_subject_CREATE_NODE;
     }
       
     /* collection */
     if(*look_ahead == '('){
-      collection_node = ags_turtle_load_read_collection(&look_ahead);
+      collection_node = ags_turtle_export_doc_read_collection(&look_ahead);
 	
-      goto ags_turtle_load_read_subject_CREATE_NODE;
+      goto ags_turtle_export_doc_read_subject_CREATE_NODE;
     }
 
     /* create node */
-  ags_turtle_load_read_subject_CREATE_NODE:
+  ags_turtle_export_doc_read_subject_CREATE_NODE:
 
     if(iri_node != NULL){
       node = xmlNewNode(NULL,
@@ -2868,7 +4151,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_object_list(gchar **iter)
+  xmlNode* ags_turtle_export_doc_read_object_list(gchar **iter)
   {
     xmlNode *node;
     xmlNode *object_node;
@@ -2880,7 +4163,7 @@ ags_turtle_load(AgsTurtle *turtle,
     look_ahead = *iter;
 
     /* read first object */
-    object_node = ags_turtle_load_read_object(&look_ahead);
+    object_node = ags_turtle_export_doc_read_object(&look_ahead);
     
     if(object_node != NULL){
       /* create node */
@@ -2890,18 +4173,18 @@ ags_turtle_load(AgsTurtle *turtle,
 		  object_node);
 
       /* iterate */
-      look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+      look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 	
       while(*look_ahead == ','){
 	look_ahead++;
 	
-	object_node = ags_turtle_load_read_object(&look_ahead);
+	object_node = ags_turtle_export_doc_read_object(&look_ahead);
 
 	if(object_node != NULL){
 	  xmlAddChild(node,
 		      object_node);
 
-	  look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+	  look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 	}
       }
       
@@ -2917,7 +4200,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }  
   
-  xmlNode* ags_turtle_load_read_collection(gchar **iter)
+  xmlNode* ags_turtle_export_doc_read_collection(gchar **iter)
   {
     xmlNode *node;
     xmlNode *object_node;
@@ -2928,7 +4211,7 @@ ags_turtle_load(AgsTurtle *turtle,
     node = NULL;
     look_ahead = *iter;
 
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
     
     if(*look_ahead == '\0'){
       return(NULL);
@@ -2943,7 +4226,7 @@ ags_turtle_load(AgsTurtle *turtle,
 			"rdf-collection");
       
       /* read objects */
-      while((object_node = ags_turtle_load_read_object(&look_ahead)) != NULL){
+      while((object_node = ags_turtle_export_doc_read_object(&look_ahead)) != NULL){
 #ifdef AGS_DEBUG
 	g_message("read rdf-collection\0");
 #endif
@@ -2961,7 +4244,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
 
-  xmlNode* ags_turtle_load_read_predicate_object_list(gchar **iter)
+  xmlNode* ags_turtle_export_doc_read_predicate_object_list(gchar **iter)
   {
     xmlNode *node;
     xmlNode *current_verb_node, *current_object_list_node;
@@ -2971,10 +4254,10 @@ ags_turtle_load(AgsTurtle *turtle,
     node = NULL;
     look_ahead = *iter;
 
-    current_verb_node = ags_turtle_load_read_verb(&look_ahead);
+    current_verb_node = ags_turtle_export_doc_read_verb(&look_ahead);
 
     if(current_verb_node != NULL){
-      current_object_list_node = ags_turtle_load_read_object_list(&look_ahead);
+      current_object_list_node = ags_turtle_export_doc_read_object_list(&look_ahead);
 
       if(current_object_list_node != NULL){
 	node = xmlNewNode(NULL,
@@ -2986,14 +4269,14 @@ ags_turtle_load(AgsTurtle *turtle,
 		    current_object_list_node);
 
 	/* iterate */	
-	look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+	look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 	
 	while(*look_ahead == ';'){
 	  look_ahead++;
-	  current_verb_node = ags_turtle_load_read_verb(&look_ahead);
+	  current_verb_node = ags_turtle_export_doc_read_verb(&look_ahead);
 
 	  if(current_verb_node != NULL){
-	    current_object_list_node = ags_turtle_load_read_object_list(&look_ahead);
+	    current_object_list_node = ags_turtle_export_doc_read_object_list(&look_ahead);
       
 	    if(current_object_list_node != NULL){
 	      xmlAddChild(node,
@@ -3001,7 +4284,7 @@ ags_turtle_load(AgsTurtle *turtle,
 	      xmlAddChild(node,
 			  current_object_list_node);
 	      
-	      look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+	      look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 	    }else{
 	      break;
 	    }
@@ -3018,7 +4301,7 @@ ags_turtle_load(AgsTurtle *turtle,
     return(node);
   }
   
-  xmlNode* ags_turtle_load_read_blank_node_property_list(gchar **iter)
+  xmlNode* ags_turtle_export_doc_read_blank_node_property_list(gchar **iter)
   {
     xmlNode *node;
     xmlNode *predicate_object_list_node;
@@ -3029,13 +4312,13 @@ ags_turtle_load(AgsTurtle *turtle,
     node = NULL;
     look_ahead = *iter;
 
-    look_ahead = ags_turtle_load_skip_comments_and_blanks(&look_ahead);
+    look_ahead = ags_turtle_export_doc_skip_comments_and_blanks(&look_ahead);
 
     if(*look_ahead == '['){
       start_ptr = look_ahead;
       look_ahead++;
       
-      predicate_object_list_node = ags_turtle_load_read_predicate_object_list(&look_ahead);
+      predicate_object_list_node = ags_turtle_export_doc_read_predicate_object_list(&look_ahead);
 
       if(predicate_object_list_node != NULL){
 #ifdef AGS_DEBUG
@@ -3062,31 +4345,21 @@ ags_turtle_load(AgsTurtle *turtle,
   g_message("file: %s\0", turtle->filename);
 #endif
   
-  /* entry point - open file and read it */
-  sb = (struct stat *) malloc(sizeof(struct stat));
-  stat(turtle->filename,
-       sb);
-  file = fopen(turtle->filename,
-	       "r\0");
-
-  if(file == NULL){
-    return(NULL);
+  if(turtle->doc != NULL){
+    return(turtle->doc);
   }
-
-  buffer = (gchar *) malloc((sb->st_size + 1) * sizeof(gchar));
+  
+  /* entry point - map file */
+  sb = (struct stat *) malloc(sizeof(struct stat));
+  buffer = ags_turtle_map_file(turtle,
+			       sb,
+			       &is_mapped);
 
   if(buffer == NULL){
+    free(sb);
+    
     return(NULL);
   }
-  
-  n_read = fread(buffer, sizeof(gchar), sb->st_size, file);
-
-  if(n_read != sb->st_size){
-    g_critical("number of read bytes doesn't match buffer size\0");
-  }
-  
-  buffer[sb->st_size] = '\0';
-  fclose(file);
 
   /* alloc document */
   turtle->doc = 
@@ -3101,9 +4374,9 @@ ags_turtle_load(AgsTurtle *turtle,
 
   do{
     /* skip blanks and comments */
-    iter = ags_turtle_load_skip_comments_and_blanks(&iter);
+    iter = ags_turtle_export_doc_skip_comments_and_blanks(&iter);
 
-    rdf_statement_node = ags_turtle_load_read_statement(&iter);
+    rdf_statement_node = ags_turtle_export_doc_read_statement(&iter);
 
     if(rdf_statement_node != NULL){
       xmlAddChild(root_node,
@@ -3114,9 +4387,11 @@ ags_turtle_load(AgsTurtle *turtle,
       iter++;
     }
   }while(iter < &(buffer[sb->st_size]));
-  
+
+  ags_turtle_unmap_file(buffer,
+			sb,
+			is_mapped);
   free(sb);
-  free(buffer);
 
   return(doc);
 }
@@ -36,8 +36,16 @@
 
 #define AGS_TURTLE_DEFAULT_VERSION "0.7.3\0"
 
+#define AGS_TURTLE_TRIPLE(ptr) ((AgsTurtleTriple *)(ptr))
+
+#define AGS_TURTLE_RDF_TYPE "<http://www.w3.org/1999/02/22-rdf-syntax-ns#type>\0"
+#define AGS_TURTLE_RDF_FIRST "<http://www.w3.org/1999/02/22-rdf-syntax-ns#first>\0"
+#define AGS_TURTLE_RDF_REST "<http://www.w3.org/1999/02/22-rdf-syntax-ns#rest>\0"
+#define AGS_TURTLE_RDF_NIL "<http://www.w3.org/1999/02/22-rdf-syntax-ns#nil>\0"
+
 typedef struct _AgsTurtle AgsTurtle;
 typedef struct _AgsTurtleClass AgsTurtleClass;
+typedef struct _AgsTurtleTriple AgsTurtleTriple;
 
 typedef enum{
   AGS_TURTLE_TOLOWER    = 1,
@@ -52,6 +60,19 @@ struct _AgsTurtle
   gchar *filename;
   
   xmlDoc *doc;
+
+  GStringChunk *string_chunk;
+  GHashTable *string_table;
+  GString *scratch;
+
+  GHashTable *prefix;
+  guint n_blank_node;
+  
+  GList *triple;
+
+  GHashTable *subject_index;
+  GHashTable *predicate_index;
+  GHashTable *object_index;
 };
 
 struct _AgsTurtleClass
@@ -59,6 +80,13 @@ struct _AgsTurtleClass
   GObjectClass object;
 };
 
+struct _AgsTurtleTriple
+{
+  gchar *subject;
+  gchar *predicate;
+  gchar *object;
+};
+
 GType ags_turtle_get_type(void);
 
 /* iri, pname, label and langtag */
@@ -135,8 +163,34 @@ GList* ags_turtle_find_xpath_with_context_node(AgsTurtle *turtle,
 
 gchar* ags_turtle_string_convert(AgsTurtle *turtle, gchar *str);
 
+/* triple index */
+gchar* ags_turtle_intern_string(AgsTurtle *turtle,
+				gchar *str);
+gchar* ags_turtle_intern_string_len(AgsTurtle *turtle,
+				    gchar *str,
+				    gsize length);
+gchar* ags_turtle_lookup_string(AgsTurtle *turtle,
+				gchar *str);
+
+gchar* ags_turtle_expand_pname(AgsTurtle *turtle,
+			       gchar *pname);
+
+GList* ags_turtle_find_triple(AgsTurtle *turtle,
+			      gchar *subject,
+			      gchar *predicate,
+			      gchar *object);
+GList* ags_turtle_find_object(AgsTurtle *turtle,
+			      gchar *subject,
+			      gchar *predicate);
+GList* ags_turtle_find_subject(AgsTurtle *turtle,
+			       gchar *predicate,
+			       gchar *object);
+
+gchar* ags_turtle_term_value(gchar *term);
+
 xmlDoc* ags_turtle_load(AgsTurtle *turtle,
 			GError **error);
+xmlDoc* ags_turtle_export_doc(AgsTurtle *turtle);
 
 AgsTurtle* ags_turtle_new(gchar *filename);
 
@@ -20,6 +20,8 @@
 #include <ags/lib/ags_turtle_manager.h>
 #include <ags/lib/ags_turtle.h>
 
+#include <pthread.h>
+
 void ags_turtle_manager_class_init(AgsTurtleManagerClass *turtle_manager);
 void ags_turtle_manager_init (AgsTurtleManager *turtle_manager);
 void ags_turtle_manager_dispose(GObject *gobject);
@@ -39,6 +41,8 @@ static gpointer ags_turtle_manager_parent_class = NULL;
 
 AgsTurtleManager *ags_turtle_manager = NULL;
 
+static pthread_mutex_t class_mutex = PTHREAD_MUTEX_INITIALIZER;
+
 GType
 ags_turtle_manager_get_type (void)
 {
@@ -141,17 +145,23 @@ ags_turtle_manager_find(AgsTurtleManager *turtle_manager,
 {
   GList *turtle;
 
+  pthread_mutex_lock(&(class_mutex));
+  
   turtle = turtle_manager->turtle;
 
   while(turtle != NULL){
     if(!g_ascii_strcasecmp(AGS_TURTLE(turtle->data)->filename,
 			   filename)){
+      pthread_mutex_unlock(&(class_mutex));
+      
       return(turtle->data);
     }
     
     turtle = turtle->next;
   }
 
+  pthread_mutex_unlock(&(class_mutex));
+  
   return(NULL);
 }
 
@@ -173,8 +183,12 @@ ags_turtle_manager_add(AgsTurtleManager *turtle_manager,
     return;
   }
 
+  pthread_mutex_lock(&(class_mutex));
+
   turtle_manager->turtle = g_list_prepend(turtle_manager->turtle,
 					  turtle);
+
+  pthread_mutex_unlock(&(class_mutex));
 }
 
 /**
@@ -161,6 +161,10 @@
 #include <ags/audio/recall/ags_mute_channel.h>
 #include <ags/audio/recall/ags_mute_channel_run.h>
 #include <ags/audio/recall/ags_mute_recycling.h>
+#include <ags/audio/recall/ags_oscillator_audio_signal.h>
+#include <ags/audio/recall/ags_oscillator_channel.h>
+#include <ags/audio/recall/ags_oscillator_channel_run.h>
+#include <ags/audio/recall/ags_oscillator_recycling.h>
 #include <ags/audio/recall/ags_peak_audio_signal.h>
 #include <ags/audio/recall/ags_peak_channel.h>
 #include <ags/audio/recall/ags_peak_channel_run.h>
@@ -23,6 +23,7 @@
 
 #include <ags/object/ags_marshal.h>
 #include <ags/object/ags_application_context.h>
+#include <ags/object/ags_soundcard.h>
 
 #include <ags/thread/ags_mutex_manager.h>
 
@@ -63,6 +64,11 @@ void ags_config_real_load_defaults(AgsConfig *config);
 void ags_config_real_set_value(AgsConfig *config, gchar *group, gchar *key, gchar *value);
 gchar* ags_config_real_get_value(AgsConfig *config, gchar *group, gchar *key);
 
+guint ags_config_snapshot_read_uint(GKeyFile *key_file,
+				    gchar *key,
+				    guint default_value);
+void ags_config_publish_snapshot(AgsConfig *config);
+
 /**
  * SECTION:ags_config
  * @short_description: Config Advanced Gtk+ Sequencer
@@ -250,6 +256,13 @@ ags_config_init(AgsConfig *config)
   config->application_context == NULL;
 
   config->key_file = g_key_file_new();
+
+  /* snapshot of defaults */
+  config->snapshot = NULL;
+  config->snapshot_reader_count = 0;
+  config->retired_snapshot = NULL;
+
+  ags_config_publish_snapshot(config);
 }
 
 void
@@ -374,6 +387,12 @@ ags_config_finalize(GObject *gobject)
     g_key_file_unref(config->key_file);
   }
 
+  /* snapshot */
+  ags_config_snapshot_free((AgsConfigSnapshot *) config->snapshot);
+  
+  g_list_free_full(config->retired_snapshot,
+		   (GDestroyNotify) ags_config_snapshot_free);
+  
   /* call parent */
   G_OBJECT_CLASS(ags_config_parent_class)->finalize(gobject);
 }
@@ -714,6 +733,15 @@ ags_config_real_set_value(AgsConfig *config, gchar *group, gchar *key, gchar *va
   
   g_key_file_set_value(config->key_file, group, key, value);
 
+  /* republish if a snapshot field might have changed */
+  if(!g_strcmp0(group, AGS_CONFIG_GENERIC) ||
+     !g_strcmp0(group, AGS_CONFIG_THREAD) ||
+     !g_strcmp0(group, AGS_CONFIG_SOUNDCARD) ||
+     !g_strcmp0(group, AGS_CONFIG_SOUNDCARD_0) ||
+     !g_strcmp0(group, AGS_CONFIG_RECALL)){
+    ags_config_publish_snapshot(config);
+  }
+  
   pthread_mutex_unlock(application_mutex);
 }
 
@@ -799,11 +827,20 @@ ags_config_get_value(AgsConfig *config, gchar *group, gchar *key)
 void
 ags_config_clear(AgsConfig *config)
 {
+  AgsMutexManager *mutex_manager;
+  
   gchar **group;
 
   gsize n_group;
   guint i;
   
+  pthread_mutex_t *application_mutex;
+
+  mutex_manager = ags_mutex_manager_get_instance();
+  application_mutex = ags_mutex_manager_get_application_mutex(mutex_manager);
+
+  pthread_mutex_lock(application_mutex);
+  
   group = g_key_file_get_groups(config->key_file,
 				&n_group);
 
@@ -812,6 +849,243 @@ ags_config_clear(AgsConfig *config)
     			    group[i],
     			    NULL);
   }
+
+  g_strfreev(group);
+  
+  ags_config_publish_snapshot(config);
+
+  pthread_mutex_unlock(application_mutex);
+}
+
+/**
+ * ags_config_snapshot_alloc:
+ *
+ * Allocate #AgsConfigSnapshot-struct filled with the defaults.
+ *
+ * Returns: the new #AgsConfigSnapshot-struct
+ *
+ * Since: 0.7.136
+ */
+AgsConfigSnapshot*
+ags_config_snapshot_alloc()
+{
+  AgsConfigSnapshot *snapshot;
+
+  snapshot = (AgsConfigSnapshot *) malloc(sizeof(AgsConfigSnapshot));
+
+  snapshot->flags = 0;
+
+  snapshot->pcm_channels = AGS_SOUNDCARD_DEFAULT_PCM_CHANNELS;
+  snapshot->samplerate = AGS_SOUNDCARD_DEFAULT_SAMPLERATE;
+  snapshot->buffer_size = AGS_SOUNDCARD_DEFAULT_BUFFER_SIZE;
+  snapshot->format = AGS_SOUNDCARD_DEFAULT_FORMAT;
+
+  return(snapshot);
+}
+
+/**
+ * ags_config_snapshot_free:
+ * @snapshot: the #AgsConfigSnapshot-struct
+ *
+ * Free @snapshot.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_config_snapshot_free(AgsConfigSnapshot *snapshot)
+{
+  if(snapshot == NULL){
+    return;
+  }
+
+  free(snapshot);
+}
+
+guint
+ags_config_snapshot_read_uint(GKeyFile *key_file,
+			      gchar *key,
+			      guint default_value)
+{
+  gchar *str;
+
+  guint value;
+
+  /* soundcard group takes precedence over the first soundcard */
+  str = g_key_file_get_value(key_file,
+			     AGS_CONFIG_SOUNDCARD,
+			     key,
+			     NULL);
+
+  if(str == NULL){
+    str = g_key_file_get_value(key_file,
+			       AGS_CONFIG_SOUNDCARD_0,
+			       key,
+			       NULL);
+  }
+
+  if(str == NULL){
+    return(default_value);
+  }
+
+  value = g_ascii_strtoull(str,
+			   NULL,
+			   10);
+  g_free(str);
+
+  return(value);
+}
+
+void
+ags_config_publish_snapshot(AgsConfig *config)
+{
+  AgsConfigSnapshot *snapshot, *old_snapshot;
+
+  gchar *model, *scope;
+  gchar *str;
+
+  snapshot = ags_config_snapshot_alloc();
+
+  /* soundcard */
+  snapshot->pcm_channels = ags_config_snapshot_read_uint(config->key_file,
+							 "pcm-channels\0",
+							 snapshot->pcm_channels);
+  snapshot->samplerate = ags_config_snapshot_read_uint(config->key_file,
+						       "samplerate\0",
+						       snapshot->samplerate);
+  snapshot->buffer_size = ags_config_snapshot_read_uint(config->key_file,
+							"buffer-size\0",
+							snapshot->buffer_size);
+  snapshot->format = ags_config_snapshot_read_uint(config->key_file,
+						   "format\0",
+						   snapshot->format);
+
+  /* engine mode */
+  str = g_key_file_get_value(config->key_file,
+			     AGS_CONFIG_GENERIC,
+			     "engine-mode\0",
+			     NULL);
+
+  if(str != NULL &&
+     !g_ascii_strncasecmp(str,
+			  "performance\0",
+			  12)){
+    snapshot->flags |= AGS_CONFIG_SNAPSHOT_PERFORMANCE_MODE;
+  }
+
+  g_free(str);
+
+  /* thread model */
+  model = g_key_file_get_value(config->key_file,
+			       AGS_CONFIG_THREAD,
+			       "model\0",
+			       NULL);
+  scope = g_key_file_get_value(config->key_file,
+			       AGS_CONFIG_THREAD,
+			       "super-threaded-scope\0",
+			       NULL);
+  
+  if(model != NULL && scope != NULL &&
+     !g_ascii_strncasecmp(model,
+			  "super-threaded\0",
+			  15)){
+    if(!g_ascii_strncasecmp(scope,
+			    "audio\0",
+			    6)){
+      snapshot->flags |= AGS_CONFIG_SNAPSHOT_SUPER_THREADED_AUDIO;
+    }else if(!g_ascii_strncasecmp(scope,
+				  "channel\0",
+				  8)){
+      snapshot->flags |= (AGS_CONFIG_SNAPSHOT_SUPER_THREADED_AUDIO |
+			  AGS_CONFIG_SNAPSHOT_SUPER_THREADED_CHANNEL);
+    }else if(!g_ascii_strncasecmp(scope,
+				  "recycling\0",
+				  10)){
+      snapshot->flags |= (AGS_CONFIG_SNAPSHOT_SUPER_THREADED_AUDIO |
+			  AGS_CONFIG_SNAPSHOT_SUPER_THREADED_CHANNEL |
+			  AGS_CONFIG_SNAPSHOT_SUPER_THREADED_RECYCLING);
+    }
+  }
+
+  g_free(model);
+  g_free(scope);
+  
+  /* auto-sense */
+  str = g_key_file_get_value(config->key_file,
+			     AGS_CONFIG_RECALL,
+			     "auto-sense\0",
+			     NULL);
+
+  if(!g_strcmp0(str, "true\0")){
+    snapshot->flags |= AGS_CONFIG_SNAPSHOT_AUTO_SENSE;
+  }
+
+  g_free(str);
+
+  /* publish - readers might still use the old one, so it is retired */
+  old_snapshot = (AgsConfigSnapshot *) g_atomic_pointer_get(&(config->snapshot));
+  g_atomic_pointer_set(&(config->snapshot),
+		       snapshot);
+
+  if(old_snapshot != NULL){
+    config->retired_snapshot = g_list_prepend(config->retired_snapshot,
+					      old_snapshot);
+  }
+
+  /* reclaim as soon as no reader is within a get and release pair */
+  if(g_atomic_int_get(&(config->snapshot_reader_count)) == 0){
+    g_list_free_full(config->retired_snapshot,
+		     (GDestroyNotify) ags_config_snapshot_free);
+    
+    config->retired_snapshot = NULL;
+  }
+}
+
+/**
+ * ags_config_get_snapshot:
+ * @config: the #AgsConfig
+ *
+ * Get the current typed configuration without locking or string lookups,
+ * meant to be used by real-time code. The snapshot is immutable and it is
+ * republished whenever a generic, thread, soundcard or recall value changes.
+ * It stays valid until passed to ags_config_release_snapshot().
+ *
+ * Returns: the #AgsConfigSnapshot-struct owned by @config
+ *
+ * Since: 0.7.136
+ */
+AgsConfigSnapshot*
+ags_config_get_snapshot(AgsConfig *config)
+{
+  if(config == NULL){
+    return(NULL);
+  }
+
+  /* announce the reader before loading, so a retired snapshot isn't freed */
+  g_atomic_int_inc(&(config->snapshot_reader_count));
+  
+  return((AgsConfigSnapshot *) g_atomic_pointer_get(&(config->snapshot)));
+}
+
+/**
+ * ags_config_release_snapshot:
+ * @config: the #AgsConfig
+ * @snapshot: the #AgsConfigSnapshot-struct
+ *
+ * Release @snapshot obtained by ags_config_get_snapshot(). Retired
+ * snapshots are reclaimed by the next publish after all readers released.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_config_release_snapshot(AgsConfig *config,
+			    AgsConfigSnapshot *snapshot)
+{
+  if(config == NULL ||
+     snapshot == NULL){
+    return;
+  }
+
+  g_atomic_int_dec_and_test(&(config->snapshot_reader_count));
 }
 
 /**
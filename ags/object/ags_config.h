@@ -41,8 +41,19 @@
 #define AGS_CONFIG_SEQUENCER_0 "sequencer-0\0"
 #define AGS_CONFIG_RECALL "recall\0"
 
+#define AGS_CONFIG_SNAPSHOT(ptr) ((AgsConfigSnapshot *)(ptr))
+
 typedef struct _AgsConfig AgsConfig;
 typedef struct _AgsConfigClass AgsConfigClass;
+typedef struct _AgsConfigSnapshot AgsConfigSnapshot;
+
+typedef enum{
+  AGS_CONFIG_SNAPSHOT_PERFORMANCE_MODE           = 1,
+  AGS_CONFIG_SNAPSHOT_SUPER_THREADED_AUDIO       = 1 <<  1,
+  AGS_CONFIG_SNAPSHOT_SUPER_THREADED_CHANNEL     = 1 <<  2,
+  AGS_CONFIG_SNAPSHOT_SUPER_THREADED_RECYCLING   = 1 <<  3,
+  AGS_CONFIG_SNAPSHOT_AUTO_SENSE                 = 1 <<  4,
+}AgsConfigSnapshotFlags;
 
 struct _AgsConfig
 {
@@ -54,6 +65,10 @@ struct _AgsConfig
   GObject *application_context;
 
   GKeyFile *key_file;
+
+  volatile AgsConfigSnapshot *snapshot;
+  volatile gint snapshot_reader_count;
+  GList *retired_snapshot;
 };
 
 struct _AgsConfigClass
@@ -66,6 +81,16 @@ struct _AgsConfigClass
   gchar* (*get_value)(AgsConfig *config, gchar *group, gchar *key);
 };
 
+struct _AgsConfigSnapshot
+{
+  guint flags;
+
+  guint pcm_channels;
+  guint samplerate;
+  guint buffer_size;
+  guint format;
+};
+
 GType ags_config_get_type();
 
 void ags_config_load_defaults(AgsConfig *config);
@@ -82,6 +107,13 @@ void ags_config_save(AgsConfig *config);
 
 void ags_config_clear(AgsConfig *config);
 
+AgsConfigSnapshot* ags_config_snapshot_alloc();
+void ags_config_snapshot_free(AgsConfigSnapshot *snapshot);
+
+AgsConfigSnapshot* ags_config_get_snapshot(AgsConfig *config);
+void ags_config_release_snapshot(AgsConfig *config,
+				 AgsConfigSnapshot *snapshot);
+
 AgsConfig* ags_config_get_instance();
 AgsConfig* ags_config_new(GObject *application_context);
 
@@ -53,6 +53,7 @@ enum{
   DEACTIVATE,
   RUN,
   LOAD_PLUGIN,
+  LOAD_BINARY,
   LAST_SIGNAL,
 };
 
@@ -242,6 +243,7 @@ ags_base_plugin_class_init(AgsBasePluginClass *base_plugin)
   base_plugin->run = NULL;
 
   base_plugin->load_plugin = NULL;
+  base_plugin->load_binary = NULL;
   
   /**
    * AgsBasePlugin::instantiate:
@@ -356,6 +358,24 @@ ags_base_plugin_class_init(AgsBasePluginClass *base_plugin)
 		 NULL, NULL,
 		 g_cclosure_marshal_VOID__VOID,
 		 G_TYPE_NONE, 0);
+
+  /**
+   * AgsBasePlugin::load-binary:
+   * @base_plugin: the plugin to load its binary
+   *
+   * The ::load-binary signal opens the plugin's shared object and
+   * retrieves its descriptor.
+   * 
+   * Since: 0.7.136
+   */
+  base_plugin_signals[LOAD_BINARY] =
+    g_signal_new("load-binary\0",
+		 G_TYPE_FROM_CLASS (base_plugin),
+		 G_SIGNAL_RUN_LAST,
+		 G_STRUCT_OFFSET (AgsBasePluginClass, load_binary),
+		 NULL, NULL,
+		 g_cclosure_marshal_VOID__VOID,
+		 G_TYPE_NONE, 0);
 }
 
 void
@@ -787,8 +807,6 @@ ags_base_plugin_find_ui_effect_index(GList *base_plugin, gchar *ui_filename, gui
 GList*
 ags_base_plugin_sort(GList *base_plugin)
 {  
-  GList *start;
-  
   auto gint ags_base_plugin_sort_compare_function(gpointer a, gpointer b);
 
   gint ags_base_plugin_sort_compare_function(gpointer a, gpointer b){
@@ -799,18 +817,10 @@ ags_base_plugin_sort(GList *base_plugin)
   if(base_plugin == NULL){
     return(NULL);
   }
-  
-  start = NULL;
-
-  while(base_plugin != NULL){
-    start = g_list_insert_sorted(start,
-				 base_plugin->data,
-				 (GCompareFunc) ags_base_plugin_sort_compare_function);
 
-    base_plugin = base_plugin->next;
-  }
-
-  return(start);
+  /* g_list_sort() is a stable merge sort */
+  return(g_list_sort(g_list_copy(base_plugin),
+		     (GCompareFunc) ags_base_plugin_sort_compare_function));
 }
 
 void
@@ -838,6 +848,12 @@ ags_base_plugin_instantiate(AgsBasePlugin *base_plugin,
   
   g_return_val_if_fail(AGS_IS_BASE_PLUGIN(base_plugin),
 		       NULL);
+
+  /* binary might be deferred by plugin cache */
+  if(base_plugin->plugin_so == NULL){
+    ags_base_plugin_load_binary(base_plugin);
+  }
+  
   g_object_ref(G_OBJECT(base_plugin));
   g_signal_emit(G_OBJECT(base_plugin),
 		base_plugin_signals[INSTANTIATE], 0,
@@ -956,6 +972,29 @@ ags_base_plugin_load_plugin(AgsBasePlugin *base_plugin)
   g_object_unref(G_OBJECT(base_plugin));
 }
 
+/**
+ * ags_base_plugin_load_binary:
+ * @base_plugin: the #AgsBasePlugin
+ *
+ * Load the plugin's binary and descriptor, if not done yet.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_base_plugin_load_binary(AgsBasePlugin *base_plugin)
+{
+  g_return_if_fail(AGS_IS_BASE_PLUGIN(base_plugin));
+
+  if(base_plugin->plugin_so != NULL){
+    return;
+  }
+  
+  g_object_ref(G_OBJECT(base_plugin));
+  g_signal_emit(G_OBJECT(base_plugin),
+		base_plugin_signals[LOAD_BINARY], 0);
+  g_object_unref(G_OBJECT(base_plugin));
+}
+
 
 /**
  * ags_base_plugin_new:
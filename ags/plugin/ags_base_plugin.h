@@ -107,6 +107,7 @@ struct _AgsBasePluginClass
 	      guint frame_count);
   
   void (*load_plugin)(AgsBasePlugin *base_plugin);
+  void (*load_binary)(AgsBasePlugin *base_plugin);
 };
 
 struct _AgsPortDescriptor
@@ -161,6 +162,7 @@ void ags_base_plugin_run(AgsBasePlugin *base_plugin,
 			 guint frame_count);
 
 void ags_base_plugin_load_plugin(AgsBasePlugin *base_plugin);
+void ags_base_plugin_load_binary(AgsBasePlugin *base_plugin);
 
 AgsBasePlugin* ags_base_plugin_new(gchar *filename, gchar *effect, guint effect_index);
 
@@ -25,6 +25,7 @@
 #include <ags/object/ags_marshal.h>
 
 #include <ags/plugin/ags_base_plugin.h>
+#include <ags/plugin/ags_plugin_scan.h>
 
 #include <dlfcn.h>
 #include <stdio.h>
@@ -42,6 +43,14 @@ void ags_dssi_manager_init (AgsDssiManager *dssi_manager);
 void ags_dssi_manager_dispose(GObject *gobject);
 void ags_dssi_manager_finalize(GObject *gobject);
 
+GList* ags_dssi_manager_scan_file(AgsDssiManager *dssi_manager,
+				  gchar *dssi_path,
+				  gchar *filename);
+void ags_dssi_manager_scan_job(AgsPluginScanJob *job,
+			       AgsDssiManager *dssi_manager);
+void ags_dssi_manager_add_plugin(AgsDssiManager *dssi_manager,
+				 GList *plugin_list);
+
 /**
  * SECTION:ags_dssi_manager
  * @short_description: Singleton pattern to organize DSSI
@@ -109,6 +118,8 @@ ags_dssi_manager_init(AgsDssiManager *dssi_manager)
 {
   dssi_manager->dssi_plugin = NULL;
 
+  dssi_manager->plugin_cache = NULL;
+
   if(ags_dssi_default_path == NULL){
     ags_dssi_default_path = (gchar **) malloc(3 * sizeof(gchar *));
 
@@ -238,6 +249,9 @@ ags_dssi_manager_find_dssi_plugin(AgsDssiManager *dssi_manager,
 		  filename) &&
        !g_strcmp0(AGS_BASE_PLUGIN(dssi_plugin)->effect,
 		  effect)){
+      /* the plugin cache defers loading the binary */
+      ags_base_plugin_load_binary((AgsBasePlugin *) dssi_plugin);
+      
       return(dssi_plugin);
     }
 
@@ -291,25 +305,50 @@ void
 ags_dssi_manager_load_file(AgsDssiManager *dssi_manager,
 			   gchar *dssi_path,
 			   gchar *filename)
+{
+  GList *plugin_list;
+
+  plugin_list = ags_dssi_manager_scan_file(dssi_manager,
+					   dssi_path,
+					   filename);
+  ags_dssi_manager_add_plugin(dssi_manager,
+			      plugin_list);
+
+  g_list_free(plugin_list);
+}
+
+GList*
+ags_dssi_manager_scan_file(AgsDssiManager *dssi_manager,
+			   gchar *dssi_path,
+			   gchar *filename)
 {
   AgsDssiPlugin *dssi_plugin;
 
+  GList *plugin_list;
+  
   gchar *path;
-  gchar *effect;
 
   void *plugin_so;
   DSSI_Descriptor_Function dssi_descriptor;
   DSSI_Descriptor *plugin_descriptor;
   unsigned long i;
-
-  static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
-
-  pthread_mutex_lock(&(mutex));
-
+  
   path = g_strdup_printf("%s/%s\0",
 			 dssi_path,
 			 filename);
   
+  /* restore from plugin cache */
+  if(ags_plugin_cache_is_valid(dssi_manager->plugin_cache,
+			       path)){
+    plugin_list = ags_plugin_cache_load_file(dssi_manager->plugin_cache,
+					     AGS_TYPE_DSSI_PLUGIN,
+					     path);
+    
+    g_free(path);
+    
+    return(plugin_list);
+  }
+  
   g_message("ags_dssi_manager.c loading - %s\0", path);
 
   plugin_so = dlopen(path,
@@ -320,32 +359,73 @@ ags_dssi_manager_load_file(AgsDssiManager *dssi_manager,
       
     dlerror();
 
-    pthread_mutex_unlock(&(mutex));
+    g_free(path);
     
-    return;
+    return(NULL);
   }
 
   dssi_descriptor = (DSSI_Descriptor_Function) dlsym(plugin_so,
 						     "dssi_descriptor\0");
     
+  plugin_list = NULL;
+  
   if(dlerror() == NULL && dssi_descriptor){
     for(i = 0; (plugin_descriptor = dssi_descriptor(i)) != NULL; i++){
-      if(ags_base_plugin_find_effect(dssi_manager->dssi_plugin,
+      if(ags_base_plugin_find_effect(plugin_list,
 				     path,
 				     plugin_descriptor->LADSPA_Plugin->Name) == NULL){
 	dssi_plugin = ags_dssi_plugin_new(path,
 					  plugin_descriptor->LADSPA_Plugin->Name,
 					  i);
 	ags_base_plugin_load_plugin((AgsBasePlugin *) dssi_plugin);
-	dssi_manager->dssi_plugin = g_list_prepend(dssi_manager->dssi_plugin,
-						   dssi_plugin);
+	plugin_list = g_list_prepend(plugin_list,
+				     dssi_plugin);
       }
     }
   }
 
-  pthread_mutex_unlock(&(mutex));
-
+  /* update plugin cache */
+  plugin_list = g_list_reverse(plugin_list);
+  ags_plugin_cache_add_file(dssi_manager->plugin_cache,
+			    path,
+			    plugin_list);
+  
   g_free(path);
+
+  return(plugin_list);
+}
+
+void
+ags_dssi_manager_scan_job(AgsPluginScanJob *job,
+			  AgsDssiManager *dssi_manager)
+{
+  job->plugin = ags_dssi_manager_scan_file(dssi_manager,
+					   job->path,
+					   job->filename);
+}
+
+void
+ags_dssi_manager_add_plugin(AgsDssiManager *dssi_manager,
+			    GList *plugin_list)
+{
+  static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+  pthread_mutex_lock(&(mutex));
+
+  while(plugin_list != NULL){
+    if(ags_base_plugin_find_effect(dssi_manager->dssi_plugin,
+				   AGS_BASE_PLUGIN(plugin_list->data)->filename,
+				   AGS_BASE_PLUGIN(plugin_list->data)->effect) == NULL){
+      dssi_manager->dssi_plugin = g_list_prepend(dssi_manager->dssi_plugin,
+						 plugin_list->data);
+    }else{
+      g_object_unref(plugin_list->data);
+    }
+
+    plugin_list = plugin_list->next;
+  }
+
+  pthread_mutex_unlock(&(mutex));
 }
 
 /**
@@ -359,15 +439,32 @@ ags_dssi_manager_load_file(AgsDssiManager *dssi_manager,
 void
 ags_dssi_manager_load_default_directory(AgsDssiManager *dssi_manager)
 {
-  AgsDssiPlugin *dssi_plugin;
+  AgsPluginScan *plugin_scan;
+  AgsPluginScanJob *job;
 
   GDir *dir;
 
+  GList *list, *start;
+
   gchar **dssi_path;
   gchar *filename;
 
+  gchar *cache_filename;
+
   GError *error;
 
+  /* plugin cache */
+  cache_filename = ags_plugin_cache_get_default_filename("dssi\0");
+  
+  dssi_manager->plugin_cache = ags_plugin_cache_alloc(cache_filename);
+  ags_plugin_cache_read(dssi_manager->plugin_cache);
+
+  g_free(cache_filename);
+
+  /* one job per shared object */
+  plugin_scan = ags_plugin_scan_alloc((AgsPluginScanFunc) ags_dssi_manager_scan_job,
+				      dssi_manager);
+  
   dssi_path = ags_dssi_default_path;
   
   while(*dssi_path != NULL){
@@ -397,14 +494,41 @@ ags_dssi_manager_load_default_directory(AgsDssiManager *dssi_manager)
 	 !g_list_find_custom(dssi_manager->dssi_plugin_blacklist,
 			     filename,
 			     strcmp)){
-	ags_dssi_manager_load_file(dssi_manager,
-				   *dssi_path,
-				   filename);
+	job = ags_plugin_scan_job_alloc(*dssi_path,
+					filename);
+	ags_plugin_scan_add_job(plugin_scan,
+				job);
       }
     }
+
+    g_dir_close(dir);
     
     dssi_path++;
   }
+
+  ags_plugin_scan_run(plugin_scan);
+
+  /* merge in order of jobs */
+  list = plugin_scan->job;
+
+  while(list != NULL){
+    ags_dssi_manager_add_plugin(dssi_manager,
+				AGS_PLUGIN_SCAN_JOB(list->data)->plugin);
+
+    list = list->next;
+  }
+
+  ags_plugin_scan_free(plugin_scan);
+
+  start = dssi_manager->dssi_plugin;
+  dssi_manager->dssi_plugin = ags_base_plugin_sort(start);
+
+  g_list_free(start);
+  
+  ags_plugin_cache_write(dssi_manager->plugin_cache);
+  ags_plugin_cache_free(dssi_manager->plugin_cache);
+
+  dssi_manager->plugin_cache = NULL;
 }
 
 /**
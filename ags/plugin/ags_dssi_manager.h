@@ -24,6 +24,7 @@
 #include <glib-object.h>
 
 #include <ags/plugin/ags_dssi_plugin.h>
+#include <ags/plugin/ags_plugin_cache.h>
 
 #define AGS_TYPE_DSSI_MANAGER                (ags_dssi_manager_get_type())
 #define AGS_DSSI_MANAGER(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_DSSI_MANAGER, AgsDssiManager))
@@ -41,6 +42,8 @@ struct _AgsDssiManager
   
   GList *dssi_plugin_blacklist;
   GList *dssi_plugin;
+
+  AgsPluginCache *plugin_cache;
 };
 
 struct _AgsDssiManagerClass
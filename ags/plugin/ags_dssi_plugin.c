@@ -57,6 +57,7 @@ void ags_dssi_plugin_run(AgsBasePlugin *base_plugin,
 			 snd_seq_event_t *seq_event,
 			 guint frame_count);
 void ags_dssi_plugin_load_plugin(AgsBasePlugin *base_plugin);
+void ags_dssi_plugin_load_binary(AgsBasePlugin *base_plugin);
 
 void ags_dssi_plugin_real_change_program(AgsDssiPlugin *dssi_plugin,
 					 gpointer ladspa_handle,
@@ -180,6 +181,7 @@ ags_dssi_plugin_class_init(AgsDssiPluginClass *dssi_plugin)
   base_plugin->run = ags_dssi_plugin_run;
 
   base_plugin->load_plugin = ags_dssi_plugin_load_plugin;
+  base_plugin->load_binary = ags_dssi_plugin_load_binary;
 
   /* AgsDssiPluginClass */
   dssi_plugin->change_program = ags_dssi_plugin_real_change_program;
@@ -353,33 +355,16 @@ ags_dssi_plugin_load_plugin(AgsBasePlugin *base_plugin)
 
   gchar *str;
   
-  DSSI_Descriptor_Function dssi_descriptor;
   LADSPA_PortDescriptor *port_descriptor;
   LADSPA_PortRangeHint *range_hint;
   LADSPA_PortRangeHintDescriptor hint_descriptor;
 
-  unsigned long effect_index;
   unsigned long port_count;
   unsigned long i;
   
-  base_plugin->plugin_so = dlopen(base_plugin->filename,
-				  RTLD_NOW);
-  
-  if(base_plugin->plugin_so == NULL){
-    g_warning("ags_dssi_plugin.c - failed to load static object file\0");
-    
-    dlerror();
-
-    return;
-  }
-
-  dssi_descriptor = (DSSI_Descriptor_Function) dlsym(base_plugin->plugin_so,
-						     "dssi_descriptor\0");
-  
-  if(dlerror() == NULL && dssi_descriptor){
-    effect_index = base_plugin->effect_index;
-    base_plugin->plugin_descriptor = dssi_descriptor(effect_index);
+  ags_base_plugin_load_binary(base_plugin);
 
+  if(base_plugin->plugin_so != NULL){
     if(base_plugin->plugin_descriptor != NULL){
       g_object_set(base_plugin,
 		   "unique-id\0", AGS_DSSI_PLUGIN_DESCRIPTOR(base_plugin->plugin_descriptor)->LADSPA_Plugin->UniqueID,
@@ -530,6 +515,33 @@ ags_dssi_plugin_load_plugin(AgsBasePlugin *base_plugin)
   }
 }
 
+void
+ags_dssi_plugin_load_binary(AgsBasePlugin *base_plugin)
+{
+  DSSI_Descriptor_Function dssi_descriptor;
+
+  unsigned long effect_index;
+
+  base_plugin->plugin_so = dlopen(base_plugin->filename,
+				  RTLD_NOW);
+  
+  if(base_plugin->plugin_so == NULL){
+    g_warning("ags_dssi_plugin.c - failed to load static object file\0");
+    
+    dlerror();
+
+    return;
+  }
+
+  dssi_descriptor = (DSSI_Descriptor_Function) dlsym(base_plugin->plugin_so,
+						     "dssi_descriptor\0");
+  
+  if(dlerror() == NULL && dssi_descriptor){
+    effect_index = base_plugin->effect_index;
+    base_plugin->plugin_descriptor = dssi_descriptor(effect_index);
+  }
+}
+
 void
 ags_dssi_plugin_real_change_program(AgsDssiPlugin *dssi_plugin,
 				    gpointer ladspa_handle,
@@ -25,6 +25,7 @@
 #include <ags/object/ags_marshal.h>
 
 #include <ags/plugin/ags_base_plugin.h>
+#include <ags/plugin/ags_plugin_scan.h>
 
 #include <dlfcn.h>
 #include <stdio.h>
@@ -42,6 +43,14 @@ void ags_ladspa_manager_init (AgsLadspaManager *ladspa_manager);
 void ags_ladspa_manager_dispose(GObject *gobject);
 void ags_ladspa_manager_finalize(GObject *gobject);
 
+GList* ags_ladspa_manager_scan_file(AgsLadspaManager *ladspa_manager,
+				    gchar *ladspa_path,
+				    gchar *filename);
+void ags_ladspa_manager_scan_job(AgsPluginScanJob *job,
+				 AgsLadspaManager *ladspa_manager);
+void ags_ladspa_manager_add_plugin(AgsLadspaManager *ladspa_manager,
+				   GList *plugin_list);
+
 /**
  * SECTION:ags_ladspa_manager
  * @short_description: Singleton pattern to organize LADSPA
@@ -109,6 +118,8 @@ ags_ladspa_manager_init(AgsLadspaManager *ladspa_manager)
 {
   ladspa_manager->ladspa_plugin = NULL;
 
+  ladspa_manager->plugin_cache = NULL;
+
   if(ags_ladspa_default_path == NULL){
     ags_ladspa_default_path = (gchar **) malloc(3 * sizeof(gchar *));
 
@@ -238,6 +249,9 @@ ags_ladspa_manager_find_ladspa_plugin(AgsLadspaManager *ladspa_manager,
 		  filename) &&
        !g_strcmp0(AGS_BASE_PLUGIN(ladspa_plugin)->effect,
 		  effect)){
+      /* the plugin cache defers loading the binary */
+      ags_base_plugin_load_binary((AgsBasePlugin *) ladspa_plugin);
+      
       return(ladspa_plugin);
     }
 
@@ -291,25 +305,50 @@ void
 ags_ladspa_manager_load_file(AgsLadspaManager *ladspa_manager,
 			     gchar *ladspa_path,
 			     gchar *filename)
+{
+  GList *plugin_list;
+
+  plugin_list = ags_ladspa_manager_scan_file(ladspa_manager,
+					     ladspa_path,
+					     filename);
+  ags_ladspa_manager_add_plugin(ladspa_manager,
+				plugin_list);
+
+  g_list_free(plugin_list);
+}
+
+GList*
+ags_ladspa_manager_scan_file(AgsLadspaManager *ladspa_manager,
+			     gchar *ladspa_path,
+			     gchar *filename)
 {
   AgsLadspaPlugin *ladspa_plugin;
+
+  GList *plugin_list;
   
   gchar *path;
-  gchar *effect;
 
   void *plugin_so;
   LADSPA_Descriptor_Function ladspa_descriptor;
   LADSPA_Descriptor *plugin_descriptor;
   unsigned long i;
   
-  static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
-
-  pthread_mutex_lock(&(mutex));
-
   path = g_strdup_printf("%s/%s\0",
 			 ladspa_path,
 			 filename);
   
+  /* restore from plugin cache */
+  if(ags_plugin_cache_is_valid(ladspa_manager->plugin_cache,
+			       path)){
+    plugin_list = ags_plugin_cache_load_file(ladspa_manager->plugin_cache,
+					     AGS_TYPE_LADSPA_PLUGIN,
+					     path);
+    
+    g_free(path);
+    
+    return(plugin_list);
+  }
+  
   g_message("ags_ladspa_manager.c loading - %s\0", path);
 
   plugin_so = dlopen(path,
@@ -319,32 +358,74 @@ ags_ladspa_manager_load_file(AgsLadspaManager *ladspa_manager,
     g_warning("ags_ladspa_manager.c - failed to load static object file\0");
       
     dlerror();
-    pthread_mutex_unlock(&(mutex));
 
-    return;
+    g_free(path);
+    
+    return(NULL);
   }
 
   ladspa_descriptor = (LADSPA_Descriptor_Function) dlsym(plugin_so,
 							 "ladspa_descriptor\0");
     
+  plugin_list = NULL;
+  
   if(dlerror() == NULL && ladspa_descriptor){
     for(i = 0; (plugin_descriptor = ladspa_descriptor(i)) != NULL; i++){
-      if(ags_base_plugin_find_effect(ladspa_manager->ladspa_plugin,
+      if(ags_base_plugin_find_effect(plugin_list,
 				     path,
 				     plugin_descriptor->Name) == NULL){
 	ladspa_plugin = ags_ladspa_plugin_new(path,
 					      plugin_descriptor->Name,
 					      i);
 	ags_base_plugin_load_plugin((AgsBasePlugin *) ladspa_plugin);
-	ladspa_manager->ladspa_plugin = g_list_prepend(ladspa_manager->ladspa_plugin,
-						       ladspa_plugin);
+	plugin_list = g_list_prepend(plugin_list,
+				     ladspa_plugin);
       }
     }
   }
 
-  pthread_mutex_unlock(&(mutex));
-
+  /* update plugin cache */
+  plugin_list = g_list_reverse(plugin_list);
+  ags_plugin_cache_add_file(ladspa_manager->plugin_cache,
+			    path,
+			    plugin_list);
+  
   g_free(path);
+
+  return(plugin_list);
+}
+
+void
+ags_ladspa_manager_scan_job(AgsPluginScanJob *job,
+			    AgsLadspaManager *ladspa_manager)
+{
+  job->plugin = ags_ladspa_manager_scan_file(ladspa_manager,
+					     job->path,
+					     job->filename);
+}
+
+void
+ags_ladspa_manager_add_plugin(AgsLadspaManager *ladspa_manager,
+			      GList *plugin_list)
+{
+  static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+  pthread_mutex_lock(&(mutex));
+
+  while(plugin_list != NULL){
+    if(ags_base_plugin_find_effect(ladspa_manager->ladspa_plugin,
+				   AGS_BASE_PLUGIN(plugin_list->data)->filename,
+				   AGS_BASE_PLUGIN(plugin_list->data)->effect) == NULL){
+      ladspa_manager->ladspa_plugin = g_list_prepend(ladspa_manager->ladspa_plugin,
+						     plugin_list->data);
+    }else{
+      g_object_unref(plugin_list->data);
+    }
+
+    plugin_list = plugin_list->next;
+  }
+
+  pthread_mutex_unlock(&(mutex));
 }
 
 /**
@@ -358,15 +439,32 @@ ags_ladspa_manager_load_file(AgsLadspaManager *ladspa_manager,
 void
 ags_ladspa_manager_load_default_directory(AgsLadspaManager *ladspa_manager)
 {
-  AgsLadspaPlugin *ladspa_plugin;
+  AgsPluginScan *plugin_scan;
+  AgsPluginScanJob *job;
 
   GDir *dir;
 
+  GList *list, *start;
+
   gchar **ladspa_path;
   gchar *filename;
 
+  gchar *cache_filename;
+
   GError *error;
 
+  /* plugin cache */
+  cache_filename = ags_plugin_cache_get_default_filename("ladspa\0");
+  
+  ladspa_manager->plugin_cache = ags_plugin_cache_alloc(cache_filename);
+  ags_plugin_cache_read(ladspa_manager->plugin_cache);
+
+  g_free(cache_filename);
+
+  /* one job per shared object */
+  plugin_scan = ags_plugin_scan_alloc((AgsPluginScanFunc) ags_ladspa_manager_scan_job,
+				      ladspa_manager);
+  
   ladspa_path = ags_ladspa_default_path;
 
   while(*ladspa_path != NULL){
@@ -396,14 +494,41 @@ ags_ladspa_manager_load_default_directory(AgsLadspaManager *ladspa_manager)
 	 !g_list_find_custom(ladspa_manager->ladspa_plugin_blacklist,
 			     filename,
 			     strcmp)){
-	ags_ladspa_manager_load_file(ladspa_manager,
-				     *ladspa_path,
-				     filename);
+	job = ags_plugin_scan_job_alloc(*ladspa_path,
+					filename);
+	ags_plugin_scan_add_job(plugin_scan,
+				job);
       }
     }
+
+    g_dir_close(dir);
     
     ladspa_path++;
   }
+
+  ags_plugin_scan_run(plugin_scan);
+
+  /* merge in order of jobs */
+  list = plugin_scan->job;
+
+  while(list != NULL){
+    ags_ladspa_manager_add_plugin(ladspa_manager,
+				  AGS_PLUGIN_SCAN_JOB(list->data)->plugin);
+
+    list = list->next;
+  }
+
+  ags_plugin_scan_free(plugin_scan);
+
+  start = ladspa_manager->ladspa_plugin;
+  ladspa_manager->ladspa_plugin = ags_base_plugin_sort(start);
+
+  g_list_free(start);
+  
+  ags_plugin_cache_write(ladspa_manager->plugin_cache);
+  ags_plugin_cache_free(ladspa_manager->plugin_cache);
+
+  ladspa_manager->plugin_cache = NULL;
 }
 
 /**
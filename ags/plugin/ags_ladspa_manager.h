@@ -24,6 +24,7 @@
 #include <glib-object.h>
 
 #include <ags/plugin/ags_ladspa_plugin.h>
+#include <ags/plugin/ags_plugin_cache.h>
 
 #define AGS_TYPE_LADSPA_MANAGER                (ags_ladspa_manager_get_type())
 #define AGS_LADSPA_MANAGER(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_LADSPA_MANAGER, AgsLadspaManager))
@@ -41,6 +42,8 @@ struct _AgsLadspaManager
 
   GList *ladspa_plugin_blacklist;
   GList *ladspa_plugin;
+
+  AgsPluginCache *plugin_cache;
 };
 
 struct _AgsLadspaManagerClass
@@ -61,6 +61,7 @@ void ags_ladspa_plugin_run(AgsBasePlugin *base_plugin,
 			   snd_seq_event_t *seq_event,
 			   guint frame_count);
 void ags_ladspa_plugin_load_plugin(AgsBasePlugin *base_plugin);
+void ags_ladspa_plugin_load_binary(AgsBasePlugin *base_plugin);
 
 /**
  * SECTION:ags_ladspa_plugin
@@ -156,6 +157,7 @@ ags_ladspa_plugin_class_init(AgsLadspaPluginClass *ladspa_plugin)
   base_plugin->run = ags_ladspa_plugin_run;
 
   base_plugin->load_plugin = ags_ladspa_plugin_load_plugin;
+  base_plugin->load_binary = ags_ladspa_plugin_load_binary;
 }
 
 void
@@ -269,33 +271,16 @@ ags_ladspa_plugin_load_plugin(AgsBasePlugin *base_plugin)
   AgsPortDescriptor *port;
   GList *port_list;
   
-  LADSPA_Descriptor_Function ladspa_descriptor;
   LADSPA_PortDescriptor *port_descriptor;
   LADSPA_PortRangeHint *range_hint;
   LADSPA_PortRangeHintDescriptor hint_descriptor;
 
-  unsigned long effect_index;
   unsigned long port_count;
   unsigned long i;
   
-  base_plugin->plugin_so = dlopen(base_plugin->filename,
-				  RTLD_NOW);
-  
-  if(base_plugin->plugin_so == NULL){
-    g_warning("ags_ladspa_plugin.c - failed to load static object file\0");
-    
-    dlerror();
-
-    return;
-  }
-
-  ladspa_descriptor = (LADSPA_Descriptor_Function) dlsym((void *) base_plugin->plugin_so,
-							 "ladspa_descriptor\0");
-  
-  if(dlerror() == NULL && ladspa_descriptor){
-    effect_index = base_plugin->effect_index;
-    base_plugin->plugin_descriptor = ladspa_descriptor((unsigned long) effect_index);
+  ags_base_plugin_load_binary(base_plugin);
 
+  if(base_plugin->plugin_so != NULL){
     if(base_plugin->plugin_descriptor != NULL){
       g_object_set(base_plugin,
 		   "unique-id\0", AGS_LADSPA_PLUGIN_DESCRIPTOR(base_plugin->plugin_descriptor)->UniqueID,
@@ -440,6 +425,33 @@ ags_ladspa_plugin_load_plugin(AgsBasePlugin *base_plugin)
   }
 }
 
+void
+ags_ladspa_plugin_load_binary(AgsBasePlugin *base_plugin)
+{
+  LADSPA_Descriptor_Function ladspa_descriptor;
+
+  unsigned long effect_index;
+
+  base_plugin->plugin_so = dlopen(base_plugin->filename,
+				  RTLD_NOW);
+  
+  if(base_plugin->plugin_so == NULL){
+    g_warning("ags_ladspa_plugin.c - failed to load static object file\0");
+    
+    dlerror();
+
+    return;
+  }
+
+  ladspa_descriptor = (LADSPA_Descriptor_Function) dlsym((void *) base_plugin->plugin_so,
+							 "ladspa_descriptor\0");
+  
+  if(dlerror() == NULL && ladspa_descriptor){
+    effect_index = base_plugin->effect_index;
+    base_plugin->plugin_descriptor = ladspa_descriptor((unsigned long) effect_index);
+  }
+}
+
 /**
  * ags_ladspa_plugin_new:
  * @filename: the plugin .so
@@ -28,6 +28,7 @@
 #include <ags/plugin/ags_base_plugin.h>
 #include <ags/plugin/ags_lv2_plugin.h>
 #include <ags/plugin/ags_lv2_preset.h>
+#include <ags/plugin/ags_plugin_scan.h>
 
 #include <dlfcn.h>
 #include <stdio.h>
@@ -53,6 +54,19 @@ void ags_lv2_manager_get_property(GObject *gobject,
 void ags_lv2_manager_dispose(GObject *gobject);
 void ags_lv2_manager_finalize(GObject *gobject);
 
+GList* ags_lv2_manager_scan_file(AgsLv2Manager *lv2_manager,
+				 AgsTurtle *manifest,
+				 AgsTurtle *turtle,
+				 gchar *lv2_path,
+				 gchar *filename);
+void ags_lv2_manager_scan_job(AgsPluginScanJob *job,
+			      AgsLv2Manager *lv2_manager);
+void ags_lv2_manager_add_plugin(AgsLv2Manager *lv2_manager,
+				GList *plugin_list);
+void ags_lv2_manager_load_bundle_preset(AgsLv2Manager *lv2_manager,
+					AgsTurtle *manifest,
+					gchar *plugin_path);
+
 /**
  * SECTION:ags_lv2_manager
  * @short_description: Singleton pattern to organize LV2
@@ -144,6 +158,8 @@ ags_lv2_manager_init(AgsLv2Manager *lv2_manager)
   /* initialize lv2_plugin GList */
   lv2_manager->lv2_plugin = NULL;
 
+  lv2_manager->plugin_cache = NULL;
+
   /* initiliaze ags_lv2_default_path string vector */
   if(ags_lv2_default_path == NULL){
     ags_lv2_default_path = (gchar **) malloc(3 * sizeof(gchar *));
@@ -337,6 +353,9 @@ ags_lv2_manager_find_lv2_plugin(AgsLv2Manager *lv2_manager,
 			   filename) &&
        !g_ascii_strcasecmp(AGS_BASE_PLUGIN(lv2_plugin)->effect,
 			   effect)){
+      /* the plugin cache defers loading the binary */
+      ags_base_plugin_load_binary((AgsBasePlugin *) lv2_plugin);
+      
       return(lv2_plugin);
     }
 
@@ -395,23 +414,37 @@ ags_lv2_manager_load_file(AgsLv2Manager *lv2_manager,
 			  gchar *lv2_path,
 			  gchar *filename)
 {
-  AgsLv2Plugin *lv2_plugin;
+  GList *plugin_list;
 
-  xmlNode *node;
+  plugin_list = ags_lv2_manager_scan_file(lv2_manager,
+					  manifest,
+					  turtle,
+					  lv2_path,
+					  filename);
+  ags_lv2_manager_add_plugin(lv2_manager,
+			     plugin_list);
 
-  GList *pname_list;
-  GList *effect_list;
-  GList *uri_list;
+  g_list_free(plugin_list);
+}
+
+GList*
+ags_lv2_manager_scan_file(AgsLv2Manager *lv2_manager,
+			  AgsTurtle *manifest,
+			  AgsTurtle *turtle,
+			  gchar *lv2_path,
+			  gchar *filename)
+{
+  AgsLv2Plugin *lv2_plugin;
+
+  GList *plugin_list;
+  GList *effect_list, *effect_start;
 
-  gchar *str;
   gchar *path;
-  gchar *xpath;
-  gchar *turtle_pname;
   gchar *effect;
-  gchar *escaped_effect;
   gchar *uri;
   
   guint effect_index;
+  gboolean found_effect_index;
   
   GError *error;
 
@@ -421,233 +454,149 @@ ags_lv2_manager_load_file(AgsLv2Manager *lv2_manager,
 
   uint32_t i;
 
-  static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
-
   if(turtle == NULL ||
      filename == NULL){
-    return;
+    return(NULL);
   }
   
   /* load plugin */
-  pthread_mutex_lock(&(mutex));
-
+  plugin_list = NULL;
+  
   path = g_strdup_printf("%s/%s\0",
 			 lv2_path,
 			 filename);
 
   g_message("lv2 check - %s\0", path);
 
-  //  xmlSaveFormatFileEnc("-\0", turtle->doc, "UTF-8\0", 1);
-  
   /* parse lv2 plugin */
-  xpath = "//rdf-triple//rdf-verb//rdf-pname-ln[substring(text(), string-length(text()) - string-length('doap:name') + 1) = 'doap:name']/ancestor::*[self::rdf-verb][1]/following-sibling::rdf-object-list[1]//rdf-string[text()]\0";
-  effect_list = ags_turtle_find_xpath(turtle,
-				      xpath);
+  effect_list =
+    effect_start = ags_turtle_find_triple(turtle,
+					  NULL,
+					  "<http://usefulinc.com/ns/doap#name>\0",
+					  NULL);
 
   while(effect_list != NULL){
     /* read effect name */
-    node = effect_list->data;
-    
-    if(node == NULL){
+    if(AGS_TURTLE_TRIPLE(effect_list->data)->object[0] != '"'){
       effect_list = effect_list->next;
 	  
       continue;
     }
-	  
-    str = xmlNodeGetContent(node);
 
-    if(strlen(str) < 2){
-      effect_list = effect_list->next;
-	  
-      continue;
-    }
-
-    effect = g_strndup(str + 1,
-		       strlen(str) - 2);
+    effect = ags_turtle_term_value(AGS_TURTLE_TRIPLE(effect_list->data)->object);
     
-    /* find URI */
-    escaped_effect = ags_string_util_escape_single_quote(effect);
-    xpath = "//rdf-triple//rdf-string[text()='\"%s\"']/ancestor::*[self::rdf-triple][1]/rdf-subject/rdf-iri\0";
+    /* the subject is the URI */
+    uri = NULL;
+  
+    if(AGS_TURTLE_TRIPLE(effect_list->data)->subject[0] == '<'){
+      uri = ags_turtle_term_value(AGS_TURTLE_TRIPLE(effect_list->data)->subject);
+    }
     
-    xpath = g_strdup_printf(xpath,
-			    escaped_effect);
-    uri_list = ags_turtle_find_xpath(turtle,
-				     xpath);
-    free(xpath);
+    /* get uri index, either cached or by loading the binary */
+    found_effect_index = FALSE;
+
+    if(uri != NULL){
+      found_effect_index = ags_plugin_cache_find_effect_index(lv2_manager->plugin_cache,
+							      path,
+							      uri,
+							      &effect_index);
+    }
     
-    uri = NULL;
+    if(!found_effect_index &&
+       uri != NULL){
+      plugin_so = dlopen(path,
+			 RTLD_NOW);
   
-    if(uri_list != NULL){
-      xmlNode *child;
-
-      child = ((xmlNode *) uri_list->data)->children;
-
-      while(child != NULL){
-	if(child->type == XML_ELEMENT_NODE){
-	  if(!g_ascii_strncasecmp(child->name,
-				  "rdf-iriref\0",
-				  11)){
-	    uri = xmlNodeGetContent(child);
+      if(plugin_so == NULL){
+	g_warning("ags_lv2_manager.c - failed to load static object file\0");
+    
+	dlerror();
 
-	    if(strlen(uri) > 2){
-	      uri = g_strndup(uri + 1,
-			      strlen(uri) - 2);
-	    }
-	    break;
-	  }else if(!g_ascii_strncasecmp(child->name,
-					"rdf-prefixed-name\0",
-					18)){
-	    xmlNode *pname_node;
+	g_free(effect);
+	g_free(uri);
+	
+	effect_list = effect_list->next;
+      
+	continue;
+      }
 
-	    gchar *pname;
-	  
-	    pname_node = child->children;
-	    pname = NULL;
-	  
-	    while(pname_node != NULL){
-	      if(pname_node->type == XML_ELEMENT_NODE){
-		if(!g_ascii_strncasecmp(pname_node->name,
-					"rdf-pname-ln\0",
-					11)){
-		  pname = xmlNodeGetContent(pname_node);
-		
-		  break;
-		}
-	      }
-
-	      pname_node = pname_node->next;
-	    }
-
-	    uri = pname;
-	    
-	    if(pname != NULL){
-	      gchar *suffix, *prefix;
-	      gchar *offset;
-
-	      offset = index(pname, ':');
-
-	      if(offset != NULL){
-		GList *prefix_node;
-	      
-		offset++;
-		suffix = g_strndup(offset,
-				   strlen(pname) - (offset - pname));
-		prefix = g_strndup(pname,
-				   offset - pname);
-
-		str = g_strdup_printf("//rdf-pname-ns[text()='%s']/following-sibling::*[self::rdf-iriref][1]\0",
-				      prefix);
-		prefix_node = ags_turtle_find_xpath(turtle,
-						    str);
-		free(str);
-
-		if(prefix_node != NULL){
-		  gchar *iriref;
-
-		  iriref = xmlNodeGetContent(prefix_node->data);
-
-		  if(iriref != NULL){
-		    if(strlen(iriref) > 2){
-		      gchar *tmp;
-		    
-		      tmp = g_strndup(iriref + 1,
-				      strlen(iriref) - 2);
-		      uri = g_strdup_printf("%s%s\0",
-					    tmp,
-					    suffix);
-		      free(tmp);
-		    }
-		  
-		    free(iriref);
-		  }
-		}
-	      }
-	    }
+      lv2_descriptor = (LV2_Descriptor_Function) dlsym(plugin_so,
+						       "lv2_descriptor\0");
+  
+      if(dlerror() == NULL && lv2_descriptor){
+	for(i = 0; (plugin_descriptor = lv2_descriptor(i)) != NULL; i++){
+	  if(!g_ascii_strcasecmp(plugin_descriptor->URI,
+				 uri)){
+	    effect_index = i;
+	    found_effect_index = TRUE;
+
+	    ags_plugin_cache_add_effect_index(lv2_manager->plugin_cache,
+					      path,
+					      uri,
+					      effect_index);
 	  
 	    break;
 	  }
 	}
-
-	child = child->next;
       }
     }
 
-    /* turtle pname */
-    xpath = g_strdup_printf("//rdf-triple//rdf-string[text()='\"%s\"']/ancestor::*[self::rdf-triple]//rdf-pname-ln[1]\0",
-			    escaped_effect);
-
-    pname_list = ags_turtle_find_xpath(turtle,
-				       xpath);
-
-    if(pname_list != NULL){
-      turtle_pname = xmlNodeGetContent(pname_list->data);
-    
-      g_list_free(pname_list);
-    }else{
-      turtle_pname = NULL;
+    /* append plugin */
+    if(found_effect_index &&
+       effect != NULL &&
+       ags_base_plugin_find_effect(plugin_list,
+				   path,
+				   effect) == NULL){
+      g_message("ags_lv2_manager.c loading - %s %s as %s\0",
+		path,
+		turtle->filename,
+		effect);
+
+      lv2_plugin = g_object_new(AGS_TYPE_LV2_PLUGIN,
+				"manifest\0", manifest,
+				"turtle\0", turtle,
+				"filename\0", path,
+				"effect\0", effect,
+				"uri\0", uri,
+				"effect-index\0", effect_index,
+				NULL);
+      ags_base_plugin_load_plugin((AgsBasePlugin *) lv2_plugin);
+      plugin_list = g_list_prepend(plugin_list,
+				   lv2_plugin);
     }
+
+    g_free(effect);
+    g_free(uri);
     
-    /* get uri index and append plugin */
-    plugin_so = dlopen(path,
-		       RTLD_NOW);
+    effect_list = effect_list->next;
+  }
+
+  g_list_free(effect_start);
   
-    if(plugin_so == NULL){
-      g_warning("ags_lv2_manager.c - failed to load static object file\0");
-    
-      dlerror();
+  g_free(path);
+  
+  return(g_list_reverse(plugin_list));
+}
 
-      effect_list = effect_list->next;
-      
-      continue;
-    }
+void
+ags_lv2_manager_add_plugin(AgsLv2Manager *lv2_manager,
+			   GList *plugin_list)
+{
+  static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
 
-    lv2_descriptor = (LV2_Descriptor_Function) dlsym(plugin_so,
-						     "lv2_descriptor\0");
-  
-    if(dlerror() == NULL && lv2_descriptor){
-      for(i = 0; (plugin_descriptor = lv2_descriptor(i)) != NULL; i++){
-	if(path != NULL &&
-	   effect != NULL &&
-	   uri != NULL &&
-	   !g_ascii_strcasecmp(plugin_descriptor->URI,
-			       uri)){
-	  /* check if already added */
-	  lv2_plugin = ags_lv2_manager_find_lv2_plugin(lv2_manager,
-						       path,
-						       effect);
-
-	  if(lv2_plugin != NULL){
-	    break;
-	  }
+  pthread_mutex_lock(&(mutex));
 
-	  if(ags_base_plugin_find_effect(lv2_manager->lv2_plugin,
-					 path,
-					 effect) == NULL){
-	    g_message("ags_lv2_manager.c loading - %s %s as %s\0",
-		      path,
-		      turtle->filename,
-		      effect);
-
-	    lv2_plugin = g_object_new(AGS_TYPE_LV2_PLUGIN,
-				      "manifest\0", manifest,
-				      "turtle\0", turtle,
-				      "filename\0", path,
-				      "effect\0", effect,
-				      "pname\0", turtle_pname,
-				      "uri\0", uri,
-				      "effect-index\0", i,
-				      NULL);
-	    ags_base_plugin_load_plugin((AgsBasePlugin *) lv2_plugin);
-	    lv2_manager->lv2_plugin = g_list_prepend(lv2_manager->lv2_plugin,
-						     lv2_plugin);
-	  }
-	  
-	  break;
-	}
-      }  
+  while(plugin_list != NULL){
+    if(ags_base_plugin_find_effect(lv2_manager->lv2_plugin,
+				   AGS_BASE_PLUGIN(plugin_list->data)->filename,
+				   AGS_BASE_PLUGIN(plugin_list->data)->effect) == NULL){
+      lv2_manager->lv2_plugin = g_list_prepend(lv2_manager->lv2_plugin,
+					       plugin_list->data);
+    }else{
+      g_object_unref(plugin_list->data);
     }
-    
-    effect_list = effect_list->next;
+
+    plugin_list = plugin_list->next;
   }
 
   pthread_mutex_unlock(&(mutex));
@@ -670,115 +619,29 @@ ags_lv2_manager_load_preset(AgsLv2Manager *lv2_manager,
 {
   AgsLv2Preset *lv2_preset;
 
-  GList *preset_list;
+  GList *preset_list, *preset_start;
 
   gchar *str;
-  gchar *xpath;
   gchar *uri;
 
   if(lv2_plugin == NULL ||
      lv2_plugin->preset != NULL){
     return;
   }
-  
-  xpath = "//rdf-triple//rdf-verb[@verb='a']/following-sibling::*[self::rdf-object-list]//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':preset') + 1) = ':preset']/ancestor::*[self::rdf-triple][1]/rdf-subject/rdf-iri\0";
 
-  preset_list = ags_turtle_find_xpath(preset,
-				      xpath);
+  preset_list =
+    preset_start = ags_turtle_find_triple(preset,
+					  NULL,
+					  AGS_TURTLE_RDF_TYPE,
+					  "<http://lv2plug.in/ns/ext/presets#Preset>\0");
 
   while(preset_list != NULL){
-    xmlNode *child;
-    
-    child = ((xmlNode *) preset_list->data)->children;
+    /* the subject is the URI */
+    str = AGS_TURTLE_TRIPLE(preset_list->data)->subject;
     uri = NULL;
-    
-    while(child != NULL){
-      if(child->type == XML_ELEMENT_NODE){
-	if(!g_ascii_strncasecmp(child->name,
-				"rdf-iriref\0",
-				11)){
-	  uri = xmlNodeGetContent(child);
-
-	  if(strlen(uri) > 2){
-	    uri = g_strndup(uri + 1,
-			    strlen(uri) - 2);
-	  }
-	  break;
-	}else if(!g_ascii_strncasecmp(child->name,
-				      "rdf-prefixed-name\0",
-				      18)){
-	  xmlNode *pname_node;
 
-	  gchar *pname;
-	  
-	  pname_node = child->children;
-	  pname = NULL;
-	  
-	  while(pname_node != NULL){
-	    if(pname_node->type == XML_ELEMENT_NODE){
-	      if(!g_ascii_strncasecmp(pname_node->name,
-				      "rdf-pname-ln\0",
-				      11)){
-		pname = xmlNodeGetContent(pname_node);
-		
-		break;
-	      }
-	    }
-
-	    pname_node = pname_node->next;
-	  }
-
-	  uri = pname;
-	    
-	  if(pname != NULL){
-	    gchar *suffix, *prefix;
-	    gchar *offset;
-
-	    offset = index(pname, ':');
-
-	    if(offset != NULL){
-	      GList *prefix_node;
-	      
-	      offset++;
-	      suffix = g_strndup(offset,
-				 strlen(pname) - (offset - pname));
-	      prefix = g_strndup(pname,
-				 offset - pname);
-
-	      str = g_strdup_printf("//rdf-pname-ns[text()='%s']/following-sibling::*[self::rdf-iriref][1]\0",
-				    prefix);
-	      prefix_node = ags_turtle_find_xpath(preset,
-						  str);
-	      free(str);
-
-	      if(prefix_node != NULL){
-		gchar *iriref;
-
-		iriref = xmlNodeGetContent(prefix_node->data);
-
-		if(iriref != NULL){
-		  if(strlen(iriref) > 2){
-		    gchar *tmp;
-		    
-		    tmp = g_strndup(iriref + 1,
-				    strlen(iriref) - 2);
-		    uri = g_strdup_printf("%s%s\0",
-					  tmp,
-					  suffix);
-		    free(tmp);
-		  }
-		  
-		  free(iriref);
-		}
-	      }
-	    }
-	  }
-	  
-	  break;
-	}
-      }
-
-      child = child->next;
+    if(str[0] == '<'){
+      uri = ags_turtle_term_value(str);
     }
 
     if(uri == NULL){
@@ -800,10 +663,285 @@ ags_lv2_manager_load_preset(AgsLv2Manager *lv2_manager,
     ags_lv2_preset_parse_turtle(lv2_preset);
     lv2_plugin->preset = g_list_append(lv2_plugin->preset,
 				       lv2_preset);
+
+    g_free(uri);
     
     /* iterate */
     preset_list = preset_list->next;
   }
+
+  g_list_free(preset_start);
+}
+
+void
+ags_lv2_manager_scan_job(AgsPluginScanJob *job,
+			 AgsLv2Manager *lv2_manager)
+{
+  AgsTurtle *manifest, *turtle;
+
+  GList *ttl_list, *ttl_start;
+  GList *binary_list, *binary_start;
+  GList *plugin_list;
+
+  gchar *plugin_path;
+  gchar *manifest_filename;
+  gchar *turtle_path, *filename;
+  gchar *str;
+
+  plugin_path = g_strdup_printf("%s/%s\0",
+				job->path,
+				job->filename);
+
+  if(!g_file_test(plugin_path,
+		  G_FILE_TEST_IS_DIR)){
+    g_free(plugin_path);
+    
+    return;
+  }
+
+  manifest_filename = g_strdup_printf("%s/manifest.ttl\0",
+				      plugin_path);
+
+  if(!g_file_test(manifest_filename,
+		  G_FILE_TEST_EXISTS)){
+    g_free(manifest_filename);
+    g_free(plugin_path);
+    
+    return;
+  }
+	
+  manifest = ags_turtle_new(manifest_filename);
+  ags_turtle_load(manifest,
+		  NULL);
+
+  /* read binary from turtle */
+  binary_list =
+    binary_start = ags_turtle_find_triple(manifest,
+					  NULL,
+					  "<http://lv2plug.in/ns/lv2core#binary>\0",
+					  NULL);
+
+  /* persist XML */
+  //NOTE:JK: no need for it
+
+  //xmlDocDumpFormatMemoryEnc(manifest->doc, &buffer, &size, "UTF-8\0", TRUE);
+
+  //out = fopen(g_strdup_printf("%s/manifest.xml\0", plugin_path), "w+\0");
+
+  //fwrite(buffer, size, sizeof(xmlChar), out);
+  //fflush(out);
+
+  /* load */
+  while(binary_list != NULL){
+    /* read filename of binary */
+    str = AGS_TURTLE_TRIPLE(binary_list->data)->object;
+
+    if(!g_str_has_suffix(str,
+			 ".so>\0")){
+      binary_list = binary_list->next;
+      continue;
+    }
+
+    str = g_strndup(&(str[1]),
+		    strlen(str) - 2);
+    filename = g_strdup_printf("%s/%s\0",
+			       job->filename,
+			       str);
+    free(str);
+
+    /* read turtle from manifest */
+    ttl_list =
+      ttl_start = ags_turtle_find_object(manifest,
+					 AGS_TURTLE_TRIPLE(binary_list->data)->subject,
+					 "<http://www.w3.org/2000/01/rdf-schema#seeAlso>\0");
+
+    while(ttl_list != NULL){
+      /* read filename */
+      turtle_path = ttl_list->data;
+
+      if(!g_str_has_suffix(turtle_path,
+			   ".ttl>\0")){
+	ttl_list = ttl_list->next;
+
+	continue;
+      }
+
+      turtle_path = g_strndup(&(turtle_path[1]),
+			      strlen(turtle_path) - 2);
+
+      if(!g_ascii_strncasecmp(turtle_path,
+			      "http://\0",
+			      7)){
+	ttl_list = ttl_list->next;
+
+	continue;
+      }
+
+      /* load turtle doc */
+      if((turtle = (AgsTurtle *) ags_turtle_manager_find(ags_turtle_manager_get_instance(),
+							 turtle_path)) == NULL){
+	turtle = ags_turtle_new(g_strdup_printf("%s/%s\0",
+						plugin_path,
+						turtle_path));
+	ags_turtle_load(turtle,
+			NULL);
+	ags_turtle_manager_add(ags_turtle_manager_get_instance(),
+			       (GObject *) turtle);
+      }
+
+      /* load specified plugin */
+      if(!g_list_find_custom(lv2_manager->lv2_plugin_blacklist,
+			     filename,
+			     strcmp)){
+	plugin_list = ags_lv2_manager_scan_file(lv2_manager,
+						manifest,
+						turtle,
+						job->path,
+						filename);
+	job->plugin = g_list_concat(job->plugin,
+				    plugin_list);
+      }
+
+      /* persist XML */
+      //NOTE:JK: no need for it
+      //xmlDocDumpFormatMemoryEnc(turtle->doc, &buffer, &size, "UTF-8\0", TRUE);
+
+      //out = fopen(g_strdup_printf("%s/%s.xml\0", plugin_path, turtle_path), "w+\0");
+
+      //fwrite(buffer, size, sizeof(xmlChar), out);
+      //fflush(out);
+      //	xmlSaveFormatFileEnc("-\0", turtle->doc, "UTF-8\0", 1);
+
+      ttl_list = ttl_list->next;
+    }
+
+    g_list_free(ttl_start);
+    
+    binary_list = binary_list->next;
+  }
+
+  g_list_free(binary_start);
+
+  /* presets are loaded after merge */
+  job->data = manifest;
+
+  g_free(plugin_path);
+}
+
+void
+ags_lv2_manager_load_bundle_preset(AgsLv2Manager *lv2_manager,
+				   AgsTurtle *manifest,
+				   gchar *plugin_path)
+{
+  AgsLv2Plugin *lv2_plugin;
+
+  AgsTurtle *preset;
+
+  GList *preset_list, *preset_start;
+  GList *uri_list;
+  GList *list, *start;
+
+  gchar *uri;
+  gchar *preset_path;
+
+  /* read presets from turtle */
+  preset_list =
+    preset_start = ags_turtle_find_subject(manifest,
+					   AGS_TURTLE_RDF_TYPE,
+					   "<http://lv2plug.in/ns/ext/presets#Preset>\0");
+
+  while(preset_list != NULL){
+    /* read filename of turtle */
+    list =
+      start = ags_turtle_find_object(manifest,
+				     preset_list->data,
+				     "<http://www.w3.org/2000/01/rdf-schema#seeAlso>\0");
+    preset_path = NULL;
+    
+    while(list != NULL){
+      if(g_str_has_suffix(list->data,
+			  ".ttl>\0")){
+	preset_path = ags_turtle_term_value(list->data);
+
+	break;
+      }
+      
+      list = list->next;
+    }
+
+    g_list_free(start);
+    
+    if(preset_path == NULL){
+      preset_list = preset_list->next;
+
+      continue;
+    }
+
+    /* read filename */
+    if(!g_ascii_strncasecmp(preset_path,
+			    "http://\0",
+			    7)){
+      g_free(preset_path);
+      
+      preset_list = preset_list->next;
+
+      continue;
+    }
+
+    /* plugin uri */
+    uri_list = ags_turtle_find_object(manifest,
+				      preset_list->data,
+				      "<http://lv2plug.in/ns/lv2core#appliesTo>\0");
+
+    if(uri_list != NULL){
+      uri = ags_turtle_term_value(uri_list->data);
+
+      g_list_free(uri_list);
+    }else{
+      g_free(preset_path);
+      
+      preset_list = preset_list->next;
+
+      continue;
+    }
+
+    /* find lv2 plugin by uri */
+    list = ags_lv2_plugin_find_uri(lv2_manager->lv2_plugin,
+				   uri);	  
+    g_free(uri);
+    
+    if(list == NULL){
+      g_free(preset_path);
+      
+      preset_list = preset_list->next;
+
+      continue;
+    }
+
+    lv2_plugin = list->data;
+
+    /* load turtle doc */
+    if((preset = (AgsTurtle *) ags_turtle_manager_find(ags_turtle_manager_get_instance(),
+						       preset_path)) == NULL){
+      preset = ags_turtle_new(g_strdup_printf("%s/%s\0",
+					      plugin_path,
+					      preset_path));
+      ags_turtle_load(preset,
+		      NULL);
+      ags_turtle_manager_add(ags_turtle_manager_get_instance(),
+			     (GObject *) preset);
+    }
+
+    ags_lv2_manager_load_preset(lv2_manager,
+				lv2_plugin,
+				preset);
+
+    g_free(preset_path);
+    
+    preset_list = preset_list->next;
+  }
+
+  g_list_free(preset_start);
 }
 
 /**
@@ -817,15 +955,32 @@ ags_lv2_manager_load_preset(AgsLv2Manager *lv2_manager,
 void
 ags_lv2_manager_load_default_directory(AgsLv2Manager *lv2_manager)
 {
+  AgsPluginScan *plugin_scan;
+  AgsPluginScanJob *job;
+
   GDir *dir;
 
+  GList *list, *start;
+
   gchar **lv2_path;
   gchar *path, *plugin_path;
-  gchar *xpath;
-  gchar *str;
+
+  gchar *cache_filename;
 
   GError *error;
 
+  /* plugin cache */
+  cache_filename = ags_plugin_cache_get_default_filename("lv2\0");
+  
+  lv2_manager->plugin_cache = ags_plugin_cache_alloc(cache_filename);
+  ags_plugin_cache_read(lv2_manager->plugin_cache);
+
+  g_free(cache_filename);
+
+  /* one job per bundle */
+  plugin_scan = ags_plugin_scan_alloc((AgsPluginScanFunc) ags_lv2_manager_scan_job,
+				      lv2_manager);
+  
   lv2_path = ags_lv2_default_path;
 
   while(*lv2_path != NULL){
@@ -858,230 +1013,60 @@ ags_lv2_manager_load_default_directory(AgsLv2Manager *lv2_manager)
 			      2)){
 	continue;
       }
-    
-      plugin_path = g_strdup_printf("%s/%s\0",
-				    *lv2_path,
-				    path);
-
-      if(g_file_test(plugin_path,
-		     G_FILE_TEST_IS_DIR)){
-	AgsLv2Plugin *lv2_plugin;
-	
-	AgsTurtle *manifest, *turtle;
-	AgsTurtle *preset;
-	
-	xmlDoc *doc;
-
-	//	FILE *out;
-
-	//	xmlChar *buffer;
-	//	int size;
-      
-	GList *ttl_list, *binary_list;
-	GList *preset_list;
-	GList *pname_list;
-	GList *list;
-	
-	gchar *manifest_filename;
-
-	gchar *turtle_path, *filename;
-	gchar *turtle_pname;
-	
-	gchar *preset_path;
-	
-	gboolean turtle_loaded;
-
-	manifest_filename = g_strdup_printf("%s/manifest.ttl\0",
-					    plugin_path);
-
-	if(!g_file_test(manifest_filename,
-			G_FILE_TEST_EXISTS)){
-	  continue;
-	}
-	
-	manifest = ags_turtle_new(manifest_filename);
-	ags_turtle_load(manifest,
-			NULL);
-
-	/* read binary from turtle */
-	binary_list = ags_turtle_find_xpath(manifest,
-					    "//rdf-triple//rdf-verb//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':binary') + 1) = ':binary']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-iriref[substring(text(), string-length(text()) - string-length('.so>') + 1) = '.so>']\0");
-
-	/* persist XML */
-	//NOTE:JK: no need for it
-      
-	//xmlDocDumpFormatMemoryEnc(manifest->doc, &buffer, &size, "UTF-8\0", TRUE);
-
-	//out = fopen(g_strdup_printf("%s/manifest.xml\0", plugin_path), "w+\0");
-
-	//fwrite(buffer, size, sizeof(xmlChar), out);
-	//fflush(out);
-            
-	/* load */
-	while(binary_list != NULL){
-	  /* read filename of binary */
-	  str = xmlNodeGetContent((xmlNode *) binary_list->data);
-
-	  if(str == NULL){
-	    binary_list = binary_list->next;
-	    continue;
-	  }
-	
-	  str = g_strndup(&(str[1]),
-			  strlen(str) - 2);
-	  filename = g_strdup_printf("%s/%s\0",
-				     path,
-				     str);
-	  free(str);
-
-	  /* read turtle from manifest */
-	  ttl_list = ags_turtle_find_xpath_with_context_node(manifest,
-							     "./ancestor::*[self::rdf-triple][1]//rdf-iriref[substring(text(), string-length(text()) - string-length('.ttl>') + 1) = '.ttl>']\0",
-							     (xmlNode *) binary_list->data);
-
-	  while(ttl_list != NULL){
-	    /* read filename */
-	    turtle_path = xmlNodeGetContent((xmlNode *) ttl_list->data);
-
-	    if(turtle_path == NULL){
-	      ttl_list = ttl_list->next;
-	  
-	      continue;
-	    }
-	
-	    turtle_path = g_strndup(&(turtle_path[1]),
-				    strlen(turtle_path) - 2);
-	
-	    if(!g_ascii_strncasecmp(turtle_path,
-				    "http://\0",
-				    7)){
-	      ttl_list = ttl_list->next;
-	  
-	      continue;
-	    }
-
-	    /* load turtle doc */
-	    if((turtle = (AgsTurtle *) ags_turtle_manager_find(ags_turtle_manager_get_instance(),
-							       turtle_path)) == NULL){
-	      turtle = ags_turtle_new(g_strdup_printf("%s/%s\0",
-						      plugin_path,
-						      turtle_path));
-	      ags_turtle_load(turtle,
-			      NULL);
-	      ags_turtle_manager_add(ags_turtle_manager_get_instance(),
-				     (GObject *) turtle);
-	    }
-	
-	    /* load specified plugin */
-	    if(!g_list_find_custom(lv2_manager->lv2_plugin_blacklist,
-				   filename,
-				   strcmp)){
-	      ags_lv2_manager_load_file(lv2_manager,
-					manifest,
-					turtle,
-					*lv2_path,
-					filename);
-	    }
-	    
-	    /* persist XML */
-	    //NOTE:JK: no need for it
-	    //xmlDocDumpFormatMemoryEnc(turtle->doc, &buffer, &size, "UTF-8\0", TRUE);
-
-	    //out = fopen(g_strdup_printf("%s/%s.xml\0", plugin_path, turtle_path), "w+\0");
-	
-	    //fwrite(buffer, size, sizeof(xmlChar), out);
-	    //fflush(out);
-	    //	xmlSaveFormatFileEnc("-\0", turtle->doc, "UTF-8\0", 1);
-
-	    ttl_list = ttl_list->next;
-	  }
-	
-	  binary_list = binary_list->next;
-	}
 
-    	/* read presets from turtle */
-	xpath = "//rdf-triple//rdf-verb[@verb='a']/following-sibling::*[self::rdf-object-list]//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':preset') + 1) = ':preset']/ancestor::*[self::rdf-triple]\0";
-	preset_list = ags_turtle_find_xpath(manifest,
-					    xpath);
-
-	while(preset_list != NULL){
-	  xpath = ".//rdf-iriref[substring(text(), string-length(text()) - string-length('.ttl>') + 1) = '.ttl>']";
-	  list = ags_turtle_find_xpath_with_context_node(manifest,
-							 xpath,
-							 preset_list->data);
-	  
-	  /* read filename of turtle */
-	  preset_path = xmlNodeGetContent((xmlNode *) list->data);
-
-	  if(preset_path == NULL){
-	    preset_list = preset_list->next;
+      job = ags_plugin_scan_job_alloc(*lv2_path,
+				      path);
+      ags_plugin_scan_add_job(plugin_scan,
+			      job);
+    }
 
-	    continue;
-	  }
+    g_dir_close(dir);
+    
+    lv2_path++;
+  }
 
-	  /* read filename */
-	  preset_path = g_strndup(&(preset_path[1]),
-				  strlen(preset_path) - 2);
-	
-	  if(!g_ascii_strncasecmp(preset_path,
-				  "http://\0",
-				  7)){
-	    preset_list = preset_list->next;
-	  
-	    continue;
-	  }
+  ags_plugin_scan_run(plugin_scan);
 
-	  /* turtle pname */
-	  xpath = ".//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':appliesto') + 1) = ':appliesto']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-pname-ln\0";
-	  pname_list = ags_turtle_find_xpath_with_context_node(manifest,
-							       xpath,
-							       preset_list->data);
+  /* merge in order of jobs */
+  list = plugin_scan->job;
 
-	  if(pname_list != NULL){
-	    turtle_pname = xmlNodeGetContent(pname_list->data);
-    
-	    g_list_free(pname_list);
-	  }else{
-	    preset_list = preset_list->next;
+  while(list != NULL){
+    ags_lv2_manager_add_plugin(lv2_manager,
+			       AGS_PLUGIN_SCAN_JOB(list->data)->plugin);
 
-	    continue;
-	  }
+    list = list->next;
+  }
 
-	  /* find lv2 plugin by pname */
-	  list = ags_lv2_plugin_find_pname(lv2_manager->lv2_plugin,
-					   turtle_pname);	  
-	  
-	  if(list == NULL){
-	    preset_list = preset_list->next;
+  start = lv2_manager->lv2_plugin;
+  lv2_manager->lv2_plugin = ags_base_plugin_sort(start);
 
-	    continue;
-	  }
+  g_list_free(start);
 
-	  lv2_plugin = list->data;
-	  
-	  /* load turtle doc */
-	  if((preset = (AgsTurtle *) ags_turtle_manager_find(ags_turtle_manager_get_instance(),
-							     preset_path)) == NULL){
-	    preset = ags_turtle_new(g_strdup_printf("%s/%s\0",
-						    plugin_path,
-						    preset_path));
-	    ags_turtle_load(preset,
-			    NULL);
-	    ags_turtle_manager_add(ags_turtle_manager_get_instance(),
-				   (GObject *) preset);
-	  }
+  /* presets need the merged plugins */
+  list = plugin_scan->job;
 
-	  ags_lv2_manager_load_preset(lv2_manager,
-				      lv2_plugin,
-				      preset);
+  while(list != NULL){
+    job = AGS_PLUGIN_SCAN_JOB(list->data);
 
-	  preset_list = preset_list->next;
-	}
-      }
+    if(job->data != NULL){
+      plugin_path = g_strdup_printf("%s/%s\0",
+				    job->path,
+				    job->filename);
+      ags_lv2_manager_load_bundle_preset(lv2_manager,
+					 (AgsTurtle *) job->data,
+					 plugin_path);
+      g_free(plugin_path);
     }
 
-    lv2_path++;
+    list = list->next;
   }
+  
+  ags_plugin_scan_free(plugin_scan);
+
+  ags_plugin_cache_write(lv2_manager->plugin_cache);
+  ags_plugin_cache_free(lv2_manager->plugin_cache);
+
+  lv2_manager->plugin_cache = NULL;
 }
 
 /**
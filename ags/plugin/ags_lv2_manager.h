@@ -24,6 +24,7 @@
 #include <glib-object.h>
 
 #include <ags/plugin/ags_lv2_plugin.h>
+#include <ags/plugin/ags_plugin_cache.h>
 
 #include <lv2.h>
 
@@ -50,6 +51,8 @@ struct _AgsLv2Manager
 
   GList *lv2_plugin_blacklist;
   GList *lv2_plugin;
+
+  AgsPluginCache *plugin_cache;
 };
 
 struct _AgsLv2ManagerClass
@@ -19,8 +19,6 @@
 
 #include <ags/plugin/ags_lv2_plugin.h>
 
-#include <ags/lib/ags_string_util.h>
-
 #include <ags/object/ags_soundcard.h>
 #include <ags/object/ags_config.h>
 #include <ags/object/ags_marshal.h>
@@ -74,6 +72,7 @@ void ags_lv2_plugin_run(AgsBasePlugin *base_plugin,
 			snd_seq_event_t *seq_event,
 			guint frame_count);
 void ags_lv2_plugin_load_plugin(AgsBasePlugin *base_plugin);
+void ags_lv2_plugin_load_binary(AgsBasePlugin *base_plugin);
 
 void ags_lv2_plugin_real_change_program(AgsLv2Plugin *lv2_plugin,
 					gpointer ladspa_handle,
@@ -247,6 +246,7 @@ ags_lv2_plugin_class_init(AgsLv2PluginClass *lv2_plugin)
   base_plugin->run = ags_lv2_plugin_run;
 
   base_plugin->load_plugin = ags_lv2_plugin_load_plugin;
+  base_plugin->load_binary = ags_lv2_plugin_load_binary;
 
   /* AgsLv2PluginClass */
   lv2_plugin->change_program = ags_lv2_plugin_real_change_program;
@@ -845,119 +845,127 @@ ags_lv2_plugin_load_plugin(AgsBasePlugin *base_plugin)
   GList *extension_list;
   GList *feature_list;
   GList *ui_list;
-  GList *port_list;
+  GList *port_list, *port_start;
   GList *port_descriptor_list;
   
-  gchar *escaped_effect;
-  gchar *xpath;
-  gchar *uri;
+  gchar *subject;
+  gchar *port_node;
+  gchar *str;
 
   gdouble lower_value, upper_value;
   guint i;
-  gboolean found_port;
-  
-  LV2_Descriptor_Function lv2_descriptor;
-  LV2_Descriptor *plugin_descriptor;
-
-  uint32_t effect_index;
   
   lv2_plugin = AGS_LV2_PLUGIN(base_plugin);  
-  base_plugin->plugin_so = dlopen(base_plugin->filename,
-				  RTLD_NOW);
 
-  if(base_plugin->plugin_so == NULL){
-    g_warning("ags_lv2_plugin.c - failed to load static object file\0");
-    
-    dlerror();
+  /* the binary itself is opened on demand by ags_base_plugin_load_binary() */
+  if(lv2_plugin->turtle != NULL){
+    GList *list, *list_start;
 
-    return;
-  }
+    /* retrieve subject by uri */
+    subject = NULL;
 
-  lv2_descriptor = (LV2_Descriptor_Function) dlsym(base_plugin->plugin_so,
-						   "lv2_descriptor\0");
-  
-  if(dlerror() == NULL && lv2_descriptor){
-    xmlNode *triple_node;
-    xmlNode *port_node;
-    xmlNode *current;
+    if(lv2_plugin->uri != NULL){
+      str = g_strdup_printf("<%s>\0",
+			    lv2_plugin->uri);
+      subject = ags_turtle_lookup_string(lv2_plugin->turtle,
+					 str);
+      g_free(str);
+    }
 
-    GList *list, *list_start;
+    /* otherwise by name */
+    if(subject == NULL){
+      list_start = 
+	list = ags_turtle_find_triple(lv2_plugin->turtle,
+				      NULL,
+				      "<http://usefulinc.com/ns/doap#name>\0",
+				      NULL);
+
+      while(list != NULL){
+	str = ags_turtle_term_value(AGS_TURTLE_TRIPLE(list->data)->object);
 
-    escaped_effect = ags_string_util_escape_single_quote(base_plugin->effect);
+	if(!g_strcmp0(str,
+		      base_plugin->effect)){
+	  subject = AGS_TURTLE_TRIPLE(list->data)->subject;
+	}
 
-    /* retrieve name node as context node */
-    xpath = g_strdup_printf("(//rdf-triple//rdf-verb[//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':name') + 1) = ':name'] and following-sibling::*//rdf-string[text()='\"%s\"']]/ancestor::*[self::rdf-triple])[1]\0",
-			    escaped_effect);
-    
-    list = ags_turtle_find_xpath(lv2_plugin->turtle,
-				 xpath);
+	g_free(str);
 
-    free(xpath);
+	if(subject != NULL){
+	  break;
+	}
+	
+	list = list->next;
+      }
 
-    if(list != NULL){
-      triple_node = (xmlNode *) list->data;
+      g_list_free(list_start);
+    }
 
-      g_list_free(list);
-    }else{
+    if(subject == NULL){
       g_warning("rdf-triple not found\0");
       
       return;
     }
     
     /* name metadata */
-    xpath = ".//rdf-pname-ln[text()='doap:name']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-string\0";    
-    metadata_list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-							    xpath,
-							    triple_node);
+    metadata_list = ags_turtle_find_object(lv2_plugin->turtle,
+					   subject,
+					   "<http://usefulinc.com/ns/doap#name>\0");
 
     if(metadata_list != NULL){
-      lv2_plugin->doap_name = xmlNodeGetContent((xmlNode *) metadata_list->data);
+      lv2_plugin->doap_name = ags_turtle_term_value(metadata_list->data);
 
       g_list_free(metadata_list);
     }
 
-    /* author metadata */
-    xpath = ".//rdf-pname-ln[text()='foaf:name']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-string\0";
-    metadata_list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-							    xpath,
-							    triple_node);
+    /* author metadata of the plugin or its maintainer */
+    list_start = ags_turtle_find_object(lv2_plugin->turtle,
+					subject,
+					"<http://usefulinc.com/ns/doap#maintainer>\0");
+    list_start = g_list_concat(list_start,
+			       ags_turtle_find_object(lv2_plugin->turtle,
+						      subject,
+						      "<http://usefulinc.com/ns/doap#developer>\0"));
+    list_start = g_list_prepend(list_start,
+				subject);
+
+    for(list = list_start; list != NULL; list = list->next){
+      if(lv2_plugin->foaf_name == NULL &&
+	 (metadata_list = ags_turtle_find_object(lv2_plugin->turtle,
+						 list->data,
+						 "<http://xmlns.com/foaf/0.1/name>\0")) != NULL){
+	lv2_plugin->foaf_name = ags_turtle_term_value(metadata_list->data);
+
+	g_list_free(metadata_list);
+      }
 
-    if(metadata_list != NULL){
-      lv2_plugin->foaf_name = xmlNodeGetContent((xmlNode *) metadata_list->data);
+      /* homepage metadata */
+      if(lv2_plugin->foaf_homepage == NULL &&
+	 (metadata_list = ags_turtle_find_object(lv2_plugin->turtle,
+						 list->data,
+						 "<http://xmlns.com/foaf/0.1/homepage>\0")) != NULL){
+	lv2_plugin->foaf_homepage = ags_turtle_term_value(metadata_list->data);
 
-      g_list_free(metadata_list);
-    }
-
-    /* homepage metadata */
-    xpath = ".//rdf-pname-ln[text()='foaf:homepage']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-string\0";
-    metadata_list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-							    xpath,
-							    triple_node);
+	g_list_free(metadata_list);
+      }
 
-    if(metadata_list != NULL){
-      lv2_plugin->foaf_homepage = xmlNodeGetContent((xmlNode *) metadata_list->data);
+      /* mbox metadata */
+      if(lv2_plugin->foaf_mbox == NULL &&
+	 (metadata_list = ags_turtle_find_object(lv2_plugin->turtle,
+						 list->data,
+						 "<http://xmlns.com/foaf/0.1/mbox>\0")) != NULL){
+	lv2_plugin->foaf_mbox = ags_turtle_term_value(metadata_list->data);
 
-      g_list_free(metadata_list);
+	g_list_free(metadata_list);
+      }
     }
 
-    /* mbox metadata */
-    xpath = ".//rdf-pname-ln[text()='foaf:mbox']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-string\0";
-    metadata_list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-							    xpath,
-							    triple_node);
-
-    if(metadata_list != NULL){
-      lv2_plugin->foaf_mbox = xmlNodeGetContent((xmlNode *) metadata_list->data);
+    g_list_free(list_start);
     
-      g_list_free(metadata_list);
-    }
-
     /* check programs interface */
-    xpath = ".//rdf-pname-ln[text()='lv2:extensiondata']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-iriref[text()='<http://kxstudio.sf.net/ns/lv2ext/programs#Interface>']";
-
-    extension_list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-							     xpath,
-							     triple_node);
+    extension_list = ags_turtle_find_triple(lv2_plugin->turtle,
+					    subject,
+					    "<http://lv2plug.in/ns/lv2core#extensionData>\0",
+					    "<http://kxstudio.sf.net/ns/lv2ext/programs#Interface>\0");
 
     if(extension_list != NULL){
       lv2_plugin->flags |= AGS_LV2_PLUGIN_HAS_PROGRAM_INTERFACE;
@@ -966,11 +974,10 @@ ags_lv2_plugin_load_plugin(AgsBasePlugin *base_plugin)
     }
     
     /* check needs worker */
-    xpath = ".//rdf-pname-ln[text()='lv2:requiredFeature']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-pname-ln[text()='lv2worker:schedule']";
-
-    feature_list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-							   xpath,
-							   triple_node);
+    feature_list = ags_turtle_find_triple(lv2_plugin->turtle,
+					  subject,
+					  "<http://lv2plug.in/ns/lv2core#requiredFeature>\0",
+					  "<http://lv2plug.in/ns/ext/worker#schedule>\0");
 
     if(feature_list != NULL){
       lv2_plugin->flags |= AGS_LV2_PLUGIN_NEEDS_WORKER;
@@ -979,10 +986,10 @@ ags_lv2_plugin_load_plugin(AgsBasePlugin *base_plugin)
     }
 
     /* check if is synthesizer */
-    xpath = ".//rdf-verb[@verb='a']/following-sibling::*[self::rdf-object-list]//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':instrumentplugin') + 1) = ':instrumentplugin']\0";
-    instrument_list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-							      xpath,
-							      triple_node);
+    instrument_list = ags_turtle_find_triple(lv2_plugin->turtle,
+					     subject,
+					     AGS_TURTLE_RDF_TYPE,
+					     "<http://lv2plug.in/ns/lv2core#InstrumentPlugin>\0");
 
     if(instrument_list != NULL){
       lv2_plugin->flags |= AGS_LV2_PLUGIN_IS_SYNTHESIZER;
@@ -991,21 +998,15 @@ ags_lv2_plugin_load_plugin(AgsBasePlugin *base_plugin)
     }
 
     /* check UI */
-    xpath = ".//rdf-pname-ln[text()='uiext:ui']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-iriref";
-
-    ui_list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						      xpath,
-						      triple_node);
+    ui_list = ags_turtle_find_object(lv2_plugin->turtle,
+				     subject,
+				     "<http://lv2plug.in/ns/extensions/ui#ui>\0");
 
-    if(ui_list != NULL){
+    if(ui_list != NULL &&
+       ((gchar *) ui_list->data)[0] == '<'){
       gchar *ui_uri;
 
-      ui_uri = xmlNodeGetContent(ui_list->data);
-
-      if(strlen(ui_uri) > 2){
-	ui_uri = g_strndup(ui_uri + 1,
-			   strlen(ui_uri) - 2);
-      }
+      ui_uri = ags_turtle_term_value(ui_list->data);
 
       g_object_set(lv2_plugin,
 		   "ui-uri\0", ui_uri,
@@ -1013,21 +1014,37 @@ ags_lv2_plugin_load_plugin(AgsBasePlugin *base_plugin)
       
       g_message("*** found UI <%s> ***\0", ui_uri);
 
-      g_list_free(ui_list);
+      g_free(ui_uri);
     }
 
+    g_list_free(ui_list);
+
     /* load ports */
-    xpath = ".//rdf-verb//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':port') + 1) = ':port']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list]/rdf-object[.//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':index') + 1) = ':index']]\0";
-    port_list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-							xpath,
-							triple_node);
+    port_list =
+      port_start = ags_turtle_find_object(lv2_plugin->turtle,
+					  subject,
+					  "<http://lv2plug.in/ns/lv2core#port>\0");
 
     /*  */
     port_descriptor_list = NULL;
 
     while(port_list != NULL){
+      port_node = (gchar *) port_list->data;
+
+      /* load index */
+      list = ags_turtle_find_object(lv2_plugin->turtle,
+				    port_node,
+				    "<http://lv2plug.in/ns/lv2core#index>\0");
+
+      if(list == NULL){
+	g_warning("ags_lv2_plugin.c - no port index found\0");
+
+	port_list = port_list->next;
+
+	continue;
+      }
+      
       port = ags_port_descriptor_alloc();
-      found_port = FALSE;
 
       g_value_init(port->upper_value,
 		   G_TYPE_FLOAT);
@@ -1038,260 +1055,155 @@ ags_lv2_plugin_load_plugin(AgsBasePlugin *base_plugin)
 
       g_value_set_float(port->upper_value,
 			0.0);
-      
-      port_node = (xmlNode *) port_list->data;
 
-      //      g_message("%s\0", port_node->name);
+      str = ags_turtle_term_value(list->data);
+      port->port_index = g_ascii_strtoull(str,
+					  NULL,
+					  10);
       
-      /* load flags - control */
-      xpath = g_ascii_strdown(".//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':ControlPort') + 1) = ':ControlPort']\0",
-			      -1);
-
-      list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						     xpath,
-						     port_node);
-
-      if(list != NULL){
-	port->flags |= AGS_PORT_DESCRIPTOR_CONTROL;
-	found_port = TRUE;
-
-	g_list_free(list);
-      }
-
-      /* load flags - output */
-      xpath = g_ascii_strdown(".//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':OutputPort') + 1) = ':OutputPort']\0",
-			      -1);
-
-      list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						     xpath,
-						     port_node);
-
-      if(list != NULL){
-	port->flags |= AGS_PORT_DESCRIPTOR_OUTPUT;
-	found_port = TRUE;
-
-	g_list_free(list);
-      }
-
-      /* load flags - input */
-      xpath = g_ascii_strdown(".//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':InputPort') + 1) = ':InputPort']\0",
-			      -1);
-
-      list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						     xpath,
-						     port_node);
-
-      if(list != NULL){
-	port->flags |= AGS_PORT_DESCRIPTOR_INPUT;
-	found_port = TRUE;
-
-	g_list_free(list);
-      }
-
-      /* load flags - audio */
-      xpath = g_ascii_strdown(".//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':AudioPort') + 1) = ':AudioPort']\0",
-			      -1);
-
-      list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						     xpath,
-						     port_node);
-
-      if(list != NULL){
-	port->flags |= AGS_PORT_DESCRIPTOR_AUDIO;
-	found_port = TRUE;
-	
-	g_list_free(list);
-      }
-
-      /* load flags - event */
-      xpath = g_ascii_strdown(".//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':EventPort') + 1) = ':EventPort']\0",
-			      -1);
-
-      list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						     xpath,
-						     port_node);
-
-      if(list != NULL){
-	port->flags |= AGS_PORT_DESCRIPTOR_EVENT;
-	found_port = TRUE;
-
-	g_list_free(list);
-      }
-
-      /* load flags - atom */
-      xpath = g_ascii_strdown(".//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':AtomPort') + 1) = ':AtomPort']\0",
-			      -1);
-
-      list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						     xpath,
-						     port_node);
+      g_free(str);
+      g_list_free(list);
 
-      if(list != NULL){
-	port->flags |= AGS_PORT_DESCRIPTOR_ATOM;
-	found_port = TRUE;
-	
-	g_list_free(list);
-      }
+      port_descriptor_list = g_list_prepend(port_descriptor_list,
+					    port);
+      
+      /* load flags - control, output, input, audio, event and atom */
+      list_start = 
+	list = ags_turtle_find_object(lv2_plugin->turtle,
+				      port_node,
+				      AGS_TURTLE_RDF_TYPE);
 
-      /* load index */
-      xpath = g_ascii_strdown(".//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':index') + 1) = ':index']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-numeric\0",
+      while(list != NULL){
+	str = g_ascii_strdown(list->data,
 			      -1);
-      list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						     xpath,
-						     port_node);
 
-      if(list != NULL){
-	current = (xmlNode *) list->data;
+	if(g_str_has_suffix(str,
+			    "#controlport>\0")){
+	  port->flags |= AGS_PORT_DESCRIPTOR_CONTROL;
+	}else if(g_str_has_suffix(str,
+				  "#outputport>\0")){
+	  port->flags |= AGS_PORT_DESCRIPTOR_OUTPUT;
+	}else if(g_str_has_suffix(str,
+				  "#inputport>\0")){
+	  port->flags |= AGS_PORT_DESCRIPTOR_INPUT;
+	}else if(g_str_has_suffix(str,
+				  "#audioport>\0")){
+	  port->flags |= AGS_PORT_DESCRIPTOR_AUDIO;
+	}else if(g_str_has_suffix(str,
+				  "#eventport>\0")){
+	  port->flags |= AGS_PORT_DESCRIPTOR_EVENT;
+	}else if(g_str_has_suffix(str,
+				  "#atomport>\0")){
+	  port->flags |= AGS_PORT_DESCRIPTOR_ATOM;
+	}
 
-       	port->port_index = g_ascii_strtoull(xmlNodeGetContent(current),
-					    NULL,
-					    10);
-	found_port = TRUE;
+	g_free(str);
 	
-	g_list_free(list);
-      }else{
-	g_warning("ags_lv2_plugin.c - no port index found\0");
+	list = list->next;
       }
-      
-      if(!found_port){
-	free(port);
-	
-	port_list = port_list->next;
 
-	continue;
-      }else{
-	port_descriptor_list = g_list_prepend(port_descriptor_list,
-					      port);
-      }
+      g_list_free(list_start);
       
       /* properties */
-      xpath = g_ascii_strdown(".//rdf-verb//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':portProperty') + 1) = ':portProperty']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-pname-ln\0",
-			      -1);
       list_start =
-	list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						       xpath,
-						       port_node);
+	list = ags_turtle_find_object(lv2_plugin->turtle,
+				      port_node,
+				      "<http://lv2plug.in/ns/lv2core#portProperty>\0");
       
       while(list != NULL){
-	current = (xmlNode *) list->data;
+	str = g_ascii_strdown(list->data,
+			      -1);
 	
-	if(g_str_has_suffix(xmlNodeGetContent(current),
-			    ":toggled\0")){
+	if(g_str_has_suffix(str,
+			    "#toggled>\0")){
 	  port->flags |= AGS_PORT_DESCRIPTOR_TOGGLED;
-	}else if(g_str_has_suffix(xmlNodeGetContent(current),
-				  ":enumeration\0")){
+	}else if(g_str_has_suffix(str,
+				  "#enumeration>\0")){
 	  port->flags |= AGS_PORT_DESCRIPTOR_ENUMERATION;
-	}else if(g_str_has_suffix(xmlNodeGetContent(current),
-				  ":logarithmic\0")){
+	}else if(g_str_has_suffix(str,
+				  "#logarithmic>\0")){
 	  port->flags |= AGS_PORT_DESCRIPTOR_LOGARITHMIC;
-	}else if(g_str_has_suffix(xmlNodeGetContent(current),
-				  ":integer\0")){
+	}else if(g_str_has_suffix(str,
+				  "#integer>\0")){
 	  port->flags |= AGS_PORT_DESCRIPTOR_INTEGER;
 	}
 
+	g_free(str);
+	
 	list = list->next;
       }
 
-      if(list_start != NULL){
-	g_list_free(list_start);
-      }
+      g_list_free(list_start);
       
       /* load name */
-      xpath = g_ascii_strdown(".//rdf-object-list//rdf-string[ancestor::*[self::rdf-object-list][1]/preceding-sibling::*[self::rdf-verb][1]//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':name') + 1) = ':name']]\0",
-			      -1);
-      list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						     xpath,
-						     port_node);
+      list = ags_turtle_find_object(lv2_plugin->turtle,
+				    port_node,
+				    "<http://lv2plug.in/ns/lv2core#name>\0");
 
       if(list != NULL){
-	gchar *str;
-	
-	current = (xmlNode *) list->data;
-	str = xmlNodeGetContent(current);
-
-	if(strlen(str) > 2){
-	  port->port_name = g_strndup(str + 1,
-				      strlen(str) - 2);
-	}
+	port->port_name = ags_turtle_term_value(list->data);
 
 	g_list_free(list);
       }
       
       /* load symbol */
-      xpath = g_ascii_strdown(".//rdf-object-list//rdf-string[ancestor::*[self::rdf-object-list][1]/preceding-sibling::*[self::rdf-verb][1]//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':symbol') + 1) = ':symbol']]\0",
-			      -1);
-      list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						     xpath,
-						     port_node);
+      list = ags_turtle_find_object(lv2_plugin->turtle,
+				    port_node,
+				    "<http://lv2plug.in/ns/lv2core#symbol>\0");
 
       if(list != NULL){
-	gchar *str;
-	
-	current = (xmlNode *) list->data;
-	str = xmlNodeGetContent(current);
-
-	if(strlen(str) > 2){
-	  port->port_symbol = g_strndup(str + 1,
-					strlen(str) - 2);
-	}
+	port->port_symbol = ags_turtle_term_value(list->data);
 
 	g_list_free(list);
       }
 
       /* load scale points and value */
-      xpath = g_ascii_strdown(".//rdf-verb//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':scalePoint') + 1) = ':scalePoint']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-string\0",
-			      -1);
       list_start = 
-	list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						       xpath,
-						       port_node);
+	list = ags_turtle_find_object(lv2_plugin->turtle,
+				      port_node,
+				      "<http://lv2plug.in/ns/lv2core#scalePoint>\0");
 
       if(list != NULL){
+	GList *scale_list;
+	
 	port->scale_steps = g_list_length(list) - 1;
 
 	port->scale_points = malloc((port->scale_steps + 1) * sizeof(gchar *));
 	port->scale_value = malloc((port->scale_steps + 1) * sizeof(float));
       
 	for(i = 0; list != NULL; i++){
-	  gchar *str;
-	
-	  current = (xmlNode *) list->data;
-	  str = xmlNodeGetContent(current);
-	
-	  if(strlen(str) > 2){
-	    port->scale_points[i] = g_strndup(str + 1,
-					      strlen(str) - 2);
+	  port->scale_points[i] = NULL;
+	  port->scale_value[i] = 0.0;
+
+	  /* label */
+	  scale_list = ags_turtle_find_object(lv2_plugin->turtle,
+					      list->data,
+					      "<http://www.w3.org/2000/01/rdf-schema#label>\0");
+
+	  if(scale_list != NULL){
+	    port->scale_points[i] = ags_turtle_term_value(scale_list->data);
+
+	    g_list_free(scale_list);
 	  }
 
-	  list = list->next;
-	}
+	  /* value */
+	  scale_list = ags_turtle_find_object(lv2_plugin->turtle,
+					      list->data,
+					      "<http://www.w3.org/1999/02/22-rdf-syntax-ns#value>\0");
 
-	if(list_start != NULL){
-	  g_list_free(list_start);
-	}
+	  if(scale_list != NULL){
+	    str = ags_turtle_term_value(scale_list->data);
+	    port->scale_value[i] = g_ascii_strtod(str,
+						  NULL);
 
-	xpath = g_ascii_strdown(".//rdf-verb//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':scalePoint') + 1) = ':scalePoint']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-numeric\0",
-				-1);
-	list_start = 
-	  list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-							 xpath,
-							 port_node);
-      
-	for(i = 0; list != NULL; i++){
-	  gchar *str;
-	
-	  current = (xmlNode *) list->data;
-	  str = xmlNodeGetContent(current);
-	
-	  port->scale_value[i] = g_ascii_strtod(str,
-						NULL);
-	
+	    g_free(str);
+	    g_list_free(scale_list);
+	  }
+	  
 	  list = list->next;
 	}
 
-	if(list_start != NULL){
-	  g_list_free(list_start);
-	}
+	g_list_free(list_start);
       }else{
 	port->scale_steps = 0;
 
@@ -1300,42 +1212,38 @@ ags_lv2_plugin_load_plugin(AgsBasePlugin *base_plugin)
       }      
 
       /* minimum */
-      xpath = g_ascii_strdown(".//rdf-verb//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':minimum') + 1) = ':minimum']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-numeric\0",
-			      -1);
-      list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						     xpath,
-						     port_node);
+      list = ags_turtle_find_object(lv2_plugin->turtle,
+				    port_node,
+				    "<http://lv2plug.in/ns/lv2core#minimum>\0");
       lower_value = 0.0;
       
       if(list != NULL){
-	current = (xmlNode *) list->data;
-
-	lower_value = g_ascii_strtod(xmlNodeGetContent(current),
+	str = ags_turtle_term_value(list->data);
+	lower_value = g_ascii_strtod(str,
 				     NULL);
 	
 	g_value_set_float(port->lower_value,
 			  lower_value);
 
+	g_free(str);
 	g_list_free(list);
       }
 
       /* maximum */
-      xpath = g_ascii_strdown(".//rdf-verb//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':maximum') + 1) = ':maximum']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-numeric\0",
-			      -1);
-      list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						     xpath,
-						     port_node);
+      list = ags_turtle_find_object(lv2_plugin->turtle,
+				    port_node,
+				    "<http://lv2plug.in/ns/lv2core#maximum>\0");
       upper_value = 1.0;
       
       if(list != NULL){
-	current = (xmlNode *) list->data;
-
-	upper_value = g_ascii_strtod(xmlNodeGetContent(current),
+	str = ags_turtle_term_value(list->data);
+	upper_value = g_ascii_strtod(str,
 				     NULL);
 	
 	g_value_set_float(port->upper_value,
 			  upper_value);
 
+	g_free(str);
 	g_list_free(list);
       }
 
@@ -1354,19 +1262,18 @@ ags_lv2_plugin_load_plugin(AgsBasePlugin *base_plugin)
       }
       
       /* default */
-      xpath = g_ascii_strdown(".//rdf-verb//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':default') + 1) = ':default']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-numeric\0",
-			      -1);
-      list = ags_turtle_find_xpath_with_context_node(lv2_plugin->turtle,
-						     xpath,
-						     port_node);
+      list = ags_turtle_find_object(lv2_plugin->turtle,
+				    port_node,
+				    "<http://lv2plug.in/ns/lv2core#default>\0");
 
       if(list != NULL){
-	current = (xmlNode *) list->data;
-
+	str = ags_turtle_term_value(list->data);
+	
 	g_value_set_float(port->default_value,
-			  g_ascii_strtod(xmlNodeGetContent(current),
+			  g_ascii_strtod(str,
 					 NULL));
 
+	g_free(str);
 	g_list_free(list);
       }
 
@@ -1374,14 +1281,36 @@ ags_lv2_plugin_load_plugin(AgsBasePlugin *base_plugin)
       port_list = port_list->next;
     }
 
-    if(port_list != NULL){
-      g_list_free(port_list);
-    }
+    g_list_free(port_start);
 
     base_plugin->port = g_list_reverse(port_descriptor_list);
   }
 }
 
+void
+ags_lv2_plugin_load_binary(AgsBasePlugin *base_plugin)
+{
+  LV2_Descriptor_Function lv2_descriptor;
+
+  base_plugin->plugin_so = dlopen(base_plugin->filename,
+				  RTLD_NOW);
+
+  if(base_plugin->plugin_so == NULL){
+    g_warning("ags_lv2_plugin.c - failed to load static object file\0");
+    
+    dlerror();
+
+    return;
+  }
+
+  lv2_descriptor = (LV2_Descriptor_Function) dlsym(base_plugin->plugin_so,
+						   "lv2_descriptor\0");
+  
+  if(dlerror() == NULL && lv2_descriptor){
+    base_plugin->plugin_descriptor = lv2_descriptor((uint32_t) base_plugin->effect_index);
+  }
+}
+
 /**
  * ags_lv2_plugin_alloc_event_buffer:
  * @buffer_size: the allocated size
@@ -1880,6 +1809,37 @@ ags_lv2_plugin_find_pname(GList *lv2_plugin,
   return(NULL);
 }
 
+/**
+ * ags_lv2_plugin_find_uri:
+ * @lv2_plugin: a #GList-struct containig #AgsLv2Plugin
+ * @uri: the uri to find
+ * 
+ * Find uri in @lv2_plugin #GList-struct
+ * 
+ * Returns: the matching #GList-struct containing #AgsLv2Plugin
+ * 
+ * Since: 0.7.136
+ */
+GList*
+ags_lv2_plugin_find_uri(GList *lv2_plugin,
+			gchar *uri)
+{
+  if(uri == NULL){
+    return(NULL);
+  }
+
+  while(lv2_plugin != NULL){
+    if(!g_strcmp0(uri,
+		  AGS_LV2_PLUGIN(lv2_plugin->data)->uri)){
+      return(lv2_plugin);
+    }
+    
+    lv2_plugin = lv2_plugin->next;
+  }
+
+  return(NULL);
+}
+
 void
 ags_lv2_plugin_real_change_program(AgsLv2Plugin *lv2_plugin,
 				   gpointer lv2_handle,
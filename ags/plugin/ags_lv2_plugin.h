@@ -136,6 +136,8 @@ void ags_lv2_plugin_clear_atom_sequence(void *atom_sequence,
 
 GList* ags_lv2_plugin_find_pname(GList *lv2_plugin,
 				 gchar *pname);
+GList* ags_lv2_plugin_find_uri(GList *lv2_plugin,
+			       gchar *uri);
 
 void ags_lv2_plugin_change_program(AgsLv2Plugin *lv2_plugin,
 				   gpointer ladspa_handle,
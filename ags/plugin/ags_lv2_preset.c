@@ -469,16 +469,14 @@ ags_lv2_preset_parse_turtle(AgsLv2Preset *lv2_preset)
 {
   AgsLv2PortPreset *lv2_port_preset;
   
-  xmlNode *triple_node;
-  xmlNode *port_node;
-  xmlNode *current;
-  
   GList *label_list;
   GList *bank_list;
-  GList *port_list, *list;
+  GList *port_list, *port_start;
+  GList *list;
 
+  gchar *subject;
+  gchar *port_node;
   gchar *str;
-  gchar *xpath;
   
   if(lv2_preset == NULL ||
      lv2_preset->turtle == NULL ||
@@ -486,71 +484,46 @@ ags_lv2_preset_parse_turtle(AgsLv2Preset *lv2_preset)
     return;
   }
 
-  /* retrieve triple by uri */
-  xpath = g_strdup_printf("(//rdf-triple/rdf-subject/rdf-iri/rdf-iriref[text() = '%s'])/ancestor::*[self::rdf-triple][1]\0",
-			  lv2_preset->uri);
-    
-  list = ags_turtle_find_xpath(lv2_preset->turtle,
-			       xpath);
-
-  free(xpath);
-
-  if(list != NULL){
-    triple_node = (xmlNode *) list->data;
-
-    g_list_free(list);
-  }else{
-    xpath = g_strdup_printf("//rdf-triple//rdf-iriref[text() = '<%s>']/ancestor::*[self::rdf-triple][1]\0",
-			    lv2_preset->uri);
-    
-    list = ags_turtle_find_xpath(lv2_preset->turtle,
-				 xpath);
-
-    free(xpath);
-    
-    if(list != NULL){
-      triple_node = (xmlNode *) list->data;
-
-      g_list_free(list);
-    }else{
-      g_warning("rdf-triple not found\0");
+  /* retrieve subject by uri */
+  str = g_strdup_printf("<%s>\0",
+			lv2_preset->uri);
+  subject = ags_turtle_lookup_string(lv2_preset->turtle,
+				     str);
+  g_free(str);
+  
+  if(subject == NULL){
+    g_warning("rdf-triple not found\0");
       
-      return;
-    }
+    return;
   }
 
   /* preset label */
-  xpath = ".//rdf-pname-ln[text()='rdfs:label']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-string\0";
-  label_list = ags_turtle_find_xpath_with_context_node(lv2_preset->turtle,
-						       xpath,
-						       triple_node);
+  label_list = ags_turtle_find_object(lv2_preset->turtle,
+				      subject,
+				      "<http://www.w3.org/2000/01/rdf-schema#label>\0");
 
   if(label_list != NULL){
-    lv2_preset->preset_label = xmlNodeGetContent((xmlNode *) label_list->data);
+    lv2_preset->preset_label = ags_turtle_term_value(label_list->data);
 
     g_list_free(label_list);
   }
 
   /* bank */
-  xpath = ".//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':bank') + 1) = ':bank']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-iriref\0";
-  bank_list = ags_turtle_find_xpath_with_context_node(lv2_preset->turtle,
-						      xpath,
-						      triple_node);
+  bank_list = ags_turtle_find_object(lv2_preset->turtle,
+				     subject,
+				     "<http://lv2plug.in/ns/ext/presets#bank>\0");
 
   if(bank_list != NULL){
-    str = xmlNodeGetContent((xmlNode *) bank_list->data);
-
-    lv2_preset->bank = g_strndup(&(str[1]),
-				 strlen(str) - 2);
+    lv2_preset->bank = ags_turtle_term_value(bank_list->data);
 
     g_list_free(bank_list);
   }
 
   /* load ports */
-  xpath = ".//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':port') + 1) = ':port']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list]/rdf-object\0";
-  port_list = ags_turtle_find_xpath_with_context_node(lv2_preset->turtle,
-						      xpath,
-						      triple_node);
+  port_list =
+    port_start = ags_turtle_find_object(lv2_preset->turtle,
+					subject,
+					"<http://lv2plug.in/ns/lv2core#port>\0");
 
   while(port_list != NULL){
     lv2_port_preset = ags_lv2_port_preset_alloc(NULL,
@@ -560,40 +533,35 @@ ags_lv2_preset_parse_turtle(AgsLv2Preset *lv2_preset)
     port_node = port_list->data;
     
     /* load symbol */
-    xpath = g_ascii_strdown(".//rdf-object-list//rdf-string[ancestor::*[self::rdf-object-list][1]/preceding-sibling::*[self::rdf-verb][1]//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':symbol') + 1) = ':symbol']]\0",
-			    -1);
-    list = ags_turtle_find_xpath_with_context_node(lv2_preset->turtle,
-						   xpath,
-						   port_node);
+    list = ags_turtle_find_object(lv2_preset->turtle,
+				  port_node,
+				  "<http://lv2plug.in/ns/lv2core#symbol>\0");
 
     if(list != NULL){
-      gchar *str;
-	
-      current = (xmlNode *) list->data;
-      str = xmlNodeGetContent(current);
-
-      if(strlen(str) > 2){
-	lv2_port_preset->port_symbol = g_strndup(str + 1,
-						 strlen(str) - 2);
-      }
+      lv2_port_preset->port_symbol = ags_turtle_term_value(list->data);
 
       g_list_free(list);
     }
 
     /* port value */
-    xpath = g_ascii_strdown(".//rdf-verb//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':value') + 1) = ':value']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-numeric\0",
-			    -1);
-    list = ags_turtle_find_xpath_with_context_node(lv2_preset->turtle,
-						   xpath,
-						   port_node);
-
+    list = ags_turtle_find_object(lv2_preset->turtle,
+				  port_node,
+				  "<http://lv2plug.in/ns/ext/presets#value>\0");
+
+    if(list == NULL){
+      list = ags_turtle_find_object(lv2_preset->turtle,
+				    port_node,
+				    "<http://www.w3.org/1999/02/22-rdf-syntax-ns#value>\0");
+    }
+    
     if(list != NULL){
-      current = (xmlNode *) list->data;
-
+      str = ags_turtle_term_value(list->data);
+      
       g_value_set_float(lv2_port_preset->port_value,
-			g_ascii_strtod(xmlNodeGetContent(current),
+			g_ascii_strtod(str,
 				       NULL));
 
+      g_free(str);
       g_list_free(list);
     }
 
@@ -603,9 +571,7 @@ ags_lv2_preset_parse_turtle(AgsLv2Preset *lv2_preset)
 
   lv2_preset->port_preset = g_list_reverse(lv2_preset->port_preset);
   
-  if(port_list != NULL){
-    g_list_free(port_list);
-  }
+  g_list_free(port_start);
 }
 
 /**
@@ -340,13 +340,12 @@ ags_lv2ui_manager_load_file(AgsLv2uiManager *lv2ui_manager,
 {
   AgsLv2uiPlugin *lv2ui_plugin;
 
-  xmlNode *node;
-
+  GList *type_list, *type_start;
   GList *gtk_uri_list;
   GList *qt4_uri_list;
   GList *qt5_uri_list;
   
-  gchar *xpath;
+  gchar *str;
   
   GError *error;
 
@@ -355,14 +354,12 @@ ags_lv2ui_manager_load_file(AgsLv2uiManager *lv2ui_manager,
   auto void ags_lv2ui_manager_load_file_ui_plugin(GList *list);
 
   void ags_lv2ui_manager_load_file_ui_plugin(GList *list){
-    GList *uri_list;
-    GList *binary_list;
+    GList *binary_list, *binary_start;
 
     gchar *ui_filename;
     gchar *str;
     gchar *path;
     gchar *ui_path;
-    gchar *xpath;
     gchar *gui_uri;
 
     guint ui_effect_index;
@@ -379,106 +376,10 @@ ags_lv2ui_manager_load_file(AgsLv2uiManager *lv2ui_manager,
 
     while(list != NULL){
       /* find URI */
-      xpath = "//rdf-triple/rdf-subject/rdf-iri\0";    
-      uri_list = ags_turtle_find_xpath_with_context_node(turtle,
-							 xpath,
-							 list->data);
-      
       gui_uri = NULL;
   
-      if(uri_list != NULL){
-	xmlNode *child;
-
-	child = ((xmlNode *) uri_list->data)->children;
-
-	while(child != NULL){
-	  if(child->type == XML_ELEMENT_NODE){
-	    if(!g_ascii_strncasecmp(child->name,
-				    "rdf-iriref\0",
-				    11)){
-	      gui_uri = xmlNodeGetContent(child);
-
-	      if(strlen(gui_uri) > 2){
-		gui_uri = g_strndup(gui_uri + 1,
-				    strlen(gui_uri) - 2);
-	      }
-	      break;
-	    }else if(!g_ascii_strncasecmp(child->name,
-					  "rdf-prefixed-name\0",
-					  18)){
-	      xmlNode *pname_node;
-
-	      gchar *pname;
-	  
-	      pname_node = child->children;
-	      pname = NULL;
-	  
-	      while(pname_node != NULL){
-		if(pname_node->type == XML_ELEMENT_NODE){
-		  if(!g_ascii_strncasecmp(pname_node->name,
-					  "rdf-pname-ln\0",
-					  11)){
-		    pname = xmlNodeGetContent(pname_node);
-		
-		    break;
-		  }
-		}
-
-		pname_node = pname_node->next;
-	      }
-
-	      gui_uri = pname;
-	    
-	      if(pname != NULL){
-		gchar *suffix, *prefix;
-		gchar *offset;
-
-		offset = index(pname, ':');
-
-		if(offset != NULL){
-		  GList *prefix_node;
-	      
-		  offset++;
-		  suffix = g_strndup(offset,
-				     strlen(pname) - (offset - pname));
-		  prefix = g_strndup(pname,
-				     offset - pname);
-
-		  str = g_strdup_printf("//rdf-pname-ns[text()='%s']/following-sibling::*[self::rdf-iriref][1]\0",
-					prefix);
-		  prefix_node = ags_turtle_find_xpath(turtle,
-						      str);
-		  free(str);
-
-		  if(prefix_node != NULL){
-		    gchar *iriref;
-
-		    iriref = xmlNodeGetContent(prefix_node->data);
-
-		    if(iriref != NULL){
-		      if(strlen(iriref) > 2){
-			gchar *tmp;
-		    
-			tmp = g_strndup(iriref + 1,
-					strlen(iriref) - 2);
-			gui_uri = g_strdup_printf("%s%s\0",
-						  tmp,
-						  suffix);
-			free(tmp);
-		      }
-		  
-		      free(iriref);
-		    }
-		  }
-		}
-	      }
-	  
-	      break;
-	    }
-	  }
-
-	  child = child->next;
-	}
+      if(((gchar *) list->data)[0] == '<'){
+	gui_uri = ags_turtle_term_value(list->data);
       }
 
       /* load plugin */
@@ -488,30 +389,39 @@ ags_lv2ui_manager_load_file(AgsLv2uiManager *lv2ui_manager,
 	continue;
       }
 
-      xpath = "//rdf-triple//rdf-verb//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':binary') + 1) = ':binary']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-iriref[substring(text(), string-length(text()) - string-length('.so>') + 1) = '.so>']\0";
-      binary_list = ags_turtle_find_xpath_with_context_node(turtle,
-							    xpath,
-							    list->data);
+      binary_start = 
+	binary_list = ags_turtle_find_object(turtle,
+					     list->data,
+					     "<http://lv2plug.in/ns/extensions/ui#binary>\0");
+      binary_start = 
+	binary_list = g_list_concat(binary_list,
+				    ags_turtle_find_object(turtle,
+							   list->data,
+							   "<http://lv2plug.in/ns/lv2core#binary>\0"));
 
       /* load */
+      ui_filename = NULL;
+      
       while(binary_list != NULL){
 	gchar *tmp;
 	
 	/* read filename of binary */
-	str = xmlNodeGetContent((xmlNode *) binary_list->data);
+	str = binary_list->data;
 	
-	if(str == NULL){
+	if(!g_str_has_suffix(str,
+			     ".so>\0")){
 	  binary_list = binary_list->next;
 	  continue;
 	}
 
-	str = g_strndup(&(str[1]),
-			strlen(str) - 2);
+	str = ags_turtle_term_value(str);
 
 	if((tmp = strstr(filename, "/\0")) != NULL){
 	  tmp = g_strndup(filename,
 			  tmp - filename);
 	}else{
+	  free(str);
+	  
 	  binary_list = binary_list->next;
 	  continue;
 	}
@@ -519,10 +429,21 @@ ags_lv2ui_manager_load_file(AgsLv2uiManager *lv2ui_manager,
 	ui_filename = g_strdup_printf("%s/%s\0",
 				      tmp,
 				      str);
+	free(tmp);
 	free(str);
 
 	break;
       }
+
+      g_list_free(binary_start);
+
+      if(ui_filename == NULL){
+	g_free(gui_uri);
+	
+	list = list->next;
+
+	continue;
+      }
       
       path = g_strdup_printf("%s/%s\0",
 			     lv2ui_path,
@@ -606,24 +527,55 @@ ags_lv2ui_manager_load_file(AgsLv2uiManager *lv2ui_manager,
   /* load plugin */
   pthread_mutex_lock(&(mutex));
 
-  /* check if gtk UI */
-  xpath = "//rdf-triple//rdf-verb[@verb='a']/following-sibling::*[self::rdf-object-list]//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':gtkui') + 1) = ':gtkui']//ancestor::*[self::rdf-triple]\0";
-  gtk_uri_list = ags_turtle_find_xpath(turtle,
-				       xpath);
+  /* check if gtk, qt4 or qt5 UI */
+  gtk_uri_list = NULL;
+  qt4_uri_list = NULL;
+  qt5_uri_list = NULL;
+  
+  type_list =
+    type_start = ags_turtle_find_triple(turtle,
+					NULL,
+					AGS_TURTLE_RDF_TYPE,
+					NULL);
+
+  while(type_list != NULL){
+    str = g_ascii_strdown(AGS_TURTLE_TRIPLE(type_list->data)->object,
+			  -1);
+
+    if(g_str_has_suffix(str,
+			"#gtkui>\0")){
+      gtk_uri_list = g_list_prepend(gtk_uri_list,
+				    AGS_TURTLE_TRIPLE(type_list->data)->subject);
+    }else if(g_str_has_suffix(str,
+			      "#qt4ui>\0")){
+      qt4_uri_list = g_list_prepend(qt4_uri_list,
+				    AGS_TURTLE_TRIPLE(type_list->data)->subject);
+    }else if(g_str_has_suffix(str,
+			      "#qt5ui>\0")){
+      qt5_uri_list = g_list_prepend(qt5_uri_list,
+				    AGS_TURTLE_TRIPLE(type_list->data)->subject);
+    }
+
+    g_free(str);
+    
+    type_list = type_list->next;
+  }
+
+  g_list_free(type_start);
+
+  gtk_uri_list = g_list_reverse(gtk_uri_list);
   ags_lv2ui_manager_load_file_ui_plugin(gtk_uri_list);
   
-  /* check if qt4 UI */
-  xpath = "//rdf-triple//rdf-verb[@verb='a']/following-sibling::*[self::rdf-object-list]//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':qt4ui') + 1) = ':qt4ui']//ancestor::*[self::rdf-triple]\0";
-  qt4_uri_list = ags_turtle_find_xpath(turtle,
-				       xpath);
+  qt4_uri_list = g_list_reverse(qt4_uri_list);
   ags_lv2ui_manager_load_file_ui_plugin(qt4_uri_list);
   
-  /* check if qt5 UI */
-  xpath = "//rdf-triple//rdf-verb[@verb='a']/following-sibling::*[self::rdf-object-list]//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':qt5ui') + 1) = ':qt5ui']//ancestor::*[self::rdf-triple]\0";
-  qt5_uri_list = ags_turtle_find_xpath(turtle,
-				       xpath);
+  qt5_uri_list = g_list_reverse(qt5_uri_list);
   ags_lv2ui_manager_load_file_ui_plugin(qt5_uri_list);
 
+  g_list_free(gtk_uri_list);
+  g_list_free(qt4_uri_list);
+  g_list_free(qt5_uri_list);
+
   /*  */
   pthread_mutex_unlock(&(mutex));
 }
@@ -695,7 +647,8 @@ ags_lv2ui_manager_load_default_directory(AgsLv2uiManager *lv2ui_manager)
 	xmlChar *buffer;
 	int size;
       
-	GList *ttl_list, *ttl_start, *binary_list;
+	GList *ttl_list, *ttl_start;
+	GList *binary_list, *binary_start;
 
 	gchar *manifest_filename;
 	gchar *turtle_path, *filename;
@@ -715,8 +668,16 @@ ags_lv2ui_manager_load_default_directory(AgsLv2uiManager *lv2ui_manager)
 			NULL);
 
 	/* read binary from turtle */
-	binary_list = ags_turtle_find_xpath(manifest,
-					    "//rdf-triple//rdf-verb//rdf-pname-ln[substring(text(), string-length(text()) - string-length(':binary') + 1) = ':binary']/ancestor::*[self::rdf-verb][1]/following-sibling::*[self::rdf-object-list][1]//rdf-iriref[substring(text(), string-length(text()) - string-length('.so>') + 1) = '.so>']\0");
+	binary_list = ags_turtle_find_triple(manifest,
+					     NULL,
+					     "<http://lv2plug.in/ns/extensions/ui#binary>\0",
+					     NULL);
+	binary_list =
+	  binary_start = g_list_concat(binary_list,
+				       ags_turtle_find_triple(manifest,
+							      NULL,
+							      "<http://lv2plug.in/ns/lv2core#binary>\0",
+							      NULL));
 
 	/* persist XML */
 	//NOTE:JK: no need for it
@@ -731,15 +692,15 @@ ags_lv2ui_manager_load_default_directory(AgsLv2uiManager *lv2ui_manager)
 	/* load */
 	while(binary_list != NULL){
 	  /* read filename of binary */
-	  str = xmlNodeGetContent((xmlNode *) binary_list->data);
+	  str = AGS_TURTLE_TRIPLE(binary_list->data)->object;
 
-	  if(str == NULL){
+	  if(!g_str_has_suffix(str,
+			       ".so>\0")){
 	    binary_list = binary_list->next;
 	    continue;
 	  }
 	
-	  str = g_strndup(&(str[1]),
-			  strlen(str) - 2);
+	  str = ags_turtle_term_value(str);
 	  filename = g_strdup_printf("%s/%s\0",
 				     path,
 				     str);
@@ -747,22 +708,22 @@ ags_lv2ui_manager_load_default_directory(AgsLv2uiManager *lv2ui_manager)
 
 	  /* read turtle from manifest */
 	  ttl_start = 
-	    ttl_list = ags_turtle_find_xpath_with_context_node(manifest,
-							       "./ancestor::*[self::rdf-triple][1]//rdf-iriref[substring(text(), string-length(text()) - string-length('.ttl>') + 1) = '.ttl>']\0",
-							       (xmlNode *) binary_list->data);
+	    ttl_list = ags_turtle_find_object(manifest,
+					      AGS_TURTLE_TRIPLE(binary_list->data)->subject,
+					      "<http://www.w3.org/2000/01/rdf-schema#seeAlso>\0");
 
 	  while(ttl_list != NULL){	
 	    /* read filename */
-	    turtle_path = xmlNodeGetContent((xmlNode *) ttl_list->data);
+	    turtle_path = ttl_list->data;
 
-	    if(turtle_path == NULL){
+	    if(!g_str_has_suffix(turtle_path,
+				 ".ttl>\0")){
 	      ttl_list = ttl_list->next;
 	  
 	      continue;
 	    }
 	
-	    turtle_path = g_strndup(&(turtle_path[1]),
-				    strlen(turtle_path) - 2);
+	    turtle_path = ags_turtle_term_value(turtle_path);
 	
 	    if(!g_ascii_strncasecmp(turtle_path,
 				    "http://\0",
@@ -807,10 +768,14 @@ ags_lv2ui_manager_load_default_directory(AgsLv2uiManager *lv2ui_manager)
 	
 	    ttl_list = ttl_list->next;
 	  }
-	
+
+	  g_list_free(ttl_start);
+	  
 	  binary_list = binary_list->next;
 	}
 
+	g_list_free(binary_start);
+	
 	g_object_unref(manifest);
       }
     }
@@ -0,0 +1,1086 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/plugin/ags_plugin_cache.h>
+
+#include <ags/object/ags_application_context.h>
+
+#include <ags/plugin/ags_base_plugin.h>
+
+#include <glib/gstdio.h>
+
+#include <libxml/parser.h>
+#include <libxml/xmlsave.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <pwd.h>
+
+xmlNode* ags_plugin_cache_lookup_node(AgsPluginCache *plugin_cache,
+				      gchar *filename);
+xmlNode* ags_plugin_cache_new_file_node(AgsPluginCache *plugin_cache,
+					gchar *filename);
+gboolean ags_plugin_cache_stat(gchar *filename,
+			       guint64 *mtime, guint64 *size);
+
+void ags_plugin_cache_write_value(xmlNode *node,
+				  gchar *name,
+				  GValue *value);
+void ags_plugin_cache_read_value(xmlNode *node,
+				 gchar *name,
+				 gchar *value_type,
+				 GValue *value);
+
+/**
+ * SECTION:ags_plugin_cache
+ * @short_description: persistent plugin metadata
+ * @title: AgsPluginCache
+ * @section_id:
+ * @include: ags/plugin/ags_plugin_cache.h
+ *
+ * The #AgsPluginCache stores the metadata of #AgsBasePlugin and its
+ * #AgsPortDescriptor as XML. Every plugin file is keyed by its path,
+ * modification time and size, so an unchanged file can be restored
+ * without loading its binary.
+ */
+
+/**
+ * ags_plugin_cache_alloc:
+ * @filename: the cache's filename
+ *
+ * Allocate #AgsPluginCache.
+ *
+ * Returns: the new #AgsPluginCache
+ *
+ * Since: 0.7.136
+ */
+AgsPluginCache*
+ags_plugin_cache_alloc(gchar *filename)
+{
+  AgsPluginCache *plugin_cache;
+
+  plugin_cache = (AgsPluginCache *) malloc(sizeof(AgsPluginCache));
+
+  plugin_cache->flags = 0;
+
+  plugin_cache->obj_mutexattr = (pthread_mutexattr_t *) malloc(sizeof(pthread_mutexattr_t));
+  pthread_mutexattr_init(plugin_cache->obj_mutexattr);
+  pthread_mutexattr_settype(plugin_cache->obj_mutexattr,
+			    PTHREAD_MUTEX_RECURSIVE);
+
+  plugin_cache->obj_mutex = (pthread_mutex_t *) malloc(sizeof(pthread_mutex_t));
+  pthread_mutex_init(plugin_cache->obj_mutex,
+		     plugin_cache->obj_mutexattr);
+
+  plugin_cache->filename = g_strdup(filename);
+
+  plugin_cache->doc = NULL;
+  plugin_cache->root_node = NULL;
+
+  plugin_cache->file_node = g_hash_table_new_full(g_str_hash, g_str_equal,
+						  g_free,
+						  NULL);
+  plugin_cache->file_visited = g_hash_table_new_full(g_str_hash, g_str_equal,
+						     g_free,
+						     NULL);
+
+  return(plugin_cache);
+}
+
+/**
+ * ags_plugin_cache_free:
+ * @plugin_cache: the #AgsPluginCache
+ *
+ * Free @plugin_cache and its XML document.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_plugin_cache_free(AgsPluginCache *plugin_cache)
+{
+  if(plugin_cache == NULL){
+    return;
+  }
+
+  g_hash_table_destroy(plugin_cache->file_node);
+  g_hash_table_destroy(plugin_cache->file_visited);
+
+  if(plugin_cache->doc != NULL){
+    xmlFreeDoc(plugin_cache->doc);
+  }
+
+  g_free(plugin_cache->filename);
+
+  pthread_mutex_destroy(plugin_cache->obj_mutex);
+  free(plugin_cache->obj_mutex);
+
+  pthread_mutexattr_destroy(plugin_cache->obj_mutexattr);
+  free(plugin_cache->obj_mutexattr);
+
+  free(plugin_cache);
+}
+
+/**
+ * ags_plugin_cache_get_default_filename:
+ * @name: the cache's name, like "ladspa"
+ *
+ * Get the default location of the cache called @name within the
+ * user's configuration directory.
+ *
+ * Returns: the filename as newly allocated string
+ *
+ * Since: 0.7.136
+ */
+gchar*
+ags_plugin_cache_get_default_filename(gchar *name)
+{
+  struct passwd *pw;
+  uid_t uid;
+
+  gchar *filename;
+
+  uid = getuid();
+  pw = getpwuid(uid);
+
+  if(pw == NULL){
+    return(NULL);
+  }
+
+  filename = g_strdup_printf("%s/%s/%s/%s.xml\0",
+			     pw->pw_dir,
+			     AGS_DEFAULT_DIRECTORY,
+			     AGS_PLUGIN_CACHE_DIRECTORY,
+			     name);
+
+  return(filename);
+}
+
+xmlNode*
+ags_plugin_cache_lookup_node(AgsPluginCache *plugin_cache,
+			     gchar *filename)
+{
+  return((xmlNode *) g_hash_table_lookup(plugin_cache->file_node,
+					 filename));
+}
+
+xmlNode*
+ags_plugin_cache_new_file_node(AgsPluginCache *plugin_cache,
+			       gchar *filename)
+{
+  xmlNode *node;
+
+  gchar *str;
+
+  guint64 mtime, size;
+
+  /* replace stale node */
+  node = ags_plugin_cache_lookup_node(plugin_cache,
+				      filename);
+
+  if(node != NULL){
+    xmlUnlinkNode(node);
+    xmlFreeNode(node);
+  }
+
+  mtime = 0;
+  size = 0;
+
+  ags_plugin_cache_stat(filename,
+			&mtime, &size);
+
+  node = xmlNewNode(NULL,
+		    "ags-plugin-cache-file\0");
+  xmlNewProp(node,
+	     "filename\0",
+	     filename);
+
+  str = g_strdup_printf("%" G_GUINT64_FORMAT, mtime);
+  xmlNewProp(node,
+	     "mtime\0",
+	     str);
+  g_free(str);
+
+  str = g_strdup_printf("%" G_GUINT64_FORMAT, size);
+  xmlNewProp(node,
+	     "size\0",
+	     str);
+  g_free(str);
+
+  xmlAddChild(plugin_cache->root_node,
+	      node);
+
+  g_hash_table_replace(plugin_cache->file_node,
+		       g_strdup(filename),
+		       node);
+  g_hash_table_replace(plugin_cache->file_visited,
+		       g_strdup(filename),
+		       GUINT_TO_POINTER(TRUE));
+
+  plugin_cache->flags |= AGS_PLUGIN_CACHE_MODIFIED;
+
+  return(node);
+}
+
+gboolean
+ags_plugin_cache_stat(gchar *filename,
+		      guint64 *mtime, guint64 *size)
+{
+  struct stat sb;
+
+  if(g_stat(filename,
+	    &sb) != 0){
+    return(FALSE);
+  }
+
+  *mtime = (guint64) sb.st_mtime;
+  *size = (guint64) sb.st_size;
+
+  return(TRUE);
+}
+
+void
+ags_plugin_cache_write_value(xmlNode *node,
+			     gchar *name,
+			     GValue *value)
+{
+  gchar buffer[G_ASCII_DTOSTR_BUF_SIZE];
+
+  if(G_VALUE_HOLDS_FLOAT(value)){
+    g_ascii_dtostr(buffer, G_ASCII_DTOSTR_BUF_SIZE,
+		   (gdouble) g_value_get_float(value));
+  }else if(G_VALUE_HOLDS_DOUBLE(value)){
+    g_ascii_dtostr(buffer, G_ASCII_DTOSTR_BUF_SIZE,
+		   g_value_get_double(value));
+  }else{
+    return;
+  }
+
+  xmlNewProp(node,
+	     name,
+	     buffer);
+}
+
+void
+ags_plugin_cache_read_value(xmlNode *node,
+			    gchar *name,
+			    gchar *value_type,
+			    GValue *value)
+{
+  xmlChar *str;
+
+  gdouble val;
+
+  if(value_type == NULL){
+    return;
+  }
+
+  str = xmlGetProp(node,
+		   name);
+  val = (str != NULL) ? g_ascii_strtod(str, NULL): 0.0;
+
+  if(!g_strcmp0(value_type,
+		"gfloat\0")){
+    g_value_init(value,
+		 G_TYPE_FLOAT);
+    g_value_set_float(value,
+		      (gfloat) val);
+  }else if(!g_strcmp0(value_type,
+		      "gdouble\0")){
+    g_value_init(value,
+		 G_TYPE_DOUBLE);
+    g_value_set_double(value,
+		       val);
+  }
+
+  if(str != NULL){
+    xmlFree(str);
+  }
+}
+
+/**
+ * ags_plugin_cache_read:
+ * @plugin_cache: the #AgsPluginCache
+ *
+ * Read the cache from disk. A missing, malformed or outdated cache
+ * results in an empty document.
+ *
+ * Returns: %TRUE if an existing cache was read, otherwise %FALSE
+ *
+ * Since: 0.7.136
+ */
+gboolean
+ags_plugin_cache_read(AgsPluginCache *plugin_cache)
+{
+  xmlNode *child;
+  xmlChar *version;
+  xmlChar *filename;
+
+  gboolean success;
+
+  if(plugin_cache == NULL){
+    return(FALSE);
+  }
+
+  pthread_mutex_lock(plugin_cache->obj_mutex);
+
+  if(plugin_cache->doc != NULL){
+    xmlFreeDoc(plugin_cache->doc);
+
+    plugin_cache->doc = NULL;
+    plugin_cache->root_node = NULL;
+  }
+
+  g_hash_table_remove_all(plugin_cache->file_node);
+  g_hash_table_remove_all(plugin_cache->file_visited);
+
+  success = FALSE;
+
+  if(plugin_cache->filename != NULL &&
+     g_file_test(plugin_cache->filename,
+		 G_FILE_TEST_EXISTS)){
+    plugin_cache->doc = xmlReadFile(plugin_cache->filename,
+				    NULL,
+				    XML_PARSE_NOBLANKS);
+  }
+
+  if(plugin_cache->doc != NULL){
+    plugin_cache->root_node = xmlDocGetRootElement(plugin_cache->doc);
+
+    version = NULL;
+
+    if(plugin_cache->root_node != NULL &&
+       !xmlStrcmp(plugin_cache->root_node->name,
+		  "ags-plugin-cache\0")){
+      version = xmlGetProp(plugin_cache->root_node,
+			   "version\0");
+    }
+
+    if(version != NULL &&
+       !xmlStrcmp(version,
+		  AGS_PLUGIN_CACHE_VERSION)){
+      success = TRUE;
+    }else{
+      g_message("ags_plugin_cache.c - discarding outdated cache %s\0", plugin_cache->filename);
+
+      xmlFreeDoc(plugin_cache->doc);
+
+      plugin_cache->doc = NULL;
+    }
+
+    if(version != NULL){
+      xmlFree(version);
+    }
+  }
+
+  if(plugin_cache->doc == NULL){
+    plugin_cache->doc = xmlNewDoc("1.0\0");
+    plugin_cache->root_node = xmlNewNode(NULL,
+					 "ags-plugin-cache\0");
+    xmlNewProp(plugin_cache->root_node,
+	       "version\0",
+	       AGS_PLUGIN_CACHE_VERSION);
+    xmlDocSetRootElement(plugin_cache->doc,
+			 plugin_cache->root_node);
+
+    plugin_cache->flags |= AGS_PLUGIN_CACHE_MODIFIED;
+  }
+
+  /* index files */
+  child = plugin_cache->root_node->children;
+
+  while(child != NULL){
+    if(child->type == XML_ELEMENT_NODE &&
+       !xmlStrcmp(child->name,
+		  "ags-plugin-cache-file\0")){
+      filename = xmlGetProp(child,
+			    "filename\0");
+
+      if(filename != NULL){
+	g_hash_table_replace(plugin_cache->file_node,
+			     g_strdup(filename),
+			     child);
+	xmlFree(filename);
+      }
+    }
+
+    child = child->next;
+  }
+
+  pthread_mutex_unlock(plugin_cache->obj_mutex);
+
+  return(success);
+}
+
+/**
+ * ags_plugin_cache_write:
+ * @plugin_cache: the #AgsPluginCache
+ *
+ * Drop the entries of files not visited since the last read and write
+ * the cache to disk, if it was modified.
+ *
+ * Returns: %TRUE on success, otherwise %FALSE
+ *
+ * Since: 0.7.136
+ */
+gboolean
+ags_plugin_cache_write(AgsPluginCache *plugin_cache)
+{
+  GHashTableIter iter;
+
+  gchar *path;
+  gchar *tmp_filename;
+  gpointer key, value;
+
+  gboolean success;
+
+  if(plugin_cache == NULL ||
+     plugin_cache->filename == NULL){
+    return(FALSE);
+  }
+
+  pthread_mutex_lock(plugin_cache->obj_mutex);
+
+  if(plugin_cache->doc == NULL){
+    pthread_mutex_unlock(plugin_cache->obj_mutex);
+
+    return(FALSE);
+  }
+
+  /* prune files gone */
+  g_hash_table_iter_init(&iter,
+			 plugin_cache->file_node);
+
+  while(g_hash_table_iter_next(&iter,
+			       &key, &value)){
+    if(!g_hash_table_contains(plugin_cache->file_visited,
+			      key)){
+      xmlUnlinkNode((xmlNode *) value);
+      xmlFreeNode((xmlNode *) value);
+
+      g_hash_table_iter_remove(&iter);
+
+      plugin_cache->flags |= AGS_PLUGIN_CACHE_MODIFIED;
+    }
+  }
+
+  if((AGS_PLUGIN_CACHE_MODIFIED & (plugin_cache->flags)) == 0){
+    pthread_mutex_unlock(plugin_cache->obj_mutex);
+
+    return(TRUE);
+  }
+
+  /* write to temporary file and rename */
+  path = g_path_get_dirname(plugin_cache->filename);
+  g_mkdir_with_parents(path,
+		       0755);
+  g_free(path);
+
+  tmp_filename = g_strdup_printf("%s.%d\0",
+				 plugin_cache->filename,
+				 getpid());
+
+  success = FALSE;
+
+  if(xmlSaveFormatFileEnc(tmp_filename,
+			  plugin_cache->doc,
+			  "UTF-8\0",
+			  1) != -1){
+    if(g_rename(tmp_filename,
+		plugin_cache->filename) == 0){
+      plugin_cache->flags &= (~AGS_PLUGIN_CACHE_MODIFIED);
+
+      success = TRUE;
+    }
+  }
+
+  if(!success){
+    g_warning("ags_plugin_cache.c - failed to write %s\0", plugin_cache->filename);
+
+    g_unlink(tmp_filename);
+  }
+
+  g_free(tmp_filename);
+
+  pthread_mutex_unlock(plugin_cache->obj_mutex);
+
+  return(success);
+}
+
+/**
+ * ags_plugin_cache_is_valid:
+ * @plugin_cache: the #AgsPluginCache
+ * @filename: the plugin's filename
+ *
+ * Check if @plugin_cache contains an entry of @filename matching the
+ * file's current modification time and size.
+ *
+ * Returns: %TRUE if the entry is up to date, otherwise %FALSE
+ *
+ * Since: 0.7.136
+ */
+gboolean
+ags_plugin_cache_is_valid(AgsPluginCache *plugin_cache,
+			  gchar *filename)
+{
+  xmlNode *node;
+  xmlChar *str;
+
+  guint64 mtime, size;
+  gboolean success;
+
+  if(plugin_cache == NULL ||
+     filename == NULL){
+    return(FALSE);
+  }
+
+  if(!ags_plugin_cache_stat(filename,
+			    &mtime, &size)){
+    return(FALSE);
+  }
+
+  pthread_mutex_lock(plugin_cache->obj_mutex);
+
+  node = ags_plugin_cache_lookup_node(plugin_cache,
+				      filename);
+
+  success = FALSE;
+
+  if(node != NULL){
+    success = TRUE;
+
+    str = xmlGetProp(node,
+		     "mtime\0");
+
+    if(str == NULL ||
+       g_ascii_strtoull(str, NULL, 10) != mtime){
+      success = FALSE;
+    }
+
+    if(str != NULL){
+      xmlFree(str);
+    }
+
+    str = xmlGetProp(node,
+		     "size\0");
+
+    if(str == NULL ||
+       g_ascii_strtoull(str, NULL, 10) != size){
+      success = FALSE;
+    }
+
+    if(str != NULL){
+      xmlFree(str);
+    }
+  }
+
+  pthread_mutex_unlock(plugin_cache->obj_mutex);
+
+  return(success);
+}
+
+/**
+ * ags_plugin_cache_load_file:
+ * @plugin_cache: the #AgsPluginCache
+ * @plugin_type: the #GType of the plugins to instantiate
+ * @filename: the plugin's filename
+ *
+ * Create the plugins of @filename from @plugin_cache. The binary is not
+ * loaded, call ags_base_plugin_load_binary() before using its descriptor.
+ *
+ * Returns: a #GList containing #AgsBasePlugin
+ *
+ * Since: 0.7.136
+ */
+GList*
+ags_plugin_cache_load_file(AgsPluginCache *plugin_cache,
+			   GType plugin_type,
+			   gchar *filename)
+{
+  AgsBasePlugin *base_plugin;
+  AgsPortDescriptor *port;
+
+  xmlNode *node;
+  xmlNode *plugin_node;
+  xmlNode *port_node;
+
+  GList *plugin_list;
+  GList *port_list;
+
+  xmlChar *effect;
+  xmlChar *str;
+  xmlChar *value_type;
+
+  guint effect_index;
+
+  if(plugin_cache == NULL ||
+     filename == NULL){
+    return(NULL);
+  }
+
+  pthread_mutex_lock(plugin_cache->obj_mutex);
+
+  node = ags_plugin_cache_lookup_node(plugin_cache,
+				      filename);
+
+  if(node == NULL){
+    pthread_mutex_unlock(plugin_cache->obj_mutex);
+
+    return(NULL);
+  }
+
+  g_hash_table_replace(plugin_cache->file_visited,
+		       g_strdup(filename),
+		       GUINT_TO_POINTER(TRUE));
+
+  plugin_list = NULL;
+  plugin_node = node->children;
+
+  while(plugin_node != NULL){
+    if(plugin_node->type != XML_ELEMENT_NODE ||
+       xmlStrcmp(plugin_node->name,
+		 "ags-plugin\0")){
+      plugin_node = plugin_node->next;
+
+      continue;
+    }
+
+    effect = xmlGetProp(plugin_node,
+			"effect\0");
+
+    str = xmlGetProp(plugin_node,
+		     "effect-index\0");
+    effect_index = (str != NULL) ? g_ascii_strtoull(str, NULL, 10): 0;
+
+    if(str != NULL){
+      xmlFree(str);
+    }
+
+    base_plugin = g_object_new(plugin_type,
+			       "filename\0", filename,
+			       "effect\0", effect,
+			       "effect-index\0", effect_index,
+			       NULL);
+
+    if(effect != NULL){
+      xmlFree(effect);
+    }
+
+    str = xmlGetProp(plugin_node,
+		     "flags\0");
+
+    if(str != NULL){
+      base_plugin->flags = g_ascii_strtoull(str, NULL, 10);
+
+      xmlFree(str);
+    }
+
+    str = xmlGetProp(plugin_node,
+		     "unique-id\0");
+
+    if(str != NULL){
+      if(g_object_class_find_property(G_OBJECT_GET_CLASS(base_plugin),
+				      "unique-id\0") != NULL){
+	g_object_set(base_plugin,
+		     "unique-id\0", (guint) g_ascii_strtoull(str, NULL, 10),
+		     NULL);
+      }
+
+      xmlFree(str);
+    }
+
+    /* port descriptor */
+    port_list = NULL;
+    port_node = plugin_node->children;
+
+    while(port_node != NULL){
+      if(port_node->type != XML_ELEMENT_NODE ||
+	 xmlStrcmp(port_node->name,
+		   "ags-port-descriptor\0")){
+	port_node = port_node->next;
+
+	continue;
+      }
+
+      port = ags_port_descriptor_alloc();
+      port_list = g_list_prepend(port_list,
+				 port);
+
+      str = xmlGetProp(port_node,
+		       "flags\0");
+      port->flags = (str != NULL) ? g_ascii_strtoull(str, NULL, 10): 0;
+
+      if(str != NULL){
+	xmlFree(str);
+      }
+
+      str = xmlGetProp(port_node,
+		       "port-index\0");
+      port->port_index = (str != NULL) ? g_ascii_strtoull(str, NULL, 10): 0;
+
+      if(str != NULL){
+	xmlFree(str);
+      }
+
+      str = xmlGetProp(port_node,
+		       "scale-steps\0");
+      port->scale_steps = (str != NULL) ? g_ascii_strtoll(str, NULL, 10): -1;
+
+      if(str != NULL){
+	xmlFree(str);
+      }
+
+      str = xmlGetProp(port_node,
+		       "port-name\0");
+      port->port_name = g_strdup(str);
+
+      if(str != NULL){
+	xmlFree(str);
+      }
+
+      str = xmlGetProp(port_node,
+		       "port-symbol\0");
+      port->port_symbol = g_strdup(str);
+
+      if(str != NULL){
+	xmlFree(str);
+      }
+
+      value_type = xmlGetProp(port_node,
+			      "value-type\0");
+
+      ags_plugin_cache_read_value(port_node,
+				  "lower-value\0",
+				  value_type,
+				  port->lower_value);
+      ags_plugin_cache_read_value(port_node,
+				  "upper-value\0",
+				  value_type,
+				  port->upper_value);
+      ags_plugin_cache_read_value(port_node,
+				  "default-value\0",
+				  value_type,
+				  port->default_value);
+
+      if(value_type != NULL){
+	xmlFree(value_type);
+      }
+
+      port_node = port_node->next;
+    }
+
+    base_plugin->port = g_list_reverse(port_list);
+
+    plugin_list = g_list_prepend(plugin_list,
+				 base_plugin);
+
+    plugin_node = plugin_node->next;
+  }
+
+  pthread_mutex_unlock(plugin_cache->obj_mutex);
+
+  return(g_list_reverse(plugin_list));
+}
+
+/**
+ * ags_plugin_cache_add_file:
+ * @plugin_cache: the #AgsPluginCache
+ * @filename: the plugin's filename
+ * @base_plugin: a #GList containing the #AgsBasePlugin of @filename
+ *
+ * Store the metadata of @base_plugin as the entry of @filename,
+ * replacing any previous one.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_plugin_cache_add_file(AgsPluginCache *plugin_cache,
+			  gchar *filename,
+			  GList *base_plugin)
+{
+  AgsPortDescriptor *port;
+
+  xmlNode *node;
+  xmlNode *plugin_node;
+  xmlNode *port_node;
+
+  GList *port_list;
+
+  gchar *str;
+
+  guint unique_id;
+
+  if(plugin_cache == NULL ||
+     filename == NULL){
+    return;
+  }
+
+  pthread_mutex_lock(plugin_cache->obj_mutex);
+
+  node = ags_plugin_cache_new_file_node(plugin_cache,
+					filename);
+
+  while(base_plugin != NULL){
+    plugin_node = xmlNewNode(NULL,
+			     "ags-plugin\0");
+    xmlAddChild(node,
+		plugin_node);
+
+    xmlNewProp(plugin_node,
+	       "effect\0",
+	       AGS_BASE_PLUGIN(base_plugin->data)->effect);
+
+    str = g_strdup_printf("%u\0", AGS_BASE_PLUGIN(base_plugin->data)->effect_index);
+    xmlNewProp(plugin_node,
+	       "effect-index\0",
+	       str);
+    g_free(str);
+
+    str = g_strdup_printf("%u\0", AGS_BASE_PLUGIN(base_plugin->data)->flags);
+    xmlNewProp(plugin_node,
+	       "flags\0",
+	       str);
+    g_free(str);
+
+    if(g_object_class_find_property(G_OBJECT_GET_CLASS(base_plugin->data),
+				    "unique-id\0") != NULL){
+      g_object_get(base_plugin->data,
+		   "unique-id\0", &unique_id,
+		   NULL);
+
+      str = g_strdup_printf("%u\0", unique_id);
+      xmlNewProp(plugin_node,
+		 "unique-id\0",
+		 str);
+      g_free(str);
+    }
+
+    /* port descriptor */
+    port_list = AGS_BASE_PLUGIN(base_plugin->data)->port;
+
+    while(port_list != NULL){
+      port = AGS_PORT_DESCRIPTOR(port_list->data);
+
+      port_node = xmlNewNode(NULL,
+			     "ags-port-descriptor\0");
+      xmlAddChild(plugin_node,
+		  port_node);
+
+      str = g_strdup_printf("%u\0", port->flags);
+      xmlNewProp(port_node,
+		 "flags\0",
+		 str);
+      g_free(str);
+
+      str = g_strdup_printf("%u\0", port->port_index);
+      xmlNewProp(port_node,
+		 "port-index\0",
+		 str);
+      g_free(str);
+
+      str = g_strdup_printf("%d\0", port->scale_steps);
+      xmlNewProp(port_node,
+		 "scale-steps\0",
+		 str);
+      g_free(str);
+
+      if(port->port_name != NULL){
+	xmlNewProp(port_node,
+		   "port-name\0",
+		   port->port_name);
+      }
+
+      if(port->port_symbol != NULL){
+	xmlNewProp(port_node,
+		   "port-symbol\0",
+		   port->port_symbol);
+      }
+
+      if(G_IS_VALUE(port->default_value)){
+	xmlNewProp(port_node,
+		   "value-type\0",
+		   g_type_name(G_VALUE_TYPE(port->default_value)));
+
+	ags_plugin_cache_write_value(port_node,
+				     "lower-value\0",
+				     port->lower_value);
+	ags_plugin_cache_write_value(port_node,
+				     "upper-value\0",
+				     port->upper_value);
+	ags_plugin_cache_write_value(port_node,
+				     "default-value\0",
+				     port->default_value);
+      }
+
+      port_list = port_list->next;
+    }
+
+    base_plugin = base_plugin->next;
+  }
+
+  pthread_mutex_unlock(plugin_cache->obj_mutex);
+}
+
+/**
+ * ags_plugin_cache_find_effect_index:
+ * @plugin_cache: the #AgsPluginCache
+ * @filename: the plugin's filename
+ * @uri: the plugin's URI
+ * @effect_index: return location of the effect index
+ *
+ * Find the effect index of @uri within @filename, if the entry of
+ * @filename is up to date.
+ *
+ * Returns: %TRUE if found, otherwise %FALSE
+ *
+ * Since: 0.7.136
+ */
+gboolean
+ags_plugin_cache_find_effect_index(AgsPluginCache *plugin_cache,
+				   gchar *filename,
+				   gchar *uri,
+				   guint *effect_index)
+{
+  xmlNode *node;
+  xmlNode *plugin_node;
+  xmlChar *str;
+
+  gboolean success;
+
+  if(plugin_cache == NULL ||
+     uri == NULL ||
+     !ags_plugin_cache_is_valid(plugin_cache,
+				filename)){
+    return(FALSE);
+  }
+
+  pthread_mutex_lock(plugin_cache->obj_mutex);
+
+  node = ags_plugin_cache_lookup_node(plugin_cache,
+				      filename);
+
+  g_hash_table_replace(plugin_cache->file_visited,
+		       g_strdup(filename),
+		       GUINT_TO_POINTER(TRUE));
+
+  success = FALSE;
+  plugin_node = (node != NULL) ? node->children: NULL;
+
+  while(plugin_node != NULL){
+    if(plugin_node->type == XML_ELEMENT_NODE &&
+       !xmlStrcmp(plugin_node->name,
+		  "ags-plugin\0")){
+      str = xmlGetProp(plugin_node,
+		       "uri\0");
+
+      if(str != NULL &&
+	 !g_ascii_strcasecmp(str,
+			     uri)){
+	xmlFree(str);
+
+	str = xmlGetProp(plugin_node,
+			 "effect-index\0");
+
+	if(str != NULL){
+	  *effect_index = g_ascii_strtoull(str, NULL, 10);
+
+	  xmlFree(str);
+
+	  success = TRUE;
+	}
+
+	break;
+      }
+
+      if(str != NULL){
+	xmlFree(str);
+      }
+    }
+
+    plugin_node = plugin_node->next;
+  }
+
+  pthread_mutex_unlock(plugin_cache->obj_mutex);
+
+  return(success);
+}
+
+/**
+ * ags_plugin_cache_add_effect_index:
+ * @plugin_cache: the #AgsPluginCache
+ * @filename: the plugin's filename
+ * @uri: the plugin's URI
+ * @effect_index: the effect index
+ *
+ * Store the effect index of @uri within @filename. A stale entry of
+ * @filename is replaced.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_plugin_cache_add_effect_index(AgsPluginCache *plugin_cache,
+				  gchar *filename,
+				  gchar *uri,
+				  guint effect_index)
+{
+  xmlNode *node;
+  xmlNode *plugin_node;
+
+  gchar *str;
+
+  if(plugin_cache == NULL ||
+     filename == NULL ||
+     uri == NULL){
+    return;
+  }
+
+  pthread_mutex_lock(plugin_cache->obj_mutex);
+
+  node = ags_plugin_cache_lookup_node(plugin_cache,
+				      filename);
+
+  if(node == NULL ||
+     !g_hash_table_contains(plugin_cache->file_visited,
+			    filename)){
+    node = ags_plugin_cache_new_file_node(plugin_cache,
+					  filename);
+  }
+
+  plugin_node = xmlNewNode(NULL,
+			   "ags-plugin\0");
+  xmlAddChild(node,
+	      plugin_node);
+
+  xmlNewProp(plugin_node,
+	     "uri\0",
+	     uri);
+
+  str = g_strdup_printf("%u\0", effect_index);
+  xmlNewProp(plugin_node,
+	     "effect-index\0",
+	     str);
+  g_free(str);
+
+  plugin_cache->flags |= AGS_PLUGIN_CACHE_MODIFIED;
+
+  pthread_mutex_unlock(plugin_cache->obj_mutex);
+}
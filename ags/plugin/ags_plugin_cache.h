@@ -0,0 +1,84 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_PLUGIN_CACHE_H__
+#define __AGS_PLUGIN_CACHE_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <libxml/tree.h>
+
+#include <pthread.h>
+
+#define AGS_PLUGIN_CACHE(ptr) ((AgsPluginCache *)(ptr))
+
+#define AGS_PLUGIN_CACHE_VERSION "1\0"
+#define AGS_PLUGIN_CACHE_DIRECTORY "cache\0"
+
+typedef struct _AgsPluginCache AgsPluginCache;
+
+typedef enum{
+  AGS_PLUGIN_CACHE_MODIFIED   = 1,
+}AgsPluginCacheFlags;
+
+struct _AgsPluginCache
+{
+  guint flags;
+
+  pthread_mutex_t *obj_mutex;
+  pthread_mutexattr_t *obj_mutexattr;
+
+  gchar *filename;
+
+  xmlDoc *doc;
+  xmlNode *root_node;
+
+  GHashTable *file_node;
+  GHashTable *file_visited;
+};
+
+AgsPluginCache* ags_plugin_cache_alloc(gchar *filename);
+void ags_plugin_cache_free(AgsPluginCache *plugin_cache);
+
+gchar* ags_plugin_cache_get_default_filename(gchar *name);
+
+gboolean ags_plugin_cache_read(AgsPluginCache *plugin_cache);
+gboolean ags_plugin_cache_write(AgsPluginCache *plugin_cache);
+
+gboolean ags_plugin_cache_is_valid(AgsPluginCache *plugin_cache,
+				   gchar *filename);
+
+GList* ags_plugin_cache_load_file(AgsPluginCache *plugin_cache,
+				  GType plugin_type,
+				  gchar *filename);
+void ags_plugin_cache_add_file(AgsPluginCache *plugin_cache,
+			       gchar *filename,
+			       GList *base_plugin);
+
+gboolean ags_plugin_cache_find_effect_index(AgsPluginCache *plugin_cache,
+					    gchar *filename,
+					    gchar *uri,
+					    guint *effect_index);
+void ags_plugin_cache_add_effect_index(AgsPluginCache *plugin_cache,
+				       gchar *filename,
+				       gchar *uri,
+				       guint effect_index);
+
+#endif /*__AGS_PLUGIN_CACHE_H__*/
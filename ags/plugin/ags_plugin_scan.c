@@ -0,0 +1,299 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ags/plugin/ags_plugin_scan.h>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+void* ags_plugin_scan_thread(void *ptr);
+
+/**
+ * SECTION:ags_plugin_scan
+ * @short_description: parallel plugin discovery
+ * @title: AgsPluginScan
+ * @section_id:
+ * @include: ags/plugin/ags_plugin_scan.h
+ *
+ * The #AgsPluginScan runs the jobs of a plugin directory scan on
+ * several worker threads. The plugin managers scan before the
+ * application's thread tree is set up, so plain pthreads are used.
+ * Every #AgsPluginScanJob collects its plugins itself, the caller merges
+ * them in order of the jobs after ags_plugin_scan_run() returned.
+ */
+
+/**
+ * ags_plugin_scan_job_alloc:
+ * @path: the directory
+ * @filename: the filename within @path
+ *
+ * Allocate #AgsPluginScanJob.
+ *
+ * Returns: the new #AgsPluginScanJob
+ *
+ * Since: 0.7.136
+ */
+AgsPluginScanJob*
+ags_plugin_scan_job_alloc(gchar *path,
+			  gchar *filename)
+{
+  AgsPluginScanJob *job;
+
+  job = (AgsPluginScanJob *) malloc(sizeof(AgsPluginScanJob));
+
+  job->path = g_strdup(path);
+  job->filename = g_strdup(filename);
+
+  job->data = NULL;
+  job->plugin = NULL;
+
+  return(job);
+}
+
+/**
+ * ags_plugin_scan_job_free:
+ * @job: the #AgsPluginScanJob
+ *
+ * Free @job. The plugins found are not unreferenced.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_plugin_scan_job_free(AgsPluginScanJob *job)
+{
+  if(job == NULL){
+    return;
+  }
+
+  g_free(job->path);
+  g_free(job->filename);
+
+  g_list_free(job->plugin);
+
+  free(job);
+}
+
+/**
+ * ags_plugin_scan_get_default_n_threads:
+ *
+ * Get the default count of worker threads, that is the count of
+ * online processors.
+ *
+ * Returns: the count of threads
+ *
+ * Since: 0.7.136
+ */
+guint
+ags_plugin_scan_get_default_n_threads()
+{
+  long n_processors;
+
+  n_processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+  if(n_processors < 1){
+    return(1);
+  }
+
+  return((guint) n_processors);
+}
+
+/**
+ * ags_plugin_scan_alloc:
+ * @func: the function to run for each job
+ * @data: user data passed to @func
+ *
+ * Allocate #AgsPluginScan.
+ *
+ * Returns: the new #AgsPluginScan
+ *
+ * Since: 0.7.136
+ */
+AgsPluginScan*
+ags_plugin_scan_alloc(AgsPluginScanFunc func,
+		      gpointer data)
+{
+  AgsPluginScan *plugin_scan;
+
+  plugin_scan = (AgsPluginScan *) malloc(sizeof(AgsPluginScan));
+
+  plugin_scan->obj_mutex = (pthread_mutex_t *) malloc(sizeof(pthread_mutex_t));
+  pthread_mutex_init(plugin_scan->obj_mutex,
+		     NULL);
+
+  plugin_scan->n_threads = ags_plugin_scan_get_default_n_threads();
+  plugin_scan->thread = NULL;
+
+  plugin_scan->job = NULL;
+  plugin_scan->pending = NULL;
+
+  plugin_scan->func = func;
+  plugin_scan->data = data;
+
+  return(plugin_scan);
+}
+
+/**
+ * ags_plugin_scan_free:
+ * @plugin_scan: the #AgsPluginScan
+ *
+ * Free @plugin_scan and all its jobs.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_plugin_scan_free(AgsPluginScan *plugin_scan)
+{
+  if(plugin_scan == NULL){
+    return;
+  }
+
+  g_list_free_full(plugin_scan->job,
+		   (GDestroyNotify) ags_plugin_scan_job_free);
+
+  pthread_mutex_destroy(plugin_scan->obj_mutex);
+  free(plugin_scan->obj_mutex);
+
+  free(plugin_scan->thread);
+
+  free(plugin_scan);
+}
+
+/**
+ * ags_plugin_scan_add_job:
+ * @plugin_scan: the #AgsPluginScan
+ * @job: the #AgsPluginScanJob
+ *
+ * Append @job to @plugin_scan.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_plugin_scan_add_job(AgsPluginScan *plugin_scan,
+			AgsPluginScanJob *job)
+{
+  if(plugin_scan == NULL ||
+     job == NULL){
+    return;
+  }
+
+  /* prepend and reverse in ags_plugin_scan_run() */
+  plugin_scan->job = g_list_prepend(plugin_scan->job,
+				    job);
+}
+
+void*
+ags_plugin_scan_thread(void *ptr)
+{
+  AgsPluginScan *plugin_scan;
+  AgsPluginScanJob *job;
+
+  plugin_scan = AGS_PLUGIN_SCAN(ptr);
+
+  for(;;){
+    /* pull next job */
+    pthread_mutex_lock(plugin_scan->obj_mutex);
+
+    if(plugin_scan->pending == NULL){
+      pthread_mutex_unlock(plugin_scan->obj_mutex);
+
+      break;
+    }
+
+    job = AGS_PLUGIN_SCAN_JOB(plugin_scan->pending->data);
+    plugin_scan->pending = plugin_scan->pending->next;
+
+    pthread_mutex_unlock(plugin_scan->obj_mutex);
+
+    plugin_scan->func(job,
+		      plugin_scan->data);
+  }
+
+  pthread_exit(NULL);
+}
+
+/**
+ * ags_plugin_scan_run:
+ * @plugin_scan: the #AgsPluginScan
+ *
+ * Run all jobs of @plugin_scan and wait for them to complete. If the
+ * threads can't be created the remaining jobs run on the calling thread.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_plugin_scan_run(AgsPluginScan *plugin_scan)
+{
+  guint n_jobs;
+  guint n_threads;
+  guint i;
+
+  if(plugin_scan == NULL ||
+     plugin_scan->func == NULL){
+    return;
+  }
+
+  plugin_scan->job = g_list_reverse(plugin_scan->job);
+  plugin_scan->pending = plugin_scan->job;
+
+  n_jobs = g_list_length(plugin_scan->job);
+
+  n_threads = plugin_scan->n_threads;
+
+  if(n_threads > n_jobs){
+    n_threads = n_jobs;
+  }
+
+  if(n_threads == 0){
+    return;
+  }
+
+  free(plugin_scan->thread);
+  plugin_scan->thread = (pthread_t *) malloc(n_threads * sizeof(pthread_t));
+
+  for(i = 0; i < n_threads; i++){
+    if(pthread_create(&(plugin_scan->thread[i]), NULL,
+		      ags_plugin_scan_thread, plugin_scan) != 0){
+      g_warning("ags_plugin_scan.c - failed to create worker thread\0");
+
+      break;
+    }
+  }
+
+  n_threads = i;
+
+  /* fallback */
+  if(n_threads == 0){
+    while(plugin_scan->pending != NULL){
+      AgsPluginScanJob *job;
+
+      job = AGS_PLUGIN_SCAN_JOB(plugin_scan->pending->data);
+      plugin_scan->pending = plugin_scan->pending->next;
+
+      plugin_scan->func(job,
+			plugin_scan->data);
+    }
+
+    return;
+  }
+
+  for(i = 0; i < n_threads; i++){
+    pthread_join(plugin_scan->thread[i],
+		 NULL);
+  }
+}
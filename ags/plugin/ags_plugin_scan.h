@@ -0,0 +1,73 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGS_PLUGIN_SCAN_H__
+#define __AGS_PLUGIN_SCAN_H__
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <pthread.h>
+
+#define AGS_PLUGIN_SCAN(ptr) ((AgsPluginScan *)(ptr))
+#define AGS_PLUGIN_SCAN_JOB(ptr) ((AgsPluginScanJob *)(ptr))
+
+typedef struct _AgsPluginScan AgsPluginScan;
+typedef struct _AgsPluginScanJob AgsPluginScanJob;
+
+typedef void (*AgsPluginScanFunc)(AgsPluginScanJob *job, gpointer data);
+
+struct _AgsPluginScan
+{
+  pthread_mutex_t *obj_mutex;
+
+  guint n_threads;
+  pthread_t *thread;
+
+  GList *job;
+  GList *pending;
+
+  AgsPluginScanFunc func;
+  gpointer data;
+};
+
+struct _AgsPluginScanJob
+{
+  gchar *path;
+  gchar *filename;
+
+  gpointer data;
+  GList *plugin;
+};
+
+AgsPluginScanJob* ags_plugin_scan_job_alloc(gchar *path,
+					    gchar *filename);
+void ags_plugin_scan_job_free(AgsPluginScanJob *job);
+
+guint ags_plugin_scan_get_default_n_threads();
+
+AgsPluginScan* ags_plugin_scan_alloc(AgsPluginScanFunc func,
+				     gpointer data);
+void ags_plugin_scan_free(AgsPluginScan *plugin_scan);
+
+void ags_plugin_scan_add_job(AgsPluginScan *plugin_scan,
+			     AgsPluginScanJob *job);
+void ags_plugin_scan_run(AgsPluginScan *plugin_scan);
+
+#endif /*__AGS_PLUGIN_SCAN_H__*/
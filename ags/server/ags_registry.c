@@ -26,6 +26,7 @@
 #include <ags/server/ags_server.h>
 
 #include <stdlib.h>
+#include <string.h>
 
 void ags_registry_class_init(AgsRegistryClass *registry);
 void ags_registry_connectable_interface_init(AgsConnectableInterface *connectable);
@@ -36,6 +37,12 @@ void ags_registry_connect(AgsConnectable *connectable);
 void ags_registry_disconnect(AgsConnectable *connectable);
 void ags_registry_finalize(GObject *gobject);
 
+guint ags_registry_uuid_hash(gconstpointer key);
+gboolean ags_registry_uuid_equal(gconstpointer a,
+				 gconstpointer b);
+gboolean ags_registry_parse_uuid(gchar *id,
+				 guchar *uuid);
+
 static gpointer ags_registry_parent_class = NULL;
 
 GType
@@ -104,6 +111,8 @@ ags_registry_init(AgsRegistry *registry)
 
   pthread_mutex_init(&(registry->mutex),
 		     NULL);
+  pthread_rwlock_init(&(registry->entry_rwlock),
+		      NULL);
 
   registry->previous = NULL;
   registry->current = NULL;
@@ -116,6 +125,8 @@ ags_registry_init(AgsRegistry *registry)
   registry->counter = 0;
   
   registry->entry = NULL;
+  registry->entry_by_uuid = g_hash_table_new(ags_registry_uuid_hash,
+					     ags_registry_uuid_equal);
 }
 
 void
@@ -165,17 +176,110 @@ ags_registry_finalize(GObject *gobject)
 
   registry = AGS_REGISTRY(gobject);
 
+  g_hash_table_destroy(registry->entry_by_uuid);
+  pthread_rwlock_destroy(&(registry->entry_rwlock));
+  
   G_OBJECT_CLASS(ags_registry_parent_class)->finalize(gobject);
 }
 
+guint
+ags_registry_uuid_hash(gconstpointer key)
+{
+  const guchar *uuid;
+  guint hash;
+  guint i;
+
+  uuid = key;
+  hash = 0;
+
+  /* fold the 128 bit into 32 bit, time low comes first */
+  for(i = 0; i < AGS_REGISTRY_UUID_LENGTH; i += 4){
+    hash ^= ((uuid[i] << 24) |
+	     (uuid[i + 1] << 16) |
+	     (uuid[i + 2] << 8) |
+	     uuid[i + 3]);
+  }
+
+  return(hash);
+}
+
+gboolean
+ags_registry_uuid_equal(gconstpointer a,
+			gconstpointer b)
+{
+  return(!memcmp(a, b, AGS_REGISTRY_UUID_LENGTH));
+}
+
+gboolean
+ags_registry_parse_uuid(gchar *id,
+			guchar *uuid)
+{
+  guint i, j;
+  gint high, low;
+
+  if(id == NULL){
+    return(FALSE);
+  }
+  
+  /* expects the canonical 8-4-4-4-12 form as unparsed by libuuid */
+  for(i = 0, j = 0; j < AGS_REGISTRY_UUID_LENGTH; j++){
+    if(i == 8 || i == 13 || i == 18 || i == 23){
+      if(id[i] != '-'){
+	return(FALSE);
+      }
+
+      i++;
+    }
+
+    high = g_ascii_xdigit_value(id[i]);
+
+    if(high == -1){
+      return(FALSE);
+    }
+    
+    low = g_ascii_xdigit_value(id[i + 1]);
+
+    if(low == -1){
+      return(FALSE);
+    }
+    
+    uuid[j] = (guchar) ((high << 4) | low);
+    i += 2;
+  }
+
+  return(id[i] == '\0');
+}
+
 AgsRegistryEntry*
 ags_registry_entry_alloc(AgsRegistry *registry)
 {
   AgsRegistryEntry *registry_entry;
 
+  guint i;
+  
   registry_entry = (AgsRegistryEntry *) malloc(sizeof(AgsRegistryEntry));
 
-  registry_entry->id = ags_id_generator_create_uuid();
+  /* the binary uuid is the key of the registry, so regenerate a malformed id */
+  for(i = 0; i < AGS_REGISTRY_UUID_RETRY; i++){
+    registry_entry->id = ags_id_generator_create_uuid();
+
+    if(ags_registry_parse_uuid(registry_entry->id,
+			       registry_entry->uuid)){
+      break;
+    }
+
+    free(registry_entry->id);
+    registry_entry->id = NULL;
+  }
+
+  if(registry_entry->id == NULL){
+    g_warning("ags_registry_entry_alloc() - failed to create uuid\0");
+    
+    free(registry_entry);
+
+    return(NULL);
+  }
+  
   memset(&(registry_entry->entry), 0, sizeof(GValue));
   g_value_init(&(registry_entry->entry),
 	       G_TYPE_OBJECT);
@@ -187,44 +291,152 @@ void
 ags_registry_add(AgsRegistry *registry,
 		 AgsRegistryEntry *registry_entry)
 {
-  pthread_mutex_lock(&(registry->mutex));
+  pthread_rwlock_wrlock(&(registry->entry_rwlock));
 
   registry->entry = g_list_prepend(registry->entry,
 				   registry_entry);
+  g_hash_table_insert(registry->entry_by_uuid,
+		      registry_entry->uuid,
+		      registry_entry);
+  
+  pthread_rwlock_unlock(&(registry->entry_rwlock));
+}
 
-  pthread_mutex_unlock(&(registry->mutex));
+void
+ags_registry_add_batch(AgsRegistry *registry,
+		       GList *registry_entry)
+{
+  AgsRegistryEntry *entry;
+  
+  /* take the write lock only once for all entries */
+  pthread_rwlock_wrlock(&(registry->entry_rwlock));
+
+  while(registry_entry != NULL){
+    entry = (AgsRegistryEntry *) registry_entry->data;
+    
+    registry->entry = g_list_prepend(registry->entry,
+				     entry);
+    g_hash_table_insert(registry->entry_by_uuid,
+			entry->uuid,
+			entry);
+
+    registry_entry = registry_entry->next;
+  }
+  
+  pthread_rwlock_unlock(&(registry->entry_rwlock));
 }
 
 AgsRegistryEntry*
 ags_registry_entry_find(AgsRegistry *registry,
 			gchar *id)
 {
-  static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
-
   GList *current;
   AgsRegistryEntry *entry;
 
-  pthread_mutex_lock(&(registry->mutex));
+  guchar uuid[AGS_REGISTRY_UUID_LENGTH];
+
+  entry = NULL;
+  
+  /* fast path - lookup by binary uuid */
+  if(ags_registry_parse_uuid(id,
+			     uuid)){
+    pthread_rwlock_rdlock(&(registry->entry_rwlock));
+
+    entry = (AgsRegistryEntry *) g_hash_table_lookup(registry->entry_by_uuid,
+						     uuid);
+    
+    pthread_rwlock_unlock(&(registry->entry_rwlock));
+
+    return(entry);
+  }
+
+  if(id == NULL){
+    return(NULL);
+  }
+  
+  /* abbreviated id - compare prefix */
+  pthread_rwlock_rdlock(&(registry->entry_rwlock));
 
   current = registry->entry;
   
   while(current != NULL){
-    entry = (AgsRegistryEntry *) current->data;
-
-    if(!g_ascii_strncasecmp(entry->id,
+    if(!g_ascii_strncasecmp(((AgsRegistryEntry *) current->data)->id,
 			    id,
 			    registry->id_length)){
-      return(entry);
+      entry = (AgsRegistryEntry *) current->data;
+      
+      break;
     }
 
     current = current->next;
   }
 
-  pthread_mutex_unlock(&(registry->mutex));
+  pthread_rwlock_unlock(&(registry->entry_rwlock));
 
   return(entry);
 }
 
+AgsRegistryEntry**
+ags_registry_entry_find_batch(AgsRegistry *registry,
+			      gchar **id,
+			      guint n_id)
+{
+  AgsRegistryEntry **entry;
+
+  guchar uuid[AGS_REGISTRY_UUID_LENGTH];
+  guint i;
+  
+  if(n_id == 0){
+    return(NULL);
+  }
+  
+  entry = (AgsRegistryEntry **) malloc(n_id * sizeof(AgsRegistryEntry *));
+
+  /* resolve all ids within one read lock, abbreviated ids separately */
+  pthread_rwlock_rdlock(&(registry->entry_rwlock));
+
+  for(i = 0; i < n_id; i++){
+    if(ags_registry_parse_uuid(id[i],
+			       uuid)){
+      entry[i] = (AgsRegistryEntry *) g_hash_table_lookup(registry->entry_by_uuid,
+							  uuid);
+    }else{
+      entry[i] = NULL;
+    }
+  }
+  
+  pthread_rwlock_unlock(&(registry->entry_rwlock));
+
+  for(i = 0; i < n_id; i++){
+    if(entry[i] == NULL &&
+       id[i] != NULL &&
+       !ags_registry_parse_uuid(id[i],
+				uuid)){
+      entry[i] = ags_registry_entry_find(registry,
+					 id[i]);
+    }
+  }
+  
+  return(entry);
+}
+
+GList*
+ags_registry_entry_snapshot(AgsRegistry *registry)
+{
+  GList *start;
+  
+  /* entries are only ever prepended, so the list starting at the
+   * current head stays valid without holding the lock
+   */
+  pthread_rwlock_rdlock(&(registry->entry_rwlock));
+
+  start = registry->entry;
+  
+  pthread_rwlock_unlock(&(registry->entry_rwlock));
+
+  return(start);
+}
+
 #ifdef AGS_WITH_XMLRPC_C
 xmlrpc_value*
 ags_registry_entry_bulk(xmlrpc_env *env,
@@ -243,21 +455,19 @@ ags_registry_entry_bulk(xmlrpc_env *env,
 
   bulk = xmlrpc_array_new(env);
 
-  pthread_mutex_lock(&(registry->mutex));
-
-  current = registry->entry;
+  /* stream the entries without holding the lock */
+  current = ags_registry_entry_snapshot(registry);
 
   while(current != NULL){
     entry = (AgsRegistryEntry *) current->data;
     item = xmlrpc_string_new(env, entry->id);
 
     xmlrpc_array_append_item(env, bulk, item);
-
+    xmlrpc_DECREF(item);
+    
     current = current->next;
   }
 
-  pthread_mutex_unlock(&(registry->mutex));
-
   return(bulk);
 }
 #endif /* AGS_WITH_XMLRPC_C */
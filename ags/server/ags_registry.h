@@ -39,6 +39,8 @@
 #define AGS_REGISTRY_GET_CLASS(obj)      (G_TYPE_INSTANCE_GET_CLASS(obj, AGS_TYPE_REGISTRY, AgsRegistryClass))
 
 #define AGS_REGISTRY_DEFAULT_ID_LENGTH 16
+#define AGS_REGISTRY_UUID_LENGTH (16)
+#define AGS_REGISTRY_UUID_RETRY (3)
 
 typedef struct _AgsRegistry AgsRegistry;
 typedef struct _AgsRegistryClass AgsRegistryClass;
@@ -57,6 +59,7 @@ struct _AgsRegistry
   guint flags;
 
   pthread_mutex_t mutex;
+  pthread_rwlock_t entry_rwlock;
 
   AgsFile *previous;
   AgsFile *current;
@@ -71,6 +74,7 @@ struct _AgsRegistry
   guint counter;
 
   GList *entry;
+  GHashTable *entry_by_uuid;
 };
 
 struct _AgsRegistryClass
@@ -81,6 +85,8 @@ struct _AgsRegistryClass
 struct _AgsRegistryEntry
 {
   gchar *id;
+  guchar uuid[AGS_REGISTRY_UUID_LENGTH];
+  
   GValue entry;
 };
 
@@ -90,9 +96,16 @@ AgsRegistryEntry* ags_registry_entry_alloc(AgsRegistry *registry);
 
 void ags_registry_add(AgsRegistry *registry,
 		      AgsRegistryEntry *registry_entry);
+void ags_registry_add_batch(AgsRegistry *registry,
+			    GList *registry_entry);
 
 AgsRegistryEntry* ags_registry_entry_find(AgsRegistry *registry,
 					  gchar *id);
+AgsRegistryEntry** ags_registry_entry_find_batch(AgsRegistry *registry,
+						 gchar **id,
+						 guint n_id);
+
+GList* ags_registry_entry_snapshot(AgsRegistry *registry);
 
 #ifdef AGS_WITH_XMLRPC_C
 xmlrpc_value* ags_registry_entry_bulk(xmlrpc_env *env,
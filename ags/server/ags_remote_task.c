@@ -26,6 +26,8 @@
 
 #include <ags/thread/ags_task.h>
 
+#include <stdlib.h>
+
 void ags_remote_task_class_init(AgsRemoteTaskClass *remote_task);
 void ags_remote_task_connectable_interface_init(AgsConnectableInterface *connectable);
 void ags_remote_task_init(AgsRemoteTask *remote_task);
@@ -126,6 +128,15 @@ ags_remote_task_add_to_registry(AgsConnectable *connectable)
   xmlrpc_registry_add_method3(&(AGS_MAIN(server->main)->env),
 			      registry->registry,
 			      method_info);
+
+  /* batch */
+  method_info = (struct xmlrpc_method_info3 *) malloc(sizeof(struct xmlrpc_method_info3));
+  method_info->methodName = "ags_remote_task_launch_batch\0";
+  method_info->methodFunction = &ags_remote_task_launch_batch;
+  method_info->serverInfo = NULL;
+  xmlrpc_registry_add_method3(&(AGS_MAIN(server->main)->env),
+			      registry->registry,
+			      method_info);
 #endif /* AGS_WITH_XMLRPC_C */
 }
 
@@ -190,6 +201,84 @@ ags_remote_task_launch(xmlrpc_env *env,
   return(NULL);
 }
 
+xmlrpc_value*
+ags_remote_task_launch_batch(xmlrpc_env *env,
+			     xmlrpc_value *param_array,
+			     void *server_info)
+{
+  AgsServer *server;
+  AgsTask *task;
+  AgsRegistryEntry **registry_entry;
+  gchar **registry_id;
+  xmlrpc_value *item;
+  int array_size;
+  guint n_task;
+  guint n_launched;
+  guint i, j;
+
+  server = ags_server_lookup(server_info);
+
+  /* read registry ids */
+  array_size = xmlrpc_array_size(env, param_array);
+
+  if(env->fault_occurred){
+    return(NULL);
+  }
+  
+  n_task = array_size;
+
+  if(n_task == 0){
+    return(xmlrpc_int_new(env, 0));
+  }
+  
+  registry_id = (gchar **) malloc(n_task * sizeof(gchar *));
+  
+  for(i = 0; i < n_task; i++){
+    registry_id[i] = NULL;
+    
+    xmlrpc_array_read_item(env, param_array, i, &item);
+
+    if(!env->fault_occurred){
+      xmlrpc_read_string(env, item, &(registry_id[i]));
+      xmlrpc_DECREF(item);
+    }
+
+    if(env->fault_occurred){
+      /* free what was read so far and propagate the fault */
+      for(j = 0; j <= i; j++){
+	g_free(registry_id[j]);
+      }
+
+      free(registry_id);
+
+      return(NULL);
+    }
+  }
+
+  registry_entry = ags_registry_entry_find_batch(server->registry,
+						 registry_id,
+						 n_task);
+
+  /* launch in order */
+  n_launched = 0;
+  
+  for(i = 0; i < n_task; i++){
+    if(registry_entry[i] != NULL){
+      task = (AgsTask *) g_value_get_object(&(registry_entry[i]->entry));
+      ags_task_launch(task);
+
+      n_launched++;
+    }
+
+    g_free(registry_id[i]);
+  }
+
+  free(registry_entry);
+  free(registry_id);
+  
+  return(xmlrpc_int_new(env, n_launched));
+}
+
 void*
 ags_remote_task_launch_timed_thread(void *ptr)
 {
@@ -57,6 +57,10 @@ xmlrpc_value* ags_remote_task_launch(xmlrpc_env *env,
 				     xmlrpc_value *param_array,
 				     void *server_info);
 
+xmlrpc_value* ags_remote_task_launch_batch(xmlrpc_env *env,
+					   xmlrpc_value *param_array,
+					   void *server_info);
+
 xmlrpc_value* ags_remote_task_launch_timed(xmlrpc_env *env,
 					   xmlrpc_value *param_array,
 					   void *server_info);
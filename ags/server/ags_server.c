@@ -28,9 +28,12 @@
 #include <string.h>
 
 #include <sys/socket.h>
+#include <sys/un.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 
+#include <unistd.h>
+
 void ags_server_class_init(AgsServerClass *server);
 void ags_server_connectable_interface_init(AgsConnectableInterface *connectable);
 void ags_server_init(AgsServer *server);
@@ -163,9 +166,15 @@ ags_server_init(AgsServer *server)
   server->flags = 0;
 
   memset(&(server->address), 0, sizeof(struct sockaddr_in));
-  server->address.sin_port = 8080;
+  server->address.sin_port = htons(AGS_SERVER_DEFAULT_PORT);
   server->address.sin_family = AF_INET;
-  inet_aton("127.0.0.1\0", &(server->address.sin_addr.s_addr));
+  inet_aton("127.0.0.1\0", &(server->address.sin_addr));
+
+  memset(&(server->unix_address), 0, sizeof(struct sockaddr_un));
+  server->unix_address.sun_family = AF_UNIX;
+
+  server->keepalive_timeout = AGS_SERVER_DEFAULT_KEEPALIVE_TIMEOUT;
+  server->keepalive_max_connection = AGS_SERVER_DEFAULT_KEEPALIVE_MAX_CONNECTION;
 
   server->server_info = NULL;
 
@@ -275,6 +284,15 @@ ags_server_add_to_registry(AgsConnectable *connectable)
   xmlrpc_registry_add_method3(&(ags_service_provider_get_env(AGS_SERVICE_PROVIDER(server->application_context))),
 			      registry->registry,
 			      method_info);
+
+  /* set property batch */
+  method_info = (struct xmlrpc_method_info3 *) malloc(sizeof(struct xmlrpc_method_info3));
+  method_info->methodName = "ags_server_object_set_property_batch\0";
+  method_info->methodFunction = &ags_server_object_set_property_batch;
+  method_info->serverInfo = NULL;
+  xmlrpc_registry_add_method3(&(ags_service_provider_get_env(AGS_SERVICE_PROVIDER(server->application_context))),
+			      registry->registry,
+			      method_info);
 #endif /* AGS_WITH_XMLRPC_C */
 
   /* children */
@@ -325,25 +343,48 @@ ags_server_real_start(AgsServer *server)
 
   //  xmlrpc_registry_set_shutdown(registry,
   //			       &requestShutdown, &terminationRequested);
-  server->socket_fd = socket(AF_INET, SOCK_RDM, PF_INET);
-  bind(server->socket_fd, &(server->address), sizeof(struct sockaddr_in));
+  if((AGS_SERVER_UNIX & (server->flags)) != 0){
+    /* same host controllers */
+    unlink(server->unix_address.sun_path);
+    
+    server->socket_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    bind(server->socket_fd, (struct sockaddr *) &(server->unix_address), sizeof(struct sockaddr_un));
+  }else{
+    int reuse_address;
+
+    server->socket_fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    reuse_address = 1;
+    setsockopt(server->socket_fd, SOL_SOCKET, SO_REUSEADDR, &reuse_address, sizeof(int));
+
+    bind(server->socket_fd, (struct sockaddr *) &(server->address), sizeof(struct sockaddr_in));
+  }
 
 #ifdef AGS_WITH_XMLRPC_C
   SocketUnixCreateFd(server->socket_fd, &(server->socket));
 
   ServerCreateSocket2(&(server->abyss_server), server->socket, &error);
   xmlrpc_server_abyss_set_handlers2(&(server->abyss_server), "/RPC2", registry->registry);
+
+  /* keep connections open and let clients pipeline their requests */
+  ServerSetKeepaliveTimeout(&(server->abyss_server), server->keepalive_timeout);
+  ServerSetKeepaliveMaxConn(&(server->abyss_server), server->keepalive_max_connection);
+  
   ServerInit(&(server->abyss_server));
   //  setupSignalHandlers();
 
-  while((AGS_SERVER_RUNNING & (server->flags)) != 0){
-    printf("Waiting for next RPC...\n");
-    ServerRunOnce(&(server->abyss_server));
-    /* This waits for the next connection, accepts it, reads the
-       HTTP POST request, executes the indicated RPC, and closes
-       the connection.
-    */
-  } 
+  server->flags |= (AGS_SERVER_STARTED |
+		    AGS_SERVER_RUNNING);
+
+  /* This accepts connections and serves each of them by its own
+   * thread, until ags_server_stop() terminates it.
+   */
+  ServerRun(&(server->abyss_server));
+
+  server->flags &= (~AGS_SERVER_RUNNING);
+
+  ServerFree(&(server->abyss_server));
+  SocketDestroy(server->socket);
 #endif /* AGS_WITH_XMLRPC_C */
 }
 
@@ -358,6 +399,58 @@ ags_server_start(AgsServer *server)
   g_object_unref((GObject *) server);
 }
 
+/**
+ * ags_server_stop:
+ * @server: the #AgsServer
+ *
+ * Stop @server from accepting further connections.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_server_stop(AgsServer *server)
+{
+  g_return_if_fail(AGS_IS_SERVER(server));
+
+  if((AGS_SERVER_RUNNING & (server->flags)) == 0){
+    return;
+  }
+  
+#ifdef AGS_WITH_XMLRPC_C
+  ServerTerminate(&(server->abyss_server));
+#endif /* AGS_WITH_XMLRPC_C */
+}
+
+/**
+ * ags_server_set_unix_socket:
+ * @server: the #AgsServer
+ * @path: the filename of the socket or %NULL to use TCP
+ *
+ * Serve on a local unix domain socket instead of TCP. Needs to be called
+ * before ags_server_start().
+ *
+ * Since: 0.7.136
+ */
+void
+ags_server_set_unix_socket(AgsServer *server,
+			   gchar *path)
+{
+  g_return_if_fail(AGS_IS_SERVER(server));
+
+  if(path == NULL){
+    server->flags &= (~AGS_SERVER_UNIX);
+
+    return;
+  }
+
+  memset(server->unix_address.sun_path, 0, sizeof(server->unix_address.sun_path));
+  strncpy(server->unix_address.sun_path,
+	  path,
+	  sizeof(server->unix_address.sun_path) - 1);
+  
+  server->flags |= AGS_SERVER_UNIX;
+}
+
 AgsServer*
 ags_server_lookup(void *server_info)
 {
@@ -460,10 +553,23 @@ ags_server_create_object(xmlrpc_env *env,
 			 parameter);
 
   registry_entry = ags_registry_entry_alloc(server->registry);
+
+  if(registry_entry == NULL){
+    g_object_unref(object);
+    
+    xmlrpc_env_set_fault(env,
+			 XMLRPC_INTERNAL_ERROR,
+			 "failed to allocate registry entry\0");
+    
+    return(NULL);
+  }
+  
   g_value_init(&(registry_entry->entry),
 	       G_TYPE_OBJECT);
   g_value_set_object(&(registry_entry->entry),
 		     object);
+  ags_registry_add(server->registry,
+		   registry_entry);
   
   /* create return value */
   retval = xmlrpc_string_new(env, registry_entry->id);
@@ -518,6 +624,124 @@ ags_server_object_set_property(xmlrpc_env *env,
 
   return(NULL);
 }
+
+xmlrpc_value*
+ags_server_object_set_property_batch(xmlrpc_env *env,
+				     xmlrpc_value *param_array,
+				     void *server_info)
+{
+  AgsServer *server;
+  GObject *object, *property;
+  AgsRegistryEntry **registry_entry;
+  gchar **registry_id;
+  gchar **param_name;
+  xmlrpc_value *item;
+  int array_size;
+  guint n_params;
+  guint n_applied;
+  guint i, j;
+  
+  array_size = xmlrpc_array_size(env, param_array);
+
+  if(env->fault_occurred){
+    return(NULL);
+  }
+  
+  /* triples of object id, property name and property id */
+  if(array_size % 3 != 0){
+    xmlrpc_env_set_fault(env,
+			 XMLRPC_INDEX_ERROR,
+			 "expected triples of object id, property name and property id\0");
+    
+    return(NULL);
+  }
+
+  server = ags_server_lookup(server_info);
+
+  n_params = array_size / 3;
+
+  if(n_params == 0){
+    return(xmlrpc_int_new(env, 0));
+  }
+  
+  registry_id = (gchar **) malloc(2 * n_params * sizeof(gchar *));
+  param_name = (gchar **) malloc(n_params * sizeof(gchar *));
+
+  memset(registry_id, 0, 2 * n_params * sizeof(gchar *));
+  memset(param_name, 0, n_params * sizeof(gchar *));
+  
+  for(i = 0; i < n_params; i++){
+    for(j = 0; j < 3; j++){
+      xmlrpc_array_read_item(env, param_array, i * 3 + j, &item);
+
+      if(env->fault_occurred){
+	break;
+      }
+      
+      switch(j){
+      case 0:
+	xmlrpc_read_string(env, item, &(registry_id[2 * i]));
+	break;
+      case 1:
+	xmlrpc_read_string(env, item, &(param_name[i]));
+	break;
+      case 2:
+	xmlrpc_read_string(env, item, &(registry_id[2 * i + 1]));
+	break;
+      }
+      
+      xmlrpc_DECREF(item);
+
+      if(env->fault_occurred){
+	break;
+      }
+    }
+
+    if(env->fault_occurred){
+      /* free what was read so far and propagate the fault */
+      for(j = 0; j <= i; j++){
+	g_free(registry_id[2 * j]);
+	g_free(registry_id[2 * j + 1]);
+	g_free(param_name[j]);
+      }
+
+      free(registry_id);
+      free(param_name);
+      
+      return(NULL);
+    }
+  }
+
+  /* resolve all ids at once */
+  registry_entry = ags_registry_entry_find_batch(server->registry,
+						 registry_id,
+						 2 * n_params);
+
+  n_applied = 0;
+  
+  for(i = 0; i < n_params; i++){
+    if(registry_entry[2 * i] != NULL &&
+       registry_entry[2 * i + 1] != NULL){
+      object = g_value_get_object(&(registry_entry[2 * i]->entry));
+      property = g_value_get_object(&(registry_entry[2 * i + 1]->entry));
+      
+      g_object_set(object,
+		   param_name[i], property,
+		   NULL);
+      n_applied++;
+    }
+    
+    g_free(registry_id[2 * i]);
+    g_free(registry_id[2 * i + 1]);
+    g_free(param_name[i]);
+  }
+
+  free(registry_entry);
+  free(registry_id);
+  free(param_name);
+  
+  return(xmlrpc_int_new(env, n_applied));
+}
 #endif /* AGS_WITH_XMLRPC_C */
 
 AgsServer*
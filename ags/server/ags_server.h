@@ -26,6 +26,7 @@
 
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/un.h>
 
 #ifdef AGS_WITH_XMLRPC_C
 #include <xmlrpc-c/util.h>
@@ -48,12 +49,17 @@
 #define AGS_IS_SERVER_CLASS(class)     (G_TYPE_CHECK_CLASS_TYPE ((class), AGS_TYPE_SERVER))
 #define AGS_SERVER_GET_CLASS(obj)      (G_TYPE_INSTANCE_GET_CLASS(obj, AGS_TYPE_SERVER, AgsServerClass))
 
+#define AGS_SERVER_DEFAULT_PORT (8080)
+#define AGS_SERVER_DEFAULT_KEEPALIVE_TIMEOUT (15)
+#define AGS_SERVER_DEFAULT_KEEPALIVE_MAX_CONNECTION (1024)
+
 typedef struct _AgsServer AgsServer;
 typedef struct _AgsServerClass AgsServerClass;
 
 typedef enum{
   AGS_SERVER_STARTED        = 1,
   AGS_SERVER_RUNNING        = 1 << 1,
+  AGS_SERVER_UNIX           = 1 << 2,
 }AgsServerFlags;
 
 struct _AgsServer
@@ -68,6 +74,10 @@ struct _AgsServer
 #endif
   int socket_fd;
   struct sockaddr_in address;
+  struct sockaddr_un unix_address;
+
+  guint keepalive_timeout;
+  guint keepalive_max_connection;
 
   void *server_info;
   
@@ -88,6 +98,10 @@ struct _AgsServerClass
 GType ags_server_get_type();
 
 void ags_server_start(AgsServer *server);
+void ags_server_stop(AgsServer *server);
+
+void ags_server_set_unix_socket(AgsServer *server,
+				gchar *path);
 
 AgsServer* ags_server_lookup(void *server_info);
 
@@ -99,6 +113,9 @@ xmlrpc_value* ags_server_create_object(xmlrpc_env *env,
 xmlrpc_value* ags_server_object_set_property(xmlrpc_env *env,
 					     xmlrpc_value *param_array,
 					     void *server_info);
+xmlrpc_value* ags_server_object_set_property_batch(xmlrpc_env *env,
+						   xmlrpc_value *param_array,
+						   void *server_info);
 #endif
 
 AgsServer* ags_server_new(GObject *application_context);
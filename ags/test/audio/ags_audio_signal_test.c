@@ -24,9 +24,14 @@
 #include <CUnit/Automated.h>
 #include <CUnit/Basic.h>
 
+#include <ags/object/ags_soundcard.h>
+
 #include <ags/audio/ags_devout.h>
 #include <ags/audio/ags_audio_signal.h>
 
+#include <pthread.h>
+#include <unistd.h>
+
 int ags_audio_signal_test_init_suite();
 int ags_audio_signal_test_clean_suite();
 
@@ -37,12 +42,24 @@ void ags_audio_signal_test_morph_samplerate();
 void ags_audio_signal_test_copy_buffer_to_buffer();
 void ags_audio_signal_test_copy_double_buffer_to_buffer();
 void ags_audio_signal_test_duplicate_stream();
+void ags_audio_signal_test_duplicate_stream_with_offset();
+void ags_audio_signal_test_pull_stream();
+void ags_audio_signal_test_wait_stream();
 void ags_audio_signal_test_get_template();
 void ags_audio_signal_test_get_stream_current();
 void ags_audio_signal_test_get_by_recall_id();
 void ags_audio_signal_test_tile();
 void ags_audio_signal_test_scale();
 
+#define AGS_AUDIO_SIGNAL_TEST_DUPLICATE_STREAM_WITH_OFFSET_LENGTH (3)
+
+#define AGS_AUDIO_SIGNAL_TEST_PULL_STREAM_LENGTH (7)
+
+#define AGS_AUDIO_SIGNAL_TEST_WAIT_STREAM_LENGTH (16)
+#define AGS_AUDIO_SIGNAL_TEST_WAIT_STREAM_HEAD_LENGTH (2)
+
+void* ags_audio_signal_test_wait_stream_thread(void *ptr);
+
 #define AGS_AUDIO_SIGNAL_TEST_GET_TEMPLATE_N_AUDIO_SIGNAL (3)
 #define AGS_AUDIO_SIGNAL_TEST_GET_STREAM_CURRENT_N_AUDIO_SIGNAL (6)
 
@@ -139,6 +156,341 @@ ags_audio_signal_test_duplicate_stream()
   //TODO:JK: implement me
 }
 
+void
+ags_audio_signal_test_duplicate_stream_with_offset()
+{
+  AgsAudioSignal *template, *audio_signal;
+
+  GList *stream;
+
+  signed short *buffer;
+
+  guint buffer_size;
+  guint length;
+  guint offset;
+  signed short expected;
+  guint i, j;
+  gboolean success;
+
+  /* instantiate template with a ramp */
+  template = ags_audio_signal_new(G_OBJECT(devout),
+				  NULL,
+				  NULL);
+  template->format = AGS_SOUNDCARD_SIGNED_16_BIT;
+
+  ags_audio_signal_stream_resize(template,
+				 AGS_AUDIO_SIGNAL_TEST_DUPLICATE_STREAM_WITH_OFFSET_LENGTH);
+
+  buffer_size = template->buffer_size;
+  length = AGS_AUDIO_SIGNAL_TEST_DUPLICATE_STREAM_WITH_OFFSET_LENGTH * buffer_size;
+  
+  for(stream = template->stream_beginning, i = 0; stream != NULL; stream = stream->next){
+    buffer = stream->data;
+
+    for(j = 0; j < buffer_size; j++, i++){
+      buffer[j] = (signed short) (i % 1000 + 1);
+    }
+  }
+
+  /* duplicate one and a third buffer later */
+  audio_signal = ags_audio_signal_new(G_OBJECT(devout),
+				      NULL,
+				      NULL);
+  audio_signal->format = AGS_SOUNDCARD_SIGNED_16_BIT;
+
+  offset = buffer_size + buffer_size / 3;
+  
+  ags_audio_signal_duplicate_stream_with_offset(audio_signal,
+						template,
+						offset);
+
+  CU_ASSERT(audio_signal->length == (length + offset + buffer_size - 1) / buffer_size);
+
+  /* assert silence before and after the shifted ramp */
+  success = TRUE;
+
+  for(stream = audio_signal->stream_beginning, i = 0; stream != NULL; stream = stream->next){
+    buffer = stream->data;
+
+    for(j = 0; j < buffer_size; j++, i++){
+      if(i < offset ||
+	 i >= offset + length){
+	expected = 0;
+      }else{
+	expected = (signed short) ((i - offset) % 1000 + 1);
+      }
+      
+      if(buffer[j] != expected){
+	success = FALSE;
+      }
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+}
+
+void
+ags_audio_signal_test_pull_stream()
+{
+  AgsAudioSignal *template, *audio_signal;
+
+  GList *stream;
+
+  signed short *buffer;
+
+  guint buffer_size;
+  guint offset, frame_count;
+  guint position, template_frame;
+  signed short expected;
+  guint i, j;
+  gboolean success;
+
+  /* instantiate template with a ramp and a loop */
+  template = ags_audio_signal_new(G_OBJECT(devout),
+				  NULL,
+				  NULL);
+  template->format = AGS_SOUNDCARD_SIGNED_16_BIT;
+
+  ags_audio_signal_stream_resize(template,
+				 AGS_AUDIO_SIGNAL_TEST_DUPLICATE_STREAM_WITH_OFFSET_LENGTH);
+
+  buffer_size = template->buffer_size;
+
+  for(stream = template->stream_beginning, i = 0; stream != NULL; stream = stream->next){
+    buffer = stream->data;
+
+    for(j = 0; j < buffer_size; j++, i++){
+      buffer[j] = (signed short) (i % 1000 + 1);
+    }
+  }
+
+  template->loop_start = buffer_size / 2;
+  template->loop_end = 2 * buffer_size + buffer_size / 4;
+
+  /* open cursor */
+  audio_signal = ags_audio_signal_new(G_OBJECT(devout),
+				      NULL,
+				      NULL);
+  audio_signal->format = AGS_SOUNDCARD_SIGNED_16_BIT;
+
+  offset = buffer_size / 3;
+  frame_count = AGS_AUDIO_SIGNAL_TEST_PULL_STREAM_LENGTH * buffer_size;
+  
+  ags_audio_signal_open_cursor(audio_signal,
+			       template,
+			       offset,
+			       frame_count);
+
+  CU_ASSERT((AGS_AUDIO_SIGNAL_CURSOR & (audio_signal->flags)) != 0);
+  CU_ASSERT(audio_signal->length == 1);
+
+  /* play it the way AgsStreamAudioSignal does */
+  success = TRUE;
+
+  audio_signal->stream_current = audio_signal->stream_beginning;
+  i = 0;
+  
+  while(audio_signal->stream_current != NULL){
+    buffer = audio_signal->stream_current->data;
+
+    for(j = 0; j < buffer_size; j++, i++){
+      if(i < offset ||
+	 i >= offset + frame_count){
+	expected = 0;
+      }else{
+	position = i - offset;
+
+	if(position >= template->loop_end){
+	  template_frame = template->loop_start + ((position - template->loop_start) % (template->loop_end - template->loop_start));
+	}else{
+	  template_frame = position;
+	}
+
+	expected = (signed short) (template_frame % 1000 + 1);
+      }
+
+      if(buffer[j] != expected){
+	success = FALSE;
+      }
+    }
+
+    if(audio_signal->stream_current->next == NULL){
+      ags_audio_signal_pull_stream(audio_signal);
+    }
+
+    audio_signal->stream_current = audio_signal->stream_current->next;
+  }
+
+  CU_ASSERT(success == TRUE);
+  CU_ASSERT(i == (offset + frame_count + buffer_size - 1) / buffer_size * buffer_size);
+
+  /* played buffers were reused */
+  CU_ASSERT(audio_signal->length <= 3);
+
+  /* resize the template while the cursor is open */
+  audio_signal = ags_audio_signal_new(G_OBJECT(devout),
+				      NULL,
+				      NULL);
+  audio_signal->format = AGS_SOUNDCARD_SIGNED_16_BIT;
+
+  ags_audio_signal_open_cursor(audio_signal,
+			       template,
+			       0,
+			       frame_count);
+
+  ags_audio_signal_stream_resize(template,
+				 0);
+  ags_audio_signal_stream_resize(template,
+				 AGS_AUDIO_SIGNAL_TEST_DUPLICATE_STREAM_WITH_OFFSET_LENGTH);
+
+  for(stream = template->stream_beginning, i = 0; stream != NULL; stream = stream->next){
+    buffer = stream->data;
+
+    for(j = 0; j < buffer_size; j++, i++){
+      buffer[j] = (signed short) (i % 1000 + 1);
+    }
+  }
+
+  ags_audio_signal_pull_stream(audio_signal);
+
+  success = TRUE;
+  buffer = audio_signal->stream_end->data;
+  
+  for(j = 0; j < buffer_size; j++){
+    if(buffer[j] != (signed short) ((buffer_size + j) % 1000 + 1)){
+      success = FALSE;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+}
+
+void*
+ags_audio_signal_test_wait_stream_thread(void *ptr)
+{
+  AgsAudioSignal *template;
+
+  GList *stream;
+
+  signed short *buffer;
+
+  guint i, j;
+
+  template = (AgsAudioSignal *) ptr;
+
+  /* fill the tail like the stream thread of AgsPlayable does */
+  stream = g_list_nth(template->stream_beginning,
+		      AGS_AUDIO_SIGNAL_TEST_WAIT_STREAM_HEAD_LENGTH);
+  
+  for(i = AGS_AUDIO_SIGNAL_TEST_WAIT_STREAM_HEAD_LENGTH; stream != NULL; i++){
+    usleep(1000);
+    
+    buffer = stream->data;
+    
+    for(j = 0; j < template->buffer_size; j++){
+      buffer[j] = (signed short) ((i * template->buffer_size + j) % 1000 + 1);
+    }
+
+    ags_audio_signal_set_stream_loaded(template,
+				       i + 1);
+
+    stream = stream->next;
+  }
+
+  pthread_exit(NULL);
+}
+
+void
+ags_audio_signal_test_wait_stream()
+{
+  AgsAudioSignal *template, *audio_signal;
+
+  GList *stream;
+
+  signed short *buffer;
+
+  pthread_t thread;
+
+  guint buffer_size;
+  guint frame_count;
+  guint i, j;
+  gboolean success;
+
+  /* instantiate template with its head loaded */
+  template = ags_audio_signal_new(G_OBJECT(devout),
+				  NULL,
+				  NULL);
+  template->format = AGS_SOUNDCARD_SIGNED_16_BIT;
+
+  ags_audio_signal_stream_resize(template,
+				 AGS_AUDIO_SIGNAL_TEST_WAIT_STREAM_LENGTH);
+
+  buffer_size = template->buffer_size;
+
+  for(stream = template->stream_beginning, i = 0; i < AGS_AUDIO_SIGNAL_TEST_WAIT_STREAM_HEAD_LENGTH; stream = stream->next, i++){
+    buffer = stream->data;
+
+    for(j = 0; j < buffer_size; j++){
+      buffer[j] = (signed short) ((i * buffer_size + j) % 1000 + 1);
+    }
+  }
+
+  template->stream_loaded = AGS_AUDIO_SIGNAL_TEST_WAIT_STREAM_HEAD_LENGTH;
+  template->flags |= AGS_AUDIO_SIGNAL_STREAM;
+
+  /* the head is available at once */
+  ags_audio_signal_wait_stream(template,
+			       AGS_AUDIO_SIGNAL_TEST_WAIT_STREAM_HEAD_LENGTH);
+
+  CU_ASSERT((AGS_AUDIO_SIGNAL_STREAM & (template->flags)) != 0);
+
+  /* pull the whole template while the tail is filled */
+  pthread_create(&thread, NULL,
+		 ags_audio_signal_test_wait_stream_thread, template);
+  
+  audio_signal = ags_audio_signal_new(G_OBJECT(devout),
+				      NULL,
+				      NULL);
+  audio_signal->format = AGS_SOUNDCARD_SIGNED_16_BIT;
+
+  frame_count = AGS_AUDIO_SIGNAL_TEST_WAIT_STREAM_LENGTH * buffer_size;
+  
+  ags_audio_signal_open_cursor(audio_signal,
+			       template,
+			       0,
+			       frame_count);
+  
+  success = TRUE;
+
+  audio_signal->stream_current = audio_signal->stream_beginning;
+  i = 0;
+  
+  while(audio_signal->stream_current != NULL){
+    buffer = audio_signal->stream_current->data;
+
+    for(j = 0; j < buffer_size; j++, i++){
+      if(buffer[j] != (signed short) (i % 1000 + 1)){
+	success = FALSE;
+      }
+    }
+
+    if(audio_signal->stream_current->next == NULL){
+      ags_audio_signal_pull_stream(audio_signal);
+    }
+
+    audio_signal->stream_current = audio_signal->stream_current->next;
+  }
+
+  CU_ASSERT(success == TRUE);
+  CU_ASSERT(i == frame_count);
+
+  /* complete as the last buffer was published */
+  pthread_join(thread, NULL);
+
+  CU_ASSERT((AGS_AUDIO_SIGNAL_STREAM & (template->flags)) == 0);
+  CU_ASSERT(template->stream_loaded == AGS_AUDIO_SIGNAL_TEST_WAIT_STREAM_LENGTH);
+}
+
 void
 ags_audio_signal_test_get_template()
 {
@@ -199,6 +551,9 @@ main(int argc, char **argv)
      (CU_add_test(pSuite, "test of AgsAudioSignal copy buffer to buffer\0", ags_audio_signal_test_copy_buffer_to_buffer) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAudioSignal copy double buffer to buffer\0", ags_audio_signal_test_copy_double_buffer_to_buffer) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAudioSignal duplicate stream\0", ags_audio_signal_test_duplicate_stream) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioSignal duplicate stream with offset\0", ags_audio_signal_test_duplicate_stream_with_offset) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioSignal pull stream\0", ags_audio_signal_test_pull_stream) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudioSignal wait stream\0", ags_audio_signal_test_wait_stream) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAudioSignal get template\0", ags_audio_signal_test_get_template) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAudioSignal get stream current\0", ags_audio_signal_test_get_stream_current) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAudioSignal get by recall id\0", ags_audio_signal_test_get_by_recall_id) == NULL) ||
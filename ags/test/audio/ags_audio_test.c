@@ -26,6 +26,8 @@
 #include <ags/libags.h>
 #include <ags/libags-audio.h>
 
+#include <stdlib.h>
+
 int ags_audio_test_init_suite();
 int ags_audio_test_clean_suite();
 
@@ -33,6 +35,8 @@ void ags_audio_test_dispose();
 void ags_audio_test_finalize();
 void ags_audio_test_set_pads();
 void ags_audio_test_set_audio_channels();
+void ags_audio_test_grow_audio_channels();
+void ags_audio_test_grow_pads();
 void ags_audio_test_link_channel();
 void ags_audio_test_finalize_linked_channel();
 void ags_audio_test_add_recall();
@@ -43,6 +47,9 @@ void ags_audio_test_duplicate_recall();
 void ags_audio_test_init_recall();
 void ags_audio_test_resolve_recall();
 
+gboolean ags_audio_test_verify_links(AgsChannel *start,
+				     guint audio_channels, guint pads);
+
 void ags_audio_test_finalize_stub(GObject *gobject);
 void ags_audio_test_set_link_callback(AgsChannel *channel, AgsChannel *link,
 				      GError **error,
@@ -74,6 +81,17 @@ void ags_audio_test_resolve_recall_callback(AgsRecall *recall,
 #define AGS_AUDIO_TEST_SET_AUDIO_CHANNELS_GROW_AUDIO_CHANNELS (5)
 #define AGS_AUDIO_TEST_SET_AUDIO_CHANNELS_SHRINK_AUDIO_CHANNELS (1)
 
+#define AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_AUDIO_CHANNELS (2)
+#define AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_INPUT_PADS (4)
+#define AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_OUTPUT_PADS (3)
+#define AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_GROW_AUDIO_CHANNELS (3)
+
+#define AGS_AUDIO_TEST_GROW_PADS_AUDIO_CHANNELS (3)
+#define AGS_AUDIO_TEST_GROW_PADS_INPUT_PADS (4)
+#define AGS_AUDIO_TEST_GROW_PADS_OUTPUT_PADS (2)
+#define AGS_AUDIO_TEST_GROW_PADS_GROW_INPUT_PADS (7)
+#define AGS_AUDIO_TEST_GROW_PADS_GROW_OUTPUT_PADS (5)
+
 #define AGS_AUDIO_TEST_LINK_CHANNEL_MASTER_AUDIO_CHANNELS (2)
 #define AGS_AUDIO_TEST_LINK_CHANNEL_MASTER_INPUT_PADS (8)
 #define AGS_AUDIO_TEST_LINK_CHANNEL_MASTER_OUTPUT_PADS (1)
@@ -557,6 +575,87 @@ ags_audio_test_set_audio_channels()
   CU_ASSERT(i == AGS_AUDIO_TEST_SET_AUDIO_CHANNELS_OUTPUT_PADS * AGS_AUDIO_TEST_SET_AUDIO_CHANNELS_AUDIO_CHANNELS);
 }
 
+void
+ags_audio_test_grow_audio_channels()
+{
+  AgsAudio *audio;
+
+  /* instantiate */
+  audio = ags_audio_new(devout);
+
+  CU_ASSERT(audio != NULL);
+
+  /* set audio channels and pads */
+  ags_audio_set_audio_channels(audio,
+			       AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_AUDIO_CHANNELS);
+
+  ags_audio_set_pads(audio,
+		     AGS_TYPE_INPUT,
+		     AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_INPUT_PADS);
+  ags_audio_set_pads(audio,
+		     AGS_TYPE_OUTPUT,
+		     AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_OUTPUT_PADS);
+
+  CU_ASSERT(ags_audio_test_verify_links(audio->input,
+					AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_AUDIO_CHANNELS, AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_INPUT_PADS) == TRUE);
+  CU_ASSERT(ags_audio_test_verify_links(audio->output,
+					AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_AUDIO_CHANNELS, AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_OUTPUT_PADS) == TRUE);
+
+  /* grow audio channels, new channels are spliced into every present pad */
+  ags_audio_set_audio_channels(audio,
+			       AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_GROW_AUDIO_CHANNELS);
+
+  CU_ASSERT(audio->audio_channels == AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_GROW_AUDIO_CHANNELS);
+
+  CU_ASSERT(ags_audio_test_verify_links(audio->input,
+					AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_GROW_AUDIO_CHANNELS, AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_INPUT_PADS) == TRUE);
+  CU_ASSERT(ags_audio_test_verify_links(audio->output,
+					AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_GROW_AUDIO_CHANNELS, AGS_AUDIO_TEST_GROW_AUDIO_CHANNELS_OUTPUT_PADS) == TRUE);
+}
+
+void
+ags_audio_test_grow_pads()
+{
+  AgsAudio *audio;
+
+  /* instantiate */
+  audio = ags_audio_new(devout);
+
+  CU_ASSERT(audio != NULL);
+
+  /* set audio channels and pads */
+  ags_audio_set_audio_channels(audio,
+			       AGS_AUDIO_TEST_GROW_PADS_AUDIO_CHANNELS);
+
+  ags_audio_set_pads(audio,
+		     AGS_TYPE_INPUT,
+		     AGS_AUDIO_TEST_GROW_PADS_INPUT_PADS);
+  ags_audio_set_pads(audio,
+		     AGS_TYPE_OUTPUT,
+		     AGS_AUDIO_TEST_GROW_PADS_OUTPUT_PADS);
+
+  CU_ASSERT(ags_audio_test_verify_links(audio->input,
+					AGS_AUDIO_TEST_GROW_PADS_AUDIO_CHANNELS, AGS_AUDIO_TEST_GROW_PADS_INPUT_PADS) == TRUE);
+  CU_ASSERT(ags_audio_test_verify_links(audio->output,
+					AGS_AUDIO_TEST_GROW_PADS_AUDIO_CHANNELS, AGS_AUDIO_TEST_GROW_PADS_OUTPUT_PADS) == TRUE);
+
+  /* grow pads, new pads are appended to the present ones */
+  ags_audio_set_pads(audio,
+		     AGS_TYPE_INPUT,
+		     AGS_AUDIO_TEST_GROW_PADS_GROW_INPUT_PADS);
+  ags_audio_set_pads(audio,
+		     AGS_TYPE_OUTPUT,
+		     AGS_AUDIO_TEST_GROW_PADS_GROW_OUTPUT_PADS);
+
+  CU_ASSERT(audio->input_pads == AGS_AUDIO_TEST_GROW_PADS_GROW_INPUT_PADS);
+  CU_ASSERT(audio->output_pads == AGS_AUDIO_TEST_GROW_PADS_GROW_OUTPUT_PADS);
+
+  CU_ASSERT(ags_audio_test_verify_links(audio->input,
+					AGS_AUDIO_TEST_GROW_PADS_AUDIO_CHANNELS, AGS_AUDIO_TEST_GROW_PADS_GROW_INPUT_PADS) == TRUE);
+  CU_ASSERT(ags_audio_test_verify_links(audio->output,
+					AGS_AUDIO_TEST_GROW_PADS_AUDIO_CHANNELS, AGS_AUDIO_TEST_GROW_PADS_GROW_OUTPUT_PADS) == TRUE);
+}
+
 void
 ags_audio_test_link_channel()
 {
@@ -1359,6 +1458,60 @@ ags_audio_test_resolve_recall()
   CU_ASSERT(test_resolve_recall_callback_hits_count == 1);
 }
 
+gboolean
+ags_audio_test_verify_links(AgsChannel *start,
+			    guint audio_channels, guint pads)
+{
+  AgsChannel **channel;
+  AgsChannel *current;
+
+  guint n_lines;
+  guint line;
+  gboolean success;
+
+  n_lines = audio_channels * pads;
+
+  /* collect the lines along next */
+  channel = (AgsChannel **) malloc(n_lines * sizeof(AgsChannel *));
+
+  current = start;
+
+  for(line = 0; line < n_lines && current != NULL; line++){
+    channel[line] = current;
+    current = current->next;
+  }
+
+  if(line != n_lines ||
+     current != NULL){
+    free(channel);
+
+    return(FALSE);
+  }
+
+  /* every neighbour and index of every line */
+  success = TRUE;
+
+  for(line = 0; line < n_lines; line++){
+    current = channel[line];
+
+    if(current->line != line ||
+       current->pad != line / audio_channels ||
+       current->audio_channel != line % audio_channels ||
+       current->prev != ((line > 0) ? channel[line - 1]: NULL) ||
+       current->next != ((line + 1 < n_lines) ? channel[line + 1]: NULL) ||
+       current->prev_pad != ((line >= audio_channels) ? channel[line - audio_channels]: NULL) ||
+       current->next_pad != ((line + audio_channels < n_lines) ? channel[line + audio_channels]: NULL)){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  free(channel);
+
+  return(success);
+}
+
 void
 ags_audio_test_finalize_stub(GObject *gobject)
 {
@@ -1417,6 +1570,8 @@ main(int argc, char **argv)
      (CU_add_test(pSuite, "test of AgsAudio finalize\0", ags_audio_test_finalize) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAudio set pads\0", ags_audio_test_set_pads) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAudio set audio channels\0", ags_audio_test_set_audio_channels) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudio grow audio channels\0", ags_audio_test_grow_audio_channels) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsAudio grow pads\0", ags_audio_test_grow_pads) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAudio link channel\0", ags_audio_test_link_channel) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAudio finalize linked channel\0", ags_audio_test_finalize_linked_channel) == NULL) ||
      (CU_add_test(pSuite, "test of AgsAudio add recall\0", ags_audio_test_add_recall) == NULL) ||
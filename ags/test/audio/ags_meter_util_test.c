@@ -0,0 +1,260 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <ags/object/ags_soundcard.h>
+
+#include <ags/audio/ags_meter_util.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+int ags_meter_util_test_init_suite();
+int ags_meter_util_test_clean_suite();
+
+void ags_meter_util_test_mix();
+void ags_meter_util_test_peak_rms();
+void ags_meter_util_test_true_peak();
+void ags_meter_util_test_slot();
+
+#define AGS_METER_UTIL_TEST_BUFFER_SIZE (1021)
+#define AGS_METER_UTIL_TEST_TOLERANCE (0.0001)
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_meter_util_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_meter_util_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_meter_util_test_mix()
+{
+  gfloat destination[AGS_METER_UTIL_TEST_BUFFER_SIZE];
+  signed short source_s16[AGS_METER_UTIL_TEST_BUFFER_SIZE];
+  signed long source_s32[AGS_METER_UTIL_TEST_BUFFER_SIZE];
+  guint i;
+  gboolean success;
+
+  for(i = 0; i < AGS_METER_UTIL_TEST_BUFFER_SIZE; i++){
+    destination[i] = 0.0;
+    source_s16[i] = ((i % 2) == 0) ? 16384: -32767;
+    source_s32[i] = 1073741824;
+  }
+
+  /* two signals sum up */
+  ags_meter_util_mix(destination,
+		     source_s16, AGS_SOUNDCARD_SIGNED_16_BIT,
+		     AGS_METER_UTIL_TEST_BUFFER_SIZE);
+  ags_meter_util_mix(destination,
+		     source_s32, AGS_SOUNDCARD_SIGNED_32_BIT,
+		     AGS_METER_UTIL_TEST_BUFFER_SIZE);
+
+  success = TRUE;
+
+  for(i = 0; i < AGS_METER_UTIL_TEST_BUFFER_SIZE; i++){
+    if(fabs(destination[i] - ((((i % 2) == 0) ? (16384.0 / 32767.0): -1.0) + 0.5)) > AGS_METER_UTIL_TEST_TOLERANCE){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+}
+
+void
+ags_meter_util_test_peak_rms()
+{
+  gfloat buffer[AGS_METER_UTIL_TEST_BUFFER_SIZE];
+  gfloat peak, rms;
+  gdouble sum;
+  guint i;
+
+  for(i = 0; i < AGS_METER_UTIL_TEST_BUFFER_SIZE; i++){
+    buffer[i] = 0.5 * sin(2.0 * M_PI * 440.0 * i / 44100.0);
+  }
+
+  /* the peak is in the remainder not covered by the lanes */
+  buffer[AGS_METER_UTIL_TEST_BUFFER_SIZE - 1] = -0.75;
+
+  sum = 0.0;
+
+  for(i = 0; i < AGS_METER_UTIL_TEST_BUFFER_SIZE; i++){
+    sum += buffer[i] * buffer[i];
+  }
+
+  ags_meter_util_peak_rms(buffer,
+			  AGS_METER_UTIL_TEST_BUFFER_SIZE,
+			  &peak, &rms);
+
+  CU_ASSERT(fabs(peak - 0.75) < AGS_METER_UTIL_TEST_TOLERANCE);
+  CU_ASSERT(fabs(rms - sqrt(sum / AGS_METER_UTIL_TEST_BUFFER_SIZE)) < AGS_METER_UTIL_TEST_TOLERANCE);
+
+  /* silence */
+  memset(buffer,
+	 0,
+	 AGS_METER_UTIL_TEST_BUFFER_SIZE * sizeof(gfloat));
+
+  ags_meter_util_peak_rms(buffer,
+			  AGS_METER_UTIL_TEST_BUFFER_SIZE,
+			  &peak, &rms);
+
+  CU_ASSERT(peak == 0.0 &&
+	    rms == 0.0);
+}
+
+void
+ags_meter_util_test_true_peak()
+{
+  gfloat buffer[AGS_METER_UTIL_TEST_BUFFER_SIZE];
+  gfloat history[AGS_METER_UTIL_TRUE_PEAK_HISTORY];
+  gfloat peak, true_peak;
+  guint i;
+
+  /* a quarter of the samplerate shifted by 45 degrees never hits its crest */
+  for(i = 0; i < AGS_METER_UTIL_TEST_BUFFER_SIZE; i++){
+    buffer[i] = sin(M_PI / 2.0 * i + M_PI / 4.0);
+  }
+
+  memset(history,
+	 0,
+	 AGS_METER_UTIL_TRUE_PEAK_HISTORY * sizeof(gfloat));
+
+  ags_meter_util_peak_rms(buffer,
+			  AGS_METER_UTIL_TEST_BUFFER_SIZE,
+			  &peak, NULL);
+  true_peak = ags_meter_util_true_peak(buffer,
+				       AGS_METER_UTIL_TEST_BUFFER_SIZE,
+				       history);
+
+  CU_ASSERT(fabs(peak - M_SQRT1_2) < AGS_METER_UTIL_TEST_TOLERANCE);
+  CU_ASSERT(true_peak > peak + 0.1 &&
+	    true_peak < 1.1);
+
+  /* history carries the last frames */
+  CU_ASSERT(history[2] == buffer[AGS_METER_UTIL_TEST_BUFFER_SIZE - 1] &&
+	    history[1] == buffer[AGS_METER_UTIL_TEST_BUFFER_SIZE - 2] &&
+	    history[0] == buffer[AGS_METER_UTIL_TEST_BUFFER_SIZE - 3]);
+}
+
+void
+ags_meter_util_test_slot()
+{
+  AgsMeterSlot *meter_slot;
+
+  gfloat peak, rms, true_peak;
+
+  meter_slot = ags_meter_slot_alloc();
+
+  CU_ASSERT(meter_slot != NULL &&
+	    meter_slot->ref_count == 1);
+
+  /* initial */
+  ags_meter_slot_read(meter_slot,
+		      &peak, &rms, &true_peak);
+
+  CU_ASSERT(peak == 0.0 &&
+	    rms == 0.0 &&
+	    true_peak == 0.0);
+
+  /* publish */
+  ags_meter_slot_publish(meter_slot,
+			 0.5, 0.25, 0.625);
+
+  ags_meter_slot_read(meter_slot,
+		      &peak, &rms, &true_peak);
+
+  CU_ASSERT(peak == 0.5 &&
+	    rms == 0.25 &&
+	    true_peak == 0.625);
+  CU_ASSERT((meter_slot->sequence % 2) == 0);
+
+  /* reference count */
+  ags_meter_slot_ref(meter_slot);
+
+  CU_ASSERT(meter_slot->ref_count == 2);
+
+  ags_meter_slot_unref(meter_slot);
+
+  CU_ASSERT(meter_slot->ref_count == 1);
+
+  ags_meter_slot_unref(meter_slot);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  putenv("LC_ALL=C\0");
+  putenv("LANG=C\0");
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsMeterUtilTest\0", ags_meter_util_test_init_suite, ags_meter_util_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of ags_meter_util.c mix\0", ags_meter_util_test_mix) == NULL) ||
+     (CU_add_test(pSuite, "test of ags_meter_util.c peak and RMS\0", ags_meter_util_test_peak_rms) == NULL) ||
+     (CU_add_test(pSuite, "test of ags_meter_util.c true-peak\0", ags_meter_util_test_true_peak) == NULL) ||
+     (CU_add_test(pSuite, "test of ags_meter_util.c meter slot\0", ags_meter_util_test_slot) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
@@ -35,6 +35,7 @@ int ags_notation_test_clean_suite();
 
 void ags_notation_test_find_near_timestamp();
 void ags_notation_test_add_note();
+void ags_notation_test_add_note_batch();
 void ags_notation_test_remove_note_at_position();
 void ags_notation_test_is_note_selected();
 void ags_notation_test_find_point();
@@ -55,6 +56,10 @@ void ags_notation_test_insert_from_clipboard();
 #define AGS_NOTATION_TEST_ADD_NOTE_HEIGHT (88)
 #define AGS_NOTATION_TEST_ADD_NOTE_COUNT (1024)
 
+#define AGS_NOTATION_TEST_ADD_NOTE_BATCH_WIDTH (4096)
+#define AGS_NOTATION_TEST_ADD_NOTE_BATCH_HEIGHT (88)
+#define AGS_NOTATION_TEST_ADD_NOTE_BATCH_COUNT (1024)
+
 #define AGS_NOTATION_TEST_REMOVE_NOTE_AT_POSITION_WIDTH (4096)
 #define AGS_NOTATION_TEST_REMOVE_NOTE_AT_POSITION_HEIGHT (88)
 #define AGS_NOTATION_TEST_REMOVE_NOTE_AT_POSITION_COUNT (1024)
@@ -215,6 +220,85 @@ ags_notation_test_add_note()
   CU_ASSERT(list == NULL);
 }
 
+void
+ags_notation_test_add_note_batch()
+{
+  AgsNotation *notation;
+  AgsNote *note;
+
+  GList *note_list;
+  GList *list;
+  
+  guint x0, y;
+  guint i;
+  gboolean success;
+
+  /* create notation */
+  notation = ags_notation_new(audio,
+			      0);
+
+  /* add some notes the regular way */
+  for(i = 0; i < AGS_NOTATION_TEST_ADD_NOTE_BATCH_COUNT / 2; i++){
+    x0 = rand() % AGS_NOTATION_TEST_ADD_NOTE_BATCH_WIDTH;
+    y = rand() % AGS_NOTATION_TEST_ADD_NOTE_BATCH_HEIGHT;
+    
+    note = ags_note_new_with_offset(x0, x0 + 1,
+				    y,
+				    0.0, 0);
+
+    ags_notation_add_note(notation,
+			  note,
+			  FALSE);
+  }
+
+  /* merge the rest as batch */
+  note_list = NULL;
+  
+  for(; i < AGS_NOTATION_TEST_ADD_NOTE_BATCH_COUNT; i++){
+    x0 = rand() % AGS_NOTATION_TEST_ADD_NOTE_BATCH_WIDTH;
+    y = rand() % AGS_NOTATION_TEST_ADD_NOTE_BATCH_HEIGHT;
+    
+    note = ags_note_new_with_offset(x0, x0 + 1,
+				    y,
+				    0.0, 0);
+    note_list = g_list_prepend(note_list,
+			       note);
+  }
+
+  ags_notation_add_note_batch(notation,
+			      note_list,
+			      FALSE);
+  g_list_free_full(note_list,
+		   g_object_unref);
+  
+  /* assert position */
+  list = notation->notes;
+  success = TRUE;
+  
+  for(i = 0; i < AGS_NOTATION_TEST_ADD_NOTE_BATCH_COUNT; i++){
+    if(list == NULL){
+      success = FALSE;
+
+      break;
+    }
+    
+    if(list->prev != NULL){
+      if(!(AGS_NOTE(list->prev->data)->x[0] < AGS_NOTE(list->data)->x[0] ||
+	   (AGS_NOTE(list->prev->data)->x[0] == AGS_NOTE(list->data)->x[0] &&
+	    (AGS_NOTE(list->prev->data)->y <= AGS_NOTE(list->data)->y)))){
+	success = FALSE;
+
+	break;
+      }
+    }
+    
+    list = list->next;
+  }
+
+  CU_ASSERT(success == TRUE);
+  CU_ASSERT(list == NULL);
+}
+
 void
 ags_notation_test_remove_note_at_position()
 {
@@ -769,6 +853,7 @@ main(int argc, char **argv)
   /* add the tests to the suite */
   if((CU_add_test(pSuite, "test of AgsNotation find near timestamp\0", ags_notation_test_find_near_timestamp) == NULL) ||
      (CU_add_test(pSuite, "test of AgsNotation add note\0", ags_notation_test_add_note) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsNotation add note batch\0", ags_notation_test_add_note_batch) == NULL) ||
      (CU_add_test(pSuite, "test of AgsNotation remove note at position\0", ags_notation_test_remove_note_at_position) == NULL) ||
      (CU_add_test(pSuite, "test of AgsNotation is note selected\0", ags_notation_test_is_note_selected) == NULL) ||
      (CU_add_test(pSuite, "test of AgsNotation find point\0", ags_notation_test_find_point) == NULL) ||
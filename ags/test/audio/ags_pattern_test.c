@@ -41,6 +41,10 @@ void ags_pattern_test_find_near_timestamp();
 void ags_pattern_test_set_dim();
 void ags_pattern_test_get_bit();
 void ags_pattern_test_toggle_bit();
+void ags_pattern_test_resize();
+void ags_pattern_test_copy_bank();
+void ags_pattern_test_shift();
+void ags_pattern_test_count_bits();
 
 #define AGS_PATTERN_TEST_FIND_NEAR_TIMESTAMP_N_PATTERN (8)
 
@@ -56,6 +60,20 @@ void ags_pattern_test_toggle_bit();
 #define AGS_PATTERN_TEST_TOGGLE_BIT_BANK_1 (4)
 #define AGS_PATTERN_TEST_TOGGLE_BIT_BIT (256)
 
+#define AGS_PATTERN_TEST_RESIZE_BANK_0 (4)
+#define AGS_PATTERN_TEST_RESIZE_BANK_1 (12)
+#define AGS_PATTERN_TEST_RESIZE_BIT (64)
+#define AGS_PATTERN_TEST_RESIZE_GROW_BIT (100)
+
+#define AGS_PATTERN_TEST_COPY_BANK_BANK_0 (4)
+#define AGS_PATTERN_TEST_COPY_BANK_BANK_1 (12)
+#define AGS_PATTERN_TEST_COPY_BANK_BIT (96)
+
+#define AGS_PATTERN_TEST_SHIFT_BIT (100)
+#define AGS_PATTERN_TEST_SHIFT_N_TICS (37)
+
+#define AGS_PATTERN_TEST_COUNT_BITS_BIT (256)
+
 /* The suite initialization function.
  * Opens the temporary file used by the tests.
  * Returns zero on success, non-zero otherwise.
@@ -272,6 +290,224 @@ ags_pattern_test_toggle_bit()
   CU_ASSERT(success = TRUE);
 }
 
+void
+ags_pattern_test_resize()
+{
+  AgsPattern *pattern;
+
+  guint i, j, k;
+  gboolean success;
+
+  pattern = ags_pattern_new();
+  ags_pattern_set_dim(pattern,
+		      AGS_PATTERN_TEST_RESIZE_BANK_0,
+		      AGS_PATTERN_TEST_RESIZE_BANK_1,
+		      AGS_PATTERN_TEST_RESIZE_BIT);
+
+  /* set every third tic */
+  for(i = 0; i < AGS_PATTERN_TEST_RESIZE_BANK_0; i++){
+    for(j = 0; j < AGS_PATTERN_TEST_RESIZE_BANK_1; j++){
+      for(k = 0; k < AGS_PATTERN_TEST_RESIZE_BIT; k += 3){
+	ags_pattern_toggle_bit(pattern,
+			       i, j,
+			       k);
+      }
+    }
+  }
+
+  /* grow and assert the tics are kept */
+  ags_pattern_set_dim(pattern,
+		      AGS_PATTERN_TEST_RESIZE_BANK_0 + 1,
+		      AGS_PATTERN_TEST_RESIZE_BANK_1 + 1,
+		      AGS_PATTERN_TEST_RESIZE_GROW_BIT);
+
+  success = TRUE;
+
+  for(i = 0; i < AGS_PATTERN_TEST_RESIZE_BANK_0 + 1 && success; i++){
+    for(j = 0; j < AGS_PATTERN_TEST_RESIZE_BANK_1 + 1 && success; j++){
+      for(k = 0; k < AGS_PATTERN_TEST_RESIZE_GROW_BIT; k++){
+	if(ags_pattern_get_bit(pattern, i, j, k) != (i < AGS_PATTERN_TEST_RESIZE_BANK_0 &&
+						     j < AGS_PATTERN_TEST_RESIZE_BANK_1 &&
+						     k < AGS_PATTERN_TEST_RESIZE_BIT &&
+						     k % 3 == 0)){
+	  success = FALSE;
+
+	  break;
+	}
+      }
+
+      if(pattern->pattern[i][j] != &(pattern->bitmap[(i * pattern->dim[1] + j) * pattern->stride])){
+	success = FALSE;
+      }
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* shrink to zero length and assert the banks are still indexed */
+  ags_pattern_set_dim(pattern,
+		      AGS_PATTERN_TEST_RESIZE_BANK_0,
+		      AGS_PATTERN_TEST_RESIZE_BANK_1,
+		      0);
+
+  CU_ASSERT(pattern->bitmap != NULL &&
+	    pattern->pattern != NULL &&
+	    pattern->stride == 1);
+
+  success = TRUE;
+
+  for(i = 0; i < AGS_PATTERN_TEST_RESIZE_BANK_0 && success; i++){
+    for(j = 0; j < AGS_PATTERN_TEST_RESIZE_BANK_1; j++){
+      if(pattern->pattern[i][j] != &(pattern->bitmap[i * pattern->dim[1] + j]) ||
+	 ags_pattern_count_bits(pattern, i, j) != 0 ||
+	 !ags_pattern_is_empty(pattern, i, j)){
+	success = FALSE;
+
+	break;
+      }
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  g_object_unref(pattern);
+}
+
+void
+ags_pattern_test_copy_bank()
+{
+  AgsPattern *pattern;
+
+  guint k;
+  gboolean success;
+
+  pattern = ags_pattern_new();
+  ags_pattern_set_dim(pattern,
+		      AGS_PATTERN_TEST_COPY_BANK_BANK_0,
+		      AGS_PATTERN_TEST_COPY_BANK_BANK_1,
+		      AGS_PATTERN_TEST_COPY_BANK_BIT);
+
+  for(k = 0; k < AGS_PATTERN_TEST_COPY_BANK_BIT; k++){
+    if(rand() % 2 == 1){
+      ags_pattern_toggle_bit(pattern,
+			     1, 2,
+			     k);
+    }
+  }
+
+  /* copy and assert */
+  ags_pattern_copy_bank(pattern,
+			1, 2,
+			3, 7);
+
+  success = TRUE;
+  
+  for(k = 0; k < AGS_PATTERN_TEST_COPY_BANK_BIT; k++){
+    if(ags_pattern_get_bit(pattern, 1, 2, k) != ags_pattern_get_bit(pattern, 3, 7, k)){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* clear and assert */
+  ags_pattern_clear(pattern,
+		    3, 7);
+
+  CU_ASSERT(ags_pattern_is_empty(pattern, 3, 7) == TRUE);
+  
+  g_object_unref(pattern);
+}
+
+void
+ags_pattern_test_shift()
+{
+  AgsPattern *pattern;
+
+  guint k;
+  gboolean success;
+
+  pattern = ags_pattern_new();
+  ags_pattern_set_dim(pattern,
+		      1, 1,
+		      AGS_PATTERN_TEST_SHIFT_BIT);
+
+  for(k = 0; k < AGS_PATTERN_TEST_SHIFT_BIT; k += 5){
+    ags_pattern_toggle_bit(pattern,
+			   0, 0,
+			   k);
+  }
+
+  /* shift towards the end */
+  ags_pattern_shift(pattern,
+		    0, 0,
+		    AGS_PATTERN_TEST_SHIFT_N_TICS);
+
+  success = TRUE;
+
+  for(k = 0; k < AGS_PATTERN_TEST_SHIFT_BIT; k++){
+    if(ags_pattern_get_bit(pattern, 0, 0, k) != (k >= AGS_PATTERN_TEST_SHIFT_N_TICS &&
+						 (k - AGS_PATTERN_TEST_SHIFT_N_TICS) % 5 == 0)){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* shift back */
+  ags_pattern_shift(pattern,
+		    0, 0,
+		    -1 * AGS_PATTERN_TEST_SHIFT_N_TICS);
+
+  success = TRUE;
+
+  for(k = 0; k < AGS_PATTERN_TEST_SHIFT_BIT; k++){
+    if(ags_pattern_get_bit(pattern, 0, 0, k) != (k < AGS_PATTERN_TEST_SHIFT_BIT - AGS_PATTERN_TEST_SHIFT_N_TICS &&
+						 k % 5 == 0)){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  g_object_unref(pattern);
+}
+
+void
+ags_pattern_test_count_bits()
+{
+  AgsPattern *pattern;
+
+  guint count;
+  guint k;
+
+  pattern = ags_pattern_new();
+  ags_pattern_set_dim(pattern,
+		      1, 1,
+		      AGS_PATTERN_TEST_COUNT_BITS_BIT);
+
+  count = 0;
+  
+  for(k = 0; k < AGS_PATTERN_TEST_COUNT_BITS_BIT; k++){
+    if(rand() % 2 == 1){
+      ags_pattern_toggle_bit(pattern,
+			     0, 0,
+			     k);
+      count++;
+    }
+  }
+
+  CU_ASSERT(ags_pattern_count_bits(pattern, 0, 0) == count);
+
+  g_object_unref(pattern);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -298,7 +534,11 @@ main(int argc, char **argv)
   if((CU_add_test(pSuite, "test of AgsPattern find near timestamp\0", ags_pattern_test_find_near_timestamp) == NULL) ||
      (CU_add_test(pSuite, "test of AgsPattern set dim\0", ags_pattern_test_set_dim) == NULL) ||
      (CU_add_test(pSuite, "test of AgsPattern get bit\0", ags_pattern_test_get_bit) == NULL) ||
-     (CU_add_test(pSuite, "test of AgsPattern toggle bit\0", ags_pattern_test_toggle_bit) == NULL)){
+     (CU_add_test(pSuite, "test of AgsPattern toggle bit\0", ags_pattern_test_toggle_bit) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsPattern resize\0", ags_pattern_test_resize) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsPattern copy bank\0", ags_pattern_test_copy_bank) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsPattern shift\0", ags_pattern_test_shift) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsPattern count bits\0", ags_pattern_test_count_bits) == NULL)){
     CU_cleanup_registry();
     
     return CU_get_error();
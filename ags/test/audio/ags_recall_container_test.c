@@ -0,0 +1,314 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2016 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <ags/object/ags_packable.h>
+
+#include <ags/audio/ags_channel.h>
+#include <ags/audio/ags_recall.h>
+#include <ags/audio/ags_recall_channel.h>
+#include <ags/audio/ags_recall_channel_run.h>
+#include <ags/audio/ags_recall_container.h>
+
+int ags_recall_container_test_init_suite();
+int ags_recall_container_test_clean_suite();
+
+void ags_recall_container_test_pack();
+void ags_recall_container_test_unpack();
+void ags_recall_container_test_reindex();
+
+#define AGS_RECALL_CONTAINER_TEST_PACK_N_CHANNELS (8)
+
+#define AGS_RECALL_CONTAINER_TEST_UNPACK_N_CHANNELS (8)
+
+AgsChannel *channel[AGS_RECALL_CONTAINER_TEST_PACK_N_CHANNELS];
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_recall_container_test_init_suite()
+{
+  guint i;
+
+  for(i = 0; i < AGS_RECALL_CONTAINER_TEST_PACK_N_CHANNELS; i++){
+    channel[i] = ags_channel_new(NULL);
+  }
+
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_recall_container_test_clean_suite()
+{
+  guint i;
+
+  for(i = 0; i < AGS_RECALL_CONTAINER_TEST_PACK_N_CHANNELS; i++){
+    g_object_unref(channel[i]);
+  }
+
+  return(0);
+}
+
+void
+ags_recall_container_test_pack()
+{
+  AgsRecallContainer *recall_container;
+  AgsRecallChannel *recall_channel[AGS_RECALL_CONTAINER_TEST_PACK_N_CHANNELS];
+  AgsRecallChannelRun *recall_channel_run[AGS_RECALL_CONTAINER_TEST_PACK_N_CHANNELS];
+
+  GList *list;
+
+  guint i;
+  gboolean success;
+
+  recall_container = ags_recall_container_new();
+
+  /* pack the channel runs first, the recall channel has to find them */
+  for(i = 0; i < AGS_RECALL_CONTAINER_TEST_PACK_N_CHANNELS; i++){
+    recall_channel_run[i] = g_object_new(AGS_TYPE_RECALL_CHANNEL_RUN,
+					 "source\0", channel[i],
+					 "recall-container\0", recall_container,
+					 NULL);
+  }
+
+  for(i = 0; i < AGS_RECALL_CONTAINER_TEST_PACK_N_CHANNELS; i++){
+    recall_channel[i] = g_object_new(AGS_TYPE_RECALL_CHANNEL,
+				     "source\0", channel[i],
+				     "recall-container\0", recall_container,
+				     NULL);
+  }
+
+  CU_ASSERT(g_list_length(recall_container->recall_channel) == AGS_RECALL_CONTAINER_TEST_PACK_N_CHANNELS);
+  CU_ASSERT(g_list_length(recall_container->recall_channel_run) == AGS_RECALL_CONTAINER_TEST_PACK_N_CHANNELS);
+
+  /* assert index and provider */
+  success = TRUE;
+
+  for(i = 0; i < AGS_RECALL_CONTAINER_TEST_PACK_N_CHANNELS; i++){
+    list = ags_recall_container_lookup_recall_channel(recall_container,
+						      (GObject *) channel[i]);
+
+    if(g_list_length(list) != 1 ||
+       list->data != recall_channel[i]){
+      success = FALSE;
+
+      break;
+    }
+
+    list = ags_recall_container_lookup_recall_channel_run(recall_container,
+							  (GObject *) channel[i]);
+
+    if(g_list_length(list) != 1 ||
+       list->data != recall_channel_run[i] ||
+       recall_channel_run[i]->recall_channel != recall_channel[i]){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* packing twice doesn't duplicate */
+  g_object_set(recall_container,
+	       "recall-channel\0", recall_channel[0],
+	       "recall-channel-run\0", recall_channel_run[0],
+	       NULL);
+
+  CU_ASSERT(g_list_length(recall_container->recall_channel) == AGS_RECALL_CONTAINER_TEST_PACK_N_CHANNELS);
+  CU_ASSERT(g_list_length(ags_recall_container_lookup_recall_channel(recall_container,
+								     (GObject *) channel[0])) == 1);
+  CU_ASSERT(g_list_length(recall_container->recall_channel_run) == AGS_RECALL_CONTAINER_TEST_PACK_N_CHANNELS);
+  CU_ASSERT(g_list_length(ags_recall_container_lookup_recall_channel_run(recall_container,
+									 (GObject *) channel[0])) == 1);
+}
+
+void
+ags_recall_container_test_unpack()
+{
+  AgsRecallContainer *recall_container;
+  AgsRecallChannel *recall_channel[AGS_RECALL_CONTAINER_TEST_UNPACK_N_CHANNELS];
+  AgsRecallChannelRun *recall_channel_run[AGS_RECALL_CONTAINER_TEST_UNPACK_N_CHANNELS];
+
+  guint i;
+  gboolean success;
+
+  recall_container = ags_recall_container_new();
+
+  for(i = 0; i < AGS_RECALL_CONTAINER_TEST_UNPACK_N_CHANNELS; i++){
+    recall_channel[i] = g_object_new(AGS_TYPE_RECALL_CHANNEL,
+				     "source\0", channel[i],
+				     "recall-container\0", recall_container,
+				     NULL);
+    g_object_ref(recall_channel[i]);
+
+    recall_channel_run[i] = g_object_new(AGS_TYPE_RECALL_CHANNEL_RUN,
+					 "source\0", channel[i],
+					 "recall-container\0", recall_container,
+					 NULL);
+    g_object_ref(recall_channel_run[i]);
+  }
+
+  /* unpack every other channel */
+  for(i = 0; i < AGS_RECALL_CONTAINER_TEST_UNPACK_N_CHANNELS; i += 2){
+    ags_packable_unpack(AGS_PACKABLE(recall_channel_run[i]));
+    ags_packable_unpack(AGS_PACKABLE(recall_channel[i]));
+  }
+
+  CU_ASSERT(g_list_length(recall_container->recall_channel) == AGS_RECALL_CONTAINER_TEST_UNPACK_N_CHANNELS / 2);
+  CU_ASSERT(g_list_length(recall_container->recall_channel_run) == AGS_RECALL_CONTAINER_TEST_UNPACK_N_CHANNELS / 2);
+
+  /* assert index */
+  success = TRUE;
+
+  for(i = 0; i < AGS_RECALL_CONTAINER_TEST_UNPACK_N_CHANNELS; i++){
+    if(i % 2 == 0){
+      if(ags_recall_container_lookup_recall_channel(recall_container,
+						    (GObject *) channel[i]) != NULL ||
+	 ags_recall_container_lookup_recall_channel_run(recall_container,
+							(GObject *) channel[i]) != NULL ||
+	 recall_channel_run[i]->recall_channel != NULL){
+	success = FALSE;
+
+	break;
+      }
+    }else{
+      if(g_list_find(ags_recall_container_lookup_recall_channel(recall_container,
+								(GObject *) channel[i]),
+		     recall_channel[i]) == NULL ||
+	 g_list_find(ags_recall_container_lookup_recall_channel_run(recall_container,
+								    (GObject *) channel[i]),
+		     recall_channel_run[i]) == NULL){
+	success = FALSE;
+
+	break;
+      }
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* remove the remaining ones */
+  for(i = 1; i < AGS_RECALL_CONTAINER_TEST_UNPACK_N_CHANNELS; i += 2){
+    ags_recall_container_remove_recall_channel_run(recall_container,
+						   (AgsRecall *) recall_channel_run[i]);
+    ags_recall_container_remove_recall_channel(recall_container,
+					       (AgsRecall *) recall_channel[i]);
+  }
+
+  CU_ASSERT(recall_container->recall_channel == NULL);
+  CU_ASSERT(recall_container->recall_channel_run == NULL);
+  CU_ASSERT(g_hash_table_size(recall_container->recall_channel_index) == 0);
+  CU_ASSERT(g_hash_table_size(recall_container->recall_channel_run_index) == 0);
+}
+
+void
+ags_recall_container_test_reindex()
+{
+  AgsRecallContainer *recall_container;
+  AgsRecallChannel *recall_channel;
+  AgsRecallChannelRun *recall_channel_run;
+
+  recall_container = ags_recall_container_new();
+
+  recall_channel = g_object_new(AGS_TYPE_RECALL_CHANNEL,
+				"source\0", channel[0],
+				"recall-container\0", recall_container,
+				NULL);
+  recall_channel_run = g_object_new(AGS_TYPE_RECALL_CHANNEL_RUN,
+				    "source\0", channel[0],
+				    "recall-container\0", recall_container,
+				    NULL);
+
+  /* change source of packed recalls */
+  g_object_set(recall_channel,
+	       "source\0", channel[1],
+	       NULL);
+  g_object_set(recall_channel_run,
+	       "source\0", channel[1],
+	       NULL);
+
+  CU_ASSERT(ags_recall_container_lookup_recall_channel(recall_container,
+						       (GObject *) channel[0]) == NULL);
+  CU_ASSERT(ags_recall_container_lookup_recall_channel_run(recall_container,
+							   (GObject *) channel[0]) == NULL);
+
+  CU_ASSERT(g_list_find(ags_recall_container_lookup_recall_channel(recall_container,
+								   (GObject *) channel[1]),
+			recall_channel) != NULL);
+  CU_ASSERT(g_list_find(ags_recall_container_lookup_recall_channel_run(recall_container,
+								       (GObject *) channel[1]),
+			recall_channel_run) != NULL);
+
+  /* the list is untouched */
+  CU_ASSERT(g_list_length(recall_container->recall_channel) == 1);
+  CU_ASSERT(g_list_length(recall_container->recall_channel_run) == 1);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  putenv("LC_ALL=C\0");
+  putenv("LANG=C\0");
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsRecallContainerTest\0", ags_recall_container_test_init_suite, ags_recall_container_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsRecallContainer pack\0", ags_recall_container_test_pack) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRecallContainer unpack\0", ags_recall_container_test_unpack) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRecallContainer reindex\0", ags_recall_container_test_reindex) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
@@ -30,6 +30,7 @@
 #include <ags/audio/ags_channel.h>
 #include <ags/audio/ags_recycling.h>
 #include <ags/audio/ags_audio_signal.h>
+#include <ags/audio/ags_recall_id.h>
 #include <ags/audio/ags_audio_buffer_util.h>
 
 #include <libintl.h>
@@ -44,6 +45,7 @@ int ags_recycling_test_clean_suite();
 
 void ags_recycling_test_add_audio_signal();
 void ags_recycling_test_remove_audio_signal();
+void ags_recycling_test_get_audio_signal_by_recall_id();
 void ags_recycling_test_create_audio_signal_with_defaults();
 void ags_recycling_test_create_audio_signal_with_frame_count();
 void ags_recycling_test_position();
@@ -56,6 +58,8 @@ void ags_recycling_test_find_next_channel();
 #define AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_FRAMES (AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_SAMPLERATE / \
 								     AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_BUFFER_SIZE * \
 								     440.0)
+#define AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_N_DELAY_BUFFERS (2)
+#define AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_ATTACK (100)
 
 #define AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_FRAME_COUNT_NOTE_DELAY (1.0 / 4.0)
 #define AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_FRAME_COUNT_NOTE_LENGTH (64.0)
@@ -159,6 +163,78 @@ ags_recycling_test_remove_audio_signal()
 			audio_signal) == NULL);
 }
 
+void
+ags_recycling_test_get_audio_signal_by_recall_id()
+{
+  AgsRecycling *recycling;
+  AgsAudioSignal *template;
+  AgsAudioSignal *audio_signal[3];
+  AgsRecallID *recall_id[2];
+
+  GList *list;
+
+  guint i;
+  
+  /* instantiate recycling */
+  recycling = ags_recycling_new(G_OBJECT(devout));
+
+  template = ags_recycling_get_template(recycling);
+
+  CU_ASSERT(template != NULL &&
+	    (AGS_AUDIO_SIGNAL_TEMPLATE & (template->flags)) != 0);
+
+  /* instantiate audio signals */
+  recall_id[0] = ags_recall_id_new(recycling);
+  recall_id[1] = ags_recall_id_new(recycling);
+
+  for(i = 0; i < 3; i++){
+    audio_signal[i] = ags_audio_signal_new(G_OBJECT(devout),
+					   (GObject *) recycling,
+					   (GObject *) ((i < 2) ? recall_id[0]: recall_id[1]));
+    ags_recycling_add_audio_signal(recycling,
+				   audio_signal[i]);
+  }
+
+  /* assert buckets, newest first */
+  list = ags_recycling_get_audio_signal_by_recall_id(recycling,
+						     (GObject *) recall_id[0]);
+
+  CU_ASSERT(g_list_length(list) == 2 &&
+	    list->data == audio_signal[1] &&
+	    list->next->data == audio_signal[0]);
+
+  list = ags_recycling_get_audio_signal_by_recall_id(recycling,
+						     (GObject *) recall_id[1]);
+  
+  CU_ASSERT(g_list_length(list) == 1 &&
+	    list->data == audio_signal[2]);
+
+  /* reindex */
+  g_object_set(audio_signal[0],
+	       "recall_id\0", recall_id[1],
+	       NULL);
+
+  list = ags_recycling_get_audio_signal_by_recall_id(recycling,
+						     (GObject *) recall_id[0]);
+
+  CU_ASSERT(g_list_length(list) == 1 &&
+	    list->data == audio_signal[1]);
+
+  list = ags_recycling_get_audio_signal_by_recall_id(recycling,
+						     (GObject *) recall_id[1]);
+  
+  CU_ASSERT(g_list_length(list) == 2);
+
+  /* remove */
+  ags_recycling_remove_audio_signal(recycling,
+				    audio_signal[1]);
+  
+  CU_ASSERT(ags_recycling_get_audio_signal_by_recall_id(recycling,
+							(GObject *) recall_id[0]) == NULL);
+  CU_ASSERT(g_list_length(recycling->audio_signal) == 3 &&
+	    ags_recycling_get_template(recycling) == template);
+}
+
 void
 ags_recycling_test_create_audio_signal_with_defaults()
 {
@@ -253,6 +329,51 @@ ags_recycling_test_create_audio_signal_with_defaults()
     
     i += AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_BUFFER_SIZE;
   }
+
+  /* attack beyond the buffer size - e.g. a note's stream attack */
+  audio_signal = ags_audio_signal_new(G_OBJECT(devout),
+				      (GObject *) recycling,
+				      NULL);
+  audio_signal->format = AGS_SOUNDCARD_SIGNED_16_BIT;
+
+  ags_recycling_create_audio_signal_with_defaults(recycling,
+						  audio_signal,
+						  0.0, (AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_N_DELAY_BUFFERS * AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_BUFFER_SIZE +
+							AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_ATTACK));
+
+  CU_ASSERT(audio_signal->attack == AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_ATTACK);
+  CU_ASSERT(audio_signal->length == template->length + AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_N_DELAY_BUFFERS);
+
+  stream = audio_signal->stream_beginning;
+
+  for(i = 0; i < AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_N_DELAY_BUFFERS; i++){
+    for(j = 0; j < AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_BUFFER_SIZE; j++){
+      if(AGS_AUDIO_BUFFER_S16(stream->data)[j] != 0){
+	break;
+      }
+    }
+
+    CU_ASSERT(j == AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_BUFFER_SIZE);
+
+    stream = stream->next;
+  }
+
+  template_stream = template->stream_beginning;
+  
+  for(i = 0; i < AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_FRAMES;){
+    for(j = 0;
+	j < AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_BUFFER_SIZE &&
+	  i + j < AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_FRAMES;
+	j++){
+      CU_ASSERT(AGS_AUDIO_BUFFER_S16(stream->data)[j] == AGS_AUDIO_BUFFER_S16(template_stream->data)[j]);
+    }
+
+    /* iterate */
+    stream = stream->next;
+    template_stream = template_stream->next;
+    
+    i += AGS_RECYCLING_TEST_CREATE_AUDIO_SIGNAL_WITH_DEFAULTS_BUFFER_SIZE;
+  }
 }
 
 void
@@ -612,6 +733,7 @@ main(int argc, char **argv)
   /* add the tests to the suite */
   if((CU_add_test(pSuite, "test of AgsRecycling add audio signal\0", ags_recycling_test_add_audio_signal) == NULL) ||
      (CU_add_test(pSuite, "test of AgsRecycling remove audio signal\0", ags_recycling_test_remove_audio_signal) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRecycling get audio signal by recall id\0", ags_recycling_test_get_audio_signal_by_recall_id) == NULL) ||
      (CU_add_test(pSuite, "test of AgsRecycling create audio signal with defaults\0", ags_recycling_test_create_audio_signal_with_defaults) == NULL) ||
      //FIXME:JK: uncomment
      /* (CU_add_test(pSuite, "test of AgsRecycling create audio signal with frame count\0", ags_recycling_test_create_audio_signal_with_frame_count) == NULL) || */
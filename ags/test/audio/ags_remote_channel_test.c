@@ -0,0 +1,437 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2017 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <ags/audio/client/ags_remote_channel.h>
+#include <ags/audio/client/ags_remote_input.h>
+#include <ags/audio/client/ags_remote_output.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+int ags_remote_channel_test_init_suite();
+int ags_remote_channel_test_clean_suite();
+
+void ags_remote_channel_test_pack_frame_header();
+void ags_remote_channel_test_transfer_oversized();
+void ags_remote_channel_test_tcp_stream();
+void ags_remote_channel_test_udp_jitter_buffer();
+
+void ags_remote_channel_test_fill_period(guchar *buffer, guint length,
+					 guint sequence);
+
+#define AGS_REMOTE_CHANNEL_TEST_BASE_PORT (18081)
+
+#define AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_SIZE (1024 * sizeof(gint16))
+#define AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_COUNT (16)
+#define AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_CONNECT_ATTEMPTS (100)
+
+#define AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE (256 * sizeof(gint16))
+#define AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_COUNT (8)
+#define AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_LOST_SEQUENCE (4)
+#define AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_FOREIGN_STREAM_ID (17)
+
+guint port;
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_remote_channel_test_init_suite()
+{
+  port = AGS_REMOTE_CHANNEL_TEST_BASE_PORT + (getpid() % 1000);
+
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_remote_channel_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_remote_channel_test_fill_period(guchar *buffer, guint length,
+				    guint sequence)
+{
+  guint i;
+
+  for(i = 0; i < length; i++){
+    buffer[i] = (guchar) ((sequence * 31 + i) % 251 + 1);
+  }
+}
+
+void
+ags_remote_channel_test_pack_frame_header()
+{
+  AgsRemoteChannelFrame frame, unpacked;
+
+  guchar buffer[AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE];
+
+  frame.sequence = 0xfffffffe;
+  frame.stream_id = 17;
+  frame.format = 16;
+  frame.buffer_size = 1024;
+  frame.payload_length = 2048;
+  frame.payload = NULL;
+
+  ags_remote_channel_pack_frame_header(&frame,
+				       buffer);
+
+  CU_ASSERT(ags_remote_channel_unpack_frame_header(&unpacked,
+						   buffer) == TRUE);
+  CU_ASSERT(unpacked.sequence == frame.sequence);
+  CU_ASSERT(unpacked.stream_id == frame.stream_id);
+  CU_ASSERT(unpacked.format == frame.format);
+  CU_ASSERT(unpacked.buffer_size == frame.buffer_size);
+  CU_ASSERT(unpacked.payload_length == frame.payload_length);
+
+  /* corrupt magic */
+  buffer[0] ^= 0xff;
+
+  CU_ASSERT(ags_remote_channel_unpack_frame_header(&unpacked,
+						   buffer) == FALSE);
+}
+
+void
+ags_remote_channel_test_transfer_oversized()
+{
+  AgsRemoteChannel *remote_channel;
+
+  GError *error;
+
+  guchar *period;
+  gchar *uri;
+
+  guint length;
+  
+  uri = g_strdup_printf("udp://127.0.0.1:%d\0", port + 2);
+
+  remote_channel = (AgsRemoteChannel *) ags_remote_output_new(NULL);
+  remote_channel->uri = uri;
+
+  CU_ASSERT(ags_remote_channel_connect(remote_channel) != NULL);
+
+  /* refused rather than truncated */
+  length = AGS_REMOTE_CHANNEL_FRAME_MAX_PAYLOAD_SIZE + 1;
+  period = (guchar *) malloc(length);
+  memset(period, 0, length);
+
+  error = NULL;
+  
+  CU_ASSERT(ags_remote_channel_transfer_data(remote_channel, NULL,
+					     period, length,
+					     &error) == 0);
+  CU_ASSERT(error != NULL &&
+	    error->code == AGS_REMOTE_CHANNEL_PAYLOAD_TOO_LARGE);
+  CU_ASSERT(remote_channel->send_sequence == 0);
+
+  if(error != NULL){
+    g_error_free(error);
+  }
+  
+  free(period);
+
+  g_object_unref(remote_channel);
+}
+
+void
+ags_remote_channel_test_tcp_stream()
+{
+  AgsRemoteChannel *remote_channel;
+
+  GError *error;
+
+  guchar *period, *expected;
+  gchar *uri;
+
+  pid_t pid;
+  guint i;
+  int status;
+  gboolean success;
+
+  uri = g_strdup_printf("tcp://127.0.0.1:%d\0", port);
+
+  pid = fork();
+
+  if(pid == 0){
+    /* sending process */
+    remote_channel = (AgsRemoteChannel *) ags_remote_output_new(NULL);
+    remote_channel->uri = uri;
+
+    for(i = 0; i < AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_CONNECT_ATTEMPTS; i++){
+      if(ags_remote_channel_connect(remote_channel) != NULL){
+	break;
+      }
+
+      usleep(10000);
+    }
+
+    if(i == AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_CONNECT_ATTEMPTS){
+      _exit(1);
+    }
+
+    period = (guchar *) malloc(AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_SIZE);
+
+    for(i = 0; i < AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_COUNT; i++){
+      ags_remote_channel_test_fill_period(period, AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_SIZE,
+					  i);
+
+      error = NULL;
+
+      if(ags_remote_channel_transfer_data(remote_channel, NULL,
+					  period, AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_SIZE,
+					  &error) != AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_SIZE){
+	_exit(1);
+      }
+    }
+
+    ags_remote_channel_close(remote_channel);
+
+    _exit(0);
+  }
+
+  /* receiving process */
+  remote_channel = (AgsRemoteChannel *) ags_remote_input_new(NULL);
+  remote_channel->uri = uri;
+
+  CU_ASSERT(ags_remote_channel_connect(remote_channel) != NULL);
+
+  /* receiving doesn't block, let all frames arrive */
+  waitpid(pid, &status, 0);
+
+  period = (guchar *) malloc(AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_SIZE);
+  expected = (guchar *) malloc(AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_SIZE);
+
+  success = TRUE;
+
+  for(i = 0; i < AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_COUNT; i++){
+    error = NULL;
+
+    if(ags_remote_channel_recieve_data(remote_channel, NULL,
+				       period, AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_SIZE,
+				       &error) != AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_SIZE){
+      success = FALSE;
+
+      break;
+    }
+
+    ags_remote_channel_test_fill_period(expected, AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_SIZE,
+					i);
+
+    if(memcmp(period, expected, AGS_REMOTE_CHANNEL_TEST_TCP_STREAM_PERIOD_SIZE) != 0){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+  CU_ASSERT(remote_channel->lost_frames == 0);
+  CU_ASSERT(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+  free(period);
+  free(expected);
+
+  g_object_unref(remote_channel);
+}
+
+void
+ags_remote_channel_test_udp_jitter_buffer()
+{
+  AgsRemoteChannel *remote_channel;
+  AgsRemoteChannelFrame frame;
+
+  GError *error;
+
+  struct sockaddr_in address;
+
+  guchar *period, *expected;
+  gchar *uri;
+
+  /* swapped pairs and one missing */
+  static const guint send_order[] = {
+    1, 0, 3, 2, 5, 6, 7,
+  };
+
+  pid_t pid;
+  guint i;
+  int fd;
+  int status;
+  gboolean success;
+
+  uri = g_strdup_printf("udp://127.0.0.1:%d\0", port + 1);
+
+  /* bind before the peer starts sending */
+  remote_channel = (AgsRemoteChannel *) ags_remote_input_new(NULL);
+  remote_channel->uri = uri;
+
+  CU_ASSERT(ags_remote_channel_connect(remote_channel) != NULL);
+
+  pid = fork();
+
+  if(pid == 0){
+    /* sending process writes frames out of order */
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+
+    memset(&address, 0, sizeof(struct sockaddr_in));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port + 1);
+    inet_aton("127.0.0.1\0", &(address.sin_addr));
+
+    period = (guchar *) malloc(AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE + AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE);
+
+    for(i = 0; i < sizeof(send_order) / sizeof(guint); i++){
+      frame.sequence = send_order[i];
+      frame.stream_id = 0;
+      frame.format = 16;
+      frame.buffer_size = AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE / sizeof(gint16);
+      frame.payload_length = AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE;
+
+      ags_remote_channel_pack_frame_header(&frame,
+					   period);
+      ags_remote_channel_test_fill_period(period + AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE, AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE,
+					  send_order[i]);
+
+      sendto(fd,
+	     period, AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE + AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE,
+	     0,
+	     (struct sockaddr *) &address, sizeof(struct sockaddr_in));
+    }
+
+    /* the missing one of an other stream doesn't fill the gap */
+    frame.sequence = AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_LOST_SEQUENCE;
+    frame.stream_id = AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_FOREIGN_STREAM_ID;
+
+    ags_remote_channel_pack_frame_header(&frame,
+					 period);
+    ags_remote_channel_test_fill_period(period + AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE, AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE,
+					AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_LOST_SEQUENCE);
+
+    sendto(fd,
+	   period, AGS_REMOTE_CHANNEL_FRAME_HEADER_SIZE + AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE,
+	   0,
+	   (struct sockaddr *) &address, sizeof(struct sockaddr_in));
+
+    close(fd);
+
+    _exit(0);
+  }
+
+  /* receiving process gets them in order */
+  waitpid(pid, &status, 0);
+  
+  period = (guchar *) malloc(AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE);
+  expected = (guchar *) malloc(AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE);
+
+  success = TRUE;
+
+  for(i = 0; i < AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_COUNT; i++){
+    error = NULL;
+
+    if(ags_remote_channel_recieve_data(remote_channel, NULL,
+				       period, AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE,
+				       &error) != AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE){
+      success = FALSE;
+
+      break;
+    }
+
+    if(i == AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_LOST_SEQUENCE){
+      /* lost frame is played as silence */
+      memset(expected, 0, AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE);
+    }else{
+      ags_remote_channel_test_fill_period(expected, AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE,
+					  i);
+    }
+
+    if(memcmp(period, expected, AGS_REMOTE_CHANNEL_TEST_UDP_JITTER_BUFFER_PERIOD_SIZE) != 0){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+  CU_ASSERT(remote_channel->lost_frames == 1);
+
+  free(period);
+  free(expected);
+
+  g_object_unref(remote_channel);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  putenv("LC_ALL=C\0");
+  putenv("LANG=C\0");
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsRemoteChannelTest\0", ags_remote_channel_test_init_suite, ags_remote_channel_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsRemoteChannel pack frame header\0", ags_remote_channel_test_pack_frame_header) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRemoteChannel transfer oversized\0", ags_remote_channel_test_transfer_oversized) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRemoteChannel tcp stream\0", ags_remote_channel_test_tcp_stream) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsRemoteChannel udp jitter buffer\0", ags_remote_channel_test_udp_jitter_buffer) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
@@ -0,0 +1,197 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2016 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <ags/audio/ags_synth_util.h>
+#include <ags/audio/ags_synth_generator.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+/* not exported by libags_audio, ags_synth_util.c is compiled into the benchmark */
+gdouble ags_synth_util_oscillator_block(gdouble *block,
+					guint oscillator,
+					gdouble increment, gdouble phase,
+					guint n_frames);
+
+gdouble ags_synth_util_bench_elapsed(struct timespec *start);
+void ags_synth_util_bench_legacy(double *buffer,
+				 guint oscillator);
+
+#define AGS_SYNTH_UTIL_BENCH_SAMPLERATE (44100)
+#define AGS_SYNTH_UTIL_BENCH_N_FRAMES (1024)
+#define AGS_SYNTH_UTIL_BENCH_FREQ (440.0)
+#define AGS_SYNTH_UTIL_BENCH_VOLUME (0.001)
+#define AGS_SYNTH_UTIL_BENCH_DEFAULT_ITERATIONS (4096)
+
+gdouble
+ags_synth_util_bench_elapsed(struct timespec *start)
+{
+  struct timespec stop;
+
+  clock_gettime(CLOCK_MONOTONIC, &stop);
+
+  return((gdouble) (stop.tv_sec - start->tv_sec) + (gdouble) (stop.tv_nsec - start->tv_nsec) / 1000000000.0);
+}
+
+void
+ags_synth_util_bench_legacy(double *buffer,
+			    guint oscillator)
+{
+  switch(oscillator){
+  case AGS_SYNTH_GENERATOR_OSCILLATOR_SIN:
+    {
+      ags_synth_util_sin_double(buffer,
+				AGS_SYNTH_UTIL_BENCH_FREQ, 0.0, AGS_SYNTH_UTIL_BENCH_VOLUME,
+				AGS_SYNTH_UTIL_BENCH_SAMPLERATE,
+				0, AGS_SYNTH_UTIL_BENCH_N_FRAMES);
+    }
+    break;
+  case AGS_SYNTH_GENERATOR_OSCILLATOR_SAWTOOTH:
+    {
+      ags_synth_util_sawtooth_double(buffer,
+				     AGS_SYNTH_UTIL_BENCH_FREQ, 0.0, AGS_SYNTH_UTIL_BENCH_VOLUME,
+				     AGS_SYNTH_UTIL_BENCH_SAMPLERATE,
+				     0, AGS_SYNTH_UTIL_BENCH_N_FRAMES);
+    }
+    break;
+  case AGS_SYNTH_GENERATOR_OSCILLATOR_TRIANGLE:
+    {
+      ags_synth_util_triangle_double(buffer,
+				     AGS_SYNTH_UTIL_BENCH_FREQ, 0.0, AGS_SYNTH_UTIL_BENCH_VOLUME,
+				     AGS_SYNTH_UTIL_BENCH_SAMPLERATE,
+				     0, AGS_SYNTH_UTIL_BENCH_N_FRAMES);
+    }
+    break;
+  case AGS_SYNTH_GENERATOR_OSCILLATOR_SQUARE:
+    {
+      ags_synth_util_square_double(buffer,
+				   AGS_SYNTH_UTIL_BENCH_FREQ, 0.0, AGS_SYNTH_UTIL_BENCH_VOLUME,
+				   AGS_SYNTH_UTIL_BENCH_SAMPLERATE,
+				   0, AGS_SYNTH_UTIL_BENCH_N_FRAMES);
+    }
+    break;
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  double buffer[AGS_SYNTH_UTIL_BENCH_N_FRAMES];
+  struct timespec start;
+  gdouble n_frames;
+  gdouble legacy_time, block_time, oscillator_time;
+  gdouble increment;
+  gdouble phase;
+  guint iterations;
+  guint oscillator;
+  guint i;
+
+  static const gchar *oscillator_name[] = {
+    "sin\0",
+    "sawtooth\0",
+    "triangle\0",
+    "square\0",
+  };
+
+  putenv("LC_ALL=C\0");
+  putenv("LANG=C\0");
+
+  iterations = AGS_SYNTH_UTIL_BENCH_DEFAULT_ITERATIONS;
+
+  if(argc > 1){
+    iterations = strtoul(argv[1], NULL, 10);
+
+    if(iterations == 0){
+      fprintf(stderr, "usage: %s [iterations]\n\0", argv[0]);
+
+      return(1);
+    }
+  }
+
+  n_frames = (gdouble) AGS_SYNTH_UTIL_BENCH_N_FRAMES * (gdouble) iterations;
+  increment = AGS_SYNTH_UTIL_BENCH_FREQ / (gdouble) AGS_SYNTH_UTIL_BENCH_SAMPLERATE;
+
+  memset(buffer, 0, AGS_SYNTH_UTIL_BENCH_N_FRAMES * sizeof(double));
+
+  /* warm up the sin table */
+  ags_synth_util_oscillator_block(buffer,
+				  AGS_SYNTH_GENERATOR_OSCILLATOR_SIN,
+				  increment, 0.0,
+				  AGS_SYNTH_UTIL_BENCH_N_FRAMES);
+
+  printf("%u x %u frames at %.0f Hz, %u Hz samplerate\n\0",
+	 iterations, AGS_SYNTH_UTIL_BENCH_N_FRAMES,
+	 AGS_SYNTH_UTIL_BENCH_FREQ, AGS_SYNTH_UTIL_BENCH_SAMPLERATE);
+
+  for(oscillator = 0; oscillator < 4; oscillator++){
+    /* legacy functions */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for(i = 0; i < iterations; i++){
+      ags_synth_util_bench_legacy(buffer,
+				  oscillator);
+    }
+
+    legacy_time = ags_synth_util_bench_elapsed(&start);
+
+    /* block kernel alone */
+    phase = 0.0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for(i = 0; i < iterations; i++){
+      phase = ags_synth_util_oscillator_block(buffer,
+					      oscillator,
+					      increment, phase,
+					      AGS_SYNTH_UTIL_BENCH_N_FRAMES);
+    }
+
+    block_time = ags_synth_util_bench_elapsed(&start);
+
+    /* block kernel mixed into the buffer */
+    memset(buffer, 0, AGS_SYNTH_UTIL_BENCH_N_FRAMES * sizeof(double));
+    phase = 0.0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for(i = 0; i < iterations; i++){
+      phase = ags_synth_util_oscillator_double(buffer,
+					       oscillator,
+					       AGS_SYNTH_UTIL_BENCH_FREQ, phase, AGS_SYNTH_UTIL_BENCH_VOLUME,
+					       AGS_SYNTH_UTIL_BENCH_SAMPLERATE,
+					       0, AGS_SYNTH_UTIL_BENCH_N_FRAMES);
+    }
+
+    oscillator_time = ags_synth_util_bench_elapsed(&start);
+
+    printf("%-8s legacy %8.1f Mframes/s, block %8.1f Mframes/s, oscillator %8.1f Mframes/s\n\0",
+	   oscillator_name[oscillator],
+	   n_frames / legacy_time / 1000000.0,
+	   n_frames / block_time / 1000000.0,
+	   n_frames / oscillator_time / 1000000.0);
+  }
+
+  return(0);
+}
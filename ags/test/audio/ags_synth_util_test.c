@@ -0,0 +1,237 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2016 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <ags/audio/ags_synth_util.h>
+#include <ags/audio/ags_synth_generator.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+int ags_synth_util_test_init_suite();
+int ags_synth_util_test_clean_suite();
+
+void ags_synth_util_test_oscillator_sin();
+void ags_synth_util_test_oscillator_phase();
+void ags_synth_util_test_oscillator_band_limit();
+
+#define AGS_SYNTH_UTIL_TEST_SAMPLERATE (44100)
+#define AGS_SYNTH_UTIL_TEST_N_FRAMES (1000)
+
+#define AGS_SYNTH_UTIL_TEST_OSCILLATOR_SIN_FREQ (440.0)
+#define AGS_SYNTH_UTIL_TEST_OSCILLATOR_SIN_TOLERANCE (0.00001)
+
+#define AGS_SYNTH_UTIL_TEST_OSCILLATOR_PHASE_FREQ (3000.0)
+#define AGS_SYNTH_UTIL_TEST_OSCILLATOR_PHASE_SPLIT (300)
+#define AGS_SYNTH_UTIL_TEST_OSCILLATOR_PHASE_TOLERANCE (0.000000001)
+
+#define AGS_SYNTH_UTIL_TEST_OSCILLATOR_BAND_LIMIT_FREQ (5000.0)
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_synth_util_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_synth_util_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_synth_util_test_oscillator_sin()
+{
+  double buffer[AGS_SYNTH_UTIL_TEST_N_FRAMES];
+  gdouble expected;
+  gdouble phase;
+  guint i;
+  gboolean success;
+
+  memset(buffer, 0, AGS_SYNTH_UTIL_TEST_N_FRAMES * sizeof(double));
+
+  phase = ags_synth_util_oscillator_double(buffer,
+					   AGS_SYNTH_GENERATOR_OSCILLATOR_SIN,
+					   AGS_SYNTH_UTIL_TEST_OSCILLATOR_SIN_FREQ, 0.0, 1.0,
+					   AGS_SYNTH_UTIL_TEST_SAMPLERATE,
+					   0, AGS_SYNTH_UTIL_TEST_N_FRAMES);
+
+  /* compare to sin() */
+  success = TRUE;
+
+  for(i = 0; i < AGS_SYNTH_UTIL_TEST_N_FRAMES; i++){
+    expected = sin(2.0 * M_PI * AGS_SYNTH_UTIL_TEST_OSCILLATOR_SIN_FREQ * (gdouble) i / (gdouble) AGS_SYNTH_UTIL_TEST_SAMPLERATE);
+
+    if(fabs(buffer[i] - expected) > AGS_SYNTH_UTIL_TEST_OSCILLATOR_SIN_TOLERANCE){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  /* returned phase */
+  expected = fmod(AGS_SYNTH_UTIL_TEST_OSCILLATOR_SIN_FREQ * (gdouble) AGS_SYNTH_UTIL_TEST_N_FRAMES / (gdouble) AGS_SYNTH_UTIL_TEST_SAMPLERATE,
+		  1.0);
+
+  CU_ASSERT(fabs(phase - expected) < AGS_SYNTH_UTIL_TEST_OSCILLATOR_PHASE_TOLERANCE);
+}
+
+void
+ags_synth_util_test_oscillator_phase()
+{
+  double buffer[AGS_SYNTH_UTIL_TEST_N_FRAMES];
+  double split_buffer[AGS_SYNTH_UTIL_TEST_N_FRAMES];
+  gdouble phase;
+  guint oscillator;
+  guint i;
+  gboolean success;
+
+  success = TRUE;
+
+  for(oscillator = 0; oscillator < 4; oscillator++){
+    memset(buffer, 0, AGS_SYNTH_UTIL_TEST_N_FRAMES * sizeof(double));
+    memset(split_buffer, 0, AGS_SYNTH_UTIL_TEST_N_FRAMES * sizeof(double));
+
+    /* one call */
+    ags_synth_util_oscillator_double(buffer,
+				     oscillator,
+				     AGS_SYNTH_UTIL_TEST_OSCILLATOR_PHASE_FREQ, 0.0, 1.0,
+				     AGS_SYNTH_UTIL_TEST_SAMPLERATE,
+				     0, AGS_SYNTH_UTIL_TEST_N_FRAMES);
+
+    /* two calls continuing the returned phase */
+    phase = ags_synth_util_oscillator_double(split_buffer,
+					     oscillator,
+					     AGS_SYNTH_UTIL_TEST_OSCILLATOR_PHASE_FREQ, 0.0, 1.0,
+					     AGS_SYNTH_UTIL_TEST_SAMPLERATE,
+					     0, AGS_SYNTH_UTIL_TEST_OSCILLATOR_PHASE_SPLIT);
+    ags_synth_util_oscillator_double(split_buffer,
+				     oscillator,
+				     AGS_SYNTH_UTIL_TEST_OSCILLATOR_PHASE_FREQ, phase, 1.0,
+				     AGS_SYNTH_UTIL_TEST_SAMPLERATE,
+				     AGS_SYNTH_UTIL_TEST_OSCILLATOR_PHASE_SPLIT, AGS_SYNTH_UTIL_TEST_N_FRAMES - AGS_SYNTH_UTIL_TEST_OSCILLATOR_PHASE_SPLIT);
+
+    for(i = 0; i < AGS_SYNTH_UTIL_TEST_N_FRAMES; i++){
+      if(fabs(buffer[i] - split_buffer[i]) > AGS_SYNTH_UTIL_TEST_OSCILLATOR_PHASE_TOLERANCE){
+	success = FALSE;
+
+	break;
+      }
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+}
+
+void
+ags_synth_util_test_oscillator_band_limit()
+{
+  double buffer[AGS_SYNTH_UTIL_TEST_N_FRAMES];
+  gdouble increment;
+  gdouble phase;
+  guint i;
+  gboolean success;
+
+  memset(buffer, 0, AGS_SYNTH_UTIL_TEST_N_FRAMES * sizeof(double));
+
+  ags_synth_util_oscillator_double(buffer,
+				   AGS_SYNTH_GENERATOR_OSCILLATOR_SAWTOOTH,
+				   AGS_SYNTH_UTIL_TEST_OSCILLATOR_BAND_LIMIT_FREQ, 0.0, 1.0,
+				   AGS_SYNTH_UTIL_TEST_SAMPLERATE,
+				   0, AGS_SYNTH_UTIL_TEST_N_FRAMES);
+
+  /* the samples next to the discontinuity must be smoothed */
+  increment = AGS_SYNTH_UTIL_TEST_OSCILLATOR_BAND_LIMIT_FREQ / (gdouble) AGS_SYNTH_UTIL_TEST_SAMPLERATE;
+
+  success = TRUE;
+
+  for(i = 0; i < AGS_SYNTH_UTIL_TEST_N_FRAMES; i++){
+    phase = (gdouble) i * increment;
+    phase -= floor(phase);
+
+    if(fabs(buffer[i]) > 1.0 ||
+       ((phase < increment ||
+	 phase > 1.0 - increment) &&
+	fabs(buffer[i] - ((2.0 * phase) - 1.0)) == 0.0)){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  putenv("LC_ALL=C\0");
+  putenv("LANG=C\0");
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsSynthUtilTest\0", ags_synth_util_test_init_suite, ags_synth_util_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of ags_synth_util.c oscillator sin\0", ags_synth_util_test_oscillator_sin) == NULL) ||
+     (CU_add_test(pSuite, "test of ags_synth_util.c oscillator phase\0", ags_synth_util_test_oscillator_phase) == NULL) ||
+     (CU_add_test(pSuite, "test of ags_synth_util.c oscillator band limit\0", ags_synth_util_test_oscillator_band_limit) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
@@ -0,0 +1,285 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <ags/audio/midi/ags_midi_event_ring.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+int ags_midi_event_ring_test_init_suite();
+int ags_midi_event_ring_test_clean_suite();
+
+void ags_midi_event_ring_test_push_pop();
+void ags_midi_event_ring_test_parse();
+void ags_midi_event_ring_test_parse_sysex();
+
+#define AGS_MIDI_EVENT_RING_TEST_SIZE (6)
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_midi_event_ring_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_midi_event_ring_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_midi_event_ring_test_push_pop()
+{
+  AgsMidiEventRing *midi_event_ring;
+  AgsMidiEvent midi_event, *current;
+
+  guint i;
+  gboolean success;
+
+  midi_event_ring = ags_midi_event_ring_alloc(AGS_MIDI_EVENT_RING_TEST_SIZE);
+
+  CU_ASSERT(midi_event_ring->size == 8 &&
+	    ags_midi_event_ring_peek(midi_event_ring) == NULL);
+
+  memset(&midi_event,
+	 0,
+	 sizeof(AgsMidiEvent));
+
+  /* fill and overflow */
+  success = TRUE;
+
+  for(i = 0; i < 10; i++){
+    midi_event.frame = i;
+
+    if(ags_midi_event_ring_push(midi_event_ring,
+				&midi_event) != (i < 8)){
+      success = FALSE;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+  CU_ASSERT(ags_midi_event_ring_count(midi_event_ring) == 8 &&
+	    midi_event_ring->dropped == 2);
+
+  /* wrap around */
+  for(i = 0; i < 20; i++){
+    current = ags_midi_event_ring_peek(midi_event_ring);
+
+    if(current == NULL ||
+       current->frame != i){
+      success = FALSE;
+
+      break;
+    }
+
+    ags_midi_event_ring_pop(midi_event_ring);
+
+    midi_event.frame = i + 8;
+    ags_midi_event_ring_push(midi_event_ring,
+			     &midi_event);
+  }
+
+  CU_ASSERT(success == TRUE);
+  CU_ASSERT(ags_midi_event_ring_count(midi_event_ring) == 8);
+
+  ags_midi_event_ring_free(midi_event_ring);
+}
+
+void
+ags_midi_event_ring_test_parse()
+{
+  AgsMidiEventRing *midi_event_ring;
+  AgsMidiEvent *current;
+
+  /* note-on, running status note-on interrupted by clock, program change split */
+  unsigned char first[] = {0x90, 0x3c, 0x7f, 0x3e, 0xf8, 0x40, 0xc1};
+  unsigned char second[] = {0x05};
+
+  midi_event_ring = ags_midi_event_ring_alloc(AGS_MIDI_EVENT_RING_DEFAULT_SIZE);
+
+  CU_ASSERT(ags_midi_event_ring_parse(midi_event_ring,
+				      first, 7,
+				      100) == 3);
+  CU_ASSERT(ags_midi_event_ring_parse(midi_event_ring,
+				      second, 1,
+				      200) == 1);
+
+  /* note-on */
+  current = ags_midi_event_ring_peek(midi_event_ring);
+
+  CU_ASSERT(current->frame == 100 &&
+	    current->length == 3 &&
+	    current->data[0] == 0x90 &&
+	    current->data[1] == 0x3c &&
+	    current->data[2] == 0x7f);
+
+  ags_midi_event_ring_pop(midi_event_ring);
+
+  /* clock */
+  current = ags_midi_event_ring_peek(midi_event_ring);
+
+  CU_ASSERT(current->length == 1 &&
+	    current->data[0] == 0xf8);
+
+  ags_midi_event_ring_pop(midi_event_ring);
+
+  /* running status expanded */
+  current = ags_midi_event_ring_peek(midi_event_ring);
+
+  CU_ASSERT(current->length == 3 &&
+	    current->data[0] == 0x90 &&
+	    current->data[1] == 0x3e &&
+	    current->data[2] == 0x40);
+
+  ags_midi_event_ring_pop(midi_event_ring);
+
+  /* program change keeps the frame of its status byte */
+  current = ags_midi_event_ring_peek(midi_event_ring);
+
+  CU_ASSERT(current->frame == 100 &&
+	    current->length == 2 &&
+	    current->data[0] == 0xc1 &&
+	    current->data[1] == 0x05);
+
+  ags_midi_event_ring_pop(midi_event_ring);
+
+  CU_ASSERT(ags_midi_event_ring_peek(midi_event_ring) == NULL);
+
+  ags_midi_event_ring_free(midi_event_ring);
+}
+
+void
+ags_midi_event_ring_test_parse_sysex()
+{
+  AgsMidiEventRing *midi_event_ring;
+  AgsMidiEvent *current;
+
+  unsigned char sysex[20];
+  unsigned char data[32];
+
+  guint length;
+  guint i;
+
+  midi_event_ring = ags_midi_event_ring_alloc(AGS_MIDI_EVENT_RING_DEFAULT_SIZE);
+
+  sysex[0] = 0xf0;
+
+  for(i = 1; i < 19; i++){
+    sysex[i] = i;
+  }
+
+  sysex[19] = 0xf7;
+
+  CU_ASSERT(ags_midi_event_ring_parse(midi_event_ring,
+				      sysex, 20,
+				      0) == 2);
+
+  /* concatenate continued events */
+  length = 0;
+
+  while((current = ags_midi_event_ring_peek(midi_event_ring)) != NULL){
+    memcpy(data + length,
+	   current->data,
+	   current->length);
+    length += current->length;
+
+    ags_midi_event_ring_pop(midi_event_ring);
+
+    if((AGS_MIDI_EVENT_CONTINUED & (current->flags)) == 0){
+      break;
+    }
+  }
+
+  CU_ASSERT(length == 20 &&
+	    !memcmp(data, sysex, 20));
+
+  /* unterminated system exclusive is closed by the next status byte */
+  sysex[0] = 0xf0;
+  sysex[1] = 0x01;
+  sysex[2] = 0x80;
+  sysex[3] = 0x3c;
+  sysex[4] = 0x00;
+
+  CU_ASSERT(ags_midi_event_ring_parse(midi_event_ring,
+				      sysex, 5,
+				      0) == 2);
+
+  current = ags_midi_event_ring_peek(midi_event_ring);
+
+  CU_ASSERT(current->length == 3 &&
+	    current->data[0] == 0xf0 &&
+	    current->data[2] == 0xf7);
+
+  ags_midi_event_ring_free(midi_event_ring);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  putenv("LC_ALL=C\0");
+  putenv("LANG=C\0");
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsMidiEventRingTest\0", ags_midi_event_ring_test_init_suite, ags_midi_event_ring_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of ags_midi_event_ring.c push and pop\0", ags_midi_event_ring_test_push_pop) == NULL) ||
+     (CU_add_test(pSuite, "test of ags_midi_event_ring.c parse\0", ags_midi_event_ring_test_parse) == NULL) ||
+     (CU_add_test(pSuite, "test of ags_midi_event_ring.c parse sysex\0", ags_midi_event_ring_test_parse_sysex) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
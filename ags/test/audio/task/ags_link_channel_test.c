@@ -0,0 +1,237 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2017 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Basic.h>
+
+#include <ags/libags.h>
+#include <ags/libags-audio.h>
+
+int ags_link_channel_test_init_suite();
+int ags_link_channel_test_clean_suite();
+
+void ags_link_channel_test_undo_relink();
+void ags_link_channel_test_undo_file_link();
+
+AgsAudio* ags_link_channel_test_audio_new();
+
+AgsDevout *devout;
+AgsHistory *history;
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_link_channel_test_init_suite()
+{
+  devout = ags_devout_new(NULL);
+  g_object_ref(devout);
+
+  /* the tasks record their inverse to the history of the application context */
+  history = ags_history_new();
+  ags_application_context_get_instance()->history = (GObject *) history;
+
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_link_channel_test_clean_suite()
+{
+  ags_application_context_get_instance()->history = NULL;
+  g_object_unref(history);
+
+  g_object_unref(devout);
+
+  return(0);
+}
+
+AgsAudio*
+ags_link_channel_test_audio_new()
+{
+  AgsAudio *audio;
+
+  audio = ags_audio_new((GObject *) devout);
+
+  ags_audio_set_audio_channels(audio,
+			       1);
+
+  ags_audio_set_pads(audio,
+		     AGS_TYPE_INPUT,
+		     1);
+  ags_audio_set_pads(audio,
+		     AGS_TYPE_OUTPUT,
+		     1);
+
+  return(audio);
+}
+
+void
+ags_link_channel_test_undo_relink()
+{
+  AgsAudio *audio_a, *audio_b, *audio_c;
+  AgsChannel *a, *b, *c;
+  AgsLinkChannel *link_channel;
+  AgsTask *task;
+
+  GError *error;
+
+  audio_a = ags_link_channel_test_audio_new();
+  audio_b = ags_link_channel_test_audio_new();
+  audio_c = ags_link_channel_test_audio_new();
+
+  a = audio_a->output;
+  b = audio_b->input;
+  c = audio_c->output;
+
+  /* link b to c */
+  error = NULL;
+  ags_channel_set_link(b, c,
+		       &error);
+
+  CU_ASSERT(error == NULL);
+  CU_ASSERT(b->link == c && c->link == b);
+
+  /* link a to b, breaks up b and c */
+  link_channel = ags_link_channel_new(a, b);
+  ags_task_launch((AgsTask *) link_channel);
+
+  CU_ASSERT(link_channel->error == NULL);
+  CU_ASSERT(a->link == b && b->link == a);
+  CU_ASSERT(c->link == NULL);
+
+  g_object_unref(link_channel);
+
+  /* undo restores both pairs */
+  task = ags_history_undo(history);
+
+  CU_ASSERT(task != NULL);
+
+  ags_task_launch(task);
+  g_object_unref(task);
+
+  CU_ASSERT(a->link == NULL);
+  CU_ASSERT(b->link == c && c->link == b);
+
+  /* replaying doesn't record */
+  CU_ASSERT(history->position == 0 &&
+	    history->count == 1);
+
+  /* redo breaks them up again */
+  task = ags_history_redo(history);
+
+  CU_ASSERT(task != NULL);
+
+  ags_task_launch(task);
+  g_object_unref(task);
+
+  CU_ASSERT(a->link == b && b->link == a);
+  CU_ASSERT(c->link == NULL);
+
+  CU_ASSERT(history->position == 1 &&
+	    history->count == 1);
+}
+
+void
+ags_link_channel_test_undo_file_link()
+{
+  AgsAudio *audio_b, *audio_c;
+  AgsChannel *b, *c;
+  AgsLinkChannel *link_channel;
+  AgsFileLink *file_link;
+  AgsTask *task;
+
+  audio_b = ags_link_channel_test_audio_new();
+  audio_c = ags_link_channel_test_audio_new();
+
+  b = audio_b->input;
+  c = audio_c->output;
+
+  file_link = ags_file_link_new();
+  g_object_set(b,
+	       "file-link\0", file_link,
+	       NULL);
+
+  /* linking clears the file link */
+  link_channel = ags_link_channel_new(b, c);
+  ags_task_launch((AgsTask *) link_channel);
+
+  CU_ASSERT(link_channel->error == NULL);
+  CU_ASSERT(b->link == c && c->link == b);
+  CU_ASSERT(AGS_INPUT(b)->file_link == NULL);
+
+  g_object_unref(link_channel);
+
+  /* undo restores it */
+  task = ags_history_undo(history);
+
+  CU_ASSERT(task != NULL);
+
+  ags_task_launch(task);
+  g_object_unref(task);
+
+  CU_ASSERT(b->link == NULL && c->link == NULL);
+  CU_ASSERT(AGS_INPUT(b)->file_link == (GObject *) file_link);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  putenv("LC_ALL=C\0");
+  putenv("LANG=C\0");
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsLinkChannelTest\0", ags_link_channel_test_init_suite, ags_link_channel_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsLinkChannel undo relink\0", ags_link_channel_test_undo_relink) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsLinkChannel undo file link\0", ags_link_channel_test_undo_file_link) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
@@ -20,6 +20,7 @@
 #include <ags/lib/ags_turtle.h>
 
 #include <glib.h>
+#include <glib/gstdio.h>
 #include <glib-object.h>
 
 #include <CUnit/CUnit.h>
@@ -57,6 +58,8 @@ void ags_turtle_test_read_plx();
 void ags_turtle_test_read_percent();
 void ags_turtle_test_read_hex();
 void ags_turtle_test_read_pn_local_esc();
+void ags_turtle_test_find_triple();
+void ags_turtle_test_load_without_doc();
 
 #define AGS_TURTLE_TEST_READ_INTEGER_COUNT (1024)
 
@@ -68,6 +71,24 @@ void ags_turtle_test_read_pn_local_esc();
 #define AGS_TURTLE_TEST_READ_PN_CHARS_BASE_ITERATION_COUNT (65535)
 #define AGS_TURTLE_TEST_READ_PN_CHARS_ITERATION_COUNT (256)
 
+#define AGS_TURTLE_TEST_FIND_TRIPLE_MANIFEST "@prefix lv2: <http://lv2plug.in/ns/lv2core#> .\n" \
+  "@prefix rdfs: <http://www.w3.org/2000/01/rdf-schema#> .\n" \
+  "\n" \
+  "<http://example.org/amp>\n" \
+  "    a lv2:Plugin ;\n" \
+  "    lv2:binary <amp.so> ;\n" \
+  "    rdfs:seeAlso <amp.ttl> , <amp-presets.ttl> .\n\0"
+
+#define AGS_TURTLE_TEST_LOAD_WITHOUT_DOC_PLUGIN "@prefix lv2: <http://lv2plug.in/ns/lv2core#> .\n" \
+  "@prefix doap: <http://usefulinc.com/ns/doap#> .\n" \
+  "\n" \
+  "<http://example.org/amp>\n" \
+  "    doap:name \"\"\"Simple Amp\"\"\"@en ;\n" \
+  "    lv2:port [\n" \
+  "        lv2:index 0 ;\n" \
+  "        lv2:symbol 'gain' ;\n" \
+  "    ] .\n\0"
+
 /* The suite initialization function.
  * Opens the temporary file used by the tests.
  * Returns zero on success, non-zero otherwise.
@@ -1284,6 +1305,154 @@ ags_turtle_test_read_pn_local_esc()
   }
 }
 
+void
+ags_turtle_test_find_triple()
+{
+  AgsTurtle *turtle;
+  
+  GList *list;
+
+  gchar *filename;
+  gchar *plugin_class;
+  
+  filename = g_build_filename(g_get_tmp_dir(),
+			      "ags_turtle_test_find_triple.ttl\0",
+			      NULL);
+
+  CU_ASSERT(g_file_set_contents(filename,
+				AGS_TURTLE_TEST_FIND_TRIPLE_MANIFEST,
+				-1,
+				NULL) == TRUE);
+
+  turtle = ags_turtle_new(filename);
+  ags_turtle_load(turtle,
+		  NULL);
+
+  /* assert prefixed names expanded */
+  list = ags_turtle_find_object(turtle,
+				"<http://example.org/amp>\0",
+				"<http://lv2plug.in/ns/lv2core#binary>\0");
+  
+  CU_ASSERT(g_list_length(list) == 1 &&
+	    !g_strcmp0(list->data,
+		       "<amp.so>\0"));
+
+  g_list_free(list);
+
+  /* assert object list in document order */
+  list = ags_turtle_find_object(turtle,
+				"<http://example.org/amp>\0",
+				"<http://www.w3.org/2000/01/rdf-schema#seeAlso>\0");
+  
+  CU_ASSERT(g_list_length(list) == 2 &&
+	    !g_strcmp0(list->data,
+		       "<amp.ttl>\0") &&
+	    !g_strcmp0(list->next->data,
+		       "<amp-presets.ttl>\0"));
+
+  g_list_free(list);
+
+  /* assert verb a */
+  plugin_class = ags_turtle_expand_pname(turtle,
+					 "lv2:Plugin\0");
+  list = ags_turtle_find_subject(turtle,
+				 AGS_TURTLE_RDF_TYPE,
+				 plugin_class);
+  
+  CU_ASSERT(plugin_class != NULL &&
+	    g_list_length(list) == 1 &&
+	    !g_strcmp0(list->data,
+		       "<http://example.org/amp>\0"));
+
+  g_list_free(list);
+
+  /* assert not present */
+  CU_ASSERT(ags_turtle_find_triple(turtle,
+				   "<http://example.org/none>\0",
+				   NULL,
+				   NULL) == NULL);
+  
+  g_object_unref(turtle);
+  
+  g_unlink(filename);
+  g_free(filename);
+}
+
+void
+ags_turtle_test_load_without_doc()
+{
+  AgsTurtle *turtle;
+  
+  GList *list, *port;
+
+  gchar *filename;
+  gchar *str;
+  
+  filename = g_build_filename(g_get_tmp_dir(),
+			      "ags_turtle_test_load_without_doc.ttl\0",
+			      NULL);
+
+  CU_ASSERT(g_file_set_contents(filename,
+				AGS_TURTLE_TEST_LOAD_WITHOUT_DOC_PLUGIN,
+				-1,
+				NULL) == TRUE);
+
+  turtle = ags_turtle_new(filename);
+
+  /* assert no XML document built */
+  CU_ASSERT(ags_turtle_load(turtle,
+			    NULL) == NULL &&
+	    turtle->doc == NULL);
+
+  /* assert literal normalized */
+  list = ags_turtle_find_object(turtle,
+				"<http://example.org/amp>\0",
+				"<http://usefulinc.com/ns/doap#name>\0");
+  str = NULL;
+  
+  if(list != NULL){
+    str = ags_turtle_term_value(list->data);
+  }
+  
+  CU_ASSERT(g_list_length(list) == 1 &&
+	    !g_strcmp0(list->data,
+		       "\"Simple Amp\"@en\0") &&
+	    !g_strcmp0(str,
+		       "Simple Amp\0"));
+
+  g_free(str);
+  g_list_free(list);
+
+  /* assert blank node property list */
+  port = ags_turtle_find_object(turtle,
+				"<http://example.org/amp>\0",
+				"<http://lv2plug.in/ns/lv2core#port>\0");
+  list = NULL;
+
+  if(port != NULL){
+    list = ags_turtle_find_object(turtle,
+				  port->data,
+				  "<http://lv2plug.in/ns/lv2core#symbol>\0");
+  }
+  
+  CU_ASSERT(g_list_length(port) == 1 &&
+	    g_list_length(list) == 1 &&
+	    !g_strcmp0(list->data,
+		       "\"gain\"\0"));
+
+  g_list_free(list);
+  g_list_free(port);
+
+  /* assert export on demand */
+  CU_ASSERT(ags_turtle_export_doc(turtle) != NULL &&
+	    turtle->doc != NULL);
+  
+  g_object_unref(turtle);
+  
+  g_unlink(filename);
+  g_free(filename);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -1334,7 +1503,9 @@ main(int argc, char **argv)
      (CU_add_test(pSuite, "test of AgsTurtle read plx\0", ags_turtle_test_read_plx) == NULL) ||
      (CU_add_test(pSuite, "test of AgsTurtle read percent\0", ags_turtle_test_read_percent) == NULL) ||
      (CU_add_test(pSuite, "test of AgsTurtle read hex\0", ags_turtle_test_read_hex) == NULL) ||
-     (CU_add_test(pSuite, "test of AgsTurtle read pn-local esc\0", ags_turtle_test_read_pn_local_esc) == NULL)){
+     (CU_add_test(pSuite, "test of AgsTurtle read pn-local esc\0", ags_turtle_test_read_pn_local_esc) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTurtle find triple\0", ags_turtle_test_find_triple) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsTurtle load without doc\0", ags_turtle_test_load_without_doc) == NULL)){
     CU_cleanup_registry();
     
     return CU_get_error();
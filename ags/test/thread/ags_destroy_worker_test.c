@@ -0,0 +1,187 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <ags/libags.h>
+
+#include <stdlib.h>
+
+int ags_destroy_worker_test_init_suite();
+int ags_destroy_worker_test_clean_suite();
+
+void ags_destroy_worker_test_add();
+void ags_destroy_worker_test_drain();
+
+void ags_destroy_worker_test_destroy_func(gpointer ptr);
+
+#define AGS_DESTROY_WORKER_TEST_COUNT (16)
+
+guint destroyed[AGS_DESTROY_WORKER_TEST_COUNT];
+guint n_destroyed;
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_destroy_worker_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_destroy_worker_test_clean_suite()
+{
+  return(0);
+}
+
+void
+ags_destroy_worker_test_destroy_func(gpointer ptr)
+{
+  destroyed[n_destroyed] = GPOINTER_TO_UINT(ptr);
+  n_destroyed++;
+}
+
+void
+ags_destroy_worker_test_add()
+{
+  AgsDestroyWorker *destroy_worker;
+
+  destroy_worker = ags_destroy_worker_new();
+
+  /* not running destroys immediately */
+  n_destroyed = 0;
+  
+  ags_destroy_worker_add(destroy_worker,
+			 GUINT_TO_POINTER(1), ags_destroy_worker_test_destroy_func);
+
+  CU_ASSERT(n_destroyed == 1 &&
+	    destroyed[0] == 1);
+  CU_ASSERT(destroy_worker->destroy_queue == NULL);
+}
+
+void
+ags_destroy_worker_test_drain()
+{
+  AgsDestroyWorker *destroy_worker;
+
+  guint queued, max_queued, destroyed_count, overrun;
+  guint i;
+  gboolean success;
+  
+  destroy_worker = ags_destroy_worker_new();
+
+  /* pretend running, the poll loop isn't started */
+  g_atomic_int_or(&(AGS_WORKER_THREAD(destroy_worker)->flags),
+		  AGS_WORKER_THREAD_RUNNING);
+
+  n_destroyed = 0;
+
+  for(i = 1; i <= AGS_DESTROY_WORKER_TEST_COUNT; i++){
+    ags_destroy_worker_add(destroy_worker,
+			   GUINT_TO_POINTER(i), ags_destroy_worker_test_destroy_func);
+  }
+
+  CU_ASSERT(n_destroyed == 0);
+
+  ags_destroy_worker_get_statistics(destroy_worker,
+				    &queued, &max_queued,
+				    NULL, NULL);
+
+  CU_ASSERT(queued == AGS_DESTROY_WORKER_TEST_COUNT &&
+	    max_queued == AGS_DESTROY_WORKER_TEST_COUNT);
+  
+  /* batches, oldest first */
+  CU_ASSERT(ags_destroy_worker_drain(destroy_worker,
+				     5) == 5);
+  CU_ASSERT(ags_destroy_worker_drain(destroy_worker,
+				     AGS_DESTROY_WORKER_TEST_COUNT) == AGS_DESTROY_WORKER_TEST_COUNT - 5);
+  CU_ASSERT(ags_destroy_worker_drain(destroy_worker,
+				     AGS_DESTROY_WORKER_TEST_COUNT) == 0);
+
+  success = (n_destroyed == AGS_DESTROY_WORKER_TEST_COUNT) ? TRUE: FALSE;
+  
+  for(i = 0; i < n_destroyed; i++){
+    if(destroyed[i] != i + 1){
+      success = FALSE;
+
+      break;
+    }
+  }
+
+  CU_ASSERT(success == TRUE);
+
+  ags_destroy_worker_get_statistics(destroy_worker,
+				    &queued, &max_queued,
+				    &destroyed_count, &overrun);
+
+  CU_ASSERT(queued == 0 &&
+	    max_queued == AGS_DESTROY_WORKER_TEST_COUNT &&
+	    destroyed_count == AGS_DESTROY_WORKER_TEST_COUNT &&
+	    overrun == 0);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  putenv("LC_ALL=C\0");
+  putenv("LANG=C\0");
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsDestroyWorkerTest\0", ags_destroy_worker_test_init_suite, ags_destroy_worker_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsDestroyWorker add\0", ags_destroy_worker_test_add) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsDestroyWorker drain\0", ags_destroy_worker_test_drain) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
@@ -0,0 +1,257 @@
+/* GSequencer - Advanced GTK Sequencer
+ * Copyright (C) 2005-2015 Joël Krähemann
+ *
+ * This file is part of GSequencer.
+ *
+ * GSequencer is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GSequencer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GSequencer.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <glib.h>
+#include <glib-object.h>
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Automated.h>
+#include <CUnit/Basic.h>
+
+#include <ags/libags.h>
+
+#include <stdlib.h>
+
+int ags_history_test_init_suite();
+int ags_history_test_clean_suite();
+
+void ags_history_test_undo_redo();
+void ags_history_test_truncate();
+void ags_history_test_overflow();
+
+AgsHistoryEntry* ags_history_test_entry_alloc();
+
+/* The suite initialization function.
+ * Opens the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_history_test_init_suite()
+{
+  return(0);
+}
+
+/* The suite cleanup function.
+ * Closes the temporary file used by the tests.
+ * Returns zero on success, non-zero otherwise.
+ */
+int
+ags_history_test_clean_suite()
+{
+  return(0);
+}
+
+AgsHistoryEntry*
+ags_history_test_entry_alloc()
+{
+  return(ags_history_entry_alloc(ags_task_new(),
+				 ags_task_new()));
+}
+
+void
+ags_history_test_undo_redo()
+{
+  AgsHistory *history;
+  AgsHistoryEntry *first, *second;
+  AgsTask *task;
+
+  guint64 sequence;
+
+  history = ags_history_new();
+
+  CU_ASSERT(ags_history_undo(history) == NULL &&
+	    ags_history_redo(history) == NULL);
+
+  first = ags_history_test_entry_alloc();
+  second = ags_history_test_entry_alloc();
+
+  /* replayed tasks aren't recorded */
+  CU_ASSERT(ags_history_is_recording(history, first->undo) == FALSE &&
+	    ags_history_is_recording(history, first->redo) == FALSE);
+
+  ags_history_append(history,
+		     first);
+  ags_history_append(history,
+		     second);
+
+  CU_ASSERT(history->count == 2 &&
+	    history->position == 2);
+
+  sequence = ags_history_get_sequence(history);
+
+  /* undo in reverse order */
+  task = ags_history_undo(history);
+
+  CU_ASSERT(task == second->undo &&
+	    G_OBJECT(task)->ref_count == 2);
+
+  g_object_unref(task);
+
+  task = ags_history_undo(history);
+
+  CU_ASSERT(task == first->undo);
+
+  g_object_unref(task);
+
+  CU_ASSERT(ags_history_undo(history) == NULL);
+  CU_ASSERT(ags_history_get_sequence(history) == sequence + 2);
+
+  /* redo in order */
+  task = ags_history_redo(history);
+
+  CU_ASSERT(task == first->redo);
+
+  g_object_unref(task);
+
+  task = ags_history_redo(history);
+
+  CU_ASSERT(task == second->redo);
+
+  g_object_unref(task);
+
+  CU_ASSERT(ags_history_redo(history) == NULL);
+
+  g_object_unref(history);
+}
+
+void
+ags_history_test_truncate()
+{
+  AgsHistory *history;
+  AgsHistoryEntry *first, *second, *third;
+  AgsTask *task;
+
+  history = ags_history_new();
+
+  first = ags_history_test_entry_alloc();
+  second = ags_history_test_entry_alloc();
+
+  ags_history_append(history,
+		     first);
+  ags_history_append(history,
+		     second);
+
+  g_object_unref(ags_history_undo(history));
+
+  /* a new change discards the entry undone */
+  third = ags_history_test_entry_alloc();
+
+  ags_history_append(history,
+		     third);
+
+  CU_ASSERT(history->count == 2 &&
+	    history->position == 2);
+  CU_ASSERT(ags_history_redo(history) == NULL);
+
+  task = ags_history_undo(history);
+
+  CU_ASSERT(task == third->undo);
+
+  g_object_unref(task);
+
+  task = ags_history_undo(history);
+
+  CU_ASSERT(task == first->undo);
+
+  g_object_unref(task);
+
+  g_object_unref(history);
+}
+
+void
+ags_history_test_overflow()
+{
+  AgsHistory *history;
+  AgsHistoryEntry *entry[AGS_HISTORY_DEFAULT_SIZE + 2];
+  AgsTask *task;
+
+  guint i;
+  gboolean success;
+
+  history = ags_history_new();
+
+  for(i = 0; i < AGS_HISTORY_DEFAULT_SIZE + 2; i++){
+    entry[i] = ags_history_test_entry_alloc();
+
+    ags_history_append(history,
+		       entry[i]);
+  }
+
+  /* the oldest entries are dropped */
+  CU_ASSERT(history->count == AGS_HISTORY_DEFAULT_SIZE &&
+	    history->position == AGS_HISTORY_DEFAULT_SIZE);
+
+  success = TRUE;
+
+  for(i = AGS_HISTORY_DEFAULT_SIZE + 2; i > 2; i--){
+    task = ags_history_undo(history);
+
+    if(task != entry[i - 1]->undo){
+      success = FALSE;
+
+      break;
+    }
+
+    g_object_unref(task);
+  }
+
+  CU_ASSERT(success == TRUE);
+  CU_ASSERT(ags_history_undo(history) == NULL);
+
+  g_object_unref(history);
+}
+
+int
+main(int argc, char **argv)
+{
+  CU_pSuite pSuite = NULL;
+
+  putenv("LC_ALL=C\0");
+  putenv("LANG=C\0");
+
+  /* initialize the CUnit test registry */
+  if(CUE_SUCCESS != CU_initialize_registry()){
+    return CU_get_error();
+  }
+
+  /* add a suite to the registry */
+  pSuite = CU_add_suite("AgsHistoryTest\0", ags_history_test_init_suite, ags_history_test_clean_suite);
+
+  if(pSuite == NULL){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* add the tests to the suite */
+  if((CU_add_test(pSuite, "test of AgsHistory undo and redo\0", ags_history_test_undo_redo) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsHistory truncate\0", ags_history_test_truncate) == NULL) ||
+     (CU_add_test(pSuite, "test of AgsHistory overflow\0", ags_history_test_overflow) == NULL)){
+    CU_cleanup_registry();
+
+    return CU_get_error();
+  }
+
+  /* Run all tests using the CUnit Basic interface */
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+
+  CU_cleanup_registry();
+
+  return(CU_get_error());
+}
@@ -22,6 +22,7 @@
 #include <ags/object/ags_connectable.h>
 
 #include <stdlib.h>
+#include <sched.h>
 
 void ags_destroy_worker_class_init(AgsDestroyWorkerClass *destroy_worker);
 void ags_destroy_worker_connectable_interface_init(AgsConnectableInterface *connectable);
@@ -35,6 +36,8 @@ void ags_destroy_worker_stop(AgsThread *thread);
 
 void ags_destroy_worker_do_poll(AgsWorkerThread *worker_thread);
 
+AgsDestroyEntry* ags_destroy_worker_take_queue(AgsDestroyWorker *destroy_worker);
+
 /**
  * SECTION:ags_destroy_worker
  * @short_description: destroy worker
@@ -44,6 +47,11 @@ void ags_destroy_worker_do_poll(AgsWorkerThread *worker_thread);
  *
  * The #AgsDestroyWorker does non-realtime work. You might want
  * give it the responsibility to destroy your objects.
+ *
+ * Adding is lock-free, so the audio threads can hand over dead objects
+ * without waiting. The worker destroys them in batches at normal priority
+ * and stops sleeping between batches as long as more entries than its
+ * high water are queued.
  */
 
 static gpointer ags_destroy_worker_parent_class = NULL;
@@ -126,19 +134,24 @@ ags_destroy_worker_init(AgsDestroyWorker *destroy_worker)
 
   destroy_worker->destroy_interval->tv_sec = 1;
   destroy_worker->destroy_interval->tv_nsec = 0;
-  
-  /* lock destroy list */
-  destroy_worker->destroy_mutexattr = (pthread_mutexattr_t *) malloc(sizeof(pthread_mutexattr_t));
-
-  pthread_mutexattr_init(destroy_worker->destroy_mutexattr);
-  pthread_mutexattr_settype(destroy_worker->destroy_mutexattr,
-			    PTHREAD_MUTEX_RECURSIVE);
-
-  destroy_worker->destroy_mutex = (pthread_mutex_t *) malloc(sizeof(pthread_mutex_t));
-  pthread_mutex_init(destroy_worker->destroy_mutex, destroy_worker->destroy_mutexattr);
 
-  /* destroy list */
-  destroy_worker->destroy_list = NULL;
+  destroy_worker->batch_size = AGS_DESTROY_WORKER_DEFAULT_BATCH_SIZE;
+  destroy_worker->high_water = AGS_DESTROY_WORKER_DEFAULT_HIGH_WATER;
+  
+  /* destroy queue */
+  g_atomic_pointer_set(&(destroy_worker->destroy_queue),
+		       NULL);
+  destroy_worker->pending = NULL;
+
+  /* statistics */
+  g_atomic_int_set(&(destroy_worker->queued),
+		   0);
+  g_atomic_int_set(&(destroy_worker->max_queued),
+		   0);
+  g_atomic_int_set(&(destroy_worker->destroyed),
+		   0);
+  g_atomic_int_set(&(destroy_worker->overrun),
+		   0);
 }
 
 void
@@ -164,9 +177,9 @@ ags_destroy_worker_finalize(GObject *gobject)
     free(destroy_worker->destroy_interval);
   }
   
-  /* destroy mutex */
-  pthread_mutex_destroy(destroy_worker->destroy_mutex);
-  free(destroy_worker->destroy_mutex);
+  /* destroy what is left */
+  ags_destroy_worker_drain(destroy_worker,
+			   G_MAXUINT);
 
   /* call parent */
   G_OBJECT_CLASS(ags_destroy_worker_parent_class)->finalize(gobject);
@@ -177,8 +190,20 @@ ags_destroy_worker_start(AgsThread *thread)
 {
   AgsWorkerThread *worker_thread;
 
+  struct sched_param param;
+  
   worker_thread = AGS_WORKER_THREAD(thread);
 
+  /* don't inherit the realtime scheduling of the audio threads */
+  param.sched_priority = 0;
+  
+  pthread_attr_setinheritsched(worker_thread->worker_thread_attr,
+			       PTHREAD_EXPLICIT_SCHED);
+  pthread_attr_setschedpolicy(worker_thread->worker_thread_attr,
+			      SCHED_OTHER);
+  pthread_attr_setschedparam(worker_thread->worker_thread_attr,
+			     &param);
+  
   g_atomic_int_or(&(worker_thread->flags),
 		  AGS_WORKER_THREAD_RUNNING);
 
@@ -201,29 +226,50 @@ void
 ags_destroy_worker_do_poll(AgsWorkerThread *worker_thread)
 {
   AgsDestroyWorker *destroy_worker;
-
-  GList *list, *list_start;
   
   destroy_worker = AGS_DESTROY_WORKER(worker_thread);
 
-  pthread_mutex_lock(destroy_worker->destroy_mutex);
+  ags_destroy_worker_drain(destroy_worker,
+			   destroy_worker->batch_size);
+
+  /* backpressure - keep on draining */
+  if(g_atomic_int_get(&(destroy_worker->queued)) > destroy_worker->high_water){
+    g_atomic_int_inc(&(destroy_worker->overrun));
 
-  list_start =
-    list = destroy_worker->destroy_list;
-  destroy_worker->destroy_list = NULL;
+    sched_yield();
+    
+    return;
+  }
   
-  pthread_mutex_unlock(destroy_worker->destroy_mutex);
+  nanosleep(destroy_worker->destroy_interval,
+	    NULL);
+}
 
-  while(list != NULL){
-    AGS_DESTROY_ENTRY(list->data)->destroy_func(AGS_DESTROY_ENTRY(list->data)->ptr);
+AgsDestroyEntry*
+ags_destroy_worker_take_queue(AgsDestroyWorker *destroy_worker)
+{
+  AgsDestroyEntry *destroy_entry, *prev, *next;
+  
+  /* detach all entries at once */
+  do{
+    destroy_entry = g_atomic_pointer_get(&(destroy_worker->destroy_queue));
+  }while(destroy_entry != NULL &&
+	 !g_atomic_pointer_compare_and_exchange(&(destroy_worker->destroy_queue),
+						destroy_entry,
+						NULL));
+
+  /* newest first, so reverse */
+  prev = NULL;
+  
+  while(destroy_entry != NULL){
+    next = destroy_entry->next;
+    destroy_entry->next = prev;
 
-    list = list->next;
+    prev = destroy_entry;
+    destroy_entry = next;
   }
 
-  g_list_free(list_start);
-
-  nanosleep(destroy_worker->destroy_interval,
-	    NULL);
+  return(prev);
 }
 
 /**
@@ -244,17 +290,23 @@ ags_destroy_entry_alloc(gpointer ptr, AgsDestroyFunc destroy_func)
 
   destroy_entry = (AgsDestroyEntry *) malloc(sizeof(AgsDestroyEntry));
 
+  destroy_entry->next = NULL;
+  
   destroy_entry->ptr = ptr;
   destroy_entry->destroy_func = destroy_func;
+
+  return(destroy_entry);
 }
 
 /**
  * ags_destroy_worker_add:
- * @destroy_worker:
- * @ptr:
- * @destroy_func:
+ * @destroy_worker: the #AgsDestroyWorker
+ * @ptr: the pointer to destroy
+ * @destroy_func: the @ptr's destroy function
  * 
- * Add @ptr for destruction using @destroy_func.
+ * Add @ptr for destruction using @destroy_func. It doesn't lock and is safe
+ * to call of any thread. If @destroy_worker isn't running @ptr is destroyed
+ * immediately.
  * 
  * Since: 0.7.122.8
  */
@@ -262,22 +314,136 @@ void
 ags_destroy_worker_add(AgsDestroyWorker *destroy_worker,
 		       gpointer ptr, AgsDestroyFunc destroy_func)
 {
-  AgsDestroyEntry *destroy_entry;
+  AgsDestroyEntry *destroy_entry, *head;
 
+  guint queued, max_queued;
+  
   if(destroy_worker == NULL ||
      ptr == NULL ||
      destroy_func == NULL){
     return;
   }
 
+  if((AGS_WORKER_THREAD_RUNNING & (g_atomic_int_get(&(AGS_WORKER_THREAD(destroy_worker)->flags)))) == 0){
+    destroy_func(ptr);
+
+    return;
+  }
+  
   destroy_entry = ags_destroy_entry_alloc(ptr, destroy_func);
+
+  /* push */
+  do{
+    head = g_atomic_pointer_get(&(destroy_worker->destroy_queue));
+    destroy_entry->next = head;
+  }while(!g_atomic_pointer_compare_and_exchange(&(destroy_worker->destroy_queue),
+						head,
+						destroy_entry));
+
+  /* statistics */
+  g_atomic_int_inc(&(destroy_worker->queued));
+  queued = g_atomic_int_get(&(destroy_worker->queued));
+  
+  do{
+    max_queued = g_atomic_int_get(&(destroy_worker->max_queued));
+  }while(queued > max_queued &&
+	 !g_atomic_int_compare_and_exchange(&(destroy_worker->max_queued),
+					    max_queued,
+					    queued));
+}
+
+/**
+ * ags_destroy_worker_drain:
+ * @destroy_worker: the #AgsDestroyWorker
+ * @batch_size: the maximum count of entries to destroy
+ * 
+ * Destroy at most @batch_size of the queued entries, oldest first. Called
+ * by the worker only.
+ *
+ * Returns: the count of entries destroyed
+ * 
+ * Since: 0.7.136
+ */
+guint
+ags_destroy_worker_drain(AgsDestroyWorker *destroy_worker,
+			 guint batch_size)
+{
+  AgsDestroyEntry *destroy_entry;
+
+  guint count;
+
+  if(destroy_worker == NULL){
+    return(0);
+  }
+
+  count = 0;
   
-  pthread_mutex_lock(destroy_worker->destroy_mutex);
+  while(count < batch_size){
+    if(destroy_worker->pending == NULL){
+      destroy_worker->pending = ags_destroy_worker_take_queue(destroy_worker);
 
-  destroy_worker->destroy_list = g_list_prepend(destroy_worker->destroy_list,
-						destroy_entry);
+      if(destroy_worker->pending == NULL){
+	break;
+      }
+    }
+
+    destroy_entry = destroy_worker->pending;
+    destroy_worker->pending = destroy_entry->next;
+    
+    destroy_entry->destroy_func(destroy_entry->ptr);
+    free(destroy_entry);
+
+    count++;
+  }
+
+  /* statistics */
+  if(count > 0){
+    g_atomic_int_add(&(destroy_worker->queued),
+		     -1 * (gint) count);
+    g_atomic_int_add(&(destroy_worker->destroyed),
+		     count);
+  }
   
-  pthread_mutex_unlock(destroy_worker->destroy_mutex);
+  return(count);
+}
+
+/**
+ * ags_destroy_worker_get_statistics:
+ * @destroy_worker: the #AgsDestroyWorker
+ * @queued: return location of the count of entries waiting
+ * @max_queued: return location of the most entries ever waiting
+ * @destroyed: return location of the count of entries destroyed
+ * @overrun: return location of the count of polls exceeding the high water
+ * 
+ * Get the backpressure statistics of @destroy_worker. Any location may
+ * be %NULL.
+ * 
+ * Since: 0.7.136
+ */
+void
+ags_destroy_worker_get_statistics(AgsDestroyWorker *destroy_worker,
+				  guint *queued, guint *max_queued,
+				  guint *destroyed, guint *overrun)
+{
+  if(destroy_worker == NULL){
+    return;
+  }
+
+  if(queued != NULL){
+    *queued = g_atomic_int_get(&(destroy_worker->queued));
+  }
+
+  if(max_queued != NULL){
+    *max_queued = g_atomic_int_get(&(destroy_worker->max_queued));
+  }
+
+  if(destroyed != NULL){
+    *destroyed = g_atomic_int_get(&(destroy_worker->destroyed));
+  }
+
+  if(overrun != NULL){
+    *overrun = g_atomic_int_get(&(destroy_worker->overrun));
+  }
 }
 
 /**
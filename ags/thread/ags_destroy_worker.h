@@ -37,6 +37,9 @@
 
 #define AGS_DESTROY_ENTRY(ptr) ((AgsDestroyEntry *) (ptr))
 
+#define AGS_DESTROY_WORKER_DEFAULT_BATCH_SIZE (256)
+#define AGS_DESTROY_WORKER_DEFAULT_HIGH_WATER (1024)
+
 typedef struct _AgsDestroyWorker AgsDestroyWorker;
 typedef struct _AgsDestroyWorkerClass AgsDestroyWorkerClass;
 typedef struct _AgsDestroyEntry AgsDestroyEntry;
@@ -48,11 +51,17 @@ struct _AgsDestroyWorker
   AgsWorkerThread worker_thread;
 
   struct timespec *destroy_interval;
-  
-  pthread_mutex_t *destroy_mutex;
-  pthread_mutexattr_t *destroy_mutexattr;
 
-  GList *destroy_list;
+  guint batch_size;
+  guint high_water;
+  
+  volatile gpointer destroy_queue;
+  AgsDestroyEntry *pending;
+  
+  volatile guint queued;
+  volatile guint max_queued;
+  volatile guint destroyed;
+  volatile guint overrun;
 };
 
 struct _AgsDestroyWorkerClass
@@ -62,6 +71,8 @@ struct _AgsDestroyWorkerClass
 
 struct _AgsDestroyEntry
 {
+  AgsDestroyEntry *next;
+  
   gpointer ptr;
   
   void (*destroy_func)(gpointer ptr);
@@ -74,6 +85,13 @@ AgsDestroyEntry* ags_destroy_entry_alloc(gpointer ptr, AgsDestroyFunc destroy_fu
 void ags_destroy_worker_add(AgsDestroyWorker *destroy_worker,
 			    gpointer ptr, AgsDestroyFunc destroy_func);
 
+guint ags_destroy_worker_drain(AgsDestroyWorker *destroy_worker,
+			       guint batch_size);
+
+void ags_destroy_worker_get_statistics(AgsDestroyWorker *destroy_worker,
+				       guint *queued, guint *max_queued,
+				       guint *destroyed, guint *overrun);
+
 AgsDestroyWorker* ags_destroy_worker_new();
 
 #endif /*__AGS_DESTROY_WORKER_H__*/
@@ -21,6 +21,8 @@
 
 #include <ags/object/ags_connectable.h>
 
+#include <stdlib.h>
+
 void ags_history_class_init(AgsHistoryClass *history);
 void ags_history_connectable_interface_init(AgsConnectableInterface *connectable);
 void ags_history_init(AgsHistory *history);
@@ -28,14 +30,22 @@ void ags_history_connect(AgsConnectable *connectable);
 void ags_history_disconnect(AgsConnectable *connectable);
 void ags_history_finalize(GObject *gobject);
 
-enum{
-  LAUNCH,
-  FAILURE,
-  LAST_SIGNAL,
-};
+void ags_history_truncate(AgsHistory *history);
+
+/**
+ * SECTION:ags_history
+ * @short_description: undo and redo log
+ * @title: AgsHistory
+ * @section_id:
+ * @include: ags/thread/ags_history.h
+ *
+ * #AgsHistory is a bounded ring of #AgsHistoryEntry. Every entry holds
+ * the tasks to revert and to reapply a single change, so undo and redo
+ * cost as much as the change itself. Tasks launched by undo or redo are
+ * flagged with %AGS_TASK_HISTORY and aren't recorded again.
+ */
 
 static gpointer ags_history_parent_class = NULL;
-static guint history_signals[LAST_SIGNAL];
 
 GType
 ags_history_get_type()
@@ -97,6 +107,18 @@ ags_history_connectable_interface_init(AgsConnectableInterface *connectable)
 void
 ags_history_init(AgsHistory *history)
 {
+  history->mutex = (pthread_mutex_t *) malloc(sizeof(pthread_mutex_t));
+  pthread_mutex_init(history->mutex,
+		     NULL);
+
+  history->size = AGS_HISTORY_DEFAULT_SIZE;
+  history->entry = (AgsHistoryEntry **) malloc(history->size * sizeof(AgsHistoryEntry *));
+
+  history->offset = 0;
+  history->count = 0;
+  history->position = 0;
+
+  history->sequence = 0;
 }
 
 void
@@ -114,8 +136,309 @@ ags_history_disconnect(AgsConnectable *connectable)
 void
 ags_history_finalize(GObject *gobject)
 {
+  AgsHistory *history;
+
+  guint i;
+
+  history = AGS_HISTORY(gobject);
+
+  for(i = 0; i < history->count; i++){
+    ags_history_entry_free(history->entry[(history->offset + i) % history->size]);
+  }
+
+  free(history->entry);
+
+  pthread_mutex_destroy(history->mutex);
+  free(history->mutex);
+
+  /* call parent */
+  G_OBJECT_CLASS(ags_history_parent_class)->finalize(gobject);
+}
+
+/**
+ * ags_history_entry_alloc:
+ * @undo: the #AgsTask reverting the change
+ * @redo: the #AgsTask reapplying the change
+ *
+ * Allocate #AgsHistoryEntry, it takes ownership of @undo and @redo.
+ *
+ * Returns: the new #AgsHistoryEntry
+ *
+ * Since: 0.7.136
+ */
+AgsHistoryEntry*
+ags_history_entry_alloc(AgsTask *undo, AgsTask *redo)
+{
+  AgsHistoryEntry *entry;
+
+  entry = (AgsHistoryEntry *) malloc(sizeof(AgsHistoryEntry));
+
+  entry->sequence = 0;
+
+  entry->undo = undo;
+  entry->redo = redo;
+
+  if(undo != NULL){
+    undo->flags |= AGS_TASK_HISTORY;
+  }
+
+  if(redo != NULL){
+    redo->flags |= AGS_TASK_HISTORY;
+  }
+
+  entry->reference = NULL;
+
+  return(entry);
+}
+
+/**
+ * ags_history_entry_free:
+ * @entry: the #AgsHistoryEntry
+ *
+ * Free @entry and release its tasks and references.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_history_entry_free(AgsHistoryEntry *entry)
+{
+  if(entry == NULL){
+    return;
+  }
+
+  if(entry->undo != NULL){
+    g_object_unref(entry->undo);
+  }
+
+  if(entry->redo != NULL){
+    g_object_unref(entry->redo);
+  }
+
+  g_list_free_full(entry->reference,
+		   g_object_unref);
+
+  free(entry);
+}
+
+/**
+ * ags_history_entry_add_reference:
+ * @entry: the #AgsHistoryEntry
+ * @reference: the #GObject to keep alive
+ *
+ * Keep @reference alive as long as @entry exists, e.g. a note removed
+ * from its notation but needed to redo.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_history_entry_add_reference(AgsHistoryEntry *entry,
+				GObject *reference)
+{
+  if(entry == NULL ||
+     reference == NULL){
+    return;
+  }
+
+  g_object_ref(reference);
+  entry->reference = g_list_prepend(entry->reference,
+				    reference);
+}
+
+/**
+ * ags_history_is_recording:
+ * @history: the #AgsHistory
+ * @task: the #AgsTask about to change state
+ *
+ * Check if the change of @task shall be appended to @history.
+ *
+ * Returns: %TRUE if @task isn't replayed by @history, otherwise %FALSE
+ *
+ * Since: 0.7.136
+ */
+gboolean
+ags_history_is_recording(AgsHistory *history,
+			 AgsTask *task)
+{
+  if(history == NULL ||
+     task == NULL){
+    return(FALSE);
+  }
+
+  return(((AGS_TASK_HISTORY & (task->flags)) == 0) ? TRUE: FALSE);
+}
+
+void
+ags_history_truncate(AgsHistory *history)
+{
+  /* a new change discards the entries undone */
+  while(history->count > history->position){
+    history->count -= 1;
+
+    ags_history_entry_free(history->entry[(history->offset + history->count) % history->size]);
+  }
+}
+
+/**
+ * ags_history_append:
+ * @history: the #AgsHistory
+ * @entry: the #AgsHistoryEntry
+ *
+ * Append @entry to @history. The entries undone are discarded and if
+ * @history is full the oldest entry is dropped.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_history_append(AgsHistory *history,
+		   AgsHistoryEntry *entry)
+{
+  if(history == NULL ||
+     entry == NULL){
+    ags_history_entry_free(entry);
+
+    return;
+  }
+
+  pthread_mutex_lock(history->mutex);
+
+  ags_history_truncate(history);
+
+  if(history->count == history->size){
+    ags_history_entry_free(history->entry[history->offset]);
+
+    history->offset = (history->offset + 1) % history->size;
+    history->count -= 1;
+  }
+
+  history->sequence += 1;
+  entry->sequence = history->sequence;
+
+  history->entry[(history->offset + history->count) % history->size] = entry;
+
+  history->count += 1;
+  history->position = history->count;
+
+  pthread_mutex_unlock(history->mutex);
+}
+
+/**
+ * ags_history_undo:
+ * @history: the #AgsHistory
+ *
+ * Step back in @history. The returned task is meant to be appended to
+ * the #AgsTaskThread, which releases it after launch.
+ *
+ * Returns: a reference of the #AgsTask reverting the last change or %NULL
+ *
+ * Since: 0.7.136
+ */
+AgsTask*
+ags_history_undo(AgsHistory *history)
+{
+  AgsTask *task;
+
+  if(history == NULL){
+    return(NULL);
+  }
+
+  task = NULL;
+
+  pthread_mutex_lock(history->mutex);
+
+  if(history->position > 0){
+    history->position -= 1;
+    history->sequence += 1;
+
+    task = history->entry[(history->offset + history->position) % history->size]->undo;
+
+    if(task != NULL){
+      g_object_ref(task);
+    }
+  }
+
+  pthread_mutex_unlock(history->mutex);
+
+  return(task);
 }
 
+/**
+ * ags_history_redo:
+ * @history: the #AgsHistory
+ *
+ * Step forward in @history. The returned task is meant to be appended to
+ * the #AgsTaskThread, which releases it after launch.
+ *
+ * Returns: a reference of the #AgsTask reapplying the last change undone or %NULL
+ *
+ * Since: 0.7.136
+ */
+AgsTask*
+ags_history_redo(AgsHistory *history)
+{
+  AgsTask *task;
+
+  if(history == NULL){
+    return(NULL);
+  }
+
+  task = NULL;
+
+  pthread_mutex_lock(history->mutex);
+
+  if(history->position < history->count){
+    task = history->entry[(history->offset + history->position) % history->size]->redo;
+
+    if(task != NULL){
+      g_object_ref(task);
+    }
+
+    history->position += 1;
+    history->sequence += 1;
+  }
+
+  pthread_mutex_unlock(history->mutex);
+
+  return(task);
+}
+
+/**
+ * ags_history_get_sequence:
+ * @history: the #AgsHistory
+ *
+ * Get the sequence of @history, it advances with every append, undo and
+ * redo. Comparing it tells if the state changed since the last look.
+ *
+ * Returns: the sequence
+ *
+ * Since: 0.7.136
+ */
+guint64
+ags_history_get_sequence(AgsHistory *history)
+{
+  guint64 sequence;
+
+  if(history == NULL){
+    return(0);
+  }
+
+  pthread_mutex_lock(history->mutex);
+
+  sequence = history->sequence;
+
+  pthread_mutex_unlock(history->mutex);
+
+  return(sequence);
+}
+
+/**
+ * ags_history_new:
+ *
+ * Create a new #AgsHistory.
+ *
+ * Returns: the new #AgsHistory
+ *
+ * Since: 0.4
+ */
 AgsHistory*
 ags_history_new()
 {
@@ -25,6 +25,8 @@
 
 #include <ags/thread/ags_task.h>
 
+#include <pthread.h>
+
 #define AGS_TYPE_HISTORY                (ags_history_get_type())
 #define AGS_HISTORY(obj)                (G_TYPE_CHECK_INSTANCE_CAST((obj), AGS_TYPE_HISTORY, AgsHistory))
 #define AGS_HISTORY_CLASS(class)        (G_TYPE_CHECK_CLASS_CAST(class, AGS_TYPE_HISTORY, AgsHistory))
@@ -32,15 +34,28 @@
 #define AGS_IS_HISTORY_CLASS(class)     (G_TYPE_CHECK_CLASS_TYPE ((class), AGS_TYPE_HISTORY))
 #define AGS_HISTORY_GET_CLASS(obj)      (G_TYPE_INSTANCE_GET_CLASS(obj, AGS_TYPE_HISTORY, AgsHistoryClass))
 
+#define AGS_HISTORY_ENTRY(ptr) ((AgsHistoryEntry *)(ptr))
+
+#define AGS_HISTORY_DEFAULT_SIZE (256)
+
 typedef struct _AgsHistory AgsHistory;
 typedef struct _AgsHistoryClass AgsHistoryClass;
-typedef struct _AgsHistoryAppend AgsHistoryAppend;
+typedef struct _AgsHistoryEntry AgsHistoryEntry;
 
 struct _AgsHistory
 {
   GObject gobject;
-  
-  GList *task;
+
+  pthread_mutex_t *mutex;
+
+  AgsHistoryEntry **entry;
+
+  guint size;
+  guint offset;
+  guint count;
+  guint position;
+
+  guint64 sequence;
 };
 
 struct _AgsHistoryClass
@@ -48,8 +63,35 @@ struct _AgsHistoryClass
   GObjectClass gobject;
 };
 
+struct _AgsHistoryEntry
+{
+  guint64 sequence;
+
+  AgsTask *undo;
+  AgsTask *redo;
+
+  GList *reference;
+};
+
 GType ags_history_get_type();
 
+AgsHistoryEntry* ags_history_entry_alloc(AgsTask *undo, AgsTask *redo);
+void ags_history_entry_free(AgsHistoryEntry *entry);
+
+void ags_history_entry_add_reference(AgsHistoryEntry *entry,
+				     GObject *reference);
+
+gboolean ags_history_is_recording(AgsHistory *history,
+				  AgsTask *task);
+
+void ags_history_append(AgsHistory *history,
+			AgsHistoryEntry *entry);
+
+AgsTask* ags_history_undo(AgsHistory *history);
+AgsTask* ags_history_redo(AgsHistory *history);
+
+guint64 ags_history_get_sequence(AgsHistory *history);
+
 AgsHistory* ags_history_new();
 
 #endif /*__AGS_HISTORY_H__*/
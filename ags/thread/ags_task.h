@@ -37,6 +37,7 @@ typedef struct _AgsTaskClass AgsTaskClass;
 typedef enum{
   AGS_TASK_LOCKED   = 1,
   AGS_TASK_CYCLIC   = 1 <<  1,
+  AGS_TASK_HISTORY  = 1 <<  2,
 }AgsTaskFlags;
 
 struct _AgsTask
@@ -422,6 +422,18 @@ ags_thread_init(AgsThread *thread)
   thread->computing_time = (struct timespec *) malloc(sizeof(struct timespec));
   thread->computing_time->tv_sec = 0;
   thread->computing_time->tv_nsec = 0;
+
+  /* absolute deadline and its accounting */
+  thread->next_deadline = (struct timespec *) malloc(sizeof(struct timespec));
+  thread->next_deadline->tv_sec = 0;
+  thread->next_deadline->tv_nsec = 0;
+
+  g_atomic_int_set(&(thread->late_wakeup),
+		   0);
+  g_atomic_int_set(&(thread->overrun),
+		   0);
+  g_atomic_int_set(&(thread->max_lateness),
+		   0);
   
   /* thread, mutex and cond */
   thread->thread = (pthread_t *) malloc(sizeof(pthread_t));
@@ -549,6 +561,10 @@ ags_thread_set_property(GObject *gobject,
       thread->delay = (guint) ceil((AGS_THREAD_HERTZ_JIFFIE / thread->freq) / (AGS_THREAD_HERTZ_JIFFIE / AGS_THREAD_MAX_PRECISION));
       thread->tic_delay = 0;
 
+      /* re-anchor the deadline */
+      thread->next_deadline->tv_sec = 0;
+      thread->next_deadline->tv_nsec = 0;
+
       if((AGS_THREAD_INTERMEDIATE_POST_SYNC & (g_atomic_int_get(&(thread->flags)))) != 0){
 	thread->tic_delay = thread->delay;
       }else if((AGS_THREAD_INTERMEDIATE_PRE_SYNC & (g_atomic_int_get(&(thread->flags)))) != 0){
@@ -679,6 +695,7 @@ ags_thread_finalize(GObject *gobject)
   
   /*  */  
   free(thread->computing_time);
+  free(thread->next_deadline);
 
   /*  */
   free(thread->barrier[0]);
@@ -2587,45 +2604,82 @@ ags_thread_real_clock(AgsThread *thread)
     pthread_mutex_unlock(thread->timer_mutex);
   }
 #else
-  if(thread->tic_delay == thread->delay &&
-     (AGS_THREAD_TIMING & (g_atomic_int_get(&(thread->flags)))) != 0){
-    gdouble time_spent, relative_time_spent;
-    gdouble time_cycle;
+  if(thread->tic_delay == thread->delay){
+    gint64 period, lateness;
+    gboolean timing;
 
-    static const gdouble nsec_per_jiffie = NSEC_PER_SEC / AGS_THREAD_HERTZ_JIFFIE;
+    timing = ((AGS_THREAD_TIMING & (g_atomic_int_get(&(thread->flags)))) != 0) ? TRUE: FALSE;
+    period = (gint64) (NSEC_PER_SEC / thread->freq);
     
-    struct timespec timed_sleep = {
-      0,
-      0,
-    };
-
     clock_gettime(CLOCK_MONOTONIC, &time_now);
-      
-    if(time_now.tv_sec == thread->computing_time->tv_sec + 1){
-      time_spent = (time_now.tv_nsec) + (NSEC_PER_SEC - thread->computing_time->tv_nsec);
-    }else if(time_now.tv_sec > thread->computing_time->tv_sec + 1){
-      time_spent = (time_now.tv_sec - thread->computing_time->tv_sec) * NSEC_PER_SEC;
-      time_spent += (time_now.tv_nsec - thread->computing_time->tv_nsec);
-    }else{
-      time_spent = time_now.tv_nsec - thread->computing_time->tv_nsec;
+
+    /* anchor at the first cycle */
+    if(thread->next_deadline->tv_sec == 0 &&
+       thread->next_deadline->tv_nsec == 0){
+      thread->next_deadline->tv_sec = time_now.tv_sec;
+      thread->next_deadline->tv_nsec = time_now.tv_nsec;
     }
 
-    time_cycle = NSEC_PER_SEC / thread->freq;
-      
-    relative_time_spent = time_cycle - time_spent - g_atomic_int_get(&(thread->time_late)) - AGS_THREAD_TOLERANCE;
+    /* advance by one period, so the cadence doesn't drift */
+    thread->next_deadline->tv_nsec += period;
 
-    if(relative_time_spent < 0.0){
+    while(thread->next_deadline->tv_nsec >= NSEC_PER_SEC){
+      thread->next_deadline->tv_sec += 1;
+      thread->next_deadline->tv_nsec -= NSEC_PER_SEC;
+    }
+
+    lateness = (((gint64) time_now.tv_sec - (gint64) thread->next_deadline->tv_sec) * NSEC_PER_SEC +
+		((gint64) time_now.tv_nsec - (gint64) thread->next_deadline->tv_nsec));
+    
+    if(!timing){
+      /* paced by the soundcard, the deadline follows each cycle and the
+       * tolerance absorbs the rounding of the frequency
+       */
+      if(lateness >= period){
+	g_atomic_int_inc(&(thread->overrun));
+      }else if(lateness > AGS_THREAD_DEVICE_WAKEUP_TOLERANCE * period){
+	g_atomic_int_inc(&(thread->late_wakeup));
+      }
+      
+      thread->next_deadline->tv_sec = time_now.tv_sec;
+      thread->next_deadline->tv_nsec = time_now.tv_nsec;
+    }else if(lateness >= 0){
+      /* overrun - the cycle took longer than its period */
+      g_atomic_int_inc(&(thread->overrun));
+      
       g_atomic_int_set(&(thread->time_late),
-		       (guint) ceil(-1.25 * relative_time_spent));
-    }else if(relative_time_spent > 0.0 &&
-	     relative_time_spent < time_cycle){
+		       (guint) ((lateness < G_MAXUINT) ? lateness: G_MAXUINT));
+
+      /* drop missed periods instead of bursting */
+      if(lateness >= period){
+	thread->next_deadline->tv_sec = time_now.tv_sec;
+	thread->next_deadline->tv_nsec = time_now.tv_nsec;
+      }
+    }else{
       g_atomic_int_set(&(thread->time_late),
 		       0);
-      timed_sleep.tv_nsec = (long) relative_time_spent - (1.0 / 45.0) * time_cycle;
-      
-      nanosleep(&timed_sleep, NULL);
+
+      while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME,
+			    thread->next_deadline,
+			    NULL) == EINTR);
+
+      clock_gettime(CLOCK_MONOTONIC, &time_now);
+
+      lateness = (((gint64) time_now.tv_sec - (gint64) thread->next_deadline->tv_sec) * NSEC_PER_SEC +
+		  ((gint64) time_now.tv_nsec - (gint64) thread->next_deadline->tv_nsec));
+
+      if(lateness > AGS_THREAD_WAKEUP_TOLERANCE){
+	g_atomic_int_inc(&(thread->late_wakeup));
+      }
     }
 
+    /* worst-case lateness */
+    if(lateness > 0 &&
+       lateness > g_atomic_int_get(&(thread->max_lateness))){
+      g_atomic_int_set(&(thread->max_lateness),
+		       (guint) ((lateness < G_MAXUINT) ? lateness: G_MAXUINT));
+    }
+    
     clock_gettime(CLOCK_MONOTONIC, thread->computing_time);
   }
 #endif
@@ -2878,6 +2932,10 @@ ags_thread_loop(void *ptr)
       thread->tic_delay = (AGS_THREAD_HERTZ_JIFFIE / thread->freq) / (AGS_THREAD_HERTZ_JIFFIE / AGS_THREAD_MAX_PRECISION);
     clock_gettime(CLOCK_MONOTONIC, thread->computing_time);
   }
+
+  /* re-anchor the deadline of a restarted thread */
+  thread->next_deadline->tv_sec = 0;
+  thread->next_deadline->tv_nsec = 0;
 #endif
   
   while((AGS_THREAD_RUNNING & running) != 0){
@@ -3461,6 +3519,44 @@ ags_thread_stop(AgsThread *thread)
   g_object_unref(G_OBJECT(thread));
 }
 
+/**
+ * ags_thread_get_timing_statistics:
+ * @thread: the #AgsThread
+ * @late_wakeup: return location of the count of wakeups later than %AGS_THREAD_WAKEUP_TOLERANCE
+ * @overrun: return location of the count of cycles exceeding their period
+ * @max_lateness: return location of the worst lateness in nanoseconds
+ *
+ * Get the deadline accounting of @thread. It is collected for every thread,
+ * only threads with %AGS_THREAD_TIMING set sleep until their deadline.
+ * The others are paced by the soundcard, so their lateness is measured
+ * from the previous cycle and a wakeup is late past
+ * %AGS_THREAD_DEVICE_WAKEUP_TOLERANCE of the period. Any location may be
+ * %NULL.
+ *
+ * Since: 0.7.136
+ */
+void
+ags_thread_get_timing_statistics(AgsThread *thread,
+				 guint *late_wakeup, guint *overrun,
+				 guint *max_lateness)
+{
+  if(thread == NULL){
+    return;
+  }
+
+  if(late_wakeup != NULL){
+    *late_wakeup = g_atomic_int_get(&(thread->late_wakeup));
+  }
+
+  if(overrun != NULL){
+    *overrun = g_atomic_int_get(&(thread->overrun));
+  }
+
+  if(max_lateness != NULL){
+    *max_lateness = g_atomic_int_get(&(thread->max_lateness));
+  }
+}
+
 /**
  * ags_thread_interrupted:
  * @thread: the #AgsThread
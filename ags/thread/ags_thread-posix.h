@@ -53,6 +53,8 @@
 #define AGS_THREAD_DEFAULT_ATTACK (1.0)
 
 #define AGS_THREAD_TOLERANCE (0.0)
+#define AGS_THREAD_WAKEUP_TOLERANCE (100000)
+#define AGS_THREAD_DEVICE_WAKEUP_TOLERANCE (0.125)
 
 typedef struct _AgsThread AgsThread;
 typedef struct _AgsThreadClass AgsThreadClass;
@@ -133,6 +135,11 @@ struct _AgsThread
   guint cycle_iteration;
   volatile guint time_late;
   struct timespec *computing_time;
+
+  struct timespec *next_deadline;
+  volatile guint late_wakeup;
+  volatile guint overrun;
+  volatile guint max_lateness;
   
   pthread_t *thread;
   pthread_attr_t *thread_attr;
@@ -270,6 +277,10 @@ void ags_thread_resume(AgsThread *thread);
 void ags_thread_timelock(AgsThread *thread);
 void ags_thread_stop(AgsThread *thread);
 
+void ags_thread_get_timing_statistics(AgsThread *thread,
+				      guint *late_wakeup, guint *overrun,
+				      guint *max_lateness);
+
 guint ags_thread_interrupted(AgsThread *thread,
 			     int sig,
 			     guint time_cycle, guint *time_spent);
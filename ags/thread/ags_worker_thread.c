@@ -166,6 +166,9 @@ ags_worker_thread_init(AgsWorkerThread *worker_thread)
 
   /* worker thread */
   worker_thread->worker_thread = (pthread_t *) malloc(sizeof(pthread_t));  
+
+  worker_thread->worker_thread_attr = (pthread_attr_t *) malloc(sizeof(pthread_attr_t));
+  pthread_attr_init(worker_thread->worker_thread_attr);
 }
 
 void